@@ -11,12 +11,12 @@
  * This file contains optimised vector functions for ARM Thumb or ARM Thumb2.
  */
 
-#include <zsl/zsl.h>
-#include <zsl/asm/arm/asm_arm.h>
-
 #ifndef ZEPHYR_INCLUDE_ZSL_ASM_ARM_VECTORS_H_
 #define ZEPHYR_INCLUDE_ZSL_ASM_ARM_VECTORS_H_
 
+#include <zsl/zsl.h>
+#include <zsl/asm/arm/asm_arm.h>
+
 #if !asm_vec_add
 #if CONFIG_ZSL_PLATFORM_OPT == 2
 int zsl_vec_add(struct zsl_vec *v, struct zsl_vec *w, struct zsl_vec *x)
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026 Kevin Townsend
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Optimised kernels for zscilib on x86 using SSE2, AVX2 and FMA.
+ *
+ * This file declares the array kernels used by the vector and matrix
+ * functions when CONFIG_ZSL_PLATFORM_OPT is set to 3. SSE2 is part of the
+ * x86-64 baseline and is always available. The AVX2/FMA variants are
+ * selected at runtime with CPUID, so the same binary runs on any x86-64
+ * processor.
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZSL_ASM_X86_H_
+#define ZEPHYR_INCLUDE_ZSL_ASM_X86_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <zsl/zsl.h>
+
+#if !defined(__SSE2__)
+#error "CONFIG_ZSL_PLATFORM_OPT=3 requires an x86 target with SSE2"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Checks if the AVX2/FMA kernels are in use. The first call queries
+ *        the processor with CPUID, and the result is cached.
+ *
+ * @return true if the AVX2/FMA kernels are used, false for the SSE2 ones.
+ */
+bool zsl_asm_x86_has_avx2(void);
+
+/**
+ * @brief Computes c[i] = a[i] + b[i] for 'n' elements. 'c' may be 'a' or 'b'.
+ */
+void zsl_asm_x86_add(const zsl_real_t *a, const zsl_real_t *b, zsl_real_t *c,
+		     size_t n);
+
+/**
+ * @brief Computes c[i] = a[i] - b[i] for 'n' elements. 'c' may be 'a' or 'b'.
+ */
+void zsl_asm_x86_sub(const zsl_real_t *a, const zsl_real_t *b, zsl_real_t *c,
+		     size_t n);
+
+/**
+ * @brief Computes c[i] = a[i] * b[i] for 'n' elements. 'c' may be 'a' or 'b'.
+ */
+void zsl_asm_x86_mul(const zsl_real_t *a, const zsl_real_t *b, zsl_real_t *c,
+		     size_t n);
+
+/**
+ * @brief Computes a[i] *= s for 'n' elements.
+ */
+void zsl_asm_x86_scale(zsl_real_t *a, zsl_real_t s, size_t n);
+
+/**
+ * @brief Returns the dot product of the first 'n' elements of 'a' and 'b'.
+ */
+zsl_real_t zsl_asm_x86_dot(const zsl_real_t *a, const zsl_real_t *b,
+			   size_t n);
+
+/**
+ * @brief Matrix multiplication micro-kernel. Computes a 4x4 tile of 'c'
+ *        (row stride 'ldc') from four rows of 'a' (row stride 'lda') and
+ *        'kc' rows of a packed, four-column panel 'bp'. When 'acc' is true,
+ *        the result is added to 'c', otherwise 'c' is overwritten.
+ */
+void zsl_asm_x86_mult_kernel(size_t kc, const zsl_real_t *a, size_t lda,
+			     const zsl_real_t *bp, zsl_real_t *c, size_t ldc,
+			     bool acc);
+
+/** Kernels used by the generic matrix code in matrices.c. */
+#define asm_mtx_add zsl_asm_x86_add
+#define asm_mtx_sub zsl_asm_x86_sub
+#define asm_mtx_mul zsl_asm_x86_mul
+#define asm_mtx_scale zsl_asm_x86_scale
+#define asm_mtx_mult_kernel zsl_asm_x86_mult_kernel
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZSL_ASM_X86_H_ */
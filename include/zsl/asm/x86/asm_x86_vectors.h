@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Kevin Townsend
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Optimised vector functions for zscilib on x86 (SSE2/AVX2).
+ *
+ * This file contains optimised vector functions for x86, built on the
+ * kernels in asm_x86.h.
+ */
+
+#include <zsl/zsl.h>
+#include <zsl/vectors.h>
+#include <zsl/asm/x86/asm_x86.h>
+
+#ifndef ZEPHYR_INCLUDE_ZSL_ASM_X86_VECTORS_H_
+#define ZEPHYR_INCLUDE_ZSL_ASM_X86_VECTORS_H_
+
+#if !asm_vec_add
+int zsl_vec_add(struct zsl_vec *v, struct zsl_vec *w, struct zsl_vec *x)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure v and w are equal length. */
+	if ((v->sz != w->sz) || (v->sz != x->sz)) {
+		return -EINVAL;
+	}
+#endif
+
+	zsl_asm_x86_add(v->data, w->data, x->data, v->sz);
+
+	return 0;
+}
+#define asm_vec_add 1
+#endif
+
+#if !asm_vec_scalar_mult
+int zsl_vec_scalar_mult(struct zsl_vec *v, zsl_real_t s)
+{
+	zsl_asm_x86_scale(v->data, s, v->sz);
+
+	return 0;
+}
+#define asm_vec_scalar_mult 1
+#endif
+
+#if !asm_vec_dot
+int zsl_vec_dot(struct zsl_vec *v, struct zsl_vec *w, zsl_real_t *d)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure v and w are equal length. */
+	if (v->sz != w->sz) {
+		return -EINVAL;
+	}
+#endif
+
+	*d = zsl_asm_x86_dot(v->data, w->data, v->sz);
+
+	return 0;
+}
+#define asm_vec_dot 1
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZSL_ASM_X86_VECTORS_H_ */
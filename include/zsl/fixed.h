@@ -0,0 +1,481 @@
+/*
+ * Copyright (c) 2026 Kevin Townsend
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @defgroup FIXED Fixed-Point
+ *
+ * @brief Q31 and Q15 fixed-point vectors, matrices and quaternions.
+ *
+ * These types mirror @ref zsl_vec, @ref zsl_mtx and @ref zsl_quat for cores
+ * without an FPU, where every zsl_real_t operation is a soft-float library
+ * call. Q31 values are signed 32-bit integers scaled by 2^31, and Q15 values
+ * are signed 16-bit integers scaled by 2^15, so both represent the range
+ * [-1.0, 1.0). All arithmetic saturates instead of wrapping, and products
+ * are rounded to nearest. Dot products and matrix products accumulate in 64
+ * bits with guard bits, and are rounded and saturated once at the end.
+ */
+
+/**
+ * @file
+ * @brief API header file for fixed-point types in zscilib.
+ *
+ * This file contains the zscilib Q31 and Q15 APIs
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZSL_FIXED_H_
+#define ZEPHYR_INCLUDE_ZSL_FIXED_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <zsl/zsl.h>
+#include <zsl/vectors.h>
+#include <zsl/matrices.h>
+#include <zsl/orientation/quaternions.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup FIXED_STRUCTS Structs, Enums and Macros
+ *
+ * @brief Fixed-point types and scalar helpers.
+ *
+ * @ingroup FIXED
+ *  @{ */
+
+/** @brief Q31 fixed-point value: 1 sign bit, 31 fractional bits. */
+typedef int32_t zsl_q31_t;
+
+/** @brief Q15 fixed-point value: 1 sign bit, 15 fractional bits. */
+typedef int16_t zsl_q15_t;
+
+/** @brief Largest Q31 value, just below 1.0. */
+#define ZSL_Q31_MAX INT32_MAX
+/** @brief Smallest Q31 value, -1.0. */
+#define ZSL_Q31_MIN INT32_MIN
+/** @brief Largest Q15 value, just below 1.0. */
+#define ZSL_Q15_MAX INT16_MAX
+/** @brief Smallest Q15 value, -1.0. */
+#define ZSL_Q15_MIN INT16_MIN
+
+/** @brief Represents a vector of Q31 values. */
+struct zsl_vec_q31 {
+	/** The number of elements in the vector. */
+	size_t sz;
+	/** The Q31 data assigned to the vector. */
+	zsl_q31_t *data;
+};
+
+/** @brief Represents a vector of Q15 values. */
+struct zsl_vec_q15 {
+	/** The number of elements in the vector. */
+	size_t sz;
+	/** The Q15 data assigned to the vector. */
+	zsl_q15_t *data;
+};
+
+/** @brief Represents a row-major matrix of Q31 values. */
+struct zsl_mtx_q31 {
+	/** The number of rows in the matrix (typically denoted as 'm'). */
+	size_t sz_rows;
+	/** The number of columns in the matrix (typically denoted as 'n'). */
+	size_t sz_cols;
+	/** Data assigned to the matrix, in row-major order. */
+	zsl_q31_t *data;
+};
+
+/** @brief Represents a row-major matrix of Q15 values. */
+struct zsl_mtx_q15 {
+	/** The number of rows in the matrix (typically denoted as 'm'). */
+	size_t sz_rows;
+	/** The number of columns in the matrix (typically denoted as 'n'). */
+	size_t sz_cols;
+	/** Data assigned to the matrix, in row-major order. */
+	zsl_q15_t *data;
+};
+
+/** @brief Represents a quaternion with Q31 components. */
+struct zsl_quat_q31 {
+	zsl_q31_t r;    /**< @brief The real component. */
+	zsl_q31_t i;    /**< @brief The first imaginary component. */
+	zsl_q31_t j;    /**< @brief The second imaginary component */
+	zsl_q31_t k;    /**< @brief The third imaginary component. */
+};
+
+/** Macro to declare a Q31 vector of size `n`, zero-filled. */
+#define ZSL_VECTOR_Q31_DEF(name, n)			 \
+	zsl_q31_t name ## _vec[n] = { 0 };		 \
+	struct zsl_vec_q31 name = {			 \
+		.sz = n,				 \
+		.data = name ## _vec			 \
+	}
+
+/** Macro to declare a Q15 vector of size `n`, zero-filled. */
+#define ZSL_VECTOR_Q15_DEF(name, n)			 \
+	zsl_q15_t name ## _vec[n] = { 0 };		 \
+	struct zsl_vec_q15 name = {			 \
+		.sz = n,				 \
+		.data = name ## _vec			 \
+	}
+
+/** Macro to declare a Q31 matrix with `m` rows and `n` columns. */
+#define ZSL_MATRIX_Q31_DEF(name, m, n)			 \
+	zsl_q31_t name ## _mtx[(m) * (n)];		 \
+	struct zsl_mtx_q31 name = {			 \
+		.sz_rows = m,				 \
+		.sz_cols = n,				 \
+		.data = name ## _mtx			 \
+	}
+
+/** Macro to declare a Q15 matrix with `m` rows and `n` columns. */
+#define ZSL_MATRIX_Q15_DEF(name, m, n)			 \
+	zsl_q15_t name ## _mtx[(m) * (n)];		 \
+	struct zsl_mtx_q15 name = {			 \
+		.sz_rows = m,				 \
+		.sz_cols = n,				 \
+		.data = name ## _mtx			 \
+	}
+
+/** @brief Saturates a 64-bit intermediate value to the Q31 range. */
+static inline zsl_q31_t zsl_q31_sat(int64_t x)
+{
+	if (x > ZSL_Q31_MAX) {
+		return ZSL_Q31_MAX;
+	}
+	if (x < ZSL_Q31_MIN) {
+		return ZSL_Q31_MIN;
+	}
+	return (zsl_q31_t)x;
+}
+
+/** @brief Saturates a 32-bit intermediate value to the Q15 range. */
+static inline zsl_q15_t zsl_q15_sat(int32_t x)
+{
+	if (x > ZSL_Q15_MAX) {
+		return ZSL_Q15_MAX;
+	}
+	if (x < ZSL_Q15_MIN) {
+		return ZSL_Q15_MIN;
+	}
+	return (zsl_q15_t)x;
+}
+
+/** @brief Saturating Q31 addition. */
+static inline zsl_q31_t zsl_q31_add(zsl_q31_t a, zsl_q31_t b)
+{
+	return zsl_q31_sat((int64_t)a + b);
+}
+
+/** @brief Saturating Q31 subtraction. */
+static inline zsl_q31_t zsl_q31_sub(zsl_q31_t a, zsl_q31_t b)
+{
+	return zsl_q31_sat((int64_t)a - b);
+}
+
+/** @brief Rounded, saturating Q31 multiplication. */
+static inline zsl_q31_t zsl_q31_mult(zsl_q31_t a, zsl_q31_t b)
+{
+	return zsl_q31_sat((((int64_t)a * b) + (1LL << 30)) >> 31);
+}
+
+/** @brief Saturating Q15 addition. */
+static inline zsl_q15_t zsl_q15_add(zsl_q15_t a, zsl_q15_t b)
+{
+	return zsl_q15_sat((int32_t)a + b);
+}
+
+/** @brief Saturating Q15 subtraction. */
+static inline zsl_q15_t zsl_q15_sub(zsl_q15_t a, zsl_q15_t b)
+{
+	return zsl_q15_sat((int32_t)a - b);
+}
+
+/** @brief Rounded, saturating Q15 multiplication. */
+static inline zsl_q15_t zsl_q15_mult(zsl_q15_t a, zsl_q15_t b)
+{
+	return zsl_q15_sat((((int32_t)a * b) + (1 << 14)) >> 15);
+}
+
+/** @brief Converts a real value to Q31, rounding and saturating. */
+static inline zsl_q31_t zsl_q31_from_real(zsl_real_t x)
+{
+	zsl_real_t s = x * 2147483648.0;
+
+	if (s >= 2147483647.0) {
+		return ZSL_Q31_MAX;
+	}
+	if (s <= -2147483648.0) {
+		return ZSL_Q31_MIN;
+	}
+	return (zsl_q31_t)(s >= 0.0 ? s + 0.5 : s - 0.5);
+}
+
+/** @brief Converts a Q31 value to a real value. */
+static inline zsl_real_t zsl_q31_to_real(zsl_q31_t x)
+{
+	return (zsl_real_t)x / 2147483648.0;
+}
+
+/** @brief Converts a real value to Q15, rounding and saturating. */
+static inline zsl_q15_t zsl_q15_from_real(zsl_real_t x)
+{
+	zsl_real_t s = x * 32768.0;
+
+	if (s >= 32767.0) {
+		return ZSL_Q15_MAX;
+	}
+	if (s <= -32768.0) {
+		return ZSL_Q15_MIN;
+	}
+	return (zsl_q15_t)(s >= 0.0 ? s + 0.5 : s - 0.5);
+}
+
+/** @brief Converts a Q15 value to a real value. */
+static inline zsl_real_t zsl_q15_to_real(zsl_q15_t x)
+{
+	return (zsl_real_t)x / 32768.0;
+}
+
+/** @} */ /* End of FIXED_STRUCTS group */
+
+/**
+ * @addtogroup FIXED_VECTORS Vectors
+ *
+ * @brief Q31 and Q15 vector functions.
+ *
+ * @ingroup FIXED
+ *  @{ */
+
+/**
+ * @brief Converts a real vector to Q31. Values outside [-1.0, 1.0) saturate.
+ *
+ * @param v     The real input vector.
+ * @param q     The Q31 output vector, of the same size as 'v'.
+ *
+ * @return 0 on success, -EINVAL if the vectors have different sizes.
+ */
+int zsl_vec_q31_from_real(struct zsl_vec *v, struct zsl_vec_q31 *q);
+
+/**
+ * @brief Converts a Q31 vector to a real vector.
+ *
+ * @param q     The Q31 input vector.
+ * @param v     The real output vector, of the same size as 'q'.
+ *
+ * @return 0 on success, -EINVAL if the vectors have different sizes.
+ */
+int zsl_vec_q31_to_real(struct zsl_vec_q31 *q, struct zsl_vec *v);
+
+/**
+ * @brief Saturating element-wise sum, x = v + w. 'x' may be 'v' or 'w'.
+ *
+ * @return 0 on success, -EINVAL if the vectors have different sizes.
+ */
+int zsl_vec_q31_add(struct zsl_vec_q31 *v, struct zsl_vec_q31 *w,
+		    struct zsl_vec_q31 *x);
+
+/**
+ * @brief Saturating element-wise difference, x = v - w. 'x' may be 'v' or
+ *        'w'.
+ *
+ * @return 0 on success, -EINVAL if the vectors have different sizes.
+ */
+int zsl_vec_q31_sub(struct zsl_vec_q31 *v, struct zsl_vec_q31 *w,
+		    struct zsl_vec_q31 *x);
+
+/**
+ * @brief Multiplies every element of 'v' by 's', in place.
+ *
+ * @return 0 on success.
+ */
+int zsl_vec_q31_scalar_mult(struct zsl_vec_q31 *v, zsl_q31_t s);
+
+/**
+ * @brief Computes the dot product of 'v' and 'w'. The products accumulate
+ *        in 64 bits with 15 guard bits, and only the final result is rounded
+ *        and saturated.
+ *
+ * @param v     The first vector.
+ * @param w     The second vector.
+ * @param d     The dot product, in Q31.
+ *
+ * @return 0 on success, -EINVAL if the vectors have different sizes.
+ */
+int zsl_vec_q31_dot(struct zsl_vec_q31 *v, struct zsl_vec_q31 *w,
+		    zsl_q31_t *d);
+
+/** @brief Q15 version of @ref zsl_vec_q31_from_real. */
+int zsl_vec_q15_from_real(struct zsl_vec *v, struct zsl_vec_q15 *q);
+
+/** @brief Q15 version of @ref zsl_vec_q31_to_real. */
+int zsl_vec_q15_to_real(struct zsl_vec_q15 *q, struct zsl_vec *v);
+
+/** @brief Q15 version of @ref zsl_vec_q31_add. */
+int zsl_vec_q15_add(struct zsl_vec_q15 *v, struct zsl_vec_q15 *w,
+		    struct zsl_vec_q15 *x);
+
+/** @brief Q15 version of @ref zsl_vec_q31_sub. */
+int zsl_vec_q15_sub(struct zsl_vec_q15 *v, struct zsl_vec_q15 *w,
+		    struct zsl_vec_q15 *x);
+
+/** @brief Q15 version of @ref zsl_vec_q31_scalar_mult. */
+int zsl_vec_q15_scalar_mult(struct zsl_vec_q15 *v, zsl_q15_t s);
+
+/** @brief Q15 version of @ref zsl_vec_q31_dot. */
+int zsl_vec_q15_dot(struct zsl_vec_q15 *v, struct zsl_vec_q15 *w,
+		    zsl_q15_t *d);
+
+/** @} */ /* End of FIXED_VECTORS group */
+
+/**
+ * @addtogroup FIXED_MATRICES Matrices
+ *
+ * @brief Q31 and Q15 matrix functions.
+ *
+ * @ingroup FIXED
+ *  @{ */
+
+/**
+ * @brief Converts a real matrix to Q31. Values outside [-1.0, 1.0) saturate.
+ *
+ * @param m     The real input matrix.
+ * @param q     The Q31 output matrix, of the same shape as 'm'.
+ *
+ * @return 0 on success, -EINVAL if the shapes differ.
+ */
+int zsl_mtx_q31_from_real(struct zsl_mtx *m, struct zsl_mtx_q31 *q);
+
+/**
+ * @brief Converts a Q31 matrix to a real matrix.
+ *
+ * @param q     The Q31 input matrix.
+ * @param m     The real output matrix, of the same shape as 'q'.
+ *
+ * @return 0 on success, -EINVAL if the shapes differ.
+ */
+int zsl_mtx_q31_to_real(struct zsl_mtx_q31 *q, struct zsl_mtx *m);
+
+/**
+ * @brief Saturating element-wise sum, mc = ma + mb. 'mc' may be 'ma' or
+ *        'mb'.
+ *
+ * @return 0 on success, -EINVAL if the shapes differ.
+ */
+int zsl_mtx_q31_add(struct zsl_mtx_q31 *ma, struct zsl_mtx_q31 *mb,
+		    struct zsl_mtx_q31 *mc);
+
+/**
+ * @brief Matrix product, mc = ma * mb. Each output element accumulates in
+ *        64 bits and is rounded and saturated once.
+ *
+ * @param ma    The first input matrix, m x k.
+ * @param mb    The second input matrix, k x n.
+ * @param mc    The output matrix, m x n. Must not share memory with 'ma'
+ *              or 'mb'.
+ *
+ * @return 0 on success, -EINVAL if the shapes don't match.
+ */
+int zsl_mtx_q31_mult(struct zsl_mtx_q31 *ma, struct zsl_mtx_q31 *mb,
+		     struct zsl_mtx_q31 *mc);
+
+/** @brief Q15 version of @ref zsl_mtx_q31_from_real. */
+int zsl_mtx_q15_from_real(struct zsl_mtx *m, struct zsl_mtx_q15 *q);
+
+/** @brief Q15 version of @ref zsl_mtx_q31_to_real. */
+int zsl_mtx_q15_to_real(struct zsl_mtx_q15 *q, struct zsl_mtx *m);
+
+/** @brief Q15 version of @ref zsl_mtx_q31_add. */
+int zsl_mtx_q15_add(struct zsl_mtx_q15 *ma, struct zsl_mtx_q15 *mb,
+		    struct zsl_mtx_q15 *mc);
+
+/** @brief Q15 version of @ref zsl_mtx_q31_mult. */
+int zsl_mtx_q15_mult(struct zsl_mtx_q15 *ma, struct zsl_mtx_q15 *mb,
+		     struct zsl_mtx_q15 *mc);
+
+/** @} */ /* End of FIXED_MATRICES group */
+
+/**
+ * @addtogroup FIXED_QUATERNIONS Quaternions
+ *
+ * @brief Q31 quaternion functions for orientation tracking.
+ *
+ * @ingroup FIXED
+ *  @{ */
+
+/**
+ * @brief Converts a real quaternion to Q31. Components outside [-1.0, 1.0)
+ *        saturate, so 'q' should be a unit quaternion.
+ */
+int zsl_quat_q31_from_real(struct zsl_quat *q, struct zsl_quat_q31 *qq);
+
+/**
+ * @brief Converts a Q31 quaternion to a real quaternion.
+ */
+int zsl_quat_q31_to_real(struct zsl_quat_q31 *qq, struct zsl_quat *q);
+
+/**
+ * @brief Multiplies two unit quaternions, qm = qa * qb. 'qm' may be 'qa' or
+ *        'qb'.
+ *
+ * @return 0 on success.
+ */
+int zsl_quat_q31_mult(struct zsl_quat_q31 *qa, struct zsl_quat_q31 *qb,
+		      struct zsl_quat_q31 *qm);
+
+/**
+ * @brief Normalises a quaternion to unit length, in place. The input may
+ *        have any magnitude up to 2.0 (for example, the sum of two unit
+ *        quaternions), which is the case after an integration or blending
+ *        step.
+ *
+ * @return 0 on success, -EINVAL if 'q' is zero.
+ */
+int zsl_quat_q31_to_unit_d(struct zsl_quat_q31 *q);
+
+/**
+ * @brief Linear interpolation between two unit quaternions, followed by
+ *        normalisation. Q31 version of @ref zsl_quat_lerp.
+ *
+ * @param qa    The first unit quaternion.
+ * @param qb    The second unit quaternion.
+ * @param t     The interpolation weight of 'qb', in [0.0, 1.0).
+ * @param qi    The interpolated unit quaternion. May be 'qa' or 'qb'.
+ *
+ * @return 0 on success, -EINVAL if 't' is negative.
+ */
+int zsl_quat_q31_lerp(struct zsl_quat_q31 *qa, struct zsl_quat_q31 *qb,
+		      zsl_q31_t t, struct zsl_quat_q31 *qi);
+
+/**
+ * @brief Integrates an angular velocity over one sample period. Q31
+ *        version of @ref zsl_quat_from_ang_vel.
+ *
+ * Since Q31 values can't exceed 1.0, the angular velocity is passed already
+ * multiplied by the sample period: 'wt' holds w * t, in radians. This keeps
+ * the full Q31 resolution for the small per-sample rotation, and allows up to
+ * 1 rad of rotation per sample.
+ *
+ * @param wt    The angular velocity (rad/s) times the sample period (s),
+ *              as a 3-vector.
+ * @param qin   The unit quaternion at the start of the period.
+ * @param qout  The unit quaternion at the end of the period. May be 'qin'.
+ *
+ * @return 0 on success, -EINVAL if 'wt' isn't a 3-vector.
+ */
+int zsl_quat_q31_from_ang_vel(struct zsl_vec_q31 *wt,
+			      struct zsl_quat_q31 *qin,
+			      struct zsl_quat_q31 *qout);
+
+/** @} */ /* End of FIXED_QUATERNIONS group */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZSL_FIXED_H_ */
+
+/** @} */ /* End of FIXED group */
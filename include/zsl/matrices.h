@@ -41,6 +41,10 @@ extern "C" {
 #define EEIGENSIZE   (100)
 /** Error: Occurs when the input matrix has complex eigenvalues. */
 #define ECOMPLEXVAL  (101)
+/** Error: The input matrix is singular. */
+#define ESINGULAR    (102)
+/** Error: An iterative algorithm failed to converge. */
+#define ECONVERGE    (103)
 
 /** @brief Represents a m x n matrix, with data stored in row-major order. */
 struct zsl_mtx {
@@ -66,6 +70,183 @@ struct zsl_mtx {
 		.data = name ## _mtx	\
 	}
 
+/**
+ * @brief A strided reference to a block of another matrix's data.
+ *
+ * A view does not own its data. Element (i, j) of the view is stored at
+ * 'data[(i * row_stride) + (j * col_stride)]', which lets a single struct
+ * describe a submatrix, a row, a column, the diagonal or the transpose of a
+ * matrix without copying any values. Views are created from a matrix with
+ * 'zsl_mtx_view_init', and can then be narrowed further with the other
+ * 'zsl_mtx_view_*' constructors.
+ */
+struct zsl_mtx_view {
+	/** The number of rows in the view. */
+	size_t sz_rows;
+	/** The number of columns in the view. */
+	size_t sz_cols;
+	/** Distance in elements between (i, j) and (i + 1, j). */
+	size_t row_stride;
+	/** Distance in elements between (i, j) and (i, j + 1). */
+	size_t col_stride;
+	/** Location of element (0, 0) of the view. */
+	zsl_real_t *data;
+};
+
+/**
+ * @brief A batch of 'sz_batch' matrices of the same m x n shape.
+ *
+ * The matrices are interleaved rather than stored one after the other:
+ * element (i, j) of matrix 'k' is found at
+ * 'data[(((i * sz_cols) + j) * sz_batch) + k]'. Every element position thus
+ * forms a contiguous run across the whole batch, which lets the batched
+ * functions process many small matrices at once with unit-stride loops that
+ * the compiler can vectorise.
+ */
+struct zsl_mtx_batch {
+	/** The number of rows in each matrix. */
+	size_t sz_rows;
+	/** The number of columns in each matrix. */
+	size_t sz_cols;
+	/** The number of matrices in the batch. */
+	size_t sz_batch;
+	/** Interleaved data for the whole batch. */
+	zsl_real_t *data;
+};
+
+/**
+ * Macro to declare a batch of 'b' matrices of shape m*n.
+ *
+ * As with 'ZSL_MATRIX_DEF', the contents are not initialised.
+ */
+#define ZSL_MATRIX_BATCH_DEF(name, m, n, b)		\
+	zsl_real_t name ## _mtxb[(m) * (n) * (b)];	\
+	struct zsl_mtx_batch name = {			\
+		.sz_rows = m,				\
+		.sz_cols = n,				\
+		.sz_batch = b,				\
+		.data = name ## _mtxb			\
+	}
+
+/**
+ * @brief A banded matrix, storing only the 'kl' diagonals below the main
+ *        diagonal, the main diagonal, and the 'ku' diagonals above it.
+ *
+ * Each row holds 'kl + ku + 1' values, so element (i, j), with
+ * i - kl <= j <= i + ku, is found at
+ * 'data[(i * (kl + ku + 1)) + j - i + kl]'. The slots of the first and last
+ * rows that fall outside the matrix are never read. Memory use is thus
+ * proportional to the number of rows rather than to rows * columns, and a
+ * tridiagonal matrix, with 'kl' and 'ku' both set to one, only needs three
+ * values per row.
+ */
+struct zsl_mtx_band {
+	/** The number of rows in the matrix (typically denoted as 'm'). */
+	size_t sz_rows;
+	/** The number of columns in the matrix (typically denoted as 'n'). */
+	size_t sz_cols;
+	/** The number of diagonals stored below the main diagonal. */
+	size_t kl;
+	/** The number of diagonals stored above the main diagonal. */
+	size_t ku;
+	/** Data assigned to the matrix, one row of the band at a time. */
+	zsl_real_t *data;
+};
+
+/**
+ * Macro to declare an m*n banded matrix with 'kl' subdiagonals and 'ku'
+ * superdiagonals.
+ *
+ * Be sure to also fill the matrix with 'zsl_mtx_band_from_mtx', or to set
+ * every element in the band, after this macro, since matrices declared on
+ * the stack may have non-zero values by default!
+ */
+#define ZSL_MATRIX_BAND_DEF(name, m, n, l, u)			\
+	zsl_real_t name ## _mtxbd[(m) * ((l) + (u) + 1)];	\
+	struct zsl_mtx_band name = {				\
+		.sz_rows = m,					\
+		.sz_cols = n,					\
+		.kl = l,					\
+		.ku = u,					\
+		.data = name ## _mtxbd				\
+	}
+
+/** @brief Which part of a packed matrix is stored, and how it is read. */
+enum zsl_mtx_packed_type {
+	/** Lower triangular: the strict upper triangle is zero. */
+	ZSL_MTX_PACKED_LOWER,
+	/** Upper triangular: the strict lower triangle is zero. */
+	ZSL_MTX_PACKED_UPPER,
+	/** Symmetric: the lower triangle is stored, and mirrored above. */
+	ZSL_MTX_PACKED_SYM,
+};
+
+/**
+ * @brief A square symmetric or triangular matrix, storing only one triangle
+ *        as n * (n + 1) / 2 values.
+ *
+ * The triangle is packed row by row. For lower triangular and symmetric
+ * matrices, element (i, j) with j <= i is found at
+ * 'data[((i * (i + 1)) / 2) + j]'. For upper triangular matrices, element
+ * (i, j) with j >= i is found at 'data[((i * ((2 * n) - i + 1)) / 2) + j - i]'.
+ */
+struct zsl_mtx_packed {
+	/** The number of rows and columns in the matrix. */
+	size_t sz;
+	/** The part of the matrix being stored. */
+	enum zsl_mtx_packed_type type;
+	/** The packed triangle, one row at a time. */
+	zsl_real_t *data;
+};
+
+/**
+ * Macro to declare an nxn packed matrix of type 't'.
+ *
+ * As with 'ZSL_MATRIX_DEF', the contents are not initialised.
+ */
+#define ZSL_MATRIX_PACKED_DEF(name, n, t)			\
+	zsl_real_t name ## _mtxp[((n) * ((n) + 1)) / 2];	\
+	struct zsl_mtx_packed name = {				\
+		.sz = n,					\
+		.type = t,					\
+		.data = name ## _mtxp				\
+	}
+
+/**
+ * @brief Bump allocator used to hand out the temporary matrices and vectors
+ *        required by the decomposition functions.
+ *
+ * A workspace is created once over a caller-supplied buffer, typically a
+ * static array, and temporaries are then carved out of it in a strictly
+ * last-in, first-out manner. Functions taking a workspace release everything
+ * they allocated before returning, so the same workspace can be reused for
+ * successive calls. The '_ws_size' helpers report the exact number of bytes
+ * a given call requires.
+ */
+struct zsl_workspace {
+	/** Start of the buffer, aligned to the size of zsl_real_t. */
+	zsl_real_t *data;
+	/** Capacity of the buffer, in zsl_real_t elements. */
+	size_t sz;
+	/** Number of zsl_real_t elements currently allocated. */
+	size_t used;
+};
+
+/**
+ * Macro to declare a workspace backed by an array of at least 'bytes' bytes.
+ *
+ * The returned workspace is empty and ready to use, there is no need to call
+ * 'zsl_ws_init' on it.
+ */
+#define ZSL_WORKSPACE_DEF(name, bytes)					 \
+	zsl_real_t name ## _ws[((bytes) + sizeof(zsl_real_t) - 1) /	 \
+			       sizeof(zsl_real_t)];			 \
+	struct zsl_workspace name = {					 \
+		.data = name ## _ws,					 \
+		.sz = sizeof(name ## _ws) / sizeof(zsl_real_t),		 \
+		.used = 0						 \
+	}
+
 /** @} */ /* End of MTX_STRUCTS group */
 
 /**
@@ -245,6 +426,78 @@ int zsl_mtx_copy(struct zsl_mtx *mdest, struct zsl_mtx *msrc);
 
 /** @} */ /* End of MTX_INIT group */
 
+/**
+ * @addtogroup MTX_WORKSPACE Workspace
+ *
+ * @brief Functions used to manage the memory of a zsl_workspace.
+ *
+ * @ingroup MATRICES
+ *  @{ */
+
+/**
+ * @brief Initialises workspace 'ws' over the memory pointed to by 'buf'.
+ *
+ * If 'buf' is not aligned to the size of zsl_real_t, the first few bytes
+ * are skipped and the capacity is reduced accordingly.
+ *
+ * @param ws    Pointer to the zsl_workspace to initialise.
+ * @param buf   Pointer to the memory to hand out.
+ * @param bytes The size of 'buf' in bytes.
+ *
+ * @return 0 on success, or -EINVAL if 'buf' is NULL or too small.
+ */
+int zsl_ws_init(struct zsl_workspace *ws, void *buf, size_t bytes);
+
+/**
+ * @brief Releases every allocation made from workspace 'ws'.
+ *
+ * @param ws    Pointer to the zsl_workspace to reset.
+ *
+ * @return 0 on success, and non-zero error code on failure
+ */
+int zsl_ws_reset(struct zsl_workspace *ws);
+
+/**
+ * @brief Returns the number of unallocated bytes in workspace 'ws'.
+ *
+ * @param ws    Pointer to the zsl_workspace to use.
+ *
+ * @return The number of bytes still available in 'ws'.
+ */
+size_t zsl_ws_avail(struct zsl_workspace *ws);
+
+/**
+ * @brief Allocates a matrix of shape rows*cols from workspace 'ws'.
+ *
+ * The contents of the matrix are undefined, so be sure to call
+ * 'zsl_mtx_init' on it if required.
+ *
+ * @param ws    Pointer to the zsl_workspace to allocate from.
+ * @param m     Pointer to the zsl_mtx to assign the allocated memory to.
+ * @param rows  The number of rows in 'm'.
+ * @param cols  The number of columns in 'm'.
+ *
+ * @return 0 on success, or -ENOMEM if 'ws' doesn't have enough room left.
+ */
+int zsl_ws_mtx(struct zsl_workspace *ws, struct zsl_mtx *m, size_t rows,
+	       size_t cols);
+
+/**
+ * @brief Allocates a vector of 'sz' elements from workspace 'ws'.
+ *
+ * The contents of the vector are undefined, so be sure to call
+ * 'zsl_vec_init' on it if required.
+ *
+ * @param ws    Pointer to the zsl_workspace to allocate from.
+ * @param v     Pointer to the zsl_vec to assign the allocated memory to.
+ * @param sz    The number of elements in 'v'.
+ *
+ * @return 0 on success, or -ENOMEM if 'ws' doesn't have enough room left.
+ */
+int zsl_ws_vec(struct zsl_workspace *ws, struct zsl_vec *v, size_t sz);
+
+/** @} */ /* End of MTX_WORKSPACE group */
+
 /**
  * @addtogroup MTX_DATACCESS Data Access
  *
@@ -339,243 +592,1064 @@ int zsl_mtx_set_col(struct zsl_mtx *m, size_t j, zsl_real_t *v);
 /** @} */ /* End of MTX_DATAACCESS group */
 
 /**
- * @ingroup MTX_OPERANDS
+ * @addtogroup MTX_VIEWS Views
+ *
+ * @brief Strided views of matrices, and the operations that accept them.
+ *
+ * Views let block algorithms work directly on a submatrix, row, column,
+ * diagonal or transpose of an existing matrix instead of first copying it
+ * into a temporary. Writing to a view writes to the underlying matrix.
+ *
+ * @ingroup MATRICES
  *  @{ */
 
 /**
- * @brief Applies a unary operand on every coefficient in matrix 'm'.
+ * @brief Initialises view 'v' to cover every element of matrix 'm'.
  *
- * @param m         Pointer to the zsl_mtx to use.
- * @param op        The unary operation to apply to each coefficient.
+ * @param m     Pointer to the matrix to reference.
+ * @param v     Pointer to the output view.
  *
  * @return 0 on success, and non-zero error code on failure
  */
-int zsl_mtx_unary_op(struct zsl_mtx *m, zsl_mtx_unary_op_t op);
+int zsl_mtx_view_init(struct zsl_mtx *m, struct zsl_mtx_view *v);
 
 /**
- * @brief Applies a unary function on every coefficient in matrix 'm', using the
- * specified 'zsl_mtx_apply_unary_fn_t' instance.
+ * @brief Creates a view 'v' of the 'rows' x 'cols' block of 'src' whose
+ *        upper-left element is (i, j).
  *
- * @param m         Pointer to the zsl_mtx to use.
- * @param fn        The zsl_mtx_unary_fn_t instance to call.
+ * @param src   Pointer to the view to narrow. May be the same as 'v'.
+ * @param v     Pointer to the output view.
+ * @param i     The row of 'src' where the block starts (0-based).
+ * @param j     The column of 'src' where the block starts (0-based).
+ * @param rows  The number of rows in the block.
+ * @param cols  The number of columns in the block.
  *
- * @return 0 on success, and non-zero error code on failure
+ * @return 0 on success, -EINVAL if the block doesn't fit inside 'src'.
  */
-int zsl_mtx_unary_func(struct zsl_mtx *m, zsl_mtx_unary_fn_t fn);
+int zsl_mtx_view_block(struct zsl_mtx_view *src, struct zsl_mtx_view *v,
+		       size_t i, size_t j, size_t rows, size_t cols);
 
 /**
- * @brief Applies a component-wise binary operation on every coefficient in
- * symmetrical matrices 'ma' and 'mb', with the results being stored in the
- * identically shaped `mc` matrix.
+ * @brief Creates a 1 x n view 'v' of row 'i' of 'src'.
  *
- * @param ma        Pointer to first zsl_mtx to use in the binary operation.
- * @param mb        Pointer to second zsl_mtx to use in the binary operation.
- * @param mc        Pointer to output zsl_mtx used to store results.
- * @param op        The binary operation to apply to each coefficient.
+ * @param src   Pointer to the source view. May be the same as 'v'.
+ * @param v     Pointer to the output view.
+ * @param i     The row to reference (0-based).
  *
  * @return 0 on success, and non-zero error code on failure
  */
-int zsl_mtx_binary_op(struct zsl_mtx *ma, struct zsl_mtx *mb,
-		      struct zsl_mtx *mc, zsl_mtx_binary_op_t op);
+int zsl_mtx_view_row(struct zsl_mtx_view *src, struct zsl_mtx_view *v,
+		     size_t i);
 
 /**
- * @brief Applies a component-wise binary operztion on every coefficient in
- * symmetrical matrices 'ma' and 'mb', with the results  being stored in the
- * identically shaped 'mc' matrix. The actual binary operation is executed
- * using the specified 'zsl_mtx_binary_fn_t' callback.
+ * @brief Creates an m x 1 view 'v' of column 'j' of 'src'.
  *
- * @param ma        Pointer to first zsl_mtx to use in the binary operation.
- * @param mb        Pointer to second zsl_mtx to use in the binary operation.
- * @param mc        Pointer to output zsl_mtx used to store results.
- * @param fn        The zsl_mtx_binary_fn_t instance to call.
+ * @param src   Pointer to the source view. May be the same as 'v'.
+ * @param v     Pointer to the output view.
+ * @param j     The column to reference (0-based).
  *
  * @return 0 on success, and non-zero error code on failure
  */
-int zsl_mtx_binary_func(struct zsl_mtx *ma, struct zsl_mtx *mb,
-			struct zsl_mtx *mc, zsl_mtx_binary_fn_t fn);
-
-/** @} */ /* End of MTX_OPERANDS group */
-
-/**
- * @addtogroup MTX_BASICMATH Basic Math
- *
- * @brief Basic mathematical operations for matrices (add, substract, etc.).
- *
- * @ingroup MATRICES
- *  @{ */
+int zsl_mtx_view_col(struct zsl_mtx_view *src, struct zsl_mtx_view *v,
+		     size_t j);
 
 /**
- * @brief Adds matrices 'ma' and 'mb', assigning the output to 'mc'.
- *        Matrices 'ma', 'mb' and 'mc' must all be identically shaped.
+ * @brief Creates a k x 1 view 'v' of the main diagonal of 'src', where 'k'
+ *        is the smaller of the two dimensions of 'src'.
  *
- * @param ma    Pointer to the first input zsl_mtx.
- * @param mb    Pointer to the second input zsl_mtx.
- * @param mc    Pointer to the output zsl_mtx.
+ * @param src   Pointer to the source view. May be the same as 'v'.
+ * @param v     Pointer to the output view.
  *
- * @return  0 if everything executed correctly, or -EINVAL if the three
- *          matrices are not all identically shaped.
+ * @return 0 on success, and non-zero error code on failure
  */
-int zsl_mtx_add(struct zsl_mtx *ma, struct zsl_mtx *mb, struct zsl_mtx *mc);
+int zsl_mtx_view_diag(struct zsl_mtx_view *src, struct zsl_mtx_view *v);
 
 /**
- * @brief Adds matrices 'ma' and 'mb', assigning the output to 'ma'.
- *        Matrices 'ma', and 'mb' must be identically shaped.
+ * @brief Creates a view 'v' of the transpose of 'src'. No data is moved,
+ *        the strides of the two dimensions are simply swapped.
  *
- * @param ma    Pointer to the first input zsl_mtx. This matrix will be
- *              overwritten with the results of the addition operations!
- * @param mb    Pointer to the second input zsl_mtx.
+ * To store the transpose in a matrix, copy this view into a view of the
+ * destination matrix with 'zsl_mtx_view_copy'.
  *
- * @warning     This function is destructive to 'ma'!
+ * @param src   Pointer to the source view. May be the same as 'v'.
+ * @param v     Pointer to the output view.
  *
- * @return  0 if everything executed correctly, or -EINVAL if the two input
- *          matrices are not identically shaped.
+ * @return 0 on success, and non-zero error code on failure
  */
-int zsl_mtx_add_d(struct zsl_mtx *ma, struct zsl_mtx *mb);
+int zsl_mtx_view_trans(struct zsl_mtx_view *src, struct zsl_mtx_view *v);
 
 /**
- * @brief Adds the values of row 'j' to row 'i' in matrix 'm'. This operation
- *        is destructive for row 'i'.
+ * @brief Gets a single value from the specified row (i) and column (j) of
+ *        view 'v'.
  *
- * @param m     Pointer to the zsl_mtx to use.
- * @param i     The first row number to add (0-based).
- * @param j     The second row number to add (0-based).
+ * @param v     Pointer to the view to use.
+ * @param i     The row number to read (0-based).
+ * @param j     The column number to read (0-based).
+ * @param x     Pointer to where the value should be stored.
  *
  * @return  0 if everything executed correctly, or -EINVAL on an out of
  *          bounds error.
  */
-int zsl_mtx_sum_rows_d(struct zsl_mtx *m, size_t i, size_t j);
+int zsl_mtx_view_get(struct zsl_mtx_view *v, size_t i, size_t j,
+		     zsl_real_t *x);
 
 /**
- * @brief This function takes the coefficients of row 'j' and multiplies them
- *        by scalar 's', then adds the resulting coefficient to the parallel
- *        element in row 'i'. Row 'i' will be modified in this operation.
- *
- * This function implements a key mechanism of Gauss–Jordan elimination, as can
- * be seen in @ref zsl_mtx_gauss_elim.
+ * @brief Sets a single value at the specified row (i) and column (j) of
+ *        view 'v', updating the underlying matrix.
  *
- * @param m     Pointer to the zsl_mtx to use.
+ * @param v     Pointer to the view to use.
  * @param i     The row number to update (0-based).
- * @param j     The row number to scale and then add to 'i' (0-based).
- * @param s     The scalar value to apply to the values in row 'j'.
+ * @param j     The column number to update (0-based).
+ * @param x     The value to assign.
  *
- * @return  0 if everything executed correctly, otherwise an appropriate
- *          error code.
+ * @return  0 if everything executed correctly, or -EINVAL on an out of
+ *          bounds error.
  */
-int zsl_mtx_sum_rows_scaled_d(struct zsl_mtx *m, size_t i, size_t j,
-			      zsl_real_t s);
+int zsl_mtx_view_set(struct zsl_mtx_view *v, size_t i, size_t j,
+		     zsl_real_t x);
 
 /**
- * @brief Subtracts matrices 'mb' from 'ma', assigning the output to 'mc'.
- *        Matrices 'ma', 'mb' and 'mc' must all be identically shaped.
+ * @brief Copies the contents of view 'vsrc' into view 'vdest'.
  *
- * @param ma    Pointer to the first input zsl_mtx.
- * @param mb    Pointer to the second input zsl_mtx.
- * @param mc    Pointer to the output zsl_mtx.
+ * The two views must not partially overlap, although they may be the same.
  *
- * @return  0 if everything executed correctly, or -EINVAL if the three
- *          matrices are not all identically shaped.
+ * @param vdest Pointer to the destination view.
+ * @param vsrc  Pointer to the source view.
+ *
+ * @return 0 on success, -EINVAL if the views are not the same shape.
  */
-int zsl_mtx_sub(struct zsl_mtx *ma, struct zsl_mtx *mb, struct zsl_mtx *mc);
+int zsl_mtx_view_copy(struct zsl_mtx_view *vdest, struct zsl_mtx_view *vsrc);
 
 /**
- * @brief Subtracts matrix 'mb' from 'ma', assigning the output to 'ma'.
- *        Matrices 'ma', and 'mb' must be identically shaped.
+ * @brief Adds views 'va' and 'vb', assigning the output to 'vc'.
  *
- * @param ma    Pointer to the first input zsl_mtx. This matrix will be
- *              overwritten with the results of the subtraction operations!
- * @param mb    Pointer to the second input zsl_mtx.
+ * 'vc' may be the same view as 'va' or 'vb' for an in-place addition.
  *
- * @warning     This function is destructive to 'ma'!
+ * @param va    Pointer to the first input view.
+ * @param vb    Pointer to the second input view.
+ * @param vc    Pointer to the output view.
  *
- * @return  0 if everything executed correctly, or -EINVAL if the two input
- *          matrices are not identically shaped.
+ * @return 0 on success, -EINVAL if the views are not the same shape.
  */
-int zsl_mtx_sub_d(struct zsl_mtx *ma, struct zsl_mtx *mb);
+int zsl_mtx_view_add(struct zsl_mtx_view *va, struct zsl_mtx_view *vb,
+		     struct zsl_mtx_view *vc);
 
 /**
- * @brief Multiplies matrix 'ma' by 'mb', assigning the output to 'mc'.
- *        Matrices 'ma' and 'mb' must be compatibly shaped, meaning that
- *        'ma' must have the same numbers of columns as there are rows
- *        in 'mb'.
+ * @brief Multiplies views 'va' and 'vb', assigning the output to 'vc'.
  *
- * @param ma    Pointer to the first input zsl_mtx.
- * @param mb    Pointer to the second input zsl_mtx.
- * @param mc    Pointer to the output zsl_mtx.
+ * 'va' and 'vb' may reference the same data, e.g. a matrix and its transpose
+ * view, but 'vc' must not share memory with either of them.
  *
- * @return  0 if everything executed correctly, or -EINVAL if the input
- *          matrices are not compatibly shaped.
+ * @param va    Pointer to the first input view.
+ * @param vb    Pointer to the second input view.
+ * @param vc    Pointer to the output view.
+ *
+ * @return 0 on success, -EINVAL if the shapes don't match or, when bounds
+ *         checks are enabled, if 'vc' overlaps an input.
  */
-int zsl_mtx_mult(struct zsl_mtx *ma, struct zsl_mtx *mb, struct zsl_mtx *mc);
+int zsl_mtx_view_mult(struct zsl_mtx_view *va, struct zsl_mtx_view *vb,
+		      struct zsl_mtx_view *vc);
 
 /**
- * @brief Multiplies matrix 'ma' by 'mb', assigning the output to 'ma'.
- *        Matrices 'ma' and 'mb' must be compatibly shaped, meaning that
- *        'ma' must have the same numbers of columns as there are rows
- *        in 'mb'. To use this function, 'mb' must be a square matrix.
- *        This function is destructive.
+ * @brief Performs gaussian elimination in place on view 'v', adding multiples
+ *        of row 'i' to the other rows until every element of column 'j'
+ *        except (i, j) is zero. The same row operations are applied to 'vi'.
  *
- * @param ma    Pointer to the first input zsl_mtx.
- * @param mb    Pointer to the second input zsl_mtx.
+ * @param v     Pointer to the view to reduce.
+ * @param vi    Pointer to the view receiving the same row operations,
+ *              typically an identity matrix. Must have as many rows as 'v'.
+ * @param i     The row number of the pivot element (0-based).
+ * @param j     The column number of the pivot element (0-based).
  *
- * @return  0 if everything executed correctly, or -EINVAL if the input
- *          matrices are not compatibly shaped.
+ * @return 0 on success, and non-zero error code on failure
  */
-int zsl_mtx_mult_d(struct zsl_mtx *ma, struct zsl_mtx *mb);
+int zsl_mtx_view_gauss_elim(struct zsl_mtx_view *v, struct zsl_mtx_view *vi,
+			    size_t i, size_t j);
 
 /**
- * @brief Multiplies all elements in matrix 'm' by scalar value 's'.
+ * @brief Calculates the Frobenius norm of view 'v', the square root of the
+ *        sum of the squares of its elements.
  *
- * @param m     Pointer to the zsl_mtz to adjust.
- * @param s     The scalar value to multiply elements in matrix 'm' with.
+ * @param v     Pointer to the input view.
+ * @param x     Pointer to where the norm should be stored.
  *
- * @return  0 if everything executed correctly, otherwise an appropriate
- *          error code.
+ * @return 0 on success, and non-zero error code on failure
  */
-int zsl_mtx_scalar_mult_d(struct zsl_mtx *m, zsl_real_t s);
+int zsl_mtx_view_norm(struct zsl_mtx_view *v, zsl_real_t *x);
 
 /**
- * @brief Multiplies the elements of row 'i' in matrix 'm' by scalar 's'.
+ * @brief Scales every column of view 'v' to unit length, assigning the
+ *        output to 'vnorm'. As with 'zsl_vec_to_unit', a zero column is
+ *        replaced with the first unit vector.
  *
- * @param m     Pointer to the zsl_mtx to use.
- * @param i     The row number to multiply by scalar 's' (0-based).
- * @param s     The scalar to use when multiplying elements of row 'i'.
+ * @param v      Pointer to the input view.
+ * @param vnorm  Pointer to the output view. May be the same as 'v'.
  *
- * @return  0 if everything executed correctly, or -EINVAL on an out of
- *          bounds error.
+ * @return 0 on success, -EINVAL if the views are not the same shape.
  */
-int zsl_mtx_scalar_mult_row_d(struct zsl_mtx *m, size_t i, zsl_real_t s);
+int zsl_mtx_view_cols_norm(struct zsl_mtx_view *v, struct zsl_mtx_view *vnorm);
 
-/** @} */ /* End of MTX_BASICMATH group */
+/** @} */ /* End of MTX_VIEWS group */
 
 /**
- * @addtogroup MTX_TRANSFORMATIONS Transformation
+ * @addtogroup MTX_FIXED Fixed-size Kernels
  *
- * @brief Transformation functions for matrices (transpose, inverse, guassian
- *        elimination, etc.).
+ * @brief Unrolled kernels for 2x2, 3x3 and 4x4 matrices.
+ *
+ * These functions work directly on row-major arrays, such as the 'data'
+ * field of a zsl_mtx of the matching shape. They skip the shape checks and
+ * loops of the generic functions, which dispatch to them automatically when
+ * given square matrices of these sizes.
  *
  * @ingroup MATRICES
  *  @{ */
 
 /**
- * @brief Transposes the matrix 'ma' into matrix 'mb'. Note that output
- *        matrix 'mb' must have 'ma->sz_rows' columns, and 'ma->sz_cols' rows.
+ * @brief Multiplies the 2x2 matrices 'a' and 'b', assigning the output to 'c'.
  *
- * @param ma    Pointer to the input matrix to transpose.
- * @param mb    Pointer to the output zsl_mtz.
+ * @param a     The first input matrix, 4 values in row-major order.
+ * @param b     The second input matrix, 4 values in row-major order.
+ * @param c     The output matrix. May be the same array as 'a' or 'b'.
  *
- * @return  0 if everything executed correctly, or -EINVAL if ma and mb are
- *          not compatibly shaped.
+ * @return 0 on success.
  */
-int zsl_mtx_trans(struct zsl_mtx *ma, struct zsl_mtx *mb);
+int zsl_mtx22_mult(const zsl_real_t *a, const zsl_real_t *b, zsl_real_t *c);
 
 /**
- * @brief Calculates the ajoint matrix, based on the input 3x3 matrix 'm'.
+ * @brief Multiplies the 3x3 matrices 'a' and 'b', assigning the output to 'c'.
  *
- * @param m     The input 3x3 square matrix to use.
- * @param ma    The output 3x3 square matrix the adjoint values will be
- *              assigned to.
+ * @param a     The first input matrix, 9 values in row-major order.
+ * @param b     The second input matrix, 9 values in row-major order.
+ * @param c     The output matrix. May be the same array as 'a' or 'b'.
  *
- * @return  0 if everything executed correctly, or -EINVAL if this isn't a
+ * @return 0 on success.
+ */
+int zsl_mtx33_mult(const zsl_real_t *a, const zsl_real_t *b, zsl_real_t *c);
+
+/**
+ * @brief Multiplies the 4x4 matrices 'a' and 'b', assigning the output to 'c'.
+ *
+ * @param a     The first input matrix, 16 values in row-major order.
+ * @param b     The second input matrix, 16 values in row-major order.
+ * @param c     The output matrix. May be the same array as 'a' or 'b'.
+ *
+ * @return 0 on success.
+ */
+int zsl_mtx44_mult(const zsl_real_t *a, const zsl_real_t *b, zsl_real_t *c);
+
+/**
+ * @brief Multiplies the 2x2 matrix 'a' by the 2-element column vector 'v',
+ *        assigning the output to 'w'.
+ *
+ * @param a     The input matrix, 4 values in row-major order.
+ * @param v     The 2-element input vector.
+ * @param w     The 2-element output vector. May be the same array as 'v'.
+ *
+ * @return 0 on success.
+ */
+int zsl_mtx22_mult_vec(const zsl_real_t *a, const zsl_real_t *v,
+			zsl_real_t *w);
+
+/**
+ * @brief Multiplies the 3x3 matrix 'a' by the 3-element column vector 'v',
+ *        assigning the output to 'w'.
+ *
+ * @param a     The input matrix, 9 values in row-major order.
+ * @param v     The 3-element input vector.
+ * @param w     The 3-element output vector. May be the same array as 'v'.
+ *
+ * @return 0 on success.
+ */
+int zsl_mtx33_mult_vec(const zsl_real_t *a, const zsl_real_t *v,
+			zsl_real_t *w);
+
+/**
+ * @brief Multiplies the 4x4 matrix 'a' by the 4-element column vector 'v',
+ *        assigning the output to 'w'.
+ *
+ * @param a     The input matrix, 16 values in row-major order.
+ * @param v     The 4-element input vector.
+ * @param w     The 4-element output vector. May be the same array as 'v'.
+ *
+ * @return 0 on success.
+ */
+int zsl_mtx44_mult_vec(const zsl_real_t *a, const zsl_real_t *v,
+			zsl_real_t *w);
+
+/**
+ * @brief Transposes the 2x2 matrix 'a', assigning the output to 'b'.
+ *
+ * @param a     The input matrix, 4 values in row-major order.
+ * @param b     The output matrix. May be the same array as 'a'.
+ *
+ * @return 0 on success.
+ */
+int zsl_mtx22_trans(const zsl_real_t *a, zsl_real_t *b);
+
+/**
+ * @brief Transposes the 3x3 matrix 'a', assigning the output to 'b'.
+ *
+ * @param a     The input matrix, 9 values in row-major order.
+ * @param b     The output matrix. May be the same array as 'a'.
+ *
+ * @return 0 on success.
+ */
+int zsl_mtx33_trans(const zsl_real_t *a, zsl_real_t *b);
+
+/**
+ * @brief Transposes the 4x4 matrix 'a', assigning the output to 'b'.
+ *
+ * @param a     The input matrix, 16 values in row-major order.
+ * @param b     The output matrix. May be the same array as 'a'.
+ *
+ * @return 0 on success.
+ */
+int zsl_mtx44_trans(const zsl_real_t *a, zsl_real_t *b);
+
+/**
+ * @brief Inverts the 2x2 matrix 'a' in closed form, assigning the output
+ *        to 'b'.
+ *
+ * @param a     The input matrix, 4 values in row-major order.
+ * @param b     The output matrix. May be the same array as 'a'.
+ *
+ * @return 0 on success, or -ESINGULAR if the determinant of 'a' is zero, in
+ *         which case 'b' is left unchanged.
+ */
+int zsl_mtx22_inv(const zsl_real_t *a, zsl_real_t *b);
+
+/**
+ * @brief Inverts the 3x3 matrix 'a' in closed form, assigning the output
+ *        to 'b'.
+ *
+ * @param a     The input matrix, 9 values in row-major order.
+ * @param b     The output matrix. May be the same array as 'a'.
+ *
+ * @return 0 on success, or -ESINGULAR if the determinant of 'a' is zero, in
+ *         which case 'b' is left unchanged.
+ */
+int zsl_mtx33_inv(const zsl_real_t *a, zsl_real_t *b);
+
+/**
+ * @brief Inverts the 4x4 matrix 'a' in closed form, assigning the output
+ *        to 'b'.
+ *
+ * @param a     The input matrix, 16 values in row-major order.
+ * @param b     The output matrix. May be the same array as 'a'.
+ *
+ * @return 0 on success, or -ESINGULAR if the determinant of 'a' is zero, in
+ *         which case 'b' is left unchanged.
+ */
+int zsl_mtx44_inv(const zsl_real_t *a, zsl_real_t *b);
+
+/** @} */ /* End of MTX_FIXED group */
+
+/**
+ * @addtogroup MTX_BATCH Batched Operations
+ *
+ * @brief Functions applying the same operation to every matrix in a batch.
+ *
+ * See 'struct zsl_mtx_batch' for the interleaved memory layout. Unless noted
+ * otherwise, the output batch must not share memory with an input batch.
+ *
+ * @ingroup MATRICES
+ *  @{ */
+
+/**
+ * @brief Copies matrix 'k' of batch 'mb' into matrix 'm'.
+ *
+ * @param mb    Pointer to the source batch.
+ * @param k     The index of the matrix in the batch (0-based).
+ * @param m     Pointer to the output matrix, with the batch's shape.
+ *
+ * @return 0 on success, or -EINVAL if 'k' is out of range or the shapes
+ *         don't match.
+ */
+int zsl_mtx_batch_get(struct zsl_mtx_batch *mb, size_t k, struct zsl_mtx *m);
+
+/**
+ * @brief Copies matrix 'm' into position 'k' of batch 'mb'.
+ *
+ * @param mb    Pointer to the destination batch.
+ * @param k     The index of the matrix in the batch (0-based).
+ * @param m     Pointer to the input matrix, with the batch's shape.
+ *
+ * @return 0 on success, or -EINVAL if 'k' is out of range or the shapes
+ *         don't match.
+ */
+int zsl_mtx_batch_set(struct zsl_mtx_batch *mb, size_t k, struct zsl_mtx *m);
+
+/**
+ * @brief Adds each matrix in 'ba' to the matching matrix in 'bb', assigning
+ *        the outputs to 'bc'. 'bc' may be the same batch as 'ba' or 'bb'.
+ *
+ * @param ba    Pointer to the first input batch.
+ * @param bb    Pointer to the second input batch.
+ * @param bc    Pointer to the output batch.
+ *
+ * @return 0 on success, or -EINVAL if the batches don't match.
+ */
+int zsl_mtx_add_batched(struct zsl_mtx_batch *ba, struct zsl_mtx_batch *bb,
+			struct zsl_mtx_batch *bc);
+
+/**
+ * @brief Multiplies each matrix in 'ba' by the matching matrix in 'bb',
+ *        assigning the outputs to 'bc'.
+ *
+ * @param ba    Pointer to the first input batch, of m x p matrices.
+ * @param bb    Pointer to the second input batch, of p x n matrices.
+ * @param bc    Pointer to the output batch, of m x n matrices.
+ *
+ * @return 0 on success, or -EINVAL if the batches don't match or, when
+ *         bounds checks are enabled, if 'bc' overlaps an input.
+ */
+int zsl_mtx_mult_batched(struct zsl_mtx_batch *ba, struct zsl_mtx_batch *bb,
+			 struct zsl_mtx_batch *bc);
+
+/**
+ * @brief Transposes each matrix in 'ba', assigning the outputs to 'bb'.
+ *
+ * @param ba    Pointer to the input batch, of m x n matrices.
+ * @param bb    Pointer to the output batch, of n x m matrices.
+ *
+ * @return 0 on success, or -EINVAL if the batches don't match or, when
+ *         bounds checks are enabled, if 'bb' overlaps 'ba'.
+ */
+int zsl_mtx_trans_batched(struct zsl_mtx_batch *ba, struct zsl_mtx_batch *bb);
+
+/**
+ * @brief Inverts each square matrix in 'ba', assigning the outputs to 'bi'.
+ *
+ * As with 'zsl_mtx_inv', a singular matrix yields an identity matrix. 2x2,
+ * 3x3 and 4x4 matrices use the closed-form kernels. 'bi' may be the same
+ * batch as 'ba'.
+ *
+ * @param ba    Pointer to the input batch.
+ * @param bi    Pointer to the output batch.
+ *
+ * @return 0 on success, or -EINVAL if the matrices are not square or the
+ *         batches don't match.
+ */
+int zsl_mtx_inv_batched(struct zsl_mtx_batch *ba, struct zsl_mtx_batch *bi);
+
+/** @} */ /* End of MTX_BATCH group */
+
+/**
+ * @addtogroup MTX_BAND Banded Matrices
+ *
+ * @brief Functions operating on banded matrices.
+ *
+ * See 'struct zsl_mtx_band' for the storage layout. Products and solves only
+ * touch the stored band, so they run in O(n * (kl + ku)) time, and the
+ * factorisation in O(n * kl * (kl + ku)), instead of O(n^2) and O(n^3) for
+ * the equivalent dense matrices.
+ *
+ * @ingroup MATRICES
+ *  @{ */
+
+/**
+ * @brief Gets a single value from a banded matrix, which is zero if (i, j)
+ *        is outside the band.
+ *
+ * @param b     Pointer to the banded matrix.
+ * @param i     The row number (0-based).
+ * @param j     The column number (0-based).
+ * @param x     Pointer to where the value should be stored.
+ *
+ * @return 0 on success, or -EINVAL if (i, j) is outside the matrix.
+ */
+int zsl_mtx_band_get(struct zsl_mtx_band *b, size_t i, size_t j,
+		     zsl_real_t *x);
+
+/**
+ * @brief Sets a single value in a banded matrix.
+ *
+ * @param b     Pointer to the banded matrix.
+ * @param i     The row number (0-based).
+ * @param j     The column number (0-based).
+ * @param x     The value to assign.
+ *
+ * @return 0 on success, or -EINVAL if (i, j) is outside the matrix or its
+ *         band.
+ */
+int zsl_mtx_band_set(struct zsl_mtx_band *b, size_t i, size_t j,
+		     zsl_real_t x);
+
+/**
+ * @brief Copies the band of dense matrix 'm' into banded matrix 'b'. Values
+ *        of 'm' outside the band are ignored.
+ *
+ * @param m     Pointer to the input matrix.
+ * @param b     Pointer to the output banded matrix, with the same shape.
+ *
+ * @return 0 on success, or -EINVAL if the shapes don't match.
+ */
+int zsl_mtx_band_from_mtx(struct zsl_mtx *m, struct zsl_mtx_band *b);
+
+/**
+ * @brief Expands banded matrix 'b' into dense matrix 'm'.
+ *
+ * @param b     Pointer to the input banded matrix.
+ * @param m     Pointer to the output matrix, with the same shape.
+ *
+ * @return 0 on success, or -EINVAL if the shapes don't match.
+ */
+int zsl_mtx_band_to_mtx(struct zsl_mtx_band *b, struct zsl_mtx *m);
+
+/**
+ * @brief Multiplies banded matrix 'b' by vector 'v', w = b * v.
+ *
+ * @param b     Pointer to the mxn banded matrix.
+ * @param v     The input vector, of size n.
+ * @param w     The output vector, of size m. Can't be the same as 'v'.
+ *
+ * @return 0 on success, or -EINVAL if the sizes don't match or 'w' is 'v'.
+ */
+int zsl_mtx_band_mult_vec(struct zsl_mtx_band *b, struct zsl_vec *v,
+			  struct zsl_vec *w);
+
+/**
+ * @brief Solves the tridiagonal system t * x = b with the Thomas algorithm.
+ *
+ * This is Gaussian elimination without pivoting specialised to three
+ * diagonals, and takes O(n) time. It is stable when 't' is diagonally
+ * dominant or symmetric positive definite, as is the case for splines and
+ * for finite-difference diffusion problems. Use @ref zsl_mtx_band_lu for
+ * other tridiagonal matrices.
+ *
+ * @param t     Pointer to the nxn banded matrix, with 'kl' and 'ku' both set
+ *              to one. It is left unmodified.
+ * @param b     The right-hand side vector, of size n.
+ * @param x     The output solution vector, of size n. This can be the same
+ *              vector as 'b' to solve the system in place.
+ *
+ * @return 0 on success, -EINVAL if the shapes don't match, or -ESINGULAR if
+ *         a zero pivot is found.
+ */
+int zsl_mtx_band_tridiag_solve(struct zsl_mtx_band *t, struct zsl_vec *b,
+			       struct zsl_vec *x);
+
+/**
+ * @brief Calculates the LU decomposition with partial pivoting of the nxn
+ *        banded matrix 'b'.
+ *
+ * Row interchanges widen the upper band of U by 'kl' diagonals, so 'lu'
+ * must have the same 'kl' as 'b', and 'ku' set to 'b->kl + b->ku'. The
+ * multipliers of L are kept in the subdiagonals of 'lu'. As with
+ * @ref zsl_mtx_lu, a singular matrix isn't reported here, but by
+ * @ref zsl_mtx_band_lu_solve.
+ *
+ * @param b     Pointer to the nxn input banded matrix.
+ * @param lu    Pointer to the output banded matrix, with the extra
+ *              superdiagonals described above.
+ * @param p     The output pivot array, of size n. Row 'i' was interchanged
+ *              with row 'p[i]' when eliminating column 'i'.
+ *
+ * @return 0 on success, or -EINVAL if the shapes don't match.
+ */
+int zsl_mtx_band_lu(struct zsl_mtx_band *b, struct zsl_mtx_band *lu,
+		    size_t *p);
+
+/**
+ * @brief Solves the linear system m * x = b, where 'lu' and 'p' are the
+ *        banded LU decomposition of 'm' as returned by
+ *        @ref zsl_mtx_band_lu.
+ *
+ * @param lu    Pointer to the banded LU decomposition.
+ * @param p     The pivot array returned alongside 'lu'.
+ * @param b     The right-hand side vector, of size n.
+ * @param x     The output solution vector, of size n. This can be the same
+ *              vector as 'b' to solve the system in place.
+ *
+ * @return 0 on success, -EINVAL if the shapes don't match, or -ESINGULAR if
+ *         the decomposed matrix is singular.
+ */
+int zsl_mtx_band_lu_solve(struct zsl_mtx_band *lu, size_t *p,
+			  struct zsl_vec *b, struct zsl_vec *x);
+
+/**
+ * @brief Solves the linear system m * x = b, where 'm' is a banded matrix,
+ *        using a banded LU decomposition with partial pivoting.
+ *
+ * The decomposition is placed on the stack, using n * (2 * kl + ku + 1)
+ * values. To solve several systems sharing the same 'm', use
+ * @ref zsl_mtx_band_lu and @ref zsl_mtx_band_lu_solve instead.
+ *
+ * @param m     Pointer to the nxn banded matrix, which is left unmodified.
+ * @param b     The right-hand side vector, of size n.
+ * @param x     The output solution vector, of size n. This can be the same
+ *              vector as 'b' to solve the system in place.
+ *
+ * @return 0 on success, -EINVAL if the shapes don't match, or -ESINGULAR if
+ *         'm' is singular.
+ */
+int zsl_mtx_band_solve(struct zsl_mtx_band *m, struct zsl_vec *b,
+		       struct zsl_vec *x);
+
+/** @} */ /* End of MTX_BAND group */
+
+/**
+ * @addtogroup MTX_PACKED Packed Matrices
+ *
+ * @brief Functions operating on packed symmetric and triangular matrices.
+ *
+ * See 'struct zsl_mtx_packed' for the storage layout. Only the stored
+ * triangle is read and written, which halves both the memory and the number
+ * of operations of the dense equivalents.
+ *
+ * @ingroup MATRICES
+ *  @{ */
+
+/**
+ * @brief Gets a single value from a packed matrix. For symmetric matrices,
+ *        (i, j) and (j, i) hold the same value. For triangular matrices,
+ *        values outside the stored triangle are zero.
+ *
+ * @param p     Pointer to the packed matrix.
+ * @param i     The row number (0-based).
+ * @param j     The column number (0-based).
+ * @param x     Pointer to where the value should be stored.
+ *
+ * @return 0 on success, or -EINVAL if (i, j) is outside the matrix.
+ */
+int zsl_mtx_packed_get(struct zsl_mtx_packed *p, size_t i, size_t j,
+		       zsl_real_t *x);
+
+/**
+ * @brief Sets a single value in a packed matrix. For symmetric matrices,
+ *        this sets both (i, j) and (j, i).
+ *
+ * @param p     Pointer to the packed matrix.
+ * @param i     The row number (0-based).
+ * @param j     The column number (0-based).
+ * @param x     The value to assign.
+ *
+ * @return 0 on success, or -EINVAL if (i, j) is outside the matrix or, for
+ *         triangular matrices, outside the stored triangle.
+ */
+int zsl_mtx_packed_set(struct zsl_mtx_packed *p, size_t i, size_t j,
+		       zsl_real_t x);
+
+/**
+ * @brief Packs the relevant triangle of dense square matrix 'm' into 'p'.
+ *        The lower triangle is used for symmetric matrices, and the other
+ *        triangle of 'm' is ignored.
+ *
+ * @param m     Pointer to the nxn input matrix.
+ * @param p     Pointer to the output packed matrix.
+ *
+ * @return 0 on success, or -EINVAL if the shapes don't match.
+ */
+int zsl_mtx_packed_from_mtx(struct zsl_mtx *m, struct zsl_mtx_packed *p);
+
+/**
+ * @brief Expands packed matrix 'p' into dense matrix 'm'.
+ *
+ * @param p     Pointer to the input packed matrix.
+ * @param m     Pointer to the nxn output matrix.
+ *
+ * @return 0 on success, or -EINVAL if the shapes don't match.
+ */
+int zsl_mtx_packed_to_mtx(struct zsl_mtx_packed *p, struct zsl_mtx *m);
+
+/**
+ * @brief Multiplies packed matrix 'p' by vector 'v', w = p * v.
+ *
+ * @param p     Pointer to the nxn packed matrix.
+ * @param v     The input vector, of size n.
+ * @param w     The output vector, of size n. Can't be the same as 'v'.
+ *
+ * @return 0 on success, or -EINVAL if the sizes don't match or 'w' is 'v'.
+ */
+int zsl_mtx_packed_mult_vec(struct zsl_mtx_packed *p, struct zsl_vec *v,
+			    struct zsl_vec *w);
+
+/**
+ * @brief Multiplies packed matrix 'pa' by dense matrix 'mb', mc = pa * mb.
+ *
+ * @param pa    Pointer to the nxn packed matrix.
+ * @param mb    Pointer to the nxk dense matrix.
+ * @param mc    Pointer to the nxk output matrix. Can't be the same as 'mb'.
+ *
+ * @return 0 on success, or -EINVAL if the shapes don't match or 'mc' is
+ *         'mb'.
+ */
+int zsl_mtx_packed_mult(struct zsl_mtx_packed *pa, struct zsl_mtx *mb,
+			struct zsl_mtx *mc);
+
+/**
+ * @brief Calculates the congruence transform po = f * p * ft of symmetric
+ *        packed matrix 'p', such as the covariance propagation step of a
+ *        Kalman filter.
+ *
+ * Since the output is symmetric, only its lower triangle is calculated.
+ *
+ * @param f     Pointer to the mxn dense matrix.
+ * @param p     Pointer to the nxn symmetric packed matrix.
+ * @param po    Pointer to the mxm symmetric packed output matrix. Can't
+ *              share memory with 'p'.
+ *
+ * @return 0 on success, or -EINVAL if the shapes or types don't match.
+ */
+int zsl_mtx_packed_congruence(struct zsl_mtx *f, struct zsl_mtx_packed *p,
+			      struct zsl_mtx_packed *po);
+
+/**
+ * @brief Calculates the Cholesky decomposition p = l * lt of symmetric
+ *        positive definite packed matrix 'p'.
+ *
+ * @param p     Pointer to the nxn symmetric packed matrix.
+ * @param l     Pointer to the nxn lower triangular packed output matrix.
+ *              Its data can be the same as that of 'p', to decompose the
+ *              matrix in place.
+ *
+ * @return 0 on success, -EINVAL if the shapes or types don't match, or
+ *         -ESINGULAR if 'p' isn't positive definite.
+ */
+int zsl_mtx_packed_cholesky(struct zsl_mtx_packed *p,
+			    struct zsl_mtx_packed *l);
+
+/**
+ * @brief Solves the linear system l * lt * x = b, where 'l' is the packed
+ *        Cholesky factor returned by @ref zsl_mtx_packed_cholesky.
+ *
+ * @param l     Pointer to the nxn lower triangular packed matrix.
+ * @param b     The right-hand side vector, of size n.
+ * @param x     The output solution vector, of size n. This can be the same
+ *              vector as 'b' to solve the system in place.
+ *
+ * @return 0 on success, -EINVAL if the shapes or types don't match, or
+ *         -ESINGULAR if 'l' has a zero on its diagonal.
+ */
+int zsl_mtx_packed_cholesky_solve(struct zsl_mtx_packed *l, struct zsl_vec *b,
+				  struct zsl_vec *x);
+
+/** @} */ /* End of MTX_PACKED group */
+
+/**
+ * @ingroup MTX_OPERANDS
+ *  @{ */
+
+/**
+ * @brief Applies a unary operand on every coefficient in matrix 'm'.
+ *
+ * @param m         Pointer to the zsl_mtx to use.
+ * @param op        The unary operation to apply to each coefficient.
+ *
+ * @return 0 on success, and non-zero error code on failure
+ */
+int zsl_mtx_unary_op(struct zsl_mtx *m, zsl_mtx_unary_op_t op);
+
+/**
+ * @brief Applies a unary function on every coefficient in matrix 'm', using the
+ * specified 'zsl_mtx_apply_unary_fn_t' instance.
+ *
+ * @param m         Pointer to the zsl_mtx to use.
+ * @param fn        The zsl_mtx_unary_fn_t instance to call.
+ *
+ * @return 0 on success, and non-zero error code on failure
+ */
+int zsl_mtx_unary_func(struct zsl_mtx *m, zsl_mtx_unary_fn_t fn);
+
+/**
+ * @brief Applies a component-wise binary operation on every coefficient in
+ * symmetrical matrices 'ma' and 'mb', with the results being stored in the
+ * identically shaped `mc` matrix.
+ *
+ * @param ma        Pointer to first zsl_mtx to use in the binary operation.
+ * @param mb        Pointer to second zsl_mtx to use in the binary operation.
+ * @param mc        Pointer to output zsl_mtx used to store results.
+ * @param op        The binary operation to apply to each coefficient.
+ *
+ * @return 0 on success, and non-zero error code on failure
+ */
+int zsl_mtx_binary_op(struct zsl_mtx *ma, struct zsl_mtx *mb,
+		      struct zsl_mtx *mc, zsl_mtx_binary_op_t op);
+
+/**
+ * @brief Applies a component-wise binary operztion on every coefficient in
+ * symmetrical matrices 'ma' and 'mb', with the results  being stored in the
+ * identically shaped 'mc' matrix. The actual binary operation is executed
+ * using the specified 'zsl_mtx_binary_fn_t' callback.
+ *
+ * @param ma        Pointer to first zsl_mtx to use in the binary operation.
+ * @param mb        Pointer to second zsl_mtx to use in the binary operation.
+ * @param mc        Pointer to output zsl_mtx used to store results.
+ * @param fn        The zsl_mtx_binary_fn_t instance to call.
+ *
+ * @return 0 on success, and non-zero error code on failure
+ */
+int zsl_mtx_binary_func(struct zsl_mtx *ma, struct zsl_mtx *mb,
+			struct zsl_mtx *mc, zsl_mtx_binary_fn_t fn);
+
+/** @} */ /* End of MTX_OPERANDS group */
+
+/**
+ * @addtogroup MTX_BASICMATH Basic Math
+ *
+ * @brief Basic mathematical operations for matrices (add, substract, etc.).
+ *
+ * @ingroup MATRICES
+ *  @{ */
+
+/**
+ * @brief Adds matrices 'ma' and 'mb', assigning the output to 'mc'.
+ *        Matrices 'ma', 'mb' and 'mc' must all be identically shaped.
+ *
+ * @param ma    Pointer to the first input zsl_mtx.
+ * @param mb    Pointer to the second input zsl_mtx.
+ * @param mc    Pointer to the output zsl_mtx.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if the three
+ *          matrices are not all identically shaped.
+ */
+int zsl_mtx_add(struct zsl_mtx *ma, struct zsl_mtx *mb, struct zsl_mtx *mc);
+
+/**
+ * @brief Adds matrices 'ma' and 'mb', assigning the output to 'ma'.
+ *        Matrices 'ma', and 'mb' must be identically shaped.
+ *
+ * @param ma    Pointer to the first input zsl_mtx. This matrix will be
+ *              overwritten with the results of the addition operations!
+ * @param mb    Pointer to the second input zsl_mtx.
+ *
+ * @warning     This function is destructive to 'ma'!
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if the two input
+ *          matrices are not identically shaped.
+ */
+int zsl_mtx_add_d(struct zsl_mtx *ma, struct zsl_mtx *mb);
+
+/**
+ * @brief Adds the values of row 'j' to row 'i' in matrix 'm'. This operation
+ *        is destructive for row 'i'.
+ *
+ * @param m     Pointer to the zsl_mtx to use.
+ * @param i     The first row number to add (0-based).
+ * @param j     The second row number to add (0-based).
+ *
+ * @return  0 if everything executed correctly, or -EINVAL on an out of
+ *          bounds error.
+ */
+int zsl_mtx_sum_rows_d(struct zsl_mtx *m, size_t i, size_t j);
+
+/**
+ * @brief This function takes the coefficients of row 'j' and multiplies them
+ *        by scalar 's', then adds the resulting coefficient to the parallel
+ *        element in row 'i'. Row 'i' will be modified in this operation.
+ *
+ * This function implements a key mechanism of Gauss–Jordan elimination, as can
+ * be seen in @ref zsl_mtx_gauss_elim.
+ *
+ * @param m     Pointer to the zsl_mtx to use.
+ * @param i     The row number to update (0-based).
+ * @param j     The row number to scale and then add to 'i' (0-based).
+ * @param s     The scalar value to apply to the values in row 'j'.
+ *
+ * @return  0 if everything executed correctly, otherwise an appropriate
+ *          error code.
+ */
+int zsl_mtx_sum_rows_scaled_d(struct zsl_mtx *m, size_t i, size_t j,
+			      zsl_real_t s);
+
+/**
+ * @brief Subtracts matrices 'mb' from 'ma', assigning the output to 'mc'.
+ *        Matrices 'ma', 'mb' and 'mc' must all be identically shaped.
+ *
+ * @param ma    Pointer to the first input zsl_mtx.
+ * @param mb    Pointer to the second input zsl_mtx.
+ * @param mc    Pointer to the output zsl_mtx.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if the three
+ *          matrices are not all identically shaped.
+ */
+int zsl_mtx_sub(struct zsl_mtx *ma, struct zsl_mtx *mb, struct zsl_mtx *mc);
+
+/**
+ * @brief Subtracts matrix 'mb' from 'ma', assigning the output to 'ma'.
+ *        Matrices 'ma', and 'mb' must be identically shaped.
+ *
+ * @param ma    Pointer to the first input zsl_mtx. This matrix will be
+ *              overwritten with the results of the subtraction operations!
+ * @param mb    Pointer to the second input zsl_mtx.
+ *
+ * @warning     This function is destructive to 'ma'!
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if the two input
+ *          matrices are not identically shaped.
+ */
+int zsl_mtx_sub_d(struct zsl_mtx *ma, struct zsl_mtx *mb);
+
+/**
+ * @brief Multiplies matrix 'ma' by 'mb', assigning the output to 'mc'.
+ *        Matrices 'ma' and 'mb' must be compatibly shaped, meaning that
+ *        'ma' must have the same numbers of columns as there are rows
+ *        in 'mb'.
+ *
+ * The multiplication is performed in cache-sized blocks using a fixed-size
+ * packed panel of 'mb' (see CONFIG_ZSL_MTX_MULT_KC), so the stack usage does
+ * not depend on the size of the input matrices. 'mc' may share memory with
+ * 'ma' or 'mb', in which case a temporary copy of the output is made.
+ *
+ * @param ma    Pointer to the first input zsl_mtx.
+ * @param mb    Pointer to the second input zsl_mtx.
+ * @param mc    Pointer to the output zsl_mtx.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if the input
+ *          matrices are not compatibly shaped.
+ */
+int zsl_mtx_mult(struct zsl_mtx *ma, struct zsl_mtx *mb, struct zsl_mtx *mc);
+
+/**
+ * @brief Multiplies matrix 'ma' by 'mb', assigning the output to 'ma'.
+ *        Matrices 'ma' and 'mb' must be compatibly shaped, meaning that
+ *        'ma' must have the same numbers of columns as there are rows
+ *        in 'mb'. To use this function, 'mb' must be a square matrix.
+ *        This function is destructive.
+ *
+ * @param ma    Pointer to the first input zsl_mtx.
+ * @param mb    Pointer to the second input zsl_mtx.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if the input
+ *          matrices are not compatibly shaped.
+ */
+int zsl_mtx_mult_d(struct zsl_mtx *ma, struct zsl_mtx *mb);
+
+/**
+ * @brief Computes mc = alpha * op(ma) * op(mb) + beta * mc, where op(x) is
+ *        either 'x' or its transpose. Transposed operands are read in place,
+ *        so there is no need to build a transposed copy first.
+ *
+ * When 'beta' is zero, the initial contents of 'mc' are ignored. 'mc' may
+ * share memory with 'ma' or 'mb', in which case a temporary matrix is used.
+ *
+ * @param ma        Pointer to the first input zsl_mtx.
+ * @param trans_a   If true, use the transpose of 'ma'.
+ * @param mb        Pointer to the second input zsl_mtx.
+ * @param trans_b   If true, use the transpose of 'mb'.
+ * @param alpha     Scale factor applied to the product.
+ * @param beta      Scale factor applied to the initial contents of 'mc'.
+ * @param mc        Pointer to the input/output zsl_mtx.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if the matrices
+ *          are not compatibly shaped.
+ */
+int zsl_mtx_mult_ex(struct zsl_mtx *ma, bool trans_a, struct zsl_mtx *mb,
+		    bool trans_b, zsl_real_t alpha, zsl_real_t beta,
+		    struct zsl_mtx *mc);
+
+/**
+ * @brief Symmetric rank-k update, mc = alpha * ma^T * ma + beta * mc when
+ *        'trans' is true, or mc = alpha * ma * ma^T + beta * mc otherwise.
+ *
+ * Only the lower triangle of the result is computed, and is then mirrored
+ * into the upper triangle, roughly halving the work of 'zsl_mtx_mult_ex'.
+ * When 'beta' is non-zero, 'mc' is assumed to be symmetric and only its lower
+ * triangle is read.
+ *
+ * @param ma        Pointer to the input zsl_mtx.
+ * @param trans     If true, compute ma^T * ma rather than ma * ma^T.
+ * @param alpha     Scale factor applied to the product.
+ * @param beta      Scale factor applied to the initial contents of 'mc'.
+ * @param mc        Pointer to the square input/output zsl_mtx. Must not
+ *                  share memory with 'ma'.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if the matrices
+ *          are not compatibly shaped.
+ */
+int zsl_mtx_syrk(struct zsl_mtx *ma, bool trans, zsl_real_t alpha,
+		 zsl_real_t beta, struct zsl_mtx *mc);
+
+/**
+ * @brief Matrix-vector product, y = alpha * op(ma) * x + beta * y, where
+ *        op(ma) is either 'ma' or its transpose.
+ *
+ * This is a single pass over 'ma', without wrapping the vectors as n x 1
+ * matrices or building a transposed copy. When 'beta' is zero, the initial
+ * contents of 'y' are ignored.
+ *
+ * @param ma        Pointer to the m x n input zsl_mtx.
+ * @param trans     If true, use the transpose of 'ma'.
+ * @param alpha     Scale factor applied to the product.
+ * @param x         The input vector, of size n (or m if 'trans' is true).
+ * @param beta      Scale factor applied to the initial contents of 'y'.
+ * @param y         The input/output vector, of size m (or n if 'trans' is
+ *                  true). Must not share memory with 'x'.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if the sizes don't
+ *          match or 'y' overlaps 'x'.
+ */
+int zsl_mtx_gemv(struct zsl_mtx *ma, bool trans, zsl_real_t alpha,
+		 struct zsl_vec *x, zsl_real_t beta, struct zsl_vec *y);
+
+/**
+ * @brief Rank-1 update, ma = ma + alpha * x * y^T, in place.
+ *
+ * @param ma        Pointer to the m x n input/output zsl_mtx.
+ * @param alpha     Scale factor applied to the outer product.
+ * @param x         The column vector, of size m.
+ * @param y         The row vector, of size n. May be the same as 'x'.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if the sizes don't
+ *          match.
+ */
+int zsl_mtx_ger(struct zsl_mtx *ma, zsl_real_t alpha, struct zsl_vec *x,
+		struct zsl_vec *y);
+
+/**
+ * @brief Multiplies all elements in matrix 'm' by scalar value 's'.
+ *
+ * @param m     Pointer to the zsl_mtz to adjust.
+ * @param s     The scalar value to multiply elements in matrix 'm' with.
+ *
+ * @return  0 if everything executed correctly, otherwise an appropriate
+ *          error code.
+ */
+int zsl_mtx_scalar_mult_d(struct zsl_mtx *m, zsl_real_t s);
+
+/**
+ * @brief Multiplies the elements of row 'i' in matrix 'm' by scalar 's'.
+ *
+ * @param m     Pointer to the zsl_mtx to use.
+ * @param i     The row number to multiply by scalar 's' (0-based).
+ * @param s     The scalar to use when multiplying elements of row 'i'.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL on an out of
+ *          bounds error.
+ */
+int zsl_mtx_scalar_mult_row_d(struct zsl_mtx *m, size_t i, zsl_real_t s);
+
+/** @} */ /* End of MTX_BASICMATH group */
+
+/**
+ * @addtogroup MTX_TRANSFORMATIONS Transformation
+ *
+ * @brief Transformation functions for matrices (transpose, inverse, guassian
+ *        elimination, etc.).
+ *
+ * @ingroup MATRICES
+ *  @{ */
+
+/**
+ * @brief Transposes the matrix 'ma' into matrix 'mb'. Note that output
+ *        matrix 'mb' must have 'ma->sz_rows' columns, and 'ma->sz_cols' rows.
+ *
+ * @param ma    Pointer to the input matrix to transpose.
+ * @param mb    Pointer to the output zsl_mtz.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if ma and mb are
+ *          not compatibly shaped.
+ */
+int zsl_mtx_trans(struct zsl_mtx *ma, struct zsl_mtx *mb);
+
+/**
+ * @brief Calculates the ajoint matrix, based on the input 3x3 matrix 'm'.
+ *
+ * @param m     The input 3x3 square matrix to use.
+ * @param ma    The output 3x3 square matrix the adjoint values will be
+ *              assigned to.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if this isn't a
  *          3x3 square matrix.
  */
 int zsl_mtx_adjoint_3x3(struct zsl_mtx *m, struct zsl_mtx *ma);
@@ -670,7 +1744,8 @@ int zsl_mtx_augm_diag(struct zsl_mtx *m, struct zsl_mtx *maug);
 int zsl_mtx_deter_3x3(struct zsl_mtx *m, zsl_real_t *d);
 
 /**
- * @brief Calculates the determinant of the input square matrix 'm'.
+ * @brief Calculates the determinant of the input square matrix 'm'. Matrices
+ *        larger than 3x3 use the LU decomposition, in O(n^3) time.
  *
  * @param m     The input square matrix to use.
  * @param d     The determinant of square matrix m.
@@ -798,7 +1873,13 @@ int zsl_mtx_norm_elem_d(struct zsl_mtx *m, struct zsl_mtx *mi,
 int zsl_mtx_inv_3x3(struct zsl_mtx *m, struct zsl_mtx *mi);
 
 /**
- * @brief Calculates the inverse of square matrix 'm'.
+ * @brief Calculates the inverse of square matrix 'm', using the LU
+ *        decomposition with partial pivoting. If 'm' is singular, an
+ *        identity matrix will be returned via 'mi'.
+ *
+ * Singularity isn't reported, and neither is a nearly singular 'm' whose
+ * inverse is dominated by rounding errors. When this matters, call
+ * @ref zsl_mtx_lu, @ref zsl_mtx_lu_rcond and @ref zsl_mtx_lu_inv instead.
  *
  * @param m     The input square matrix to use.
  * @param mi    The output inverse square matrix.
@@ -808,6 +1889,241 @@ int zsl_mtx_inv_3x3(struct zsl_mtx *m, struct zsl_mtx *mi);
  */
 int zsl_mtx_inv(struct zsl_mtx *m, struct zsl_mtx *mi);
 
+/**
+ * @brief Calculates the LU decomposition of square matrix 'm' using Gaussian
+ *        elimination with partial pivoting, such that P * m = L * U.
+ *
+ * L is a unit lower triangular matrix and U is an upper triangular matrix.
+ * Both are stored in 'lu': U on and above the diagonal, and L below the
+ * diagonal (its unit diagonal is not stored). The row interchanges that make
+ * up the permutation matrix P are stored in 'p', where row 'k' was swapped
+ * with row 'p[k]' at step 'k', in increasing order of 'k'.
+ *
+ * A singular matrix is still factorised, but will have at least one zero on
+ * the diagonal of U.
+ *
+ * @param m     The input square matrix to use.
+ * @param lu    The output square matrix where L and U should be stored. This
+ *              can be the same matrix as 'm' to factorise it in place.
+ * @param p     Pointer to the output pivot array. Must be at least
+ *              m->sz_rows elements long!
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if 'm' isn't a
+ *          square matrix or 'lu' isn't the same shape as 'm'.
+ */
+int zsl_mtx_lu(struct zsl_mtx *m, struct zsl_mtx *lu, size_t *p);
+
+/**
+ * @brief Solves the linear system m * x = b, where 'lu' and 'p' are the LU
+ *        decomposition of 'm' as returned by @ref zsl_mtx_lu.
+ *
+ * Every column of 'b' is treated as a separate right-hand side, so multiple
+ * systems sharing the same 'm' can be solved in a single call.
+ *
+ * @param lu    The LU decomposition of the nxn input matrix.
+ * @param p     The pivot array returned alongside 'lu'.
+ * @param b     The nxk right-hand side matrix.
+ * @param x     The nxk output solution matrix. This can be the same matrix
+ *              as 'b' to solve the system in place.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if the matrices are
+ *          not compatibly shaped, or -ESINGULAR if the decomposed matrix is
+ *          singular.
+ */
+int zsl_mtx_lu_solve(struct zsl_mtx *lu, size_t *p, struct zsl_mtx *b,
+		     struct zsl_mtx *x);
+
+/**
+ * @brief Calculates the determinant of a square matrix from its LU
+ *        decomposition, as returned by @ref zsl_mtx_lu.
+ *
+ * @param lu    The LU decomposition of the input square matrix.
+ * @param p     The pivot array returned alongside 'lu'.
+ * @param d     The determinant of the decomposed matrix.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if 'lu' isn't a
+ *          square matrix.
+ */
+int zsl_mtx_lu_det(struct zsl_mtx *lu, size_t *p, zsl_real_t *d);
+
+/**
+ * @brief Calculates the inverse of a square matrix from its LU
+ *        decomposition, as returned by @ref zsl_mtx_lu.
+ *
+ * @param lu    The LU decomposition of the input square matrix.
+ * @param p     The pivot array returned alongside 'lu'.
+ * @param mi    The output inverse square matrix.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if 'lu' and 'mi' are
+ *          not square matrices of the same shape, or -ESINGULAR if the
+ *          decomposed matrix is singular.
+ */
+int zsl_mtx_lu_inv(struct zsl_mtx *lu, size_t *p, struct zsl_mtx *mi);
+
+/**
+ * @brief Calculates the 1-norm of matrix 'm', which is its largest absolute
+ *        column sum.
+ *
+ * @param m     The input matrix to use.
+ * @param norm  The 1-norm of 'm', or NaN if 'm' contains a NaN.
+ *
+ * @return  0 if everything executed correctly.
+ */
+int zsl_mtx_norm_1(struct zsl_mtx *m, zsl_real_t *norm);
+
+/**
+ * @brief Estimates the reciprocal of the 1-norm condition number of a square
+ *        matrix from its LU decomposition, as returned by @ref zsl_mtx_lu.
+ *
+ * The condition number ||m|| * ||inv(m)|| bounds how much relative errors in
+ * 'm' or in a right-hand side are amplified in the solution, so roughly
+ * -log10(rcond) significant digits are lost when solving with 'm'. Rather
+ * than forming inv(m), ||inv(m)|| is estimated with Hager's method as
+ * refined by Higham, which takes a few O(n^2) solves with the factors. The
+ * estimate is nearly always within a factor of three of the true value.
+ *
+ * Values of 'rcond' close to ZSL_EPSILON or below mean 'm' is singular to
+ * working precision. An exactly singular matrix gives 0.
+ *
+ * @param lu    The LU decomposition of the input square matrix.
+ * @param p     The pivot array returned alongside 'lu'.
+ * @param anorm The 1-norm of the matrix before it was decomposed, as given
+ *              by @ref zsl_mtx_norm_1.
+ * @param rcond The estimated reciprocal condition number, between 0 and 1.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if 'lu' isn't a
+ *          square matrix.
+ */
+int zsl_mtx_lu_rcond(struct zsl_mtx *lu, size_t *p, zsl_real_t anorm,
+		     zsl_real_t *rcond);
+
+/**
+ * @brief Solves the linear system a * x = b using LU decomposition with
+ *        partial pivoting.
+ *
+ * This is both faster and more accurate than calculating the inverse of 'a'
+ * and multiplying it by 'b'. Every column of 'b' is treated as a separate
+ * right-hand side. To solve several systems sharing the same 'a' in
+ * separate calls, use @ref zsl_mtx_lu and @ref zsl_mtx_lu_solve instead to
+ * avoid repeating the decomposition.
+ *
+ * @param a     The nxn input matrix, which is left unmodified.
+ * @param b     The nxk right-hand side matrix.
+ * @param x     The nxk output solution matrix. This can be the same matrix
+ *              as 'b' to solve the system in place.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if the matrices are
+ *          not compatibly shaped, or -ESINGULAR if 'a' is singular.
+ */
+int zsl_mtx_solve(struct zsl_mtx *a, struct zsl_mtx *b, struct zsl_mtx *x);
+
+/**
+ * @brief Same as @ref zsl_mtx_solve, but also estimates the reciprocal of
+ *        the 1-norm condition number of 'a' with @ref zsl_mtx_lu_rcond.
+ *
+ * The estimate reuses the decomposition, adding only O(n^2) work, so it is a
+ * cheap way to find out whether the solution can be trusted. A singular
+ * matrix returns -ESINGULAR with 'rcond' set to 0.
+ *
+ * @param a     The nxn input matrix, which is left unmodified.
+ * @param b     The nxk right-hand side matrix.
+ * @param x     The nxk output solution matrix. This can be the same matrix
+ *              as 'b' to solve the system in place.
+ * @param rcond The estimated reciprocal condition number of 'a'.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if the matrices are
+ *          not compatibly shaped, or -ESINGULAR if 'a' is singular.
+ */
+int zsl_mtx_solve_rcond(struct zsl_mtx *a, struct zsl_mtx *b,
+			struct zsl_mtx *x, zsl_real_t *rcond);
+
+/**
+ * @brief Calculates the relative residual ||b - a * x|| / (||a|| * ||x|| +
+ *        ||b||) of a solution 'x' to the linear system a * x = b, using
+ *        1-norms.
+ *
+ * This is the normwise backward error of 'x': the smallest relative change
+ * to 'a' and 'b' for which 'x' is an exact solution. A stable solver gives
+ * a value within a small multiple of ZSL_EPSILON, whatever the condition of
+ * 'a', so larger values reveal a failed or inaccurate solve. It takes
+ * O(n^2) operations per column of 'x', and no temporary storage.
+ *
+ * @param a     The mxn input matrix.
+ * @param x     The nxk solution matrix to check.
+ * @param b     The mxk right-hand side matrix.
+ * @param res   The relative residual.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if the matrices
+ *          are not compatibly shaped.
+ */
+int zsl_mtx_residual_rel(struct zsl_mtx *a, struct zsl_mtx *x,
+			 struct zsl_mtx *b, zsl_real_t *res);
+
+/**
+ * @brief Solves the linear system a * x = b using a single-precision LU
+ *        decomposition and iterative refinement in double precision.
+ *
+ * The O(n^3) decomposition of 'a' is done in float, which is fast on parts
+ * with a single-precision FPU. The solution is then refined in O(n^2) steps,
+ * computing the residual b - a * x in double precision each time, until it
+ * reaches the working precision of zsl_real_t. For systems with a condition
+ * number up to about 1/FLT_EPSILON, this gives the same accuracy as
+ * @ref zsl_mtx_solve at a fraction of the cost when double precision is
+ * emulated in software.
+ *
+ * If the refinement doesn't converge within CONFIG_ZSL_MTX_MIXED_ITER_MAX
+ * steps, or 'a' can't be represented or factorised in single precision, the
+ * system is solved again with @ref zsl_mtx_solve.
+ *
+ * @param a     The nxn input matrix, which is left unmodified.
+ * @param b     The nxk right-hand side matrix.
+ * @param x     The nxk output solution matrix. This can be the same matrix
+ *              as 'b' to solve the system in place, at the cost of an extra
+ *              copy of 'b' on the stack.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if the matrices are
+ *          not compatibly shaped, or -ESINGULAR if 'a' is singular.
+ */
+int zsl_mtx_solve_mixed(struct zsl_mtx *a, struct zsl_mtx *b,
+			struct zsl_mtx *x);
+
+/**
+ * @brief Solves the linear system l * x = b by forward substitution, where
+ *        'l' is a lower triangular matrix.
+ *
+ * Only the lower triangle of 'l', diagonal included, is read, so the
+ * output of @ref zsl_mtx_cholesky can be used directly.
+ *
+ * @param l     The nxn lower triangular input matrix.
+ * @param b     The nxk right-hand side matrix.
+ * @param x     The nxk output solution matrix. This can be the same matrix
+ *              as 'b' to solve the system in place.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if the matrices are
+ *          not compatibly shaped, or -ESINGULAR if the diagonal of 'l'
+ *          contains a zero.
+ */
+int zsl_mtx_solve_lower(struct zsl_mtx *l, struct zsl_mtx *b,
+			struct zsl_mtx *x);
+
+/**
+ * @brief Solves the linear system u * x = b by back substitution, where
+ *        'u' is an upper triangular matrix.
+ *
+ * Only the upper triangle of 'u', diagonal included, is read.
+ *
+ * @param u     The nxn upper triangular input matrix.
+ * @param b     The nxk right-hand side matrix.
+ * @param x     The nxk output solution matrix. This can be the same matrix
+ *              as 'b' to solve the system in place.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if the matrices are
+ *          not compatibly shaped, or -ESINGULAR if the diagonal of 'u'
+ *          contains a zero.
+ */
+int zsl_mtx_solve_upper(struct zsl_mtx *u, struct zsl_mtx *b,
+			struct zsl_mtx *x);
+
 /**
  * @brief Calculates the Cholesky decomposition of a symmetric square matrix
  *        using the Cholesky–Crout algorithm.
@@ -815,13 +2131,66 @@ int zsl_mtx_inv(struct zsl_mtx *m, struct zsl_mtx *mi);
  * Computing the Cholesky decomposition of a symmetric square matrix M consists
  * in finding a matrix L such that M = L * Lt (L multiplied by its transpose).
  *
- * @param m     The input symmetric square matrix to use.
- * @param l     The output lower triangular matrix.
+ * @param m     The input symmetric square matrix to use.
+ * @param l     The output lower triangular matrix.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if 'm' isn't a
+ *          symmetric square matrix.
+ */
+int zsl_mtx_cholesky(struct zsl_mtx *m, struct zsl_mtx *l);
+
+/**
+ * @brief Solves the linear system m * x = b, where 'l' is the Cholesky
+ *        decomposition of the symmetric positive definite matrix 'm', as
+ *        returned by @ref zsl_mtx_cholesky.
+ *
+ * This performs a forward substitution with 'l' followed by a back
+ * substitution with its transpose, in O(n^2) per right-hand side.
+ *
+ * @param l     The nxn lower triangular Cholesky factor of 'm'.
+ * @param b     The nxk right-hand side matrix.
+ * @param x     The nxk output solution matrix. This can be the same matrix
+ *              as 'b' to solve the system in place.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if the matrices are
+ *          not compatibly shaped, or -ESINGULAR if the diagonal of 'l'
+ *          contains a zero.
+ */
+int zsl_mtx_cholesky_solve(struct zsl_mtx *l, struct zsl_mtx *b,
+			   struct zsl_mtx *x);
+
+/**
+ * @brief Updates the Cholesky factor 'l' of matrix 'm' in place, so that it
+ *        becomes the Cholesky factor of m + v * vt.
+ *
+ * This takes O(n^2) operations, instead of the O(n^3) required to
+ * decompose the updated matrix from scratch.
+ *
+ * @param l     The nxn lower triangular Cholesky factor to update.
+ * @param v     The vector of size n to add to the decomposed matrix.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if 'l' and 'v' don't
+ *          have compatible shapes, or -ESINGULAR if the diagonal of 'l'
+ *          contains a zero.
+ */
+int zsl_mtx_cholesky_update(struct zsl_mtx *l, struct zsl_vec *v);
+
+/**
+ * @brief Downdates the Cholesky factor 'l' of matrix 'm' in place, so that
+ *        it becomes the Cholesky factor of m - v * vt.
+ *
+ * This takes O(n^2) operations, instead of the O(n^3) required to
+ * decompose the downdated matrix from scratch.
+ *
+ * @param l     The nxn lower triangular Cholesky factor to downdate.
+ * @param v     The vector of size n to remove from the decomposed matrix.
  *
- * @return  0 if everything executed correctly, or -EINVAL if 'm' isn't a
- *          symmetric square matrix.
+ * @return  0 if everything executed correctly, -EINVAL if 'l' and 'v' don't
+ *          have compatible shapes, or -ESINGULAR if the diagonal of 'l'
+ *          contains a zero or m - v * vt wouldn't be positive definite, in
+ *          which case 'l' is left unmodified.
  */
-int zsl_mtx_cholesky(struct zsl_mtx *m, struct zsl_mtx *l);
+int zsl_mtx_cholesky_downdate(struct zsl_mtx *l, struct zsl_vec *v);
 
 /**
  * @brief Balances the square matrix 'm', a process in which the eigenvalues of
@@ -863,9 +2232,15 @@ int zsl_mtx_householder(struct zsl_mtx *m, struct zsl_mtx *h, bool hessenberg);
  * but they tend to be less stable than the householder method for a similar
  * computational cost.
  *
- * @param m     Pointer to the input square matrix.
+ * The reflectors are applied in compact form (see @ref zsl_mtx_qr), so the
+ * decomposition is O(n^3) and only needs a vector of 'zsl_mtx_qrd_ws_size'
+ * bytes on the stack. Use 'zsl_mtx_qrd_ws' to provide it from a
+ * zsl_workspace instead.
+ *
+ * @param m     Pointer to the input matrix, which must be square if
+ *              'hessenberg' is true.
  * @param q     Pointer to the output orthoogonal square matrix.
- * @param r     Pointer to the output upper triangular square matrix or
+ * @param r     Pointer to the output upper triangular matrix or
  *              hessenberg matrix if set to true.
  * @param hessenberg Sets the matrix to hessenberg format if 'true'.
  *
@@ -875,6 +2250,139 @@ int zsl_mtx_householder(struct zsl_mtx *m, struct zsl_mtx *h, bool hessenberg);
 int zsl_mtx_qrd(struct zsl_mtx *m, struct zsl_mtx *q, struct zsl_mtx *r,
 		bool hessenberg);
 
+/**
+ * @brief Returns the number of bytes of workspace needed by
+ *        'zsl_mtx_qrd_ws' for a rows*cols input matrix.
+ *
+ * @param rows  The number of rows in the input matrix.
+ * @param cols  The number of columns in the input matrix.
+ *
+ * @return The size of the required workspace in bytes.
+ */
+size_t zsl_mtx_qrd_ws_size(size_t rows, size_t cols);
+
+/**
+ * @brief Same as 'zsl_mtx_qrd', but every temporary matrix and vector is
+ *        taken from workspace 'ws' rather than from the stack.
+ *
+ * @param m     Pointer to the input matrix.
+ * @param q     Pointer to the output orthogonal square matrix.
+ * @param r     Pointer to the output upper triangular matrix or
+ *              hessenberg matrix if set to true.
+ * @param hessenberg Sets the matrix to hessenberg format if 'true'.
+ * @param ws    Pointer to the workspace to allocate temporaries from. At
+ *              least 'zsl_mtx_qrd_ws_size' bytes must be available.
+ *
+ * @return  0 if everything executed correctly, -ENOMEM if 'ws' is too small,
+ *          otherwise an appropriate error code.
+ */
+int zsl_mtx_qrd_ws(struct zsl_mtx *m, struct zsl_mtx *q, struct zsl_mtx *r,
+		   bool hessenberg, struct zsl_workspace *ws);
+
+/**
+ * @brief Calculates the QR decomposition of matrix 'm' in compact form, as
+ *        a sequence of Householder reflectors that are never expanded into
+ *        full matrices.
+ *
+ * On return, R is stored on and above the diagonal of 'qr'. The reflectors
+ * H(k) = I - tau[k] * v * vt are stored below the diagonal, one per column,
+ * with the leading 1 of each 'v' implied. Q = H(0) * H(1) * ... * H(k-1) can
+ * be applied with @ref zsl_mtx_qr_apply_q. The diagonal of R has the sign of
+ * the matching entry of 'm' at each step, as with @ref zsl_mtx_qrd.
+ *
+ * @param m     The input mxn matrix to use.
+ * @param qr    The output mxn matrix where R and the reflectors should be
+ *              stored. This can be the same matrix as 'm' to factorise it
+ *              in place.
+ * @param tau   The output vector of reflector coefficients, with at least
+ *              min(m, n) entries.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if the arguments
+ *          are not compatibly shaped.
+ */
+int zsl_mtx_qr(struct zsl_mtx *m, struct zsl_mtx *qr, struct zsl_vec *tau);
+
+/**
+ * @brief Multiplies matrix 'b' in place by Q, or by Q transposed if 'trans'
+ *        is true, where Q is stored in compact form by @ref zsl_mtx_qr.
+ *
+ * @param qr    The compact QR decomposition of an mxn matrix.
+ * @param tau   The reflector coefficients returned alongside 'qr'.
+ * @param trans If true, 'b' is multiplied by Q transposed instead of Q.
+ * @param b     The mxk matrix to multiply, which is overwritten with the
+ *              result. Use an identity matrix to form Q explicitly.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if 'b' doesn't
+ *          have the same number of rows as 'qr'.
+ */
+int zsl_mtx_qr_apply_q(struct zsl_mtx *qr, struct zsl_vec *tau, bool trans,
+		       struct zsl_mtx *b);
+
+/**
+ * @brief Solves the linear system a * x = b in the least-squares sense, where
+ *        'qr' and 'tau' are the compact QR decomposition of the mxn matrix
+ *        'a', with m >= n and full column rank.
+ *
+ * Every column of 'b' is treated as a separate right-hand side. This avoids
+ * forming at * a, which squares the condition number of the problem.
+ *
+ * @param qr    The compact QR decomposition of 'a', from @ref zsl_mtx_qr.
+ * @param tau   The reflector coefficients returned alongside 'qr'.
+ * @param b     The mxk right-hand side matrix, which is left unmodified.
+ * @param x     The nxk output solution matrix.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if the matrices are
+ *          not compatibly shaped, or -ESINGULAR if R has a zero on its
+ *          diagonal.
+ */
+int zsl_mtx_qr_solve(struct zsl_mtx *qr, struct zsl_vec *tau, struct zsl_mtx *b,
+		     struct zsl_mtx *x);
+
+/**
+ * @brief Estimates the reciprocal of the 1-norm condition number of R, from
+ *        the compact QR decomposition of an mxn matrix 'a' with m >= n, as
+ *        returned by @ref zsl_mtx_qr.
+ *
+ * Since Q is orthogonal, 'a' and R have the same 2-norm condition number,
+ * and their 1-norm condition numbers differ by at most a factor of n. This
+ * uses the same estimator as @ref zsl_mtx_lu_rcond, with triangular solves
+ * costing O(n^2). A zero on the diagonal of R, meaning 'a' doesn't have full
+ * column rank, gives 0.
+ *
+ * @param qr    The compact QR decomposition of 'a', from @ref zsl_mtx_qr.
+ * @param rcond The estimated reciprocal condition number, between 0 and 1.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if 'qr' has fewer
+ *          rows than columns.
+ */
+int zsl_mtx_qr_rcond(struct zsl_mtx *qr, zsl_real_t *rcond);
+
+/**
+ * @brief Solves the least-squares problem min ||a * x - b|| using a
+ *        single-precision QR decomposition and iterative refinement in
+ *        double precision.
+ *
+ * This is the least-squares counterpart of @ref zsl_mtx_solve_mixed. The
+ * O(m * n^2) decomposition of 'a' is done in float, and each refinement step
+ * corrects both 'x' and the residual b - a * x, using the augmented system
+ * with residuals computed in double precision. Refining the residual as well
+ * lets the solution reach working precision even when 'b' isn't in the
+ * column space of 'a'. This falls back to @ref zsl_mtx_qr and
+ * @ref zsl_mtx_qr_solve in working precision if the refinement doesn't
+ * converge.
+ *
+ * @param a     The mxn input matrix, with m >= n and full column rank. It is
+ *              left unmodified.
+ * @param b     The mxk right-hand side matrix, which is left unmodified.
+ * @param x     The nxk output solution matrix, which can't be the same
+ *              matrix as 'b'.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if the matrices are
+ *          not compatibly shaped, or -ESINGULAR if 'a' is rank deficient.
+ */
+int zsl_mtx_lstsq_mixed(struct zsl_mtx *a, struct zsl_mtx *b,
+			struct zsl_mtx *x);
+
 #ifndef CONFIG_ZSL_SINGLE_PRECISION
 /**
  * @brief Computes recursively the QR decompisition method to put the input
@@ -890,30 +2398,129 @@ int zsl_mtx_qrd(struct zsl_mtx *m, struct zsl_mtx *q, struct zsl_mtx *r,
  *          error code.
  */
 int zsl_mtx_qrd_iter(struct zsl_mtx *m, struct zsl_mtx *mout, size_t iter);
+
+/**
+ * @brief Returns the number of bytes of workspace needed by
+ *        'zsl_mtx_qrd_iter_ws' for a square n*n input matrix.
+ *
+ * @param n     The number of rows and columns in the input matrix.
+ *
+ * @return The size of the required workspace in bytes.
+ */
+size_t zsl_mtx_qrd_iter_ws_size(size_t n);
+
+/**
+ * @brief Same as 'zsl_mtx_qrd_iter', but every temporary matrix and vector is
+ *        taken from workspace 'ws' rather than from the stack.
+ *
+ * @param m     The input square matrix to use when performing the QR
+ *              decomposition.
+ * @param mout  The output upper triangular square matrix where the results
+ *              should be stored.
+ * @param iter  The number of times that 'zsl_mtx_qrd' should be called.
+ * @param ws    Pointer to the workspace to allocate temporaries from. At
+ *              least 'zsl_mtx_qrd_iter_ws_size' bytes must be available.
+ *
+ * @return  0 if everything executed correctly, -ENOMEM if 'ws' is too small,
+ *          otherwise an appropriate error code.
+ */
+int zsl_mtx_qrd_iter_ws(struct zsl_mtx *m, struct zsl_mtx *mout, size_t iter,
+			struct zsl_workspace *ws);
 #endif
 
-#ifndef CONFIG_ZSL_SINGLE_PRECISION
 /**
- * @brief   Calculates the eigenvalues for input matrix 'm' using QR
- *          decomposition recursively. The output vector will only contain real
- *          eigenvalues, even if the input matrix has complex eigenvalues.
+ * @brief   Calculates the eigenvalues for input matrix 'm'. The matrix is
+ *          balanced, reduced to upper Hessenberg form and then iterated with
+ *          the implicit double-shift (Francis) QR algorithm, deflating each
+ *          eigenvalue as soon as it converges. The output vector will only
+ *          contain real eigenvalues, even if the input matrix has complex
+ *          eigenvalues, sorted by descending absolute value. The unshifted
+ *          QR iteration used before only produced this order when it
+ *          converged, and kept the diagonal order of triangular inputs.
  *
  * @param m     The input square matrix to use.
  * @param v     The placeholder for the output vector where the real eigenvalues
  *              should be stored.
- * @param iter  The number of times that 'zsl_mtx_qrd' should be called
- *              during the QR decomposition phase.
- *
- * NOTE: Large values required more iterations to get precise results, and
- * some trial and error may be required to find the right balance of
- * iterations versus processing time.
+ * @param iter  The maximum number of QR sweeps allowed per eigenvalue, or 0
+ *              to use the default of 30.
  *
  * @return  0 if everything executed correctly, otherwise an appropriate
  *          error code. If -ECOMPLEXVAL is returned, it means that complex
- *          numbers were detected in the output eigenvalues.
+ *          numbers were detected in the output eigenvalues. -ECONVERGE is
+ *          returned if an eigenvalue didn't converge within 'iter' sweeps.
  */
 int zsl_mtx_eigenvalues(struct zsl_mtx *m, struct zsl_vec *v, size_t iter);
-#endif
+
+/**
+ * @brief Returns the number of bytes of workspace needed by
+ *        'zsl_mtx_eigenvalues_ws' and 'zsl_mtx_eigenvalues_cplx_ws' for a
+ *        square n*n input matrix.
+ *
+ * @param n     The number of rows and columns in the input matrix.
+ *
+ * @return The size of the required workspace in bytes.
+ */
+size_t zsl_mtx_eigenvalues_ws_size(size_t n);
+
+/**
+ * @brief Same as 'zsl_mtx_eigenvalues', but every temporary matrix and
+ *        vector is taken from workspace 'ws' rather than from the stack.
+ *
+ * @param m     The input square matrix to use.
+ * @param v     The placeholder for the output vector where the real eigenvalues
+ *              should be stored.
+ * @param iter  The maximum number of QR sweeps allowed per eigenvalue, or 0
+ *              to use the default of 30.
+ * @param ws    Pointer to the workspace to allocate temporaries from. At
+ *              least 'zsl_mtx_eigenvalues_ws_size' bytes must be available.
+ *
+ * @return  0 if everything executed correctly, -ENOMEM if 'ws' is too small,
+ *          otherwise an appropriate error code.
+ *          If -ECOMPLEXVAL is returned, it means that complex numbers
+ *          were detected in the output eigenvalues.
+ */
+int zsl_mtx_eigenvalues_ws(struct zsl_mtx *m, struct zsl_vec *v, size_t iter,
+			   struct zsl_workspace *ws);
+
+/**
+ * @brief   Calculates every eigenvalue of input matrix 'm', real or complex,
+ *          using the same method as 'zsl_mtx_eigenvalues'. Eigenvalues are
+ *          sorted by descending modulus, and complex conjugate pairs are
+ *          stored in consecutive entries, positive imaginary part first.
+ *
+ * @param m     The input square matrix to use.
+ * @param re    The output vector for the real parts of the eigenvalues, with
+ *              the same number of entries as 'm' has rows.
+ * @param im    The output vector for the imaginary parts of the eigenvalues,
+ *              with the same number of entries as 'm' has rows.
+ * @param iter  The maximum number of QR sweeps allowed per eigenvalue, or 0
+ *              to use the default of 30.
+ *
+ * @return  0 if everything executed correctly, -ECONVERGE if an eigenvalue
+ *          didn't converge within 'iter' sweeps, otherwise an appropriate
+ *          error code.
+ */
+int zsl_mtx_eigenvalues_cplx(struct zsl_mtx *m, struct zsl_vec *re,
+			     struct zsl_vec *im, size_t iter);
+
+/**
+ * @brief Same as 'zsl_mtx_eigenvalues_cplx', but every temporary matrix and
+ *        vector is taken from workspace 'ws' rather than from the stack.
+ *
+ * @param m     The input square matrix to use.
+ * @param re    The output vector for the real parts of the eigenvalues.
+ * @param im    The output vector for the imaginary parts of the eigenvalues.
+ * @param iter  The maximum number of QR sweeps allowed per eigenvalue, or 0
+ *              to use the default of 30.
+ * @param ws    Pointer to the workspace to allocate temporaries from. At
+ *              least 'zsl_mtx_eigenvalues_ws_size' bytes must be available.
+ *
+ * @return  0 if everything executed correctly, -ENOMEM if 'ws' is too small,
+ *          otherwise an appropriate error code.
+ */
+int zsl_mtx_eigenvalues_cplx_ws(struct zsl_mtx *m, struct zsl_vec *re,
+				struct zsl_vec *im, size_t iter,
+				struct zsl_workspace *ws);
 
 #ifndef CONFIG_ZSL_SINGLE_PRECISION
 /**
@@ -924,9 +2531,11 @@ int zsl_mtx_eigenvalues(struct zsl_mtx *m, struct zsl_vec *v, size_t iter);
  *
  * @param m             The input square matrix to use.
  * @param mev           The placeholder for the output square matrix where the
- *                      eigenvectors should be stored as column vectors.
- * @param iter          The number of times that 'zsl_mtx_qrd' should be called.
- *                      during the QR decomposition phase.
+ *                      eigenvectors should be stored as column vectors, in
+ *                      the order of their eigenvalues in
+ *                      'zsl_mtx_eigenvalues' (descending absolute value).
+ * @param iter          The maximum number of QR sweeps allowed per
+ *                      eigenvalue, or 0 to use the default of 30.
  * @param orthonormal   If set to true, the output matrix 'mev' will be
  *                      orthonormalised.
  *
@@ -940,42 +2549,497 @@ int zsl_mtx_eigenvalues(struct zsl_mtx *m, struct zsl_vec *v, size_t iter);
  */
 int zsl_mtx_eigenvectors(struct zsl_mtx *m, struct zsl_mtx *mev, size_t iter,
 			 bool orthonormal);
+
+/**
+ * @brief Returns the number of bytes of workspace needed by
+ *        'zsl_mtx_eigenvectors_ws' for a square n*n input matrix.
+ *
+ * @param n     The number of rows and columns in the input matrix.
+ *
+ * @return The size of the required workspace in bytes.
+ */
+size_t zsl_mtx_eigenvectors_ws_size(size_t n);
+
+/**
+ * @brief Same as 'zsl_mtx_eigenvectors', but every temporary matrix and
+ *        vector is taken from workspace 'ws' rather than from the stack.
+ *
+ * @param m             The input square matrix to use.
+ * @param mev           The placeholder for the output square matrix where the
+ *                      eigenvectors should be stored as column vectors.
+ * @param iter          The maximum number of QR sweeps allowed per
+ *                      eigenvalue, or 0 to use the default of 30.
+ * @param orthonormal   If set to true, the output matrix 'mev' will be
+ *                      orthonormalised.
+ * @param ws            Pointer to the workspace to allocate temporaries from.
+ *                      At least 'zsl_mtx_eigenvectors_ws_size' bytes must be
+ *                      available.
+ *
+ * @return  0 if everything executed correctly, -ENOMEM if 'ws' is too small,
+ *          otherwise an appropriate error code.
+ *          If the number of calcualted eigenvectors is less than the
+ *          columns in 'm', EEIGENSIZE will be returned.
+ */
+int zsl_mtx_eigenvectors_ws(struct zsl_mtx *m, struct zsl_mtx *mev,
+			    size_t iter, bool orthonormal,
+			    struct zsl_workspace *ws);
 #endif
 
-#ifndef CONFIG_ZSL_SINGLE_PRECISION
+/**
+ * @brief Calculates the eigenvalues and orthonormal eigenvectors of the
+ *        symmetric matrix 'm' in a single pass. Matrices of up to
+ *        CONFIG_ZSL_MTX_EIGEN_SYM_JACOBI_MAX rows use the cyclic Jacobi
+ *        method, larger ones are reduced to tridiagonal form with Householder
+ *        reflections and then solved with the implicit QL or QR method,
+ *        following LAPACK's dsytrd and dsteqr.
+ *
+ * The eigenvalues are sorted by descending absolute value, like
+ * 'zsl_mtx_eigenvalues', and each eigenvector is scaled so that its largest
+ * component is positive.
+ *
+ * @param m     The input symmetric square matrix. Only its lower triangle
+ *              is read.
+ * @param v     The output vector of eigenvalues, with the same number of
+ *              entries as 'm' has rows.
+ * @param mev   The output square matrix where the eigenvectors are stored as
+ *              column vectors. May be the same matrix as 'm', in which case
+ *              'm' is overwritten.
+ *
+ * @return  0 if everything executed correctly, -ECONVERGE if the iteration
+ *          didn't converge, otherwise an appropriate error code.
+ */
+int zsl_mtx_eigen_sym(struct zsl_mtx *m, struct zsl_vec *v,
+		      struct zsl_mtx *mev);
+
+/**
+ * @brief Returns the number of bytes of workspace needed by
+ *        'zsl_mtx_eigen_sym_ws' for a square n*n input matrix.
+ *
+ * @param n     The number of rows and columns in the input matrix.
+ *
+ * @return The size of the required workspace in bytes.
+ */
+size_t zsl_mtx_eigen_sym_ws_size(size_t n);
+
+/**
+ * @brief Same as 'zsl_mtx_eigen_sym', but every temporary matrix and vector
+ *        is taken from workspace 'ws' rather than from the stack.
+ *
+ * @param m     The input symmetric square matrix. Only its lower triangle
+ *              is read.
+ * @param v     The output vector of eigenvalues.
+ * @param mev   The output square matrix where the eigenvectors are stored as
+ *              column vectors.
+ * @param ws    Pointer to the workspace to allocate temporaries from. At
+ *              least 'zsl_mtx_eigen_sym_ws_size' bytes must be available.
+ *
+ * @return  0 if everything executed correctly, -ENOMEM if 'ws' is too small,
+ *          otherwise an appropriate error code.
+ */
+int zsl_mtx_eigen_sym_ws(struct zsl_mtx *m, struct zsl_vec *v,
+			 struct zsl_mtx *mev, struct zsl_workspace *ws);
+
+/**
+ * @brief Function prototype called by 'zsl_mtx_eigen_topk_fn' to multiply a
+ *        vector by the matrix whose eigenpairs are being calculated.
+ *
+ * @param arg   The pointer given to zsl_mtx_eigen_topk_fn.
+ * @param x     The input vector, which must be left unmodified.
+ * @param y     The output vector, where a * x should be stored.
+ *
+ * @return 0 on success, or a negative error code, which stops the
+ *         iteration and is returned by zsl_mtx_eigen_topk_fn.
+ */
+typedef int (*zsl_mtx_matvec_fn_t)(void *arg, struct zsl_vec *x,
+				   struct zsl_vec *y);
+
+/**
+ * @brief Calculates the k eigenvalues of largest absolute value of the
+ *        symmetric matrix 'm', along with their orthonormal eigenvectors,
+ *        using subspace (block power) iteration.
+ *
+ * Each step multiplies the k current vectors by 'm', orthonormalises them,
+ * and solves the kxk projected eigenproblem (Rayleigh-Ritz) to extract the
+ * best approximations they contain. This only needs memory for a few nxk
+ * and kxk matrices, and about k*n^2 operations per step, so it is much
+ * cheaper than 'zsl_mtx_eigen_sym' when k is small, as in PCA.
+ *
+ * The iteration stops once a * v - lambda * v is below sqrt(ZSL_EPSILON)
+ * times the largest eigenvalue for every pair, which leaves an error in
+ * each eigenvector of about that much divided by the distance to the
+ * nearest other eigenvalue. The eigenvalue error is about the square of
+ * the residual over that distance, so the eigenvalues are usually accurate
+ * to working precision. Convergence is faster the better the k-th
+ * eigenvalue is separated from the (k+1)-th, so asking for one or two more
+ * eigenpairs than needed can help when they are close.
+ * Eigenvalues are sorted and eigenvectors signed like 'zsl_mtx_eigen_sym'.
+ *
+ * @param m     The input nxn symmetric matrix.
+ * @param v     The output vector of k eigenvalues, with k <= n.
+ * @param mev   The output nxk matrix where the eigenvectors are stored as
+ *              column vectors.
+ * @param iter  The maximum number of steps, or 0 to use the default of
+ *              2000.
+ *
+ * @return  0 if everything executed correctly, -ECONVERGE if the iteration
+ *          didn't converge, in which case the latest estimates are still
+ *          returned, otherwise an appropriate error code.
+ */
+int zsl_mtx_eigen_topk(struct zsl_mtx *m, struct zsl_vec *v,
+		       struct zsl_mtx *mev, size_t iter);
+
+/**
+ * @brief Returns the number of bytes of workspace needed by
+ *        'zsl_mtx_eigen_topk_ws' and 'zsl_mtx_eigen_topk_fn' for k
+ *        eigenpairs of an nxn matrix.
+ *
+ * @param n     The number of rows and columns in the input matrix.
+ * @param k     The number of eigenpairs to calculate.
+ *
+ * @return The size of the required workspace in bytes.
+ */
+size_t zsl_mtx_eigen_topk_ws_size(size_t n, size_t k);
+
+/**
+ * @brief Same as 'zsl_mtx_eigen_topk', but every temporary matrix and vector
+ *        is taken from workspace 'ws' rather than from the stack.
+ *
+ * @param m     The input nxn symmetric matrix.
+ * @param v     The output vector of k eigenvalues, with k <= n.
+ * @param mev   The output nxk matrix of eigenvectors.
+ * @param iter  The maximum number of steps, or 0 to use the default.
+ * @param ws    Pointer to the workspace to allocate temporaries from. At
+ *              least 'zsl_mtx_eigen_topk_ws_size' bytes must be available.
+ *
+ * @return  0 if everything executed correctly, -ENOMEM if 'ws' is too small,
+ *          otherwise an appropriate error code.
+ */
+int zsl_mtx_eigen_topk_ws(struct zsl_mtx *m, struct zsl_vec *v,
+			  struct zsl_mtx *mev, size_t iter,
+			  struct zsl_workspace *ws);
+
+/**
+ * @brief Same as 'zsl_mtx_eigen_topk_ws', but the symmetric nxn matrix is
+ *        only accessed through 'fn', which multiplies a vector by it.
+ *
+ * This allows the eigenpairs of matrices that are never stored densely to be
+ * calculated, such as a sparse matrix, or the covariance matrix xt * x of a
+ * window of samples 'x', applied as xt * (x * v) without forming it.
+ *
+ * @param fn    The function called to multiply a vector by the matrix.
+ * @param arg   Pointer passed unchanged to 'fn'.
+ * @param v     The output vector of k eigenvalues, with k <= n.
+ * @param mev   The output nxk matrix of eigenvectors, whose number of rows
+ *              sets n.
+ * @param iter  The maximum number of steps, or 0 to use the default.
+ * @param ws    Pointer to the workspace to allocate temporaries from. At
+ *              least 'zsl_mtx_eigen_topk_ws_size' bytes must be available.
+ *
+ * @return  0 if everything executed correctly, -ENOMEM if 'ws' is too small,
+ *          the error code returned by 'fn' if it failed, otherwise an
+ *          appropriate error code.
+ */
+int zsl_mtx_eigen_topk_fn(zsl_mtx_matvec_fn_t fn, void *arg,
+			  struct zsl_vec *v, struct zsl_mtx *mev, size_t iter,
+			  struct zsl_workspace *ws);
+
 /**
  * @brief Performs singular value decomposition, converting input matrix 'm'
  *        into matrices 'u', 'e', and 'v'.
  *
+ * The decomposition uses one-sided Jacobi rotations on a copy of 'm' (or of
+ * its transpose, whichever has fewer columns), so 'm' times 'm' transposed
+ * is never formed. Singular values are sorted in descending order, and the
+ * last non-zero entry of each column of 'v' is positive.
+ *
  * @param m     The input mxn matrix to use.
  * @param u     The placeholder for the output mxm matrix u.
  * @param e     The placeholder for the output mxn matrix sigma.
  * @param v     The placeholder for the output nxn matrix v.
- * @param iter  The number of times that 'zsl_mtx_qrd' should be called.
- *              during the QR decomposition phase.
+ * @param iter  The maximum number of Jacobi sweeps, or 0 to use the
+ *              default of 30.
  *
- * @return  0 if everything executed correctly, otherwise an appropriate
- *          error code.
+ * @return  0 if everything executed correctly, -ECONVERGE if the rotations
+ *          didn't converge, otherwise an appropriate error code.
  */
 int zsl_mtx_svd(struct zsl_mtx *m, struct zsl_mtx *u, struct zsl_mtx *e,
 		struct zsl_mtx *v, size_t iter);
-#endif
 
-#ifndef CONFIG_ZSL_SINGLE_PRECISION
+/**
+ * @brief Returns the number of bytes of workspace needed by
+ *        'zsl_mtx_svd_ws' and 'zsl_mtx_svd_thin_ws' for a rows*cols input
+ *        matrix.
+ *
+ * @param rows  The number of rows in the input matrix.
+ * @param cols  The number of columns in the input matrix.
+ *
+ * @return The size of the required workspace in bytes.
+ */
+size_t zsl_mtx_svd_ws_size(size_t rows, size_t cols);
+
+/**
+ * @brief Same as 'zsl_mtx_svd', but every temporary matrix and vector is
+ *        taken from workspace 'ws' rather than from the stack.
+ *
+ * @param m     The input mxn matrix to use.
+ * @param u     The placeholder for the output mxm matrix u.
+ * @param e     The placeholder for the output mxn matrix sigma.
+ * @param v     The placeholder for the output nxn matrix v.
+ * @param iter  The maximum number of Jacobi sweeps, or 0 to use the
+ *              default of 30.
+ * @param ws    Pointer to the workspace to allocate temporaries from. At
+ *              least 'zsl_mtx_svd_ws_size' bytes must be available.
+ *
+ * @return  0 if everything executed correctly, -ENOMEM if 'ws' is too small,
+ *          otherwise an appropriate error code.
+ */
+int zsl_mtx_svd_ws(struct zsl_mtx *m, struct zsl_mtx *u, struct zsl_mtx *e,
+		   struct zsl_mtx *v, size_t iter, struct zsl_workspace *ws);
+
+/**
+ * @brief Performs the thin (economy) singular value decomposition of input
+ *        matrix 'm', so that m = u * diag(s) * v transposed, where k is the
+ *        smaller of m and n.
+ *
+ * This uses the same method as 'zsl_mtx_svd', but skips the columns of 'u'
+ * or 'v' that only complete the orthonormal basis, and doesn't build the
+ * mostly empty sigma matrix.
+ *
+ * @param m     The input mxn matrix to use.
+ * @param u     The placeholder for the output mxk matrix u.
+ * @param s     The placeholder for the k singular values, in descending
+ *              order.
+ * @param v     The placeholder for the output nxk matrix v.
+ * @param iter  The maximum number of Jacobi sweeps, or 0 to use the
+ *              default of 30.
+ *
+ * @return  0 if everything executed correctly, -ECONVERGE if the rotations
+ *          didn't converge, otherwise an appropriate error code.
+ */
+int zsl_mtx_svd_thin(struct zsl_mtx *m, struct zsl_mtx *u, struct zsl_vec *s,
+		     struct zsl_mtx *v, size_t iter);
+
+/**
+ * @brief Same as 'zsl_mtx_svd_thin', but every temporary matrix and vector
+ *        is taken from workspace 'ws' rather than from the stack.
+ *
+ * @param m     The input mxn matrix to use.
+ * @param u     The placeholder for the output mxk matrix u.
+ * @param s     The placeholder for the k singular values.
+ * @param v     The placeholder for the output nxk matrix v.
+ * @param iter  The maximum number of Jacobi sweeps, or 0 to use the
+ *              default of 30.
+ * @param ws    Pointer to the workspace to allocate temporaries from. At
+ *              least 'zsl_mtx_svd_ws_size' bytes must be available.
+ *
+ * @return  0 if everything executed correctly, -ENOMEM if 'ws' is too small,
+ *          otherwise an appropriate error code.
+ */
+int zsl_mtx_svd_thin_ws(struct zsl_mtx *m, struct zsl_mtx *u,
+			struct zsl_vec *s, struct zsl_mtx *v, size_t iter,
+			struct zsl_workspace *ws);
+
 /**
  * @brief   Performs the pseudo-inverse (aka pinv or Moore-Penrose inverse)
- *          on input matrix 'm'.
+ *          on input matrix 'm', using its thin SVD. Singular values that are
+ *          negligible compared to the largest one are treated as zero.
  *
  * @param m     The input mxn matrix to use.
  * @param pinv  The placeholder for the output pseudo inverse nxm matrix.
- * @param iter  The number of times that 'zsl_mtx_qrd' should be called.
- *              during the QR decomposition phase.
+ * @param iter  The maximum number of Jacobi sweeps, or 0 to use the
+ *              default of 30.
  *
  * @return  0 if everything executed correctly, otherwise an appropriate
  *          error code.
  */
 int zsl_mtx_pinv(struct zsl_mtx *m, struct zsl_mtx *pinv, size_t iter);
-#endif
+
+/**
+ * @brief Returns the number of bytes of workspace needed by
+ *        'zsl_mtx_pinv_ws' for a rows*cols input matrix.
+ *
+ * @param rows  The number of rows in the input matrix.
+ * @param cols  The number of columns in the input matrix.
+ *
+ * @return The size of the required workspace in bytes.
+ */
+size_t zsl_mtx_pinv_ws_size(size_t rows, size_t cols);
+
+/**
+ * @brief Same as 'zsl_mtx_pinv', but every temporary matrix and vector is
+ *        taken from workspace 'ws' rather than from the stack.
+ *
+ * @param m     The input mxn matrix to use.
+ * @param pinv  The placeholder for the output pseudo inverse nxm matrix.
+ * @param iter  The maximum number of Jacobi sweeps, or 0 to use the
+ *              default of 30.
+ * @param ws    Pointer to the workspace to allocate temporaries from. At
+ *              least 'zsl_mtx_pinv_ws_size' bytes must be available.
+ *
+ * @return  0 if everything executed correctly, -ENOMEM if 'ws' is too small,
+ *          otherwise an appropriate error code.
+ */
+int zsl_mtx_pinv_ws(struct zsl_mtx *m, struct zsl_mtx *pinv, size_t iter,
+		    struct zsl_workspace *ws);
+
+/**
+ * @brief Calculates the numerical rank of matrix 'm', which is the number of
+ *        its singular values greater than 'tol'.
+ *
+ * Unlike counting the non-zero pivots of an LU or QR decomposition without
+ * column pivoting, the singular values reliably reveal the rank of 'm', but
+ * this costs a full SVD. Use @ref zsl_mtx_lu_rcond or
+ * @ref zsl_mtx_qr_rcond instead to cheaply check an existing decomposition
+ * for (near) singularity.
+ *
+ * @param m     The input mxn matrix to use.
+ * @param tol   Singular values at or below this are treated as zero. If 0,
+ *              max(m, n) * ZSL_EPSILON times the largest singular value is
+ *              used, as with @ref zsl_mtx_pinv.
+ * @param rank  The numerical rank of 'm'.
+ *
+ * @return  0 if everything executed correctly, otherwise an appropriate
+ *          error code.
+ */
+int zsl_mtx_rank(struct zsl_mtx *m, zsl_real_t tol, size_t *rank);
+
+/**
+ * @brief Returns the number of bytes of workspace needed by
+ *        'zsl_mtx_rank_ws' for a rows*cols input matrix.
+ *
+ * @param rows  The number of rows in the input matrix.
+ * @param cols  The number of columns in the input matrix.
+ *
+ * @return The size of the required workspace in bytes.
+ */
+size_t zsl_mtx_rank_ws_size(size_t rows, size_t cols);
+
+/**
+ * @brief Same as 'zsl_mtx_rank', but every temporary matrix and vector is
+ *        taken from workspace 'ws' rather than from the stack.
+ *
+ * @param m     The input mxn matrix to use.
+ * @param tol   Singular values at or below this are treated as zero, or 0
+ *              to use the default threshold.
+ * @param rank  The numerical rank of 'm'.
+ * @param ws    Pointer to the workspace to allocate temporaries from. At
+ *              least 'zsl_mtx_rank_ws_size' bytes must be available.
+ *
+ * @return  0 if everything executed correctly, -ENOMEM if 'ws' is too small,
+ *          otherwise an appropriate error code.
+ */
+int zsl_mtx_rank_ws(struct zsl_mtx *m, zsl_real_t tol, size_t *rank,
+		    struct zsl_workspace *ws);
+
+/**
+ * @brief Computes the matrix exponential e^m of square matrix 'm', using
+ *        the scaling and squaring method with a Padé approximant.
+ *
+ * The degree of the approximant is chosen from the 1-norm of 'm', as given
+ * by Higham (2005). Matrices whose norm is too large for the highest degree
+ * are first scaled down by a power of two, and the result squared back up.
+ * Single-precision builds use degrees up to 7 rather than 13.
+ *
+ * @param m     The input nxn matrix.
+ * @param me    The placeholder for the output nxn matrix. It may be the same
+ *              matrix as 'm'.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if 'm' contains
+ *          non-finite values, otherwise an appropriate error code.
+ */
+int zsl_mtx_exp(struct zsl_mtx *m, struct zsl_mtx *me);
+
+/**
+ * @brief Returns the number of bytes of workspace needed by 'zsl_mtx_exp_ws'
+ *        for an nxn matrix.
+ *
+ * @param n     The number of rows and columns in the input matrix.
+ *
+ * @return The size of the required workspace in bytes.
+ */
+size_t zsl_mtx_exp_ws_size(size_t n);
+
+/**
+ * @brief Same as 'zsl_mtx_exp', but every temporary matrix is taken from
+ *        workspace 'ws' rather than from the stack.
+ *
+ * @param m     The input nxn matrix.
+ * @param me    The placeholder for the output nxn matrix. It may be the same
+ *              matrix as 'm'.
+ * @param ws    Pointer to the workspace to allocate temporaries from. At
+ *              least 'zsl_mtx_exp_ws_size' bytes must be available.
+ *
+ * @return  0 if everything executed correctly, -ENOMEM if 'ws' is too small,
+ *          otherwise an appropriate error code.
+ */
+int zsl_mtx_exp_ws(struct zsl_mtx *m, struct zsl_mtx *me,
+		   struct zsl_workspace *ws);
+
+/**
+ * @brief Discretizes the continuous-time system dx/dt = A x + B u + w, where
+ *        'w' is white noise with spectral density Q, for a sample period of
+ *        'dt' seconds.
+ *
+ * The results are the state transition matrix Ad = e^(A dt), the input
+ * matrix Bd = (integral of e^(A s) ds from 0 to dt) * B, and the process
+ * noise covariance Qd = integral of e^(A s) Q e^(At s) ds from 0 to dt,
+ * which Van Loan's method gives from the exponential of a 2nx2n block
+ * matrix. Unlike first-order approximations such as Ad = I + A dt, these
+ * are exact up to rounding.
+ *
+ * 'b' and 'bd', or 'q' and 'qd', may both be NULL if they aren't needed. The
+ * outputs can't be the same matrices as the inputs.
+ *
+ * @param a     The nxn continuous-time state matrix.
+ * @param b     The nxp continuous-time input matrix, or NULL.
+ * @param q     The nxn continuous-time process noise density, or NULL.
+ * @param dt    The sample period.
+ * @param ad    The placeholder for the nxn discrete state transition matrix.
+ * @param bd    The placeholder for the nxp discrete input matrix, or NULL.
+ * @param qd    The placeholder for the nxn discrete process noise covariance,
+ *              or NULL.
+ *
+ * @return  0 if everything executed correctly, otherwise an appropriate
+ *          error code.
+ */
+int zsl_mtx_discretize(struct zsl_mtx *a, struct zsl_mtx *b, struct zsl_mtx *q,
+		       zsl_real_t dt, struct zsl_mtx *ad, struct zsl_mtx *bd,
+		       struct zsl_mtx *qd);
+
+/**
+ * @brief Returns the number of bytes of workspace needed by
+ *        'zsl_mtx_discretize_ws' for a system with 'n' states and 'p'
+ *        inputs, whether or not 'b' and 'q' are given.
+ *
+ * @param n     The number of states, or rows and columns in 'a'.
+ * @param p     The number of inputs, or columns in 'b'.
+ *
+ * @return The size of the required workspace in bytes.
+ */
+size_t zsl_mtx_discretize_ws_size(size_t n, size_t p);
+
+/**
+ * @brief Same as 'zsl_mtx_discretize', but every temporary matrix is taken
+ *        from workspace 'ws' rather than from the stack.
+ *
+ * @param a     The nxn continuous-time state matrix.
+ * @param b     The nxp continuous-time input matrix, or NULL.
+ * @param q     The nxn continuous-time process noise density, or NULL.
+ * @param dt    The sample period.
+ * @param ad    The placeholder for the nxn discrete state transition matrix.
+ * @param bd    The placeholder for the nxp discrete input matrix, or NULL.
+ * @param qd    The placeholder for the nxn discrete process noise covariance,
+ *              or NULL.
+ * @param ws    Pointer to the workspace to allocate temporaries from. At
+ *              least 'zsl_mtx_discretize_ws_size' bytes must be available.
+ *
+ * @return  0 if everything executed correctly, -ENOMEM if 'ws' is too small,
+ *          otherwise an appropriate error code.
+ */
+int zsl_mtx_discretize_ws(struct zsl_mtx *a, struct zsl_mtx *b,
+			  struct zsl_mtx *q, zsl_real_t dt, struct zsl_mtx *ad,
+			  struct zsl_mtx *bd, struct zsl_mtx *qd,
+			  struct zsl_workspace *ws);
 
 /** @} */ /* End of MTX_TRANSFORMATIONS group */
 
@@ -28,6 +28,7 @@
 #include <zsl/matrices.h>
 #include <zsl/orientation/quaternions.h>
 #include <zsl/orientation/ahrs.h>
+#include <zsl/fixed.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -78,6 +79,26 @@ int zsl_fus_comp_feed(struct zsl_vec *a, struct zsl_vec *m,
 		      struct zsl_vec *g, zsl_real_t *incl, struct zsl_quat *q,
 		      void *cfg);
 
+/**
+ * @brief Fixed-point complementary filter step, for cores without an FPU.
+ *
+ * This integrates the gyroscope data into 'q' and blends the result with
+ * an absolute orientation estimate 'q_am', using only integer arithmetic.
+ * The accelerometer/magnetometer attitude needs trigonometry, so 'q_am' is
+ * computed by the caller, typically at a lower rate than the gyroscope.
+ *
+ * @param wt    Angular velocity (rad/s) times the sample period (s), Q31.
+ * @param q_am  Accel/mag orientation as a Q31 unit quaternion, or NULL to
+ *              only integrate the gyroscope.
+ * @param alpha Weight of 'q_am', in [0.0, 1.0). See
+ *              @ref zsl_fus_comp_cfg.alpha.
+ * @param q     Pointer to the Q31 unit quaternion to update.
+ * @return int  0 if everything executed correctly, otherwise an appropriate
+ *              negative error code.
+ */
+int zsl_fus_comp_q31(struct zsl_vec_q31 *wt, struct zsl_quat_q31 *q_am,
+		     zsl_q31_t alpha, struct zsl_quat_q31 *q);
+
 /**
  * @brief Default error handler for the complementary sensor fusion driver.
  *
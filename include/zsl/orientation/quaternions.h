@@ -455,6 +455,17 @@ int zsl_quat_from_euler(struct zsl_euler *e, struct zsl_quat *q);
  */
 int zsl_quat_to_rot_mtx(struct zsl_quat *q, struct zsl_mtx *m);
 
+/**
+ * @brief Converts an array of unit quaternions to a batch of rotation
+ *        matrices. See 'zsl_mtx_batch' for the batch layout.
+ *
+ * @param q     Pointer to an array of 'm->sz_batch' unit quaternions.
+ * @param m     Pointer to the 3x3 rotation matrix batch.
+ *
+ * @return 0 if everything executed normally, or a negative error code.
+ */
+int zsl_quat_to_rot_mtx_batched(struct zsl_quat *q, struct zsl_mtx_batch *m);
+
 /**
  * @brief Converts a rotation matrix to it's equivalent unit quaternion.
  *
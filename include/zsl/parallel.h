@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 Kevin Townsend
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @defgroup PARALLEL Parallel Execution
+ *
+ * @brief Optional worker pool used to split large matrix operations across
+ *        several cores.
+ *
+ * When CONFIG_ZSL_PARALLEL is enabled, the matrix multiplication, LU
+ * trailing updates, Householder (QR) reflections and element-wise matrix
+ * operations split their outer loop between the calling thread and a pool
+ * of worker threads. On Zephyr the workers are dedicated work queues, which
+ * the scheduler spreads across CPUs on SMP targets. POSIX threads are used
+ * instead when CONFIG_ZSL_PARALLEL_PTHREAD is set, such as on native_sim, or
+ * when zscilib is built outside of Zephyr.
+ *
+ * Operations below CONFIG_ZSL_PARALLEL_MIN_OPS stay on the calling thread,
+ * since handing them to the pool would cost more than it saves. The pool
+ * only serves one operation at a time: if it is already busy, for example
+ * when a worker calls back into zscilib, the operation runs serially
+ * instead of waiting.
+ *
+ * When CONFIG_ZSL_PARALLEL is disabled, @ref zsl_par_for simply calls its
+ * function once for the whole range, so none of this has any cost.
+ */
+
+/**
+ * @file
+ * @brief API header file for parallel execution in zscilib.
+ *
+ * This file contains the zscilib parallel execution APIs
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZSL_PARALLEL_H_
+#define ZEPHYR_INCLUDE_ZSL_PARALLEL_H_
+
+#include <stddef.h>
+#include <zsl/zsl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup PARALLEL_CONFIG Configuration
+ *
+ * @brief Defaults for builds without Kconfig, such as host builds.
+ *
+ * @ingroup PARALLEL
+ *  @{ */
+
+#if CONFIG_ZSL_PARALLEL
+
+/**
+ * Number of threads sharing an operation, including the calling thread.
+ * Outside of Zephyr, zero uses one thread per online CPU.
+ */
+#ifndef CONFIG_ZSL_PARALLEL_THREADS
+#define CONFIG_ZSL_PARALLEL_THREADS 0
+#endif
+
+/**
+ * Smallest operation, in multiply-adds or elements, that is split between
+ * threads.
+ */
+#ifndef CONFIG_ZSL_PARALLEL_MIN_OPS
+#define CONFIG_ZSL_PARALLEL_MIN_OPS 32768
+#endif
+
+#endif /* CONFIG_ZSL_PARALLEL */
+
+/** @} */ /* End of PARALLEL_CONFIG group */
+
+/**
+ * @addtogroup PARALLEL_FUNCTIONS Functions
+ *
+ * @brief Parallel loop helper.
+ *
+ * @ingroup PARALLEL
+ *  @{ */
+
+/**
+ * @brief Function type called by @ref zsl_par_for for every chunk of a
+ *        range.
+ *
+ * @param arg   The pointer given to zsl_par_for.
+ * @param start The first index of the chunk.
+ * @param end   One past the last index of the chunk.
+ *
+ * @return 0 on success, or a negative error code.
+ */
+typedef int (*zsl_par_fn_t)(void *arg, size_t start, size_t end);
+
+#if CONFIG_ZSL_PARALLEL
+/**
+ * @brief Calls 'fn' on contiguous chunks of the range [0, n), possibly from
+ *        several threads at once, and waits until every chunk is done.
+ *
+ * The chunks don't overlap and cover the whole range, so 'fn' may write to
+ * any data indexed by its chunk without locking. The range is only split if
+ * 'ops' is at least CONFIG_ZSL_PARALLEL_MIN_OPS and the pool is free.
+ *
+ * @param n     The number of indices in the range.
+ * @param ops   Estimated cost of the whole range, in multiply-adds or
+ *              elements, used to keep small operations serial.
+ * @param fn    The function to call on every chunk.
+ * @param arg   Pointer passed unchanged to 'fn'.
+ *
+ * @return 0 if every chunk succeeded, otherwise the error code returned by
+ *         one of the failed chunks.
+ */
+int zsl_par_for(size_t n, size_t ops, zsl_par_fn_t fn, void *arg);
+#else
+static inline int zsl_par_for(size_t n, size_t ops, zsl_par_fn_t fn,
+			      void *arg)
+{
+	(void)ops;
+
+	return fn(arg, 0, n);
+}
+#endif
+
+/** @} */ /* End of PARALLEL_FUNCTIONS group */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZSL_PARALLEL_H_ */
+
+/** @} */ /* End of PARALLEL group */
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2026 Kevin Townsend
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @defgroup SPARSE Sparse Matrices
+ *
+ * @brief Sparse matrices in compressed sparse row (CSR) format.
+ *
+ * A @ref zsl_spmtx only stores its non-zero entries, so its memory use
+ * scales with the number of non-zero values instead of rows * columns. The
+ * entries of each row are kept sorted by column, with no duplicates. Sparse
+ * matrices can be built from (row, col, value) triplets, or converted to and
+ * from a dense @ref zsl_mtx.
+ */
+
+/**
+ * @file
+ * @brief API header file for sparse matrices in zscilib.
+ *
+ * This file contains the zscilib sparse matrix APIs
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZSL_SPARSE_H_
+#define ZEPHYR_INCLUDE_ZSL_SPARSE_H_
+
+#include <stddef.h>
+#include <zsl/zsl.h>
+#include <zsl/vectors.h>
+#include <zsl/matrices.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup SPARSE_STRUCTS Structs, Enums and Macros
+ *
+ * @brief Sparse matrix type.
+ *
+ * @ingroup SPARSE
+ *  @{ */
+
+/**
+ * @brief Represents a sparse matrix in compressed sparse row (CSR) format.
+ *
+ * The non-zero entries of row 'i' are stored at indices row_ptr[i] to
+ * row_ptr[i + 1] - 1 of 'col_idx' and 'data', sorted by column.
+ */
+struct zsl_spmtx {
+	/** The number of rows in the matrix (typically denoted as 'm'). */
+	size_t sz_rows;
+	/** The number of columns in the matrix (typically denoted as 'n'). */
+	size_t sz_cols;
+	/** The number of non-zero entries currently stored. */
+	size_t nnz;
+	/** The capacity of 'col_idx' and 'data', in entries. */
+	size_t sz_nnz;
+	/** Start of every row in 'col_idx' and 'data', plus the end of the
+	 *  last one. Must have sz_rows + 1 elements. */
+	size_t *row_ptr;
+	/** Column index of every stored entry. */
+	size_t *col_idx;
+	/** Value of every stored entry. */
+	zsl_real_t *data;
+};
+
+/**
+ * Macro to declare a sparse matrix with `m` rows, `n` columns, and room for
+ * up to `nz` non-zero entries.
+ *
+ * Be sure to also fill the matrix with 'zsl_spmtx_from_coo' or
+ * 'zsl_spmtx_from_mtx' after this macro, since the row pointers declared on
+ * the stack may have non-zero values by default!
+ */
+#define ZSL_SPMATRIX_DEF(name, m, n, nz)		 \
+	size_t name ## _rp[(m) + 1];			 \
+	size_t name ## _ci[nz];				 \
+	zsl_real_t name ## _sp[nz];			 \
+	struct zsl_spmtx name = {			 \
+		.sz_rows = m,				 \
+		.sz_cols = n,				 \
+		.nnz = 0,				 \
+		.sz_nnz = nz,				 \
+		.row_ptr = name ## _rp,			 \
+		.col_idx = name ## _ci,			 \
+		.data = name ## _sp			 \
+	}
+
+/** @} */ /* End of SPARSE_STRUCTS group */
+
+/**
+ * @addtogroup SPARSE_BUILD Building and Conversion
+ *
+ * @brief Functions to fill sparse matrices and convert them to dense ones.
+ *
+ * @ingroup SPARSE
+ *  @{ */
+
+/**
+ * @brief Fills a sparse matrix from a list of (row, col, value) triplets,
+ *        also known as coordinate (COO) format.
+ *
+ * The triplets can be given in any order. Values given more than once for
+ * the same row and column are added together, which is convenient when
+ * assembling finite element or graph matrices element by element. Any
+ * previous contents of 's' are discarded.
+ *
+ * @param s     The output sparse matrix.
+ * @param rows  The row index of each triplet.
+ * @param cols  The column index of each triplet.
+ * @param vals  The value of each triplet.
+ * @param n     The number of triplets.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if an index is out of
+ *          bounds, or -ENOMEM if 's' has room for fewer than 'n' entries.
+ *          Duplicates are only merged once every triplet has been stored.
+ */
+int zsl_spmtx_from_coo(struct zsl_spmtx *s, const size_t *rows,
+		       const size_t *cols, const zsl_real_t *vals, size_t n);
+
+/**
+ * @brief Fills a sparse matrix with the non-zero values of dense matrix 'm'.
+ *
+ * @param m     The dense input matrix.
+ * @param s     The output sparse matrix, with the same shape as 'm'.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if the shapes don't
+ *          match, or -ENOMEM if 's' doesn't have room for every non-zero
+ *          value of 'm'.
+ */
+int zsl_spmtx_from_mtx(struct zsl_mtx *m, struct zsl_spmtx *s);
+
+/**
+ * @brief Expands a sparse matrix into dense matrix 'm'.
+ *
+ * @param s     The sparse input matrix.
+ * @param m     The dense output matrix, with the same shape as 's'.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if the shapes
+ *          don't match.
+ */
+int zsl_spmtx_to_mtx(struct zsl_spmtx *s, struct zsl_mtx *m);
+
+/**
+ * @brief Gets a single value from a sparse matrix, which is zero if the
+ *        entry isn't stored.
+ *
+ * The row is searched with a binary search, so this takes O(log k) time for
+ * a row with k stored entries.
+ *
+ * @param s     The sparse matrix.
+ * @param i     The row number (0-based).
+ * @param j     The column number (0-based).
+ * @param x     Pointer to where the value should be stored.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if 'i' or 'j' is
+ *          out of bounds.
+ */
+int zsl_spmtx_get(struct zsl_spmtx *s, size_t i, size_t j, zsl_real_t *x);
+
+/** @} */ /* End of SPARSE_BUILD group */
+
+/**
+ * @addtogroup SPARSE_OPERATIONS Operations
+ *
+ * @brief Sparse matrix-vector products and triangular solves.
+ *
+ * These only touch the stored entries, so they run in O(nnz) time.
+ *
+ * @ingroup SPARSE
+ *  @{ */
+
+/**
+ * @brief Multiplies sparse matrix 's' by vector 'v', w = s * v.
+ *
+ * @param s     The mxn sparse matrix.
+ * @param v     The input vector, of size n.
+ * @param w     The output vector, of size m. Can't be the same as 'v'.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if the sizes
+ *          don't match or 'w' is 'v'.
+ */
+int zsl_spmtx_mult_vec(struct zsl_spmtx *s, struct zsl_vec *v,
+		       struct zsl_vec *w);
+
+/**
+ * @brief Multiplies the transpose of sparse matrix 's' by vector 'v',
+ *        w = st * v, without forming the transpose.
+ *
+ * @param s     The mxn sparse matrix.
+ * @param v     The input vector, of size m.
+ * @param w     The output vector, of size n. Can't be the same as 'v'.
+ *
+ * @return  0 if everything executed correctly, or -EINVAL if the sizes
+ *          don't match or 'w' is 'v'.
+ */
+int zsl_spmtx_mult_vec_trans(struct zsl_spmtx *s, struct zsl_vec *v,
+			     struct zsl_vec *w);
+
+/**
+ * @brief Solves the linear system l * x = b by forward substitution, where
+ *        'l' is a sparse lower triangular matrix.
+ *
+ * Only the entries on or below the diagonal of 'l' are read.
+ *
+ * @param l     The nxn sparse lower triangular matrix.
+ * @param b     The right-hand side vector, of size n.
+ * @param x     The output solution vector, of size n. This can be the same
+ *              vector as 'b' to solve the system in place.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if the sizes don't
+ *          match, or -ESINGULAR if a diagonal entry of 'l' is zero or
+ *          missing.
+ */
+int zsl_spmtx_solve_lower(struct zsl_spmtx *l, struct zsl_vec *b,
+			  struct zsl_vec *x);
+
+/**
+ * @brief Solves the linear system u * x = b by back substitution, where
+ *        'u' is a sparse upper triangular matrix.
+ *
+ * Only the entries on or above the diagonal of 'u' are read.
+ *
+ * @param u     The nxn sparse upper triangular matrix.
+ * @param b     The right-hand side vector, of size n.
+ * @param x     The output solution vector, of size n. This can be the same
+ *              vector as 'b' to solve the system in place.
+ *
+ * @return  0 if everything executed correctly, -EINVAL if the sizes don't
+ *          match, or -ESINGULAR if a diagonal entry of 'u' is zero or
+ *          missing.
+ */
+int zsl_spmtx_solve_upper(struct zsl_spmtx *u, struct zsl_vec *b,
+			  struct zsl_vec *x);
+
+/** @} */ /* End of SPARSE_OPERATIONS group */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZSL_SPARSE_H_ */
+
+/** @} */ /* End of SPARSE group */
@@ -295,6 +295,22 @@ int zsl_sta_covar(struct zsl_vec *v, struct zsl_vec *w, zsl_real_t *c);
  */
 int zsl_sta_covar_mtx(struct zsl_mtx *m, struct zsl_mtx *mc);
 
+/**
+ * @brief Calculates the nxn covariance matrix of a set of n vectors of the
+ *        same length, in packed symmetric form.
+ *
+ * This only calculates and stores the lower triangle of the covariance
+ * matrix, which halves both the work and the memory used compared to
+ * @ref zsl_sta_covar_mtx.
+ *
+ * @param m   Input matrix, whose columns are the different data sets.
+ * @param pc  Output nxn symmetric packed covariance matrix.
+ *
+ * @return 0 on success, and -EINVAL if 'pc' is not a symmetric packed
+ *         matrix with as many rows as 'm' has columns.
+ */
+int zsl_sta_covar_mtx_packed(struct zsl_mtx *m, struct zsl_mtx_packed *pc);
+
 /**
  * @brief Calculates the slope, intercept and correlation coefficient of the
  *        linear regression of two vectors, allowing us to make a prediction
@@ -383,8 +399,9 @@ int zsl_sta_weighted_mult_linear_reg(struct zsl_mtx *x, struct zsl_vec *y,
  * @param m   Matrix, whose rows are the (x, y, z) points.
  * @param b   Pointer to the calculated coefficients of the quadric.
  *
- * @return 0 on success, and -EINVAL if dimension of the input vectors isn't 9
- *         and the input matrix isn't a Nx3 matrix.
+ * @return 0 on success, -EINVAL if dimension of the input vectors isn't 9
+ *         and the input matrix isn't a Nx3 matrix, or -ESINGULAR if the
+ *         points don't determine a unique quadric.
  */
 int zsl_sta_quad_fit(struct zsl_mtx *m, struct zsl_vec *b);
 #endif
@@ -210,6 +210,18 @@ int zsl_vec_scalar_mult(struct zsl_vec *v, zsl_real_t s);
  */
 int zsl_vec_scalar_div(struct zsl_vec *v, zsl_real_t s);
 
+/**
+ * @brief Adds vector 'x', scaled by 'a', to vector 'y', y = a * x + y, in a
+ *        single pass and without a temporary vector.
+ *
+ * @param a The scalar to multiply 'x' by.
+ * @param x The vector to scale and add.
+ * @param y The vector to add to, which is also the output vector.
+ *
+ * @return 0 on success, -EINVAL if x and y are not equal length.
+ */
+int zsl_vec_axpy(zsl_real_t a, struct zsl_vec *x, struct zsl_vec *y);
+
 /**
  * @brief Calculates the distance between two vectors, which is equal to the
  *        norm of vector v - vector w.
@@ -298,6 +310,30 @@ int zsl_vec_to_unit(struct zsl_vec *v);
  */
 int zsl_vec_cross(struct zsl_vec *v, struct zsl_vec *w, struct zsl_vec *c);
 
+/**
+ * @brief Computes the cross product of the 3-element arrays 'v' and 'w',
+ *        without the size checks of 'zsl_vec_cross'.
+ *
+ * @param v     The first 3-element input array.
+ * @param w     The second 3-element input array.
+ * @param c     The 3-element output array. May be the same as 'v' or 'w'.
+ *
+ * @return 0 on success.
+ */
+int zsl_vec3_cross(const zsl_real_t *v, const zsl_real_t *w, zsl_real_t *c);
+
+/**
+ * @brief Computes the dot product of the 3-element arrays 'v' and 'w',
+ *        without the size checks of 'zsl_vec_dot'.
+ *
+ * @param v     The first 3-element input array.
+ * @param w     The second 3-element input array.
+ * @param d     Pointer to where the dot product should be stored.
+ *
+ * @return 0 on success.
+ */
+int zsl_vec3_dot(const zsl_real_t *v, const zsl_real_t *w, zsl_real_t *d);
+
 /**
  * @brief Computes the vector's sum of squares.
  *
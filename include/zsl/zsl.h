@@ -14,6 +14,7 @@
 #ifndef ZEPHYR_INCLUDE_ZSL_H_
 #define ZEPHYR_INCLUDE_ZSL_H_
 
+#include <float.h>
 #include <math.h>
 #include <stdbool.h>
 #include <stddef.h>
@@ -51,6 +52,13 @@ typedef float zsl_real_t;
 typedef double zsl_real_t;
 #endif
 
+/* Machine epsilon for zsl_real_t. */
+#if CONFIG_ZSL_SINGLE_PRECISION
+#define ZSL_EPSILON    FLT_EPSILON
+#else
+#define ZSL_EPSILON    DBL_EPSILON
+#endif
+
 /* Map math functions based on single or double precision. */
 /* TODO: Add an option for fast approximations of trig operations. */
 #if CONFIG_ZSL_SINGLE_PRECISION
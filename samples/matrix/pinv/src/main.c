@@ -17,8 +17,14 @@
 #define EPSILON 1e-6
 #endif
 
+/* Memory used for the temporary matrices of the decomposition, instead of
+ * the stack. */
+static uint8_t ws_buf[1024];
+
 void pinv_demo(void)
 {
+	struct zsl_workspace ws;
+
 	size_t q = 18;
 	size_t p = 3;
 
@@ -43,16 +49,18 @@ void pinv_demo(void)
 		-4.7,  0.0, -0.4
 	};
 
-	/* Large stack space warning. */
-	printf("WARNING: Operations involving large matrices and eigenvectors\n");
-	printf("         require a large amount of stack memory. This sample\n");
-	printf("         may not work on small embedded devices, and may\n");
-	printf("         cause a stack overflow.\n\n");
-
 	/* Define the 18x3 matrix, assigning the chosen values. */
 	ZSL_MATRIX_DEF(mep, q, p);
 	zsl_mtx_from_arr(&mep, vi);
 
+	/* Take the temporaries from 'ws_buf', which must be large enough. */
+	zsl_ws_init(&ws, ws_buf, sizeof(ws_buf));
+	if (zsl_ws_avail(&ws) < zsl_mtx_pinv_ws_size(q, p)) {
+		printf("ERROR: The workspace needs %zu bytes\n",
+		       zsl_mtx_pinv_ws_size(q, p));
+		return;
+	}
+
 	/* Define the pseudoinverse output matrix. */
 	ZSL_MATRIX_DEF(pinv, p, q);
 
@@ -62,8 +70,9 @@ void pinv_demo(void)
 	zsl_mtx_print(&mep);
 	printf("\n");
 
-	/* Calculate and display the pseudoinverse using 150 iterations. */
-	zsl_mtx_pinv(&mep, &pinv, 150);
+	/* Calculate and display the pseudoinverse, allowing up to 150 Jacobi
+	 * sweeps. */
+	zsl_mtx_pinv_ws(&mep, &pinv, 150, &ws);
 	printf("PSEUDOINVERSE (3x18 MATRIX)\n");
 	printf("--------------------------\n");
 	zsl_mtx_print(&pinv);
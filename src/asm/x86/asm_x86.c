@@ -0,0 +1,521 @@
+/*
+ * Copyright (c) 2026 Kevin Townsend
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cpuid.h>
+#include <errno.h>
+#include <immintrin.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <zsl/zsl.h>
+#include <zsl/asm/x86/asm_x86.h>
+
+/*
+ * Every kernel has an SSE2 version, which any x86-64 processor can run, and
+ * an AVX2/FMA version compiled with the 'target' attribute. The public
+ * functions pick one at runtime with zsl_asm_x86_has_avx2, so no special
+ * compiler flags are needed for the rest of the library.
+ *
+ * The macros below map a 128-bit and a 256-bit register to 'zsl_real_t', so
+ * the kernels themselves are written once for both precisions. 'W128' and
+ * 'W256' are the number of elements per register.
+ */
+#define ZSL_X86_AVX2 __attribute__((target("avx2,fma")))
+
+#if CONFIG_ZSL_SINGLE_PRECISION
+#define W128 4
+#define W256 8
+typedef __m128 v128_t;
+typedef __m256 v256_t;
+#define V128_LOAD       _mm_loadu_ps
+#define V128_STORE      _mm_storeu_ps
+#define V128_SET1       _mm_set1_ps
+#define V128_ZERO       _mm_setzero_ps
+#define V128_ADD        _mm_add_ps
+#define V128_SUB        _mm_sub_ps
+#define V128_MUL        _mm_mul_ps
+#define V128_FMA        _mm_fmadd_ps
+#define V256_LOAD       _mm256_loadu_ps
+#define V256_STORE      _mm256_storeu_ps
+#define V256_SET1       _mm256_set1_ps
+#define V256_ZERO       _mm256_setzero_ps
+#define V256_ADD        _mm256_add_ps
+#define V256_SUB        _mm256_sub_ps
+#define V256_MUL        _mm256_mul_ps
+#define V256_FMA        _mm256_fmadd_ps
+#define V256_LO         _mm256_castps256_ps128
+#define V256_HI(x)      _mm256_extractf128_ps(x, 1)
+#else
+#define W128 2
+#define W256 4
+typedef __m128d v128_t;
+typedef __m256d v256_t;
+#define V128_LOAD       _mm_loadu_pd
+#define V128_STORE      _mm_storeu_pd
+#define V128_SET1       _mm_set1_pd
+#define V128_ZERO       _mm_setzero_pd
+#define V128_ADD        _mm_add_pd
+#define V128_SUB        _mm_sub_pd
+#define V128_MUL        _mm_mul_pd
+#define V128_FMA        _mm_fmadd_pd
+#define V256_LOAD       _mm256_loadu_pd
+#define V256_STORE      _mm256_storeu_pd
+#define V256_SET1       _mm256_set1_pd
+#define V256_ZERO       _mm256_setzero_pd
+#define V256_ADD        _mm256_add_pd
+#define V256_SUB        _mm256_sub_pd
+#define V256_MUL        _mm256_mul_pd
+#define V256_FMA        _mm256_fmadd_pd
+#define V256_LO         _mm256_castpd256_pd128
+#define V256_HI(x)      _mm256_extractf128_pd(x, 1)
+#endif
+
+/**
+ * Kernel selection: 0 not yet probed, 1 SSE2, 2 AVX2/FMA. The parallel
+ * workers can reach the first probe concurrently, so it is only accessed
+ * with (relaxed) atomic builtins.
+ */
+static int zsl_asm_x86_level;
+
+/**
+ * @brief Probes the processor for AVX2 and FMA support, including the
+ *        operating system support needed to use the 256-bit registers.
+ */
+static bool
+zsl_asm_x86_probe_avx2(void)
+{
+	unsigned int eax, ebx, ecx, edx;
+	unsigned int xcr0_lo, xcr0_hi;
+	unsigned int need = bit_FMA | bit_OSXSAVE | bit_AVX;
+
+	if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx) || (ecx & need) != need) {
+		return false;
+	}
+
+	/* The OS must save the SSE and AVX state (XCR0 bits 1 and 2). */
+	__asm__ volatile ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+	(void)xcr0_hi;
+	if ((xcr0_lo & 0x6) != 0x6) {
+		return false;
+	}
+
+	if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+		return false;
+	}
+
+	return (ebx & bit_AVX2) != 0;
+}
+
+bool
+zsl_asm_x86_has_avx2(void)
+{
+	int level = __atomic_load_n(&zsl_asm_x86_level, __ATOMIC_RELAXED);
+	int probed;
+
+	/* Concurrent first callers may each probe. Only the first result is
+	 * stored, and a level forced in the meantime is kept. */
+	if (level == 0) {
+		probed = zsl_asm_x86_probe_avx2() ? 2 : 1;
+		if (__atomic_compare_exchange_n(&zsl_asm_x86_level, &level,
+						probed, false,
+						__ATOMIC_RELAXED,
+						__ATOMIC_RELAXED)) {
+			level = probed;
+		}
+	}
+
+	return level == 2;
+}
+
+#ifdef CONFIG_ZTEST
+/*
+ * Test hook to force the kernel level, declared in tests/src/asm_x86_test.h
+ * rather than in the public header.
+ */
+int
+zsl_asm_x86_force_level(int level)
+{
+	if (level < 0 || level > 2) {
+		return -EINVAL;
+	}
+
+	if (level == 2 && !zsl_asm_x86_probe_avx2()) {
+		return -ENOSYS;
+	}
+
+	__atomic_store_n(&zsl_asm_x86_level, level, __ATOMIC_RELAXED);
+
+	return 0;
+}
+#endif
+
+/**
+ * @brief Returns the sum of the elements of a 128-bit register.
+ */
+static inline zsl_real_t
+zsl_asm_x86_hsum128(v128_t x)
+{
+	zsl_real_t t[W128];
+	zsl_real_t sum = 0.0;
+
+	V128_STORE(t, x);
+	for (size_t i = 0; i < W128; i++) {
+		sum += t[i];
+	}
+
+	return sum;
+}
+
+/*
+ * Element-wise binary operations, c = a 'op' b. The vector loops handle two
+ * registers per iteration, and the tail is done with scalar code. 'vop' is
+ * the register operation and 'sop' the matching C operator.
+ */
+#define ZSL_X86_BINARY(name, vop, sop)					\
+static void								\
+zsl_asm_x86_ ## name ## _sse2(const zsl_real_t *a,			\
+			      const zsl_real_t *b, zsl_real_t *c,	\
+			      size_t n)					\
+{									\
+	size_t i = 0;							\
+									\
+	for (; i + 2 * W128 <= n; i += 2 * W128) {			\
+		v128_t x0 = V128_LOAD(a + i);				\
+		v128_t x1 = V128_LOAD(a + i + W128);			\
+		v128_t y0 = V128_LOAD(b + i);				\
+		v128_t y1 = V128_LOAD(b + i + W128);			\
+		V128_STORE(c + i, V128_ ## vop(x0, y0));		\
+		V128_STORE(c + i + W128, V128_ ## vop(x1, y1));		\
+	}								\
+	for (; i < n; i++) {						\
+		c[i] = a[i] sop b[i];					\
+	}								\
+}									\
+									\
+static ZSL_X86_AVX2 void						\
+zsl_asm_x86_ ## name ## _avx2(const zsl_real_t *a,			\
+			      const zsl_real_t *b, zsl_real_t *c,	\
+			      size_t n)					\
+{									\
+	size_t i = 0;							\
+									\
+	for (; i + 2 * W256 <= n; i += 2 * W256) {			\
+		v256_t x0 = V256_LOAD(a + i);				\
+		v256_t x1 = V256_LOAD(a + i + W256);			\
+		v256_t y0 = V256_LOAD(b + i);				\
+		v256_t y1 = V256_LOAD(b + i + W256);			\
+		V256_STORE(c + i, V256_ ## vop(x0, y0));		\
+		V256_STORE(c + i + W256, V256_ ## vop(x1, y1));		\
+	}								\
+	for (; i < n; i++) {						\
+		c[i] = a[i] sop b[i];					\
+	}								\
+}									\
+									\
+void									\
+zsl_asm_x86_ ## name(const zsl_real_t *a, const zsl_real_t *b,		\
+		     zsl_real_t *c, size_t n)				\
+{									\
+	if (zsl_asm_x86_has_avx2()) {					\
+		zsl_asm_x86_ ## name ## _avx2(a, b, c, n);		\
+	} else {							\
+		zsl_asm_x86_ ## name ## _sse2(a, b, c, n);		\
+	}								\
+}
+
+ZSL_X86_BINARY(add, ADD, +)
+ZSL_X86_BINARY(sub, SUB, -)
+ZSL_X86_BINARY(mul, MUL, *)
+
+/**
+ * @brief SSE2 kernel for zsl_asm_x86_scale.
+ */
+static void
+zsl_asm_x86_scale_sse2(zsl_real_t *a, zsl_real_t s, size_t n)
+{
+	v128_t vs = V128_SET1(s);
+	size_t i = 0;
+
+	for (; i + 2 * W128 <= n; i += 2 * W128) {
+		V128_STORE(a + i, V128_MUL(V128_LOAD(a + i), vs));
+		V128_STORE(a + i + W128, V128_MUL(V128_LOAD(a + i + W128), vs));
+	}
+	for (; i < n; i++) {
+		a[i] *= s;
+	}
+}
+
+/**
+ * @brief AVX2 kernel for zsl_asm_x86_scale.
+ */
+static ZSL_X86_AVX2 void
+zsl_asm_x86_scale_avx2(zsl_real_t *a, zsl_real_t s, size_t n)
+{
+	v256_t vs = V256_SET1(s);
+	size_t i = 0;
+
+	for (; i + 2 * W256 <= n; i += 2 * W256) {
+		V256_STORE(a + i, V256_MUL(V256_LOAD(a + i), vs));
+		V256_STORE(a + i + W256, V256_MUL(V256_LOAD(a + i + W256), vs));
+	}
+	for (; i < n; i++) {
+		a[i] *= s;
+	}
+}
+
+void
+zsl_asm_x86_scale(zsl_real_t *a, zsl_real_t s, size_t n)
+{
+	if (zsl_asm_x86_has_avx2()) {
+		zsl_asm_x86_scale_avx2(a, s, n);
+	} else {
+		zsl_asm_x86_scale_sse2(a, s, n);
+	}
+}
+
+/**
+ * @brief SSE2 kernel for zsl_asm_x86_dot. Two independent accumulators hide
+ *        the latency of the additions.
+ */
+static zsl_real_t
+zsl_asm_x86_dot_sse2(const zsl_real_t *a, const zsl_real_t *b, size_t n)
+{
+	v128_t s0 = V128_ZERO();
+	v128_t s1 = V128_ZERO();
+	zsl_real_t sum;
+	size_t i = 0;
+
+	for (; i + 2 * W128 <= n; i += 2 * W128) {
+		s0 = V128_ADD(s0, V128_MUL(V128_LOAD(a + i), V128_LOAD(b + i)));
+		s1 = V128_ADD(s1, V128_MUL(V128_LOAD(a + i + W128),
+					   V128_LOAD(b + i + W128)));
+	}
+
+	sum = zsl_asm_x86_hsum128(V128_ADD(s0, s1));
+	for (; i < n; i++) {
+		sum += a[i] * b[i];
+	}
+
+	return sum;
+}
+
+/**
+ * @brief AVX2/FMA kernel for zsl_asm_x86_dot.
+ */
+static ZSL_X86_AVX2 zsl_real_t
+zsl_asm_x86_dot_avx2(const zsl_real_t *a, const zsl_real_t *b, size_t n)
+{
+	v256_t s0 = V256_ZERO();
+	v256_t s1 = V256_ZERO();
+	zsl_real_t sum;
+	size_t i = 0;
+
+	for (; i + 2 * W256 <= n; i += 2 * W256) {
+		s0 = V256_FMA(V256_LOAD(a + i), V256_LOAD(b + i), s0);
+		s1 = V256_FMA(V256_LOAD(a + i + W256), V256_LOAD(b + i + W256),
+			      s1);
+	}
+
+	s0 = V256_ADD(s0, s1);
+	sum = zsl_asm_x86_hsum128(V128_ADD(V256_LO(s0), V256_HI(s0)));
+	for (; i < n; i++) {
+		sum += a[i] * b[i];
+	}
+
+	return sum;
+}
+
+zsl_real_t
+zsl_asm_x86_dot(const zsl_real_t *a, const zsl_real_t *b, size_t n)
+{
+	if (zsl_asm_x86_has_avx2()) {
+		return zsl_asm_x86_dot_avx2(a, b, n);
+	}
+
+	return zsl_asm_x86_dot_sse2(a, b, n);
+}
+
+/*
+ * Matrix multiplication micro-kernels. One row of the 4x4 output tile is
+ * held in registers: a single 128-bit register in single precision, and
+ * either two 128-bit or one 256-bit register in double precision. Each step
+ * broadcasts one element of 'a' per row and multiplies it by the packed row
+ * of 'bp'.
+ */
+
+#if CONFIG_ZSL_SINGLE_PRECISION
+
+/**
+ * @brief SSE2 kernel for zsl_asm_x86_mult_kernel, single precision.
+ */
+static void
+zsl_asm_x86_mult_kernel_sse2(size_t kc, const zsl_real_t *a, size_t lda,
+			     const zsl_real_t *bp, zsl_real_t *c, size_t ldc,
+			     bool acc)
+{
+	v128_t c0 = V128_ZERO(), c1 = V128_ZERO();
+	v128_t c2 = V128_ZERO(), c3 = V128_ZERO();
+	v128_t b;
+
+	for (size_t p = 0; p < kc; p++) {
+		b = V128_LOAD(bp);
+		bp += 4;
+		c0 = V128_ADD(c0, V128_MUL(V128_SET1(a[p]), b));
+		c1 = V128_ADD(c1, V128_MUL(V128_SET1(a[lda + p]), b));
+		c2 = V128_ADD(c2, V128_MUL(V128_SET1(a[2 * lda + p]), b));
+		c3 = V128_ADD(c3, V128_MUL(V128_SET1(a[3 * lda + p]), b));
+	}
+
+	if (acc) {
+		c0 = V128_ADD(c0, V128_LOAD(c));
+		c1 = V128_ADD(c1, V128_LOAD(c + ldc));
+		c2 = V128_ADD(c2, V128_LOAD(c + 2 * ldc));
+		c3 = V128_ADD(c3, V128_LOAD(c + 3 * ldc));
+	}
+
+	V128_STORE(c, c0);
+	V128_STORE(c + ldc, c1);
+	V128_STORE(c + 2 * ldc, c2);
+	V128_STORE(c + 3 * ldc, c3);
+}
+
+/**
+ * @brief FMA kernel for zsl_asm_x86_mult_kernel, single precision.
+ */
+static ZSL_X86_AVX2 void
+zsl_asm_x86_mult_kernel_avx2(size_t kc, const zsl_real_t *a, size_t lda,
+			     const zsl_real_t *bp, zsl_real_t *c, size_t ldc,
+			     bool acc)
+{
+	v128_t c0 = V128_ZERO(), c1 = V128_ZERO();
+	v128_t c2 = V128_ZERO(), c3 = V128_ZERO();
+	v128_t b;
+
+	for (size_t p = 0; p < kc; p++) {
+		b = V128_LOAD(bp);
+		bp += 4;
+		c0 = V128_FMA(V128_SET1(a[p]), b, c0);
+		c1 = V128_FMA(V128_SET1(a[lda + p]), b, c1);
+		c2 = V128_FMA(V128_SET1(a[2 * lda + p]), b, c2);
+		c3 = V128_FMA(V128_SET1(a[3 * lda + p]), b, c3);
+	}
+
+	if (acc) {
+		c0 = V128_ADD(c0, V128_LOAD(c));
+		c1 = V128_ADD(c1, V128_LOAD(c + ldc));
+		c2 = V128_ADD(c2, V128_LOAD(c + 2 * ldc));
+		c3 = V128_ADD(c3, V128_LOAD(c + 3 * ldc));
+	}
+
+	V128_STORE(c, c0);
+	V128_STORE(c + ldc, c1);
+	V128_STORE(c + 2 * ldc, c2);
+	V128_STORE(c + 3 * ldc, c3);
+}
+
+#else
+
+/**
+ * @brief SSE2 kernel for zsl_asm_x86_mult_kernel, double precision. Each
+ *        output row is split over two registers.
+ */
+static void
+zsl_asm_x86_mult_kernel_sse2(size_t kc, const zsl_real_t *a, size_t lda,
+			     const zsl_real_t *bp, zsl_real_t *c, size_t ldc,
+			     bool acc)
+{
+	v128_t c0l = V128_ZERO(), c0h = V128_ZERO();
+	v128_t c1l = V128_ZERO(), c1h = V128_ZERO();
+	v128_t c2l = V128_ZERO(), c2h = V128_ZERO();
+	v128_t c3l = V128_ZERO(), c3h = V128_ZERO();
+	v128_t bl, bh, x;
+
+	for (size_t p = 0; p < kc; p++) {
+		bl = V128_LOAD(bp);
+		bh = V128_LOAD(bp + 2);
+		bp += 4;
+
+		x = V128_SET1(a[p]);
+		c0l = V128_ADD(c0l, V128_MUL(x, bl));
+		c0h = V128_ADD(c0h, V128_MUL(x, bh));
+		x = V128_SET1(a[lda + p]);
+		c1l = V128_ADD(c1l, V128_MUL(x, bl));
+		c1h = V128_ADD(c1h, V128_MUL(x, bh));
+		x = V128_SET1(a[2 * lda + p]);
+		c2l = V128_ADD(c2l, V128_MUL(x, bl));
+		c2h = V128_ADD(c2h, V128_MUL(x, bh));
+		x = V128_SET1(a[3 * lda + p]);
+		c3l = V128_ADD(c3l, V128_MUL(x, bl));
+		c3h = V128_ADD(c3h, V128_MUL(x, bh));
+	}
+
+	if (acc) {
+		c0l = V128_ADD(c0l, V128_LOAD(c));
+		c0h = V128_ADD(c0h, V128_LOAD(c + 2));
+		c1l = V128_ADD(c1l, V128_LOAD(c + ldc));
+		c1h = V128_ADD(c1h, V128_LOAD(c + ldc + 2));
+		c2l = V128_ADD(c2l, V128_LOAD(c + 2 * ldc));
+		c2h = V128_ADD(c2h, V128_LOAD(c + 2 * ldc + 2));
+		c3l = V128_ADD(c3l, V128_LOAD(c + 3 * ldc));
+		c3h = V128_ADD(c3h, V128_LOAD(c + 3 * ldc + 2));
+	}
+
+	V128_STORE(c, c0l);
+	V128_STORE(c + 2, c0h);
+	V128_STORE(c + ldc, c1l);
+	V128_STORE(c + ldc + 2, c1h);
+	V128_STORE(c + 2 * ldc, c2l);
+	V128_STORE(c + 2 * ldc + 2, c2h);
+	V128_STORE(c + 3 * ldc, c3l);
+	V128_STORE(c + 3 * ldc + 2, c3h);
+}
+
+/**
+ * @brief AVX2/FMA kernel for zsl_asm_x86_mult_kernel, double precision.
+ */
+static ZSL_X86_AVX2 void
+zsl_asm_x86_mult_kernel_avx2(size_t kc, const zsl_real_t *a, size_t lda,
+			     const zsl_real_t *bp, zsl_real_t *c, size_t ldc,
+			     bool acc)
+{
+	v256_t c0 = V256_ZERO(), c1 = V256_ZERO();
+	v256_t c2 = V256_ZERO(), c3 = V256_ZERO();
+	v256_t b;
+
+	for (size_t p = 0; p < kc; p++) {
+		b = V256_LOAD(bp);
+		bp += 4;
+		c0 = V256_FMA(V256_SET1(a[p]), b, c0);
+		c1 = V256_FMA(V256_SET1(a[lda + p]), b, c1);
+		c2 = V256_FMA(V256_SET1(a[2 * lda + p]), b, c2);
+		c3 = V256_FMA(V256_SET1(a[3 * lda + p]), b, c3);
+	}
+
+	if (acc) {
+		c0 = V256_ADD(c0, V256_LOAD(c));
+		c1 = V256_ADD(c1, V256_LOAD(c + ldc));
+		c2 = V256_ADD(c2, V256_LOAD(c + 2 * ldc));
+		c3 = V256_ADD(c3, V256_LOAD(c + 3 * ldc));
+	}
+
+	V256_STORE(c, c0);
+	V256_STORE(c + ldc, c1);
+	V256_STORE(c + 2 * ldc, c2);
+	V256_STORE(c + 3 * ldc, c3);
+}
+
+#endif /* CONFIG_ZSL_SINGLE_PRECISION */
+
+void
+zsl_asm_x86_mult_kernel(size_t kc, const zsl_real_t *a, size_t lda,
+			const zsl_real_t *bp, zsl_real_t *c, size_t ldc,
+			bool acc)
+{
+	if (zsl_asm_x86_has_avx2()) {
+		zsl_asm_x86_mult_kernel_avx2(kc, a, lda, bp, c, ldc, acc);
+	} else {
+		zsl_asm_x86_mult_kernel_sse2(kc, a, lda, bp, c, ldc, acc);
+	}
+}
@@ -0,0 +1,552 @@
+/*
+ * Copyright (c) 2026 Kevin Townsend
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <zsl/zsl.h>
+#include <zsl/fixed.h>
+
+/*
+ * Q31 products are 2.62 values. Before they are accumulated they are shifted
+ * down to 2.48, which leaves 15 guard bits, so up to 32768 full-scale terms
+ * can be summed without overflow. The sum is rounded to Q31 once at the end.
+ */
+#define ZSL_Q31_ACC_SHIFT 14
+
+/**
+ * @brief Rounds a Q31 accumulator (see ZSL_Q31_ACC_SHIFT) to a saturated Q31
+ *        value.
+ */
+static zsl_q31_t zsl_q31_from_acc(int64_t acc)
+{
+	int s = 31 - ZSL_Q31_ACC_SHIFT;
+
+	return zsl_q31_sat((acc + (1LL << (s - 1))) >> s);
+}
+
+int zsl_vec_q31_from_real(struct zsl_vec *v, struct zsl_vec_q31 *q)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (v->sz != q->sz) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < v->sz; i++) {
+		q->data[i] = zsl_q31_from_real(v->data[i]);
+	}
+
+	return 0;
+}
+
+int zsl_vec_q31_to_real(struct zsl_vec_q31 *q, struct zsl_vec *v)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (v->sz != q->sz) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < q->sz; i++) {
+		v->data[i] = zsl_q31_to_real(q->data[i]);
+	}
+
+	return 0;
+}
+
+int zsl_vec_q31_add(struct zsl_vec_q31 *v, struct zsl_vec_q31 *w,
+		    struct zsl_vec_q31 *x)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((v->sz != w->sz) || (v->sz != x->sz)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < v->sz; i++) {
+		x->data[i] = zsl_q31_add(v->data[i], w->data[i]);
+	}
+
+	return 0;
+}
+
+int zsl_vec_q31_sub(struct zsl_vec_q31 *v, struct zsl_vec_q31 *w,
+		    struct zsl_vec_q31 *x)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((v->sz != w->sz) || (v->sz != x->sz)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < v->sz; i++) {
+		x->data[i] = zsl_q31_sub(v->data[i], w->data[i]);
+	}
+
+	return 0;
+}
+
+int zsl_vec_q31_scalar_mult(struct zsl_vec_q31 *v, zsl_q31_t s)
+{
+	for (size_t i = 0; i < v->sz; i++) {
+		v->data[i] = zsl_q31_mult(v->data[i], s);
+	}
+
+	return 0;
+}
+
+int zsl_vec_q31_dot(struct zsl_vec_q31 *v, struct zsl_vec_q31 *w,
+		    zsl_q31_t *d)
+{
+	int64_t acc = 0;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (v->sz != w->sz) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < v->sz; i++) {
+		acc += ((int64_t)v->data[i] * w->data[i]) >> ZSL_Q31_ACC_SHIFT;
+	}
+
+	*d = zsl_q31_from_acc(acc);
+
+	return 0;
+}
+
+int zsl_vec_q15_from_real(struct zsl_vec *v, struct zsl_vec_q15 *q)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (v->sz != q->sz) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < v->sz; i++) {
+		q->data[i] = zsl_q15_from_real(v->data[i]);
+	}
+
+	return 0;
+}
+
+int zsl_vec_q15_to_real(struct zsl_vec_q15 *q, struct zsl_vec *v)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (v->sz != q->sz) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < q->sz; i++) {
+		v->data[i] = zsl_q15_to_real(q->data[i]);
+	}
+
+	return 0;
+}
+
+int zsl_vec_q15_add(struct zsl_vec_q15 *v, struct zsl_vec_q15 *w,
+		    struct zsl_vec_q15 *x)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((v->sz != w->sz) || (v->sz != x->sz)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < v->sz; i++) {
+		x->data[i] = zsl_q15_add(v->data[i], w->data[i]);
+	}
+
+	return 0;
+}
+
+int zsl_vec_q15_sub(struct zsl_vec_q15 *v, struct zsl_vec_q15 *w,
+		    struct zsl_vec_q15 *x)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((v->sz != w->sz) || (v->sz != x->sz)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < v->sz; i++) {
+		x->data[i] = zsl_q15_sub(v->data[i], w->data[i]);
+	}
+
+	return 0;
+}
+
+int zsl_vec_q15_scalar_mult(struct zsl_vec_q15 *v, zsl_q15_t s)
+{
+	for (size_t i = 0; i < v->sz; i++) {
+		v->data[i] = zsl_q15_mult(v->data[i], s);
+	}
+
+	return 0;
+}
+
+int zsl_vec_q15_dot(struct zsl_vec_q15 *v, struct zsl_vec_q15 *w,
+		    zsl_q15_t *d)
+{
+	/* Q15 products are 2.30 values, so a 64-bit sum can't overflow. */
+	int64_t acc = 0;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (v->sz != w->sz) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < v->sz; i++) {
+		acc += (int32_t)v->data[i] * w->data[i];
+	}
+
+	acc = (acc + (1 << 14)) >> 15;
+	*d = acc > ZSL_Q15_MAX ? ZSL_Q15_MAX :
+	     acc < ZSL_Q15_MIN ? ZSL_Q15_MIN : (zsl_q15_t)acc;
+
+	return 0;
+}
+
+int zsl_mtx_q31_from_real(struct zsl_mtx *m, struct zsl_mtx_q31 *q)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((m->sz_rows != q->sz_rows) || (m->sz_cols != q->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < m->sz_rows * m->sz_cols; i++) {
+		q->data[i] = zsl_q31_from_real(m->data[i]);
+	}
+
+	return 0;
+}
+
+int zsl_mtx_q31_to_real(struct zsl_mtx_q31 *q, struct zsl_mtx *m)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((m->sz_rows != q->sz_rows) || (m->sz_cols != q->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < q->sz_rows * q->sz_cols; i++) {
+		m->data[i] = zsl_q31_to_real(q->data[i]);
+	}
+
+	return 0;
+}
+
+int zsl_mtx_q31_add(struct zsl_mtx_q31 *ma, struct zsl_mtx_q31 *mb,
+		    struct zsl_mtx_q31 *mc)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((ma->sz_rows != mb->sz_rows) || (mb->sz_rows != mc->sz_rows) ||
+	    (ma->sz_cols != mb->sz_cols) || (mb->sz_cols != mc->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < ma->sz_rows * ma->sz_cols; i++) {
+		mc->data[i] = zsl_q31_add(ma->data[i], mb->data[i]);
+	}
+
+	return 0;
+}
+
+int zsl_mtx_q31_mult(struct zsl_mtx_q31 *ma, struct zsl_mtx_q31 *mb,
+		     struct zsl_mtx_q31 *mc)
+{
+	size_t k = ma->sz_cols;
+	size_t n = mb->sz_cols;
+	int64_t acc;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((k != mb->sz_rows) || (mc->sz_rows != ma->sz_rows) ||
+	    (mc->sz_cols != n)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < ma->sz_rows; i++) {
+		for (size_t j = 0; j < n; j++) {
+			acc = 0;
+			for (size_t p = 0; p < k; p++) {
+				acc += ((int64_t)ma->data[(i * k) + p] *
+					mb->data[(p * n) + j]) >>
+				       ZSL_Q31_ACC_SHIFT;
+			}
+			mc->data[(i * n) + j] = zsl_q31_from_acc(acc);
+		}
+	}
+
+	return 0;
+}
+
+int zsl_mtx_q15_from_real(struct zsl_mtx *m, struct zsl_mtx_q15 *q)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((m->sz_rows != q->sz_rows) || (m->sz_cols != q->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < m->sz_rows * m->sz_cols; i++) {
+		q->data[i] = zsl_q15_from_real(m->data[i]);
+	}
+
+	return 0;
+}
+
+int zsl_mtx_q15_to_real(struct zsl_mtx_q15 *q, struct zsl_mtx *m)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((m->sz_rows != q->sz_rows) || (m->sz_cols != q->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < q->sz_rows * q->sz_cols; i++) {
+		m->data[i] = zsl_q15_to_real(q->data[i]);
+	}
+
+	return 0;
+}
+
+int zsl_mtx_q15_add(struct zsl_mtx_q15 *ma, struct zsl_mtx_q15 *mb,
+		    struct zsl_mtx_q15 *mc)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((ma->sz_rows != mb->sz_rows) || (mb->sz_rows != mc->sz_rows) ||
+	    (ma->sz_cols != mb->sz_cols) || (mb->sz_cols != mc->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < ma->sz_rows * ma->sz_cols; i++) {
+		mc->data[i] = zsl_q15_add(ma->data[i], mb->data[i]);
+	}
+
+	return 0;
+}
+
+int zsl_mtx_q15_mult(struct zsl_mtx_q15 *ma, struct zsl_mtx_q15 *mb,
+		     struct zsl_mtx_q15 *mc)
+{
+	size_t k = ma->sz_cols;
+	size_t n = mb->sz_cols;
+	int64_t acc;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((k != mb->sz_rows) || (mc->sz_rows != ma->sz_rows) ||
+	    (mc->sz_cols != n)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < ma->sz_rows; i++) {
+		for (size_t j = 0; j < n; j++) {
+			acc = 0;
+			for (size_t p = 0; p < k; p++) {
+				acc += (int32_t)ma->data[(i * k) + p] *
+				       mb->data[(p * n) + j];
+			}
+			acc = (acc + (1 << 14)) >> 15;
+			mc->data[(i * n) + j] =
+				acc > ZSL_Q15_MAX ? ZSL_Q15_MAX :
+				acc < ZSL_Q15_MIN ? ZSL_Q15_MIN :
+				(zsl_q15_t)acc;
+		}
+	}
+
+	return 0;
+}
+
+int zsl_quat_q31_from_real(struct zsl_quat *q, struct zsl_quat_q31 *qq)
+{
+	qq->r = zsl_q31_from_real(q->r);
+	qq->i = zsl_q31_from_real(q->i);
+	qq->j = zsl_q31_from_real(q->j);
+	qq->k = zsl_q31_from_real(q->k);
+
+	return 0;
+}
+
+int zsl_quat_q31_to_real(struct zsl_quat_q31 *qq, struct zsl_quat *q)
+{
+	q->r = zsl_q31_to_real(qq->r);
+	q->i = zsl_q31_to_real(qq->i);
+	q->j = zsl_q31_to_real(qq->j);
+	q->k = zsl_q31_to_real(qq->k);
+
+	return 0;
+}
+
+int zsl_quat_q31_mult(struct zsl_quat_q31 *qa, struct zsl_quat_q31 *qb,
+		      struct zsl_quat_q31 *qm)
+{
+	int64_t ar = qa->r, ai = qa->i, aj = qa->j, ak = qa->k;
+	int64_t br = qb->r, bi = qb->i, bj = qb->j, bk = qb->k;
+
+	/* Each product is shifted to 2.60 so the sum of four can't overflow,
+	 * even for non-unit inputs. */
+	qm->i = zsl_q31_sat(((((ar * bi) >> 2) + ((ai * br) >> 2) +
+			      ((aj * bk) >> 2) - ((ak * bj) >> 2)) +
+			     (1LL << 28)) >> 29);
+	qm->j = zsl_q31_sat(((((ar * bj) >> 2) - ((ai * bk) >> 2) +
+			      ((aj * br) >> 2) + ((ak * bi) >> 2)) +
+			     (1LL << 28)) >> 29);
+	qm->k = zsl_q31_sat(((((ar * bk) >> 2) + ((ai * bj) >> 2) -
+			      ((aj * bi) >> 2) + ((ak * br) >> 2)) +
+			     (1LL << 28)) >> 29);
+	qm->r = zsl_q31_sat(((((ar * br) >> 2) - ((ai * bi) >> 2) -
+			      ((aj * bj) >> 2) - ((ak * bk) >> 2)) +
+			     (1LL << 28)) >> 29);
+
+	return 0;
+}
+
+/**
+ * @brief Returns floor(sqrt(x)), using the bit-by-bit method. This needs only
+ *        shifts, adds and compares, so it stays fast on cores without a
+ *        hardware divider.
+ */
+static uint64_t zsl_fixed_isqrt(uint64_t x)
+{
+	uint64_t r = 0;
+	uint64_t b = 1ULL << 62;
+
+	while (b > x) {
+		b >>= 2;
+	}
+
+	while (b != 0) {
+		if (x >= r + b) {
+			x -= r + b;
+			r = (r >> 1) + b;
+		} else {
+			r >>= 1;
+		}
+		b >>= 2;
+	}
+
+	return r;
+}
+
+/**
+ * @brief Divides 'n' by the positive value 'd', rounding to nearest.
+ */
+static int64_t zsl_fixed_div_round(int64_t n, int64_t d)
+{
+	return (n >= 0 ? n + (d / 2) : n - (d / 2)) / d;
+}
+
+/**
+ * @brief Normalises the quaternion 'c', given as Q31 values in 64-bit
+ *        integers with a magnitude of at most 4.0, and stores it in 'q'.
+ *
+ * @return 0 on success, -EINVAL if 'c' is zero.
+ */
+static int zsl_fixed_quat_unit(int64_t c[4], struct zsl_quat_q31 *q)
+{
+	uint64_t n2 = 0;
+	int64_t norm;
+	int64_t t;
+
+	/* Square in Q29 so the sum of four squares fits in 62 bits. The norm
+	 * is then a Q29 value. */
+	for (size_t i = 0; i < 4; i++) {
+		t = c[i] / 4;
+		n2 += (uint64_t)(t * t);
+	}
+
+	norm = (int64_t)zsl_fixed_isqrt(n2);
+	if (norm == 0) {
+		return -EINVAL;
+	}
+
+	/* Q31 / Q29 needs the numerator in Q60 to give a Q31 quotient. */
+	q->r = zsl_q31_sat(zsl_fixed_div_round(c[0] * (1LL << 29), norm));
+	q->i = zsl_q31_sat(zsl_fixed_div_round(c[1] * (1LL << 29), norm));
+	q->j = zsl_q31_sat(zsl_fixed_div_round(c[2] * (1LL << 29), norm));
+	q->k = zsl_q31_sat(zsl_fixed_div_round(c[3] * (1LL << 29), norm));
+
+	return 0;
+}
+
+int zsl_quat_q31_to_unit_d(struct zsl_quat_q31 *q)
+{
+	int64_t c[4] = { q->r, q->i, q->j, q->k };
+
+	return zsl_fixed_quat_unit(c, q);
+}
+
+int zsl_quat_q31_lerp(struct zsl_quat_q31 *qa, struct zsl_quat_q31 *qb,
+		      zsl_q31_t t, struct zsl_quat_q31 *qi)
+{
+	int64_t s;
+	int64_t c[4];
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure t is between 0 and 1. */
+	if (t < 0) {
+		return -EINVAL;
+	}
+#endif
+
+	/* qi = (1 - t) * qa + t * qb. Since (1 - t) + t = 1, the sum of the
+	 * two products fits in 63 bits. */
+	s = (1LL << 31) - t;
+	c[0] = ((s * qa->r) + ((int64_t)t * qb->r) + (1LL << 30)) >> 31;
+	c[1] = ((s * qa->i) + ((int64_t)t * qb->i) + (1LL << 30)) >> 31;
+	c[2] = ((s * qa->j) + ((int64_t)t * qb->j) + (1LL << 30)) >> 31;
+	c[3] = ((s * qa->k) + ((int64_t)t * qb->k) + (1LL << 30)) >> 31;
+
+	return zsl_fixed_quat_unit(c, qi);
+}
+
+int zsl_quat_q31_from_ang_vel(struct zsl_vec_q31 *wt,
+			      struct zsl_quat_q31 *qin,
+			      struct zsl_quat_q31 *qout)
+{
+	int64_t wx, wy, wz;
+	int64_t r, i, j, k;
+	int64_t c[4];
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure the angular velocity is a tridimensional vector. */
+	if (wt->sz != 3) {
+		return -EINVAL;
+	}
+#endif
+
+	wx = wt->data[0];
+	wy = wt->data[1];
+	wz = wt->data[2];
+	r = qin->r;
+	i = qin->i;
+	j = qin->j;
+	k = qin->k;
+
+	/* qout = qin + 0.5 * (w * t) x qin, as in zsl_quat_from_ang_vel. The
+	 * (0, w * t) x qin product has three terms per component, each of up
+	 * to 2^62, so their sum could overflow 64 bits if 'qin' isn't a unit
+	 * quaternion. Each term is halved first, which applies the 0.5
+	 * factor and keeps the sum below 2^63 for any input, and the shift
+	 * by 31 applies the Q31 scaling. */
+	c[0] = r + ((-((wx * i) >> 1) - ((wy * j) >> 1) - ((wz * k) >> 1) +
+		     (1LL << 30)) >> 31);
+	c[1] = i + ((((wx * r) >> 1) + ((wy * k) >> 1) - ((wz * j) >> 1) +
+		     (1LL << 30)) >> 31);
+	c[2] = j + ((-((wx * k) >> 1) + ((wy * r) >> 1) + ((wz * i) >> 1) +
+		     (1LL << 30)) >> 31);
+	c[3] = k + ((((wx * j) >> 1) - ((wy * i) >> 1) + ((wz * r) >> 1) +
+		     (1LL << 30)) >> 31);
+
+	return zsl_fixed_quat_unit(c, qout);
+}
@@ -9,6 +9,7 @@
 #include <zephyr/kernel.h>
 #include <zsl/zsl.h>
 #include <zsl/interp.h>
+#include <zsl/matrices.h>
 
 int
 zsl_interp_lerp(zsl_real_t v0, zsl_real_t v1, zsl_real_t t, zsl_real_t *v)
@@ -255,13 +256,19 @@ zsl_interp_cubic_calc(struct zsl_interp_xyc xyc[], size_t n, zsl_real_t yp1,
 		  zsl_real_t ypn)
 {
 	int rc;
-	int i;
-	int k;
-	zsl_real_t sigma;
-	zsl_real_t p;
-	zsl_real_t qn;
-	zsl_real_t un;
-	zsl_real_t *u;
+	zsl_real_t h0;
+	zsl_real_t h1;
+	zsl_real_t *buf;
+	zsl_real_t *ti;
+	struct zsl_mtx_band t = {
+		.sz_rows = n,
+		.sz_cols = n,
+		.kl = 1,
+		.ku = 1
+	};
+	struct zsl_vec y2 = {
+		.sz = n
+	};
 
 	/* Make sure we have at least three values. */
 	if (n < 3) {
@@ -269,50 +276,72 @@ zsl_interp_cubic_calc(struct zsl_interp_xyc xyc[], size_t n, zsl_real_t yp1,
 		goto err;
 	}
 
-	u = (zsl_real_t *)k_malloc((n - 1) * sizeof(zsl_real_t));
-	if (u == NULL) {
+	/* The tridiagonal system for the second derivatives, three values
+	 * per row, followed by its right-hand side. */
+	buf = (zsl_real_t *)k_malloc(4 * n * sizeof(zsl_real_t));
+	if (buf == NULL) {
 		rc = -ENOMEM;
 		goto err;
 	}
-
+	t.data = buf;
+	y2.data = &buf[3 * n];
+
+	/* First row: either y2[0] = 0 for a natural spline, or the first
+	 * derivative at x[0] is yp1. */
+	h1 = xyc[1].x - xyc[0].x;
+	ti = &buf[0];
+	ti[0] = 0.0;
 	if (yp1 > 0.99e30) {
-		xyc[0].y2 = u[0] = 0.0;
+		ti[1] = 1.0;
+		ti[2] = 0.0;
+		y2.data[0] = 0.0;
 	} else {
-		xyc[0].y2 = -0.5;
-		u[0] = (3.0 / (xyc[1].x - xyc[0].x)) *
-		       ((xyc[1].y - xyc[0].y) / (xyc[1].x - xyc[0].x) - yp1);
+		ti[1] = 2.0 * h1;
+		ti[2] = h1;
+		y2.data[0] = 6.0 * ((xyc[1].y - xyc[0].y) / h1 - yp1);
 	}
 
-	for (i = 1; i < n - 1; i++) {
-		/* Break out common values. */
-		zsl_real_t x_i_im1 = xyc[i].x - xyc[i - 1].x;
-		zsl_real_t x_ip1_im1 = xyc[i + 1].x - xyc[i - 1].x;
-		sigma = x_i_im1 / x_ip1_im1;
-		p = sigma * xyc[i - 1].y2 + 2.0;
-		xyc[i].y2 = (sigma - 1.0) / p;
-		u[i] = (xyc[i + 1].y - xyc[i].y) / (xyc[i + 1].x - xyc[i].x) -
-		       (xyc[i].y - xyc[i - 1].y) / (x_i_im1);
-		u[i] = (6.0 * u[i] / (x_ip1_im1) - sigma * u[i - 1]) / p;
+	/* Continuity of the first derivative at every interior point:
+	 * h0 * y2[i - 1] + 2 * (h0 + h1) * y2[i] + h1 * y2[i + 1] =
+	 * 6 * (slope to the right - slope to the left). */
+	for (size_t i = 1; i < n - 1; i++) {
+		h0 = h1;
+		h1 = xyc[i + 1].x - xyc[i].x;
+		ti = &buf[i * 3];
+		ti[0] = h0;
+		ti[1] = 2.0 * (h0 + h1);
+		ti[2] = h1;
+		y2.data[i] = 6.0 * ((xyc[i + 1].y - xyc[i].y) / h1 -
+				    (xyc[i].y - xyc[i - 1].y) / h0);
 	}
 
+	/* Last row: either y2[n - 1] = 0, or the first derivative at x[n - 1]
+	 * is ypn. */
+	ti = &buf[(n - 1) * 3];
+	ti[2] = 0.0;
 	if (ypn > 0.99e30) {
-		qn = un = 0.0;
+		ti[0] = 0.0;
+		ti[1] = 1.0;
+		y2.data[n - 1] = 0.0;
 	} else {
-		qn = 0.5;
-		un = (3.0 / (xyc[n - 1].x - xyc[n - 2].x)) *
-		     (ypn - (xyc[n - 1].y -
-			     xyc[n - 2].y) / (xyc[n - 1].x - xyc[n - 2].x));
+		ti[0] = h1;
+		ti[1] = 2.0 * h1;
+		y2.data[n - 1] = 6.0 * (ypn - (xyc[n - 1].y - xyc[n - 2].y) /
+					h1);
 	}
 
-	xyc[n - 1].y2 = (un - qn * u[n - 2]) / (qn * xyc[n - 2].y2 + 1.0);
-
-	for (k = n - 2; k >= 0; k--) {
-		xyc[k].y2 = xyc[k].y2 * xyc[k + 1].y2 + u[k];
+	/* The system is diagonally dominant, so the O(n) Thomas algorithm
+	 * needs no pivoting. */
+	rc = zsl_mtx_band_tridiag_solve(&t, &y2, &y2);
+	if (rc == 0) {
+		for (size_t i = 0; i < n; i++) {
+			xyc[i].y2 = y2.data[i];
+		}
 	}
 
-	k_free(u);
+	k_free(buf);
 
-	return 0;
+	return rc;
 err:
 	return rc;
 }
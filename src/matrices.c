@@ -10,6 +10,13 @@
 #include <string.h>
 #include <zsl/zsl.h>
 #include <zsl/matrices.h>
+#include <zsl/parallel.h>
+#include "matrices_lapack.h"
+
+/* Enable optimised x86 SSE2/AVX2 kernels if available. */
+#if (CONFIG_ZSL_PLATFORM_OPT == 3)
+#include <zsl/asm/x86/asm_x86.h>
+#endif
 
 /*
  * WARNING: Work in progress!
@@ -95,6 +102,73 @@ zsl_mtx_copy(struct zsl_mtx *mdest, struct zsl_mtx *msrc)
 	return 0;
 }
 
+int
+zsl_ws_init(struct zsl_workspace *ws, void *buf, size_t bytes)
+{
+	size_t pad;
+
+	if (buf == NULL) {
+		return -EINVAL;
+	}
+
+	/* Skip any leading bytes that would misalign the first element. */
+	pad = (sizeof(zsl_real_t) - ((uintptr_t)buf % sizeof(zsl_real_t))) %
+	      sizeof(zsl_real_t);
+	if (bytes < pad) {
+		return -EINVAL;
+	}
+
+	ws->data = (zsl_real_t *)((uint8_t *)buf + pad);
+	ws->sz = (bytes - pad) / sizeof(zsl_real_t);
+	ws->used = 0;
+
+	return 0;
+}
+
+int
+zsl_ws_reset(struct zsl_workspace *ws)
+{
+	ws->used = 0;
+
+	return 0;
+}
+
+size_t
+zsl_ws_avail(struct zsl_workspace *ws)
+{
+	return (ws->sz - ws->used) * sizeof(zsl_real_t);
+}
+
+int
+zsl_ws_mtx(struct zsl_workspace *ws, struct zsl_mtx *m, size_t rows,
+	   size_t cols)
+{
+	if (rows * cols > ws->sz - ws->used) {
+		return -ENOMEM;
+	}
+
+	m->sz_rows = rows;
+	m->sz_cols = cols;
+	m->data = ws->data + ws->used;
+	ws->used += rows * cols;
+
+	return 0;
+}
+
+int
+zsl_ws_vec(struct zsl_workspace *ws, struct zsl_vec *v, size_t sz)
+{
+	if (sz > ws->sz - ws->used) {
+		return -ENOMEM;
+	}
+
+	v->sz = sz;
+	v->data = ws->data + ws->used;
+	ws->used += sz;
+
+	return 0;
+}
+
 int
 zsl_mtx_get(struct zsl_mtx *m, size_t i, size_t j, zsl_real_t *x)
 {
@@ -187,1001 +261,1152 @@ zsl_mtx_set_col(struct zsl_mtx *m, size_t j, zsl_real_t *v)
 	return 0;
 }
 
+/* Element (i, j) of view 'v'. */
+#define ZSL_MTX_VIEW_AT(v, i, j) \
+	((v)->data[((i) * (v)->row_stride) + ((j) * (v)->col_stride)])
+
 int
-zsl_mtx_unary_op(struct zsl_mtx *m, zsl_mtx_unary_op_t op)
+zsl_mtx_view_init(struct zsl_mtx *m, struct zsl_mtx_view *v)
 {
-	/* Execute the unary operation component by component. */
-	for (size_t i = 0; i < m->sz_cols * m->sz_rows; i++) {
-		switch (op) {
-		case ZSL_MTX_UNARY_OP_INCREMENT:
-			m->data[i] += 1.0;
-			break;
-		case ZSL_MTX_UNARY_OP_DECREMENT:
-			m->data[i] -= 1.0;
-			break;
-		case ZSL_MTX_UNARY_OP_NEGATIVE:
-			m->data[i] = -m->data[i];
-			break;
-		case ZSL_MTX_UNARY_OP_ROUND:
-			m->data[i] = ZSL_ROUND(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_ABS:
-			m->data[i] = ZSL_ABS(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_FLOOR:
-			m->data[i] = ZSL_FLOOR(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_CEIL:
-			m->data[i] = ZSL_CEIL(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_EXP:
-			m->data[i] = ZSL_EXP(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_LOG:
-			m->data[i] = ZSL_LOG(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_LOG10:
-			m->data[i] = ZSL_LOG10(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_SQRT:
-			m->data[i] = ZSL_SQRT(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_SIN:
-			m->data[i] = ZSL_SIN(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_COS:
-			m->data[i] = ZSL_COS(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_TAN:
-			m->data[i] = ZSL_TAN(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_ASIN:
-			m->data[i] = ZSL_ASIN(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_ACOS:
-			m->data[i] = ZSL_ACOS(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_ATAN:
-			m->data[i] = ZSL_ATAN(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_SINH:
-			m->data[i] = ZSL_SINH(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_COSH:
-			m->data[i] = ZSL_COSH(m->data[i]);
-			break;
-		case ZSL_MTX_UNARY_OP_TANH:
-			m->data[i] = ZSL_TANH(m->data[i]);
-			break;
-		default:
-			/* Not yet implemented! */
-			return -ENOSYS;
-		}
-	}
+	v->sz_rows = m->sz_rows;
+	v->sz_cols = m->sz_cols;
+	v->row_stride = m->sz_cols;
+	v->col_stride = 1;
+	v->data = m->data;
 
 	return 0;
 }
 
 int
-zsl_mtx_unary_func(struct zsl_mtx *m, zsl_mtx_unary_fn_t fn)
+zsl_mtx_view_block(struct zsl_mtx_view *src, struct zsl_mtx_view *v,
+		   size_t i, size_t j, size_t rows, size_t cols)
 {
-	int rc;
+	if ((i + rows > src->sz_rows) || (j + cols > src->sz_cols)) {
+		return -EINVAL;
+	}
 
-	for (size_t i = 0; i < m->sz_rows; i++) {
-		for (size_t j = 0; j < m->sz_cols; j++) {
-			/* If fn is NULL, do nothing. */
-			if (fn != NULL) {
-				rc = fn(m, i, j);
-				if (rc) {
-					return rc;
-				}
-			}
-		}
+	/* An empty block may start one past the end of 'src', so only move
+	 * the data pointer when there is something to reference. */
+	v->data = src->data;
+	if (rows != 0 && cols != 0) {
+		v->data = &ZSL_MTX_VIEW_AT(src, i, j);
 	}
+	v->sz_rows = rows;
+	v->sz_cols = cols;
+	v->row_stride = src->row_stride;
+	v->col_stride = src->col_stride;
 
 	return 0;
 }
 
 int
-zsl_mtx_binary_op(struct zsl_mtx *ma, struct zsl_mtx *mb, struct zsl_mtx *mc,
-		  zsl_mtx_binary_op_t op)
+zsl_mtx_view_row(struct zsl_mtx_view *src, struct zsl_mtx_view *v, size_t i)
 {
-#if CONFIG_ZSL_BOUNDS_CHECKS
-	if ((ma->sz_rows != mb->sz_rows) || (mb->sz_rows != mc->sz_rows) ||
-	    (ma->sz_cols != mb->sz_cols) || (mb->sz_cols != mc->sz_cols)) {
-		return -EINVAL;
-	}
-#endif
-
-	/* Execute the binary operation component by component. */
-	for (size_t i = 0; i < ma->sz_cols * ma->sz_rows; i++) {
-		switch (op) {
-		case ZSL_MTX_BINARY_OP_ADD:
-			mc->data[i] = ma->data[i] + mb->data[i];
-			break;
-		case ZSL_MTX_BINARY_OP_SUB:
-			mc->data[i] = ma->data[i] - mb->data[i];
-			break;
-		case ZSL_MTX_BINARY_OP_MULT:
-			mc->data[i] = ma->data[i] * mb->data[i];
-			break;
-		case ZSL_MTX_BINARY_OP_DIV:
-			if (mb->data[i] == 0.0) {
-				mc->data[i] = 0.0;
-			} else {
-				mc->data[i] = ma->data[i] / mb->data[i];
-			}
-			break;
-		case ZSL_MTX_BINARY_OP_MEAN:
-			mc->data[i] = (ma->data[i] + mb->data[i]) / 2.0;
-		case ZSL_MTX_BINARY_OP_EXPON:
-			mc->data[i] = ZSL_POW(ma->data[i], mb->data[i]);
-		case ZSL_MTX_BINARY_OP_MIN:
-			mc->data[i] = ma->data[i] < mb->data[i] ?
-				      ma->data[i] : mb->data[i];
-		case ZSL_MTX_BINARY_OP_MAX:
-			mc->data[i] = ma->data[i] > mb->data[i] ?
-				      ma->data[i] : mb->data[i];
-		case ZSL_MTX_BINARY_OP_EQUAL:
-			mc->data[i] = ma->data[i] == mb->data[i] ? 1.0 : 0.0;
-		case ZSL_MTX_BINARY_OP_NEQUAL:
-			mc->data[i] = ma->data[i] != mb->data[i] ? 1.0 : 0.0;
-		case ZSL_MTX_BINARY_OP_LESS:
-			mc->data[i] = ma->data[i] < mb->data[i] ? 1.0 : 0.0;
-		case ZSL_MTX_BINARY_OP_GREAT:
-			mc->data[i] = ma->data[i] > mb->data[i] ? 1.0 : 0.0;
-		case ZSL_MTX_BINARY_OP_LEQ:
-			mc->data[i] = ma->data[i] <= mb->data[i] ? 1.0 : 0.0;
-		case ZSL_MTX_BINARY_OP_GEQ:
-			mc->data[i] = ma->data[i] >= mb->data[i] ? 1.0 : 0.0;
-		default:
-			/* Not yet implemented! */
-			return -ENOSYS;
-		}
-	}
-
-	return 0;
+	return zsl_mtx_view_block(src, v, i, 0, 1, src->sz_cols);
 }
 
 int
-zsl_mtx_binary_func(struct zsl_mtx *ma, struct zsl_mtx *mb,
-		    struct zsl_mtx *mc, zsl_mtx_binary_fn_t fn)
+zsl_mtx_view_col(struct zsl_mtx_view *src, struct zsl_mtx_view *v, size_t j)
 {
-	int rc;
+	return zsl_mtx_view_block(src, v, 0, j, src->sz_rows, 1);
+}
 
-#if CONFIG_ZSL_BOUNDS_CHECKS
-	if ((ma->sz_rows != mb->sz_rows) || (mb->sz_rows != mc->sz_rows) ||
-	    (ma->sz_cols != mb->sz_cols) || (mb->sz_cols != mc->sz_cols)) {
-		return -EINVAL;
-	}
-#endif
+int
+zsl_mtx_view_diag(struct zsl_mtx_view *src, struct zsl_mtx_view *v)
+{
+	size_t k = src->sz_rows < src->sz_cols ? src->sz_rows : src->sz_cols;
 
-	for (size_t i = 0; i < ma->sz_rows; i++) {
-		for (size_t j = 0; j < ma->sz_cols; j++) {
-			/* If fn is NULL, do nothing. */
-			if (fn != NULL) {
-				rc = fn(ma, mb, mc, i, j);
-				if (rc) {
-					return rc;
-				}
-			}
-		}
-	}
+	v->data = src->data;
+	v->row_stride = src->row_stride + src->col_stride;
+	v->col_stride = 1;
+	v->sz_rows = k;
+	v->sz_cols = 1;
 
 	return 0;
 }
 
 int
-zsl_mtx_add(struct zsl_mtx *ma, struct zsl_mtx *mb, struct zsl_mtx *mc)
+zsl_mtx_view_trans(struct zsl_mtx_view *src, struct zsl_mtx_view *v)
 {
-	return zsl_mtx_binary_op(ma, mb, mc, ZSL_MTX_BINARY_OP_ADD);
-}
+	size_t rows = src->sz_rows;
+	size_t rs = src->row_stride;
 
-int
-zsl_mtx_add_d(struct zsl_mtx *ma, struct zsl_mtx *mb)
-{
-	return zsl_mtx_binary_op(ma, mb, ma, ZSL_MTX_BINARY_OP_ADD);
+	v->data = src->data;
+	v->sz_rows = src->sz_cols;
+	v->sz_cols = rows;
+	v->row_stride = src->col_stride;
+	v->col_stride = rs;
+
+	return 0;
 }
 
 int
-zsl_mtx_sum_rows_d(struct zsl_mtx *m, size_t i, size_t j)
+zsl_mtx_view_get(struct zsl_mtx_view *v, size_t i, size_t j, zsl_real_t *x)
 {
 #if CONFIG_ZSL_BOUNDS_CHECKS
-	if ((i >= m->sz_rows) || (j >= m->sz_rows)) {
+	if ((i >= v->sz_rows) || (j >= v->sz_cols)) {
 		return -EINVAL;
 	}
 #endif
 
-	/* Add row j to row i, element by element. */
-	for (size_t x = 0; x < m->sz_cols; x++) {
-		m->data[(i * m->sz_cols) + x] += m->data[(j * m->sz_cols) + x];
-	}
+	*x = ZSL_MTX_VIEW_AT(v, i, j);
 
 	return 0;
 }
 
-int zsl_mtx_sum_rows_scaled_d(struct zsl_mtx *m,
-			      size_t i, size_t j, zsl_real_t s)
+int
+zsl_mtx_view_set(struct zsl_mtx_view *v, size_t i, size_t j, zsl_real_t x)
 {
 #if CONFIG_ZSL_BOUNDS_CHECKS
-	if ((i >= m->sz_rows) || (j >= m->sz_cols)) {
+	if ((i >= v->sz_rows) || (j >= v->sz_cols)) {
 		return -EINVAL;
 	}
 #endif
 
-	/* Set the values in row 'i' to 'i[n] += j[n] * s' . */
-	for (size_t x = 0; x < m->sz_cols; x++) {
-		m->data[(i * m->sz_cols) + x] +=
-			(m->data[(j * m->sz_cols) + x] * s);
-	}
+	ZSL_MTX_VIEW_AT(v, i, j) = x;
 
 	return 0;
 }
 
 int
-zsl_mtx_sub(struct zsl_mtx *ma, struct zsl_mtx *mb, struct zsl_mtx *mc)
+zsl_mtx22_mult(const zsl_real_t *a, const zsl_real_t *b, zsl_real_t *c)
 {
-	return zsl_mtx_binary_op(ma, mb, mc, ZSL_MTX_BINARY_OP_SUB);
+	zsl_real_t c00, c01;
+	zsl_real_t c10, c11;
+
+	c00 = a[0] * b[0] + a[1] * b[2];
+	c01 = a[0] * b[1] + a[1] * b[3];
+	c10 = a[2] * b[0] + a[3] * b[2];
+	c11 = a[2] * b[1] + a[3] * b[3];
+
+	c[0] = c00;
+	c[1] = c01;
+	c[2] = c10;
+	c[3] = c11;
+
+	return 0;
 }
 
 int
-zsl_mtx_sub_d(struct zsl_mtx *ma, struct zsl_mtx *mb)
+zsl_mtx33_mult(const zsl_real_t *a, const zsl_real_t *b, zsl_real_t *c)
 {
-	return zsl_mtx_binary_op(ma, mb, ma, ZSL_MTX_BINARY_OP_SUB);
+	zsl_real_t c00, c01, c02;
+	zsl_real_t c10, c11, c12;
+	zsl_real_t c20, c21, c22;
+
+	c00 = a[0] * b[0] + a[1] * b[3] + a[2] * b[6];
+	c01 = a[0] * b[1] + a[1] * b[4] + a[2] * b[7];
+	c02 = a[0] * b[2] + a[1] * b[5] + a[2] * b[8];
+	c10 = a[3] * b[0] + a[4] * b[3] + a[5] * b[6];
+	c11 = a[3] * b[1] + a[4] * b[4] + a[5] * b[7];
+	c12 = a[3] * b[2] + a[4] * b[5] + a[5] * b[8];
+	c20 = a[6] * b[0] + a[7] * b[3] + a[8] * b[6];
+	c21 = a[6] * b[1] + a[7] * b[4] + a[8] * b[7];
+	c22 = a[6] * b[2] + a[7] * b[5] + a[8] * b[8];
+
+	c[0] = c00;
+	c[1] = c01;
+	c[2] = c02;
+	c[3] = c10;
+	c[4] = c11;
+	c[5] = c12;
+	c[6] = c20;
+	c[7] = c21;
+	c[8] = c22;
+
+	return 0;
 }
 
 int
-zsl_mtx_mult(struct zsl_mtx *ma, struct zsl_mtx *mb, struct zsl_mtx *mc)
+zsl_mtx44_mult(const zsl_real_t *a, const zsl_real_t *b, zsl_real_t *c)
 {
-#if CONFIG_ZSL_BOUNDS_CHECKS
-	/* Ensure that ma has the same number as columns as mb has rows. */
-	if (ma->sz_cols != mb->sz_rows) {
-		return -EINVAL;
-	}
+	zsl_real_t c00, c01, c02, c03;
+	zsl_real_t c10, c11, c12, c13;
+	zsl_real_t c20, c21, c22, c23;
+	zsl_real_t c30, c31, c32, c33;
+
+	c00 = a[0] * b[0] + a[1] * b[4] + a[2] * b[8] + a[3] * b[12];
+	c01 = a[0] * b[1] + a[1] * b[5] + a[2] * b[9] + a[3] * b[13];
+	c02 = a[0] * b[2] + a[1] * b[6] + a[2] * b[10] + a[3] * b[14];
+	c03 = a[0] * b[3] + a[1] * b[7] + a[2] * b[11] + a[3] * b[15];
+	c10 = a[4] * b[0] + a[5] * b[4] + a[6] * b[8] + a[7] * b[12];
+	c11 = a[4] * b[1] + a[5] * b[5] + a[6] * b[9] + a[7] * b[13];
+	c12 = a[4] * b[2] + a[5] * b[6] + a[6] * b[10] + a[7] * b[14];
+	c13 = a[4] * b[3] + a[5] * b[7] + a[6] * b[11] + a[7] * b[15];
+	c20 = a[8] * b[0] + a[9] * b[4] + a[10] * b[8] + a[11] * b[12];
+	c21 = a[8] * b[1] + a[9] * b[5] + a[10] * b[9] + a[11] * b[13];
+	c22 = a[8] * b[2] + a[9] * b[6] + a[10] * b[10] + a[11] * b[14];
+	c23 = a[8] * b[3] + a[9] * b[7] + a[10] * b[11] + a[11] * b[15];
+	c30 = a[12] * b[0] + a[13] * b[4] + a[14] * b[8] + a[15] * b[12];
+	c31 = a[12] * b[1] + a[13] * b[5] + a[14] * b[9] + a[15] * b[13];
+	c32 = a[12] * b[2] + a[13] * b[6] + a[14] * b[10] + a[15] * b[14];
+	c33 = a[12] * b[3] + a[13] * b[7] + a[14] * b[11] + a[15] * b[15];
+
+	c[0] = c00;
+	c[1] = c01;
+	c[2] = c02;
+	c[3] = c03;
+	c[4] = c10;
+	c[5] = c11;
+	c[6] = c12;
+	c[7] = c13;
+	c[8] = c20;
+	c[9] = c21;
+	c[10] = c22;
+	c[11] = c23;
+	c[12] = c30;
+	c[13] = c31;
+	c[14] = c32;
+	c[15] = c33;
 
-	/* Ensure that mc has ma rows and mb cols */
-	if ((mc->sz_rows != ma->sz_rows) || (mc->sz_cols != mb->sz_cols)) {
-		return -EINVAL;
-	}
-#endif
+	return 0;
+}
+
+int
+zsl_mtx22_mult_vec(const zsl_real_t *a, const zsl_real_t *v, zsl_real_t *w)
+{
+	zsl_real_t w0, w1;
 
-	ZSL_MATRIX_DEF(ma_copy, ma->sz_rows, ma->sz_cols);
-	ZSL_MATRIX_DEF(mb_copy, mb->sz_rows, mb->sz_cols);
-	zsl_mtx_copy(&ma_copy, ma);
-	zsl_mtx_copy(&mb_copy, mb);
+	w0 = a[0] * v[0] + a[1] * v[1];
+	w1 = a[2] * v[0] + a[3] * v[1];
 
-	for (size_t i = 0; i < ma_copy.sz_rows; i++) {
-		for (size_t j = 0; j < mb_copy.sz_cols; j++) {
-			mc->data[j + i * mb_copy.sz_cols] = 0;
-			for (size_t k = 0; k < ma_copy.sz_cols; k++) {
-				mc->data[j + i * mb_copy.sz_cols] +=
-					ma_copy.data[k + i * ma_copy.sz_cols] *
-					mb_copy.data[j + k * mb_copy.sz_cols];
-			}
-		}
-	}
+	w[0] = w0;
+	w[1] = w1;
 
 	return 0;
 }
 
 int
-zsl_mtx_mult_d(struct zsl_mtx *ma, struct zsl_mtx *mb)
+zsl_mtx33_mult_vec(const zsl_real_t *a, const zsl_real_t *v, zsl_real_t *w)
 {
-#if CONFIG_ZSL_BOUNDS_CHECKS
-	/* Ensure that ma has the same number as columns as mb has rows. */
-	if (ma->sz_cols != mb->sz_rows) {
-		return -EINVAL;
-	}
+	zsl_real_t w0, w1, w2;
 
-	/* Ensure that mb is a square matrix. */
-	if (mb->sz_rows != mb->sz_cols) {
-		return -EINVAL;
-	}
-#endif
+	w0 = a[0] * v[0] + a[1] * v[1] + a[2] * v[2];
+	w1 = a[3] * v[0] + a[4] * v[1] + a[5] * v[2];
+	w2 = a[6] * v[0] + a[7] * v[1] + a[8] * v[2];
 
-	zsl_mtx_mult(ma, mb, ma);
+	w[0] = w0;
+	w[1] = w1;
+	w[2] = w2;
 
 	return 0;
 }
 
 int
-zsl_mtx_scalar_mult_d(struct zsl_mtx *m, zsl_real_t s)
+zsl_mtx44_mult_vec(const zsl_real_t *a, const zsl_real_t *v, zsl_real_t *w)
 {
-	for (size_t i = 0; i < m->sz_rows * m->sz_cols; i++) {
-		m->data[i] *= s;
-	}
+	zsl_real_t w0, w1, w2, w3;
+
+	w0 = a[0] * v[0] + a[1] * v[1] + a[2] * v[2] + a[3] * v[3];
+	w1 = a[4] * v[0] + a[5] * v[1] + a[6] * v[2] + a[7] * v[3];
+	w2 = a[8] * v[0] + a[9] * v[1] + a[10] * v[2] + a[11] * v[3];
+	w3 = a[12] * v[0] + a[13] * v[1] + a[14] * v[2] + a[15] * v[3];
+
+	w[0] = w0;
+	w[1] = w1;
+	w[2] = w2;
+	w[3] = w3;
 
 	return 0;
 }
 
 int
-zsl_mtx_scalar_mult_row_d(struct zsl_mtx *m, size_t i, zsl_real_t s)
+zsl_mtx22_trans(const zsl_real_t *a, zsl_real_t *b)
 {
-#if CONFIG_ZSL_BOUNDS_CHECKS
-	if (i >= m->sz_rows) {
-		return -EINVAL;
-	}
-#endif
+	zsl_real_t t;
 
-	for (size_t k = 0; k < m->sz_cols; k++) {
-		m->data[(i * m->sz_cols) + k] *= s;
-	}
+	/* Copy the diagonal, then swap each pair of opposite elements, so
+	 * that 'b' may be the same array as 'a'. */
+	b[0] = a[0];
+	b[3] = a[3];
+	t = a[1];
+	b[1] = a[2];
+	b[2] = t;
 
 	return 0;
 }
 
 int
-zsl_mtx_trans(struct zsl_mtx *ma, struct zsl_mtx *mb)
+zsl_mtx33_trans(const zsl_real_t *a, zsl_real_t *b)
 {
-#if CONFIG_ZSL_BOUNDS_CHECKS
-	/* Ensure that ma and mb have the same shape. */
-	if ((ma->sz_rows != mb->sz_cols) || (ma->sz_cols != mb->sz_rows)) {
-		return -EINVAL;
-	}
-#endif
+	zsl_real_t t;
+
+	/* Copy the diagonal, then swap each pair of opposite elements, so
+	 * that 'b' may be the same array as 'a'. */
+	b[0] = a[0];
+	b[4] = a[4];
+	b[8] = a[8];
+	t = a[1];
+	b[1] = a[3];
+	b[3] = t;
+	t = a[2];
+	b[2] = a[6];
+	b[6] = t;
+	t = a[5];
+	b[5] = a[7];
+	b[7] = t;
 
-	zsl_real_t d[ma->sz_cols];
+	return 0;
+}
 
-	for (size_t i = 0; i < ma->sz_rows; i++) {
-		zsl_mtx_get_row(ma, i, d);
-		zsl_mtx_set_col(mb, i, d);
-	}
+int
+zsl_mtx44_trans(const zsl_real_t *a, zsl_real_t *b)
+{
+	zsl_real_t t;
+
+	/* Copy the diagonal, then swap each pair of opposite elements, so
+	 * that 'b' may be the same array as 'a'. */
+	b[0] = a[0];
+	b[5] = a[5];
+	b[10] = a[10];
+	b[15] = a[15];
+	t = a[1];
+	b[1] = a[4];
+	b[4] = t;
+	t = a[2];
+	b[2] = a[8];
+	b[8] = t;
+	t = a[3];
+	b[3] = a[12];
+	b[12] = t;
+	t = a[6];
+	b[6] = a[9];
+	b[9] = t;
+	t = a[7];
+	b[7] = a[13];
+	b[13] = t;
+	t = a[11];
+	b[11] = a[14];
+	b[14] = t;
 
 	return 0;
 }
 
 int
-zsl_mtx_adjoint_3x3(struct zsl_mtx *m, struct zsl_mtx *ma)
+zsl_mtx22_inv(const zsl_real_t *a, zsl_real_t *b)
 {
-	/* Make sure this is a square matrix. */
-	if ((m->sz_rows != m->sz_cols) || (ma->sz_rows != ma->sz_cols)) {
-		return -EINVAL;
-	}
+	zsl_real_t d = a[0] * a[3] - a[1] * a[2];
+	zsl_real_t a0 = a[0];
 
-#if CONFIG_ZSL_BOUNDS_CHECKS
-	/* Make sure this is a 3x3 matrix. */
-	if ((m->sz_rows != 3) || (ma->sz_rows != 3)) {
-		return -EINVAL;
+	if (d == 0.0) {
+		return -ESINGULAR;
 	}
-#endif
-
-	/*
-	 * 3x3 matrix element to array table:
-	 *
-	 * 1,1 = 0  1,2 = 1  1,3 = 2
-	 * 2,1 = 3  2,2 = 4  2,3 = 5
-	 * 3,1 = 6  3,2 = 7  3,3 = 8
-	 */
-
-	ma->data[0] = m->data[4] * m->data[8] - m->data[7] * m->data[5];
-	ma->data[1] = m->data[7] * m->data[2] - m->data[1] * m->data[8];
-	ma->data[2] = m->data[1] * m->data[5] - m->data[4] * m->data[2];
-
-	ma->data[3] = m->data[6] * m->data[5] - m->data[3] * m->data[8];
-	ma->data[4] = m->data[0] * m->data[8] - m->data[6] * m->data[2];
-	ma->data[5] = m->data[3] * m->data[2] - m->data[0] * m->data[5];
 
-	ma->data[6] = m->data[3] * m->data[7] - m->data[6] * m->data[4];
-	ma->data[7] = m->data[6] * m->data[1] - m->data[0] * m->data[7];
-	ma->data[8] = m->data[0] * m->data[4] - m->data[3] * m->data[1];
+	d = 1.0 / d;
+	b[0] = a[3] * d;
+	b[1] = -a[1] * d;
+	b[2] = -a[2] * d;
+	b[3] = a0 * d;
 
 	return 0;
 }
 
 int
-zsl_mtx_adjoint(struct zsl_mtx *m, struct zsl_mtx *ma)
+zsl_mtx33_inv(const zsl_real_t *a, zsl_real_t *b)
 {
-	/* Shortcut for 3x3 matrices. */
-	if (m->sz_rows == 3) {
-		return zsl_mtx_adjoint_3x3(m, ma);
-	}
-
-#if CONFIG_ZSL_BOUNDS_CHECKS
-	/* Make sure this is a square matrix. */
-	if (m->sz_rows != m->sz_cols) {
-		return -EINVAL;
-	}
-#endif
-
-	zsl_real_t sign;
+	zsl_real_t c00, c01, c02, c10, c11, c12, c20, c21, c22;
 	zsl_real_t d;
-	ZSL_MATRIX_DEF(mr, (m->sz_cols - 1), (m->sz_cols - 1));
 
-	for (size_t i = 0; i < m->sz_cols; i++) {
-		for (size_t j = 0; j < m->sz_cols; j++) {
-			sign = 1.0;
-			if ((i + j) % 2 != 0) {
-				sign = -1.0;
-			}
-			zsl_mtx_reduce(m, &mr, i, j);
-			zsl_mtx_deter(&mr, &d);
-			d *= sign;
-			zsl_mtx_set(ma, i, j, d);
-		}
+	/* Cofactors, already transposed into the adjoint. */
+	c00 = a[4] * a[8] - a[5] * a[7];
+	c01 = a[2] * a[7] - a[1] * a[8];
+	c02 = a[1] * a[5] - a[2] * a[4];
+	c10 = a[5] * a[6] - a[3] * a[8];
+	c11 = a[0] * a[8] - a[2] * a[6];
+	c12 = a[2] * a[3] - a[0] * a[5];
+	c20 = a[3] * a[7] - a[4] * a[6];
+	c21 = a[1] * a[6] - a[0] * a[7];
+	c22 = a[0] * a[4] - a[1] * a[3];
+
+	/* Expand the determinant along the first column. */
+	d = a[0] * c00 + a[3] * c01 + a[6] * c02;
+	if (d == 0.0) {
+		return -ESINGULAR;
 	}
 
+	d = 1.0 / d;
+	b[0] = c00 * d;
+	b[1] = c01 * d;
+	b[2] = c02 * d;
+	b[3] = c10 * d;
+	b[4] = c11 * d;
+	b[5] = c12 * d;
+	b[6] = c20 * d;
+	b[7] = c21 * d;
+	b[8] = c22 * d;
+
 	return 0;
 }
 
-#ifndef CONFIG_ZSL_SINGLE_PRECISION
-int zsl_mtx_vec_wedge(struct zsl_mtx *m, struct zsl_vec *v)
+int
+zsl_mtx44_inv(const zsl_real_t *a, zsl_real_t *b)
 {
-#if CONFIG_ZSL_BOUNDS_CHECKS
-	/* Make sure the dimensions of 'm' and 'v' match. */
-	if (v->sz != m->sz_cols || v->sz < 4 || m->sz_rows != (m->sz_cols - 1)) {
-		return -EINVAL;
-	}
-#endif
-
+	zsl_real_t s0, s1, s2, s3, s4, s5;
+	zsl_real_t c0, c1, c2, c3, c4, c5;
+	zsl_real_t t[16];
 	zsl_real_t d;
 
-	ZSL_MATRIX_DEF(A, m->sz_cols, m->sz_cols);
-	ZSL_MATRIX_DEF(Ai, m->sz_cols, m->sz_cols);
-	ZSL_VECTOR_DEF(Av, m->sz_cols);
-	ZSL_MATRIX_DEF(b, m->sz_cols, 1);
-
-	zsl_mtx_init(&A, NULL);
-	A.data[(m->sz_cols * m->sz_cols - 1)] = 1.0;
-
-	for (size_t i = 0; i < m->sz_rows; i++) {
-		zsl_mtx_get_row(m, i, Av.data);
-		zsl_mtx_set_row(&A, i, Av.data);
+	/* 2x2 minors of the top two rows ('s') and the bottom two rows ('c'),
+	 * from which every cofactor can be built (Laplace expansion). */
+	s0 = a[0] * a[5] - a[4] * a[1];
+	s1 = a[0] * a[6] - a[4] * a[2];
+	s2 = a[0] * a[7] - a[4] * a[3];
+	s3 = a[1] * a[6] - a[5] * a[2];
+	s4 = a[1] * a[7] - a[5] * a[3];
+	s5 = a[2] * a[7] - a[6] * a[3];
+
+	c5 = a[10] * a[15] - a[14] * a[11];
+	c4 = a[9] * a[15] - a[13] * a[11];
+	c3 = a[9] * a[14] - a[13] * a[10];
+	c2 = a[8] * a[15] - a[12] * a[11];
+	c1 = a[8] * a[14] - a[12] * a[10];
+	c0 = a[8] * a[13] - a[12] * a[9];
+
+	d = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+	if (d == 0.0) {
+		return -ESINGULAR;
 	}
 
-	zsl_mtx_deter(&A, &d);
-	zsl_mtx_inv(&A, &Ai);
-	zsl_mtx_init(&b, NULL);
-	b.data[(m->sz_cols - 1)] = d;
-
-	zsl_mtx_mult(&Ai, &b, &b);
-
-	zsl_vec_from_arr(v, b.data);
+	d = 1.0 / d;
+	t[0] = (a[5] * c5 - a[6] * c4 + a[7] * c3) * d;
+	t[1] = (-a[1] * c5 + a[2] * c4 - a[3] * c3) * d;
+	t[2] = (a[13] * s5 - a[14] * s4 + a[15] * s3) * d;
+	t[3] = (-a[9] * s5 + a[10] * s4 - a[11] * s3) * d;
+	t[4] = (-a[4] * c5 + a[6] * c2 - a[7] * c1) * d;
+	t[5] = (a[0] * c5 - a[2] * c2 + a[3] * c1) * d;
+	t[6] = (-a[12] * s5 + a[14] * s2 - a[15] * s1) * d;
+	t[7] = (a[8] * s5 - a[10] * s2 + a[11] * s1) * d;
+	t[8] = (a[4] * c4 - a[5] * c2 + a[7] * c0) * d;
+	t[9] = (-a[0] * c4 + a[1] * c2 - a[3] * c0) * d;
+	t[10] = (a[12] * s4 - a[13] * s2 + a[15] * s0) * d;
+	t[11] = (-a[8] * s4 + a[9] * s2 - a[11] * s0) * d;
+	t[12] = (-a[4] * c3 + a[5] * c1 - a[6] * c0) * d;
+	t[13] = (a[0] * c3 - a[1] * c1 + a[2] * c0) * d;
+	t[14] = (-a[12] * s3 + a[13] * s1 - a[14] * s0) * d;
+	t[15] = (a[8] * s3 - a[9] * s1 + a[10] * s0) * d;
+
+	memcpy(b, t, sizeof(t));
 
 	return 0;
 }
-#endif
 
 int
-zsl_mtx_reduce(struct zsl_mtx *m, struct zsl_mtx *mr, size_t i, size_t j)
+zsl_mtx_batch_get(struct zsl_mtx_batch *mb, size_t k, struct zsl_mtx *m)
 {
-	size_t u = 0;
-	zsl_real_t x;
-	zsl_real_t v[mr->sz_rows * mr->sz_rows];
+	size_t nb = mb->sz_batch;
 
-#if CONFIG_ZSL_BOUNDS_CHECKS
-	/* Make sure mr is 1 less than m. */
-	if (mr->sz_rows != m->sz_rows - 1) {
-		return -EINVAL;
-	}
-	if (mr->sz_cols != m->sz_cols - 1) {
-		return -EINVAL;
-	}
-	if ((i >= m->sz_rows) || (j >= m->sz_cols)) {
+	if ((k >= nb) || (m->sz_rows != mb->sz_rows) ||
+	    (m->sz_cols != mb->sz_cols)) {
 		return -EINVAL;
 	}
-#endif
 
-	for (size_t k = 0; k < m->sz_rows; k++) {
-		for (size_t g = 0; g < m->sz_rows; g++) {
-			if (k != i && g != j) {
-				zsl_mtx_get(m, k, g, &x);
-				v[u] = x;
-				u++;
-			}
-		}
+	for (size_t e = 0; e < m->sz_rows * m->sz_cols; e++) {
+		m->data[e] = mb->data[(e * nb) + k];
 	}
 
-	zsl_mtx_from_arr(mr, v);
-
 	return 0;
 }
 
 int
-zsl_mtx_reduce_iter(struct zsl_mtx *m, struct zsl_mtx *mred, 
-				struct zsl_mtx *place1, struct zsl_mtx *place2)
+zsl_mtx_batch_set(struct zsl_mtx_batch *mb, size_t k, struct zsl_mtx *m)
 {
-	/* TODO: Properly check if matrix is square. */
-	if (m->sz_rows == place1->sz_rows) {
-		zsl_mtx_copy(place1, m);
-	}
+	size_t nb = mb->sz_batch;
 
-	if (place1->sz_rows == mred->sz_rows) {
-		zsl_mtx_copy(mred, place1);
+	if ((k >= nb) || (m->sz_rows != mb->sz_rows) ||
+	    (m->sz_cols != mb->sz_cols)) {
+		return -EINVAL;
+	}
 
-		/* restore the original placeholder size */
-		place1->sz_rows = m->sz_rows;
-		place1->sz_cols = m->sz_cols;
-		place2->sz_rows = m->sz_rows;
-		place2->sz_cols = m->sz_cols;
-		return 0;
+	for (size_t e = 0; e < m->sz_rows * m->sz_cols; e++) {
+		mb->data[(e * nb) + k] = m->data[e];
 	}
-	
-	/* trick the iterative method by generating the inner
-	 * call intermediate matrix, adjusting its size
-	 */
-	place2->sz_rows = place1->sz_rows - 1;
-	place2->sz_cols = place1->sz_cols - 1;
-	zsl_mtx_reduce(place1, place2, 0, 0);
 
-	/* Do the same with the second placeholder matrix */
-	place1->sz_rows--;
-	place1->sz_cols--;
-	zsl_mtx_copy(place1, place2);
+	return 0;
+}
 
-	return -EAGAIN;
+#if CONFIG_ZSL_BOUNDS_CHECKS
+/**
+ * @brief Checks if the data arrays of batches 'ba' and 'bb' overlap in memory.
+ */
+static bool
+zsl_mtx_batch_overlaps(struct zsl_mtx_batch *ba, struct zsl_mtx_batch *bb)
+{
+	zsl_real_t *a_end = ba->data +
+			    (ba->sz_rows * ba->sz_cols * ba->sz_batch);
+	zsl_real_t *b_end = bb->data +
+			    (bb->sz_rows * bb->sz_cols * bb->sz_batch);
+
+	return (ba->data < b_end) && (bb->data < a_end);
 }
+#endif
 
 int
-zsl_mtx_augm_diag(struct zsl_mtx *m, struct zsl_mtx *maug)
+zsl_mtx_add_batched(struct zsl_mtx_batch *ba, struct zsl_mtx_batch *bb,
+		    struct zsl_mtx_batch *bc)
 {
-	zsl_real_t x;
-	/* TODO: Properly check if matrix is square, and diff > 0. */
-	size_t diff = (maug->sz_rows) - (m->sz_rows);
+	size_t sz = ba->sz_rows * ba->sz_cols * ba->sz_batch;
 
-	zsl_mtx_init(maug, zsl_mtx_entry_fn_identity);
-	for (size_t i = 0; i < m->sz_rows; i++) {
-		for (size_t j = 0; j < m->sz_rows; j++) {
-			zsl_mtx_get(m, i, j, &x);
-			zsl_mtx_set(maug, i + diff, j + diff, x);
-		}
+	if ((ba->sz_rows != bb->sz_rows) || (ba->sz_cols != bb->sz_cols) ||
+	    (ba->sz_batch != bb->sz_batch) || (ba->sz_rows != bc->sz_rows) ||
+	    (ba->sz_cols != bc->sz_cols) || (ba->sz_batch != bc->sz_batch)) {
+		return -EINVAL;
+	}
+
+	/* The layout is the same for all three, so this is a flat sum. */
+	for (size_t e = 0; e < sz; e++) {
+		bc->data[e] = ba->data[e] + bb->data[e];
 	}
 
 	return 0;
 }
 
 int
-zsl_mtx_deter_3x3(struct zsl_mtx *m, zsl_real_t *d)
+zsl_mtx_mult_batched(struct zsl_mtx_batch *ba, struct zsl_mtx_batch *bb,
+		     struct zsl_mtx_batch *bc)
 {
-	/* Make sure this is a square matrix. */
-	if (m->sz_rows != m->sz_cols) {
+	size_t nb = ba->sz_batch;
+	size_t q = ba->sz_cols;
+	size_t n = bb->sz_cols;
+	zsl_real_t *a, *b, *c;
+
+	if ((q != bb->sz_rows) || (bc->sz_rows != ba->sz_rows) ||
+	    (bc->sz_cols != n) || (bb->sz_batch != nb) ||
+	    (bc->sz_batch != nb)) {
 		return -EINVAL;
 	}
 
 #if CONFIG_ZSL_BOUNDS_CHECKS
-	/* Make sure this is a 3x3 matrix. */
-	if (m->sz_rows != 3) {
+	if (zsl_mtx_batch_overlaps(bc, ba) || zsl_mtx_batch_overlaps(bc, bb)) {
 		return -EINVAL;
 	}
 #endif
 
-	/*
-	 * 3x3 matrix element to array table:
-	 *
-	 * 1,1 = 0  1,2 = 1  1,3 = 2
-	 * 2,1 = 3  2,2 = 4  2,3 = 5
-	 * 3,1 = 6  3,2 = 7  3,3 = 8
-	 */
-
-	*d = m->data[0] * (m->data[4] * m->data[8] - m->data[7] * m->data[5]);
-	*d -= m->data[3] * (m->data[1] * m->data[8] - m->data[7] * m->data[2]);
-	*d += m->data[6] * (m->data[1] * m->data[5] - m->data[4] * m->data[2]);
+	/* The innermost loop runs along the batch, so every access is
+	 * unit-stride and independent of the matrix size. */
+	for (size_t i = 0; i < bc->sz_rows; i++) {
+		for (size_t j = 0; j < n; j++) {
+			c = &bc->data[((i * n) + j) * nb];
+			memset(c, 0, nb * sizeof(zsl_real_t));
+			for (size_t p = 0; p < q; p++) {
+				a = &ba->data[((i * q) + p) * nb];
+				b = &bb->data[((p * n) + j) * nb];
+				for (size_t k = 0; k < nb; k++) {
+					c[k] += a[k] * b[k];
+				}
+			}
+		}
+	}
 
 	return 0;
 }
 
 int
-zsl_mtx_deter(struct zsl_mtx *m, zsl_real_t *d)
+zsl_mtx_trans_batched(struct zsl_mtx_batch *ba, struct zsl_mtx_batch *bb)
 {
-	/* Shortcut for 1x1 matrices. */
-	if (m->sz_rows == 1) {
-		*d = m->data[0];
-		return 0;
-	}
-
-	/* Shortcut for 2x2 matrices. */
-	if (m->sz_rows == 2) {
-		*d = m->data[0] * m->data[3] - m->data[2] * m->data[1];
-		return 0;
-	}
+	size_t nb = ba->sz_batch;
+	size_t r = ba->sz_rows;
+	size_t c = ba->sz_cols;
 
-	/* Shortcut for 3x3 matrices. */
-	if (m->sz_rows == 3) {
-		return zsl_mtx_deter_3x3(m, d);
+	if ((bb->sz_rows != c) || (bb->sz_cols != r) || (bb->sz_batch != nb)) {
+		return -EINVAL;
 	}
 
 #if CONFIG_ZSL_BOUNDS_CHECKS
-	/* Make sure this is a square matrix. */
-	if (m->sz_rows != m->sz_cols) {
+	if (zsl_mtx_batch_overlaps(ba, bb)) {
 		return -EINVAL;
 	}
 #endif
 
-	/* Full calculation required for non 3x3 matrices. */
-	int rc;
-	zsl_real_t dtmp;
-	zsl_real_t cur;
-	zsl_real_t sign;
-	ZSL_MATRIX_DEF(mr, (m->sz_rows - 1), (m->sz_rows - 1));
-
-	/* Clear determinant output before starting. */
-	*d = 0.0;
-
-	/*
-	 * Iterate across row 0, removing columns one by one.
-	 * Note that these calls are recursive until we reach a 3x3 matrix,
-	 * which will be calculated using the shortcut at the top of this
-	 * function.
-	 */
-	for (size_t g = 0; g < m->sz_cols; g++) {
-		zsl_mtx_get(m, 0, g, &cur);     /* Get value at (0, g). */
-		zsl_mtx_init(&mr, NULL);        /* Clear mr. */
-		zsl_mtx_reduce(m, &mr, 0, g);   /* Remove row 0, column g. */
-		rc = zsl_mtx_deter(&mr, &dtmp); /* Calc. determinant of mr. */
-		sign = 1.0;
-		if (rc) {
-			return -EINVAL;
+	/* Each element position is a contiguous run of 'nb' values. */
+	for (size_t i = 0; i < r; i++) {
+		for (size_t j = 0; j < c; j++) {
+			memcpy(&bb->data[((j * r) + i) * nb],
+			       &ba->data[((i * c) + j) * nb],
+			       nb * sizeof(zsl_real_t));
 		}
+	}
 
-		/* Uneven elements are negative. */
-		if (g % 2 != 0) {
-			sign = -1.0;
-		}
+	return 0;
+}
 
-		/* Add current determinant to final output value. */
-		*d += dtmp * cur * sign;
+/**
+ * @brief Inverts a batch of 'nb' 2x2 matrices stored element-interleaved in
+ *        'a', writing the inverses to 'b'. Singular matrices yield the
+ *        identity. 'b' may be the same array as 'a'.
+ */
+static void
+zsl_mtx_inv_batched_22(const zsl_real_t *a, zsl_real_t *b, size_t nb)
+{
+	zsl_real_t a0, a1, a2, a3, d, r, z;
+
+	for (size_t k = 0; k < nb; k++) {
+		a0 = a[k];
+		a1 = a[nb + k];
+		a2 = a[(2 * nb) + k];
+		a3 = a[(3 * nb) + k];
+
+		/* A singular matrix gets r = 0 and the identity added on
+		 * through 'z', so the loop body has no branches. */
+		d = a0 * a3 - a1 * a2;
+		z = (d == 0.0) ? 1.0 : 0.0;
+		r = (1.0 - z) / (d + z);
+
+		b[k] = a3 * r + z;
+		b[nb + k] = -a1 * r;
+		b[(2 * nb) + k] = -a2 * r;
+		b[(3 * nb) + k] = a0 * r + z;
 	}
+}
 
-	return 0;
+/**
+ * @brief Inverts a batch of 'nb' 3x3 matrices stored element-interleaved in
+ *        'a', writing the inverses to 'b'. Singular matrices yield the
+ *        identity. 'b' may be the same array as 'a'.
+ */
+static void
+zsl_mtx_inv_batched_33(const zsl_real_t *a, zsl_real_t *b, size_t nb)
+{
+	zsl_real_t a0, a1, a2, a3, a4, a5, a6, a7, a8;
+	zsl_real_t c00, c01, c02, c10, c11, c12, c20, c21, c22;
+	zsl_real_t d, r, z;
+
+	for (size_t k = 0; k < nb; k++) {
+		a0 = a[k];
+		a1 = a[nb + k];
+		a2 = a[(2 * nb) + k];
+		a3 = a[(3 * nb) + k];
+		a4 = a[(4 * nb) + k];
+		a5 = a[(5 * nb) + k];
+		a6 = a[(6 * nb) + k];
+		a7 = a[(7 * nb) + k];
+		a8 = a[(8 * nb) + k];
+
+		/* Same cofactors and expansion as zsl_mtx33_inv. */
+		c00 = a4 * a8 - a5 * a7;
+		c01 = a2 * a7 - a1 * a8;
+		c02 = a1 * a5 - a2 * a4;
+		c10 = a5 * a6 - a3 * a8;
+		c11 = a0 * a8 - a2 * a6;
+		c12 = a2 * a3 - a0 * a5;
+		c20 = a3 * a7 - a4 * a6;
+		c21 = a1 * a6 - a0 * a7;
+		c22 = a0 * a4 - a1 * a3;
+
+		d = a0 * c00 + a3 * c01 + a6 * c02;
+		z = (d == 0.0) ? 1.0 : 0.0;
+		r = (1.0 - z) / (d + z);
+
+		b[k] = c00 * r + z;
+		b[nb + k] = c01 * r;
+		b[(2 * nb) + k] = c02 * r;
+		b[(3 * nb) + k] = c10 * r;
+		b[(4 * nb) + k] = c11 * r + z;
+		b[(5 * nb) + k] = c12 * r;
+		b[(6 * nb) + k] = c20 * r;
+		b[(7 * nb) + k] = c21 * r;
+		b[(8 * nb) + k] = c22 * r + z;
+	}
 }
 
 int
-zsl_mtx_gauss_elim(struct zsl_mtx *m, struct zsl_mtx *mg, struct zsl_mtx *mi,
-		   size_t i, size_t j)
+zsl_mtx_inv_batched(struct zsl_mtx_batch *ba, struct zsl_mtx_batch *bi)
 {
+	size_t nb = ba->sz_batch;
+	size_t n = ba->sz_rows;
+	zsl_real_t t[16];
 	int rc;
-	zsl_real_t x, y;
-	zsl_real_t epsilon = 1E-6;
 
-	/* Make a copy of matrix m. */
-	rc = zsl_mtx_copy(mg, m);
-	if (rc) {
+	if ((n != ba->sz_cols) || (bi->sz_rows != n) || (bi->sz_cols != n) ||
+	    (bi->sz_batch != nb)) {
 		return -EINVAL;
 	}
 
-	/* Get the value of the element at position (i, j). */
-	rc = zsl_mtx_get(mg, i, j, &y);
-	if (rc) {
-		return rc;
-	}
-
-	/* If this is a zero value, don't do anything. */
-	if ((y >= 0 && y < epsilon) || (y <= 0 && y > -epsilon)) {
+	/* Larger matrices are inverted one at a time. */
+	if (n < 2 || n > 4) {
+		ZSL_MATRIX_DEF(m, n, n);
+		ZSL_MATRIX_DEF(mi, n, n);
+		for (size_t k = 0; k < nb; k++) {
+			zsl_mtx_batch_get(ba, k, &m);
+			rc = zsl_mtx_inv(&m, &mi);
+			if (rc) {
+				return rc;
+			}
+			zsl_mtx_batch_set(bi, k, &mi);
+		}
 		return 0;
 	}
 
-	/* Cycle through the matrix row by row. */
-	for (size_t p = 0; p < mg->sz_rows; p++) {
-		/* Skip row 'i'. */
-		if (p == i) {
-			p++;
-		}
-		if (p == mg->sz_rows) {
-			break;
+	/* 2x2 and 3x3 matrices are inverted with the cofactor formulas
+	 * applied along the batch, as in zsl_mtx_mult_batched, so every
+	 * element is read and written with unit stride in 'k'. */
+	if (n == 2) {
+		zsl_mtx_inv_batched_22(ba->data, bi->data, nb);
+		return 0;
+	}
+	if (n == 3) {
+		zsl_mtx_inv_batched_33(ba->data, bi->data, nb);
+		return 0;
+	}
+
+	/* 4x4 matrices are gathered into 't' one at a time, inverted with
+	 * zsl_mtx44_inv and scattered back, with a stride of 'nb'. */
+	for (size_t k = 0; k < nb; k++) {
+		for (size_t e = 0; e < n * n; e++) {
+			t[e] = ba->data[(e * nb) + k];
 		}
-		/* Get the value of (p, j), aborting if value is zero. */
-		zsl_mtx_get(mg, p, j, &x);
-		if ((x >= 1E-6) || (x <= -1E-6)) {
-			rc = zsl_mtx_sum_rows_scaled_d(mg, p, i, -(x / y));
 
-			if (rc) {
-				return -EINVAL;
-			}
-			rc = zsl_mtx_sum_rows_scaled_d(mi, p, i, -(x / y));
-			if (rc) {
-				return -EINVAL;
+		rc = zsl_mtx44_inv(t, t);
+
+		for (size_t e = 0; e < n * n; e++) {
+			if (rc == -ESINGULAR) {
+				t[e] = (e % (n + 1)) == 0 ? 1.0 : 0.0;
 			}
+			bi->data[(e * nb) + k] = t[e];
 		}
 	}
 
 	return 0;
 }
 
-int
-zsl_mtx_gauss_elim_d(struct zsl_mtx *m, struct zsl_mtx *mi, size_t i, size_t j)
+/**
+ * @brief Returns a pointer to element (i, j) of banded matrix 'b', which
+ *        must be inside the band.
+ */
+static inline zsl_real_t *
+zsl_mtx_band_at(struct zsl_mtx_band *b, size_t i, size_t j)
 {
-	return zsl_mtx_gauss_elim(m, m, mi, i, j);
+	return &b->data[(i * (b->kl + b->ku + 1)) + j + b->kl - i];
 }
 
 int
-zsl_mtx_gauss_reduc(struct zsl_mtx *m, struct zsl_mtx *mi,
-		    struct zsl_mtx *mg)
+zsl_mtx_band_get(struct zsl_mtx_band *b, size_t i, size_t j, zsl_real_t *x)
 {
-	zsl_real_t v[m->sz_rows];
-	zsl_real_t epsilon = 1E-6;
-	zsl_real_t x;
-	zsl_real_t y;
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((i >= b->sz_rows) || (j >= b->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
 
-	/* Copy the input matrix into 'mg' so all the changes will be done to
-	 * 'mg' and the input matrix will not be destroyed. */
-	zsl_mtx_copy(mg, m);
+	if ((j + b->kl < i) || (j > i + b->ku)) {
+		*x = 0.0;
+	} else {
+		*x = *zsl_mtx_band_at(b, i, j);
+	}
 
-	for (size_t k = 0; k < m->sz_rows; k++) {
+	return 0;
+}
 
-		/* Get every element in the diagonal. */
-		zsl_mtx_get(mg, k, k, &x);
+int
+zsl_mtx_band_set(struct zsl_mtx_band *b, size_t i, size_t j, zsl_real_t x)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((i >= b->sz_rows) || (j >= b->sz_cols) || (j + b->kl < i) ||
+	    (j > i + b->ku)) {
+		return -EINVAL;
+	}
+#endif
 
-		/* If the diagonal element is zero, find another value in the
-		 * same column that isn't zero and add the row containing
-		 * the non-zero element to the diagonal element's row. */
-		if ((x >= 0 && x < epsilon) || (x <= 0 && x > -epsilon)) {
-			zsl_mtx_get_col(mg, k, v);
-			for (size_t q = 0; q < m->sz_rows; q++) {
-				zsl_mtx_get(mg, q, q, &y);
-				if ((v[q] >= epsilon) || (v[q] <= -epsilon)) {
+	*zsl_mtx_band_at(b, i, j) = x;
 
-					/* If the non-zero element found is
-					 * above the diagonal, only add its row
-					 * if the diagonal element in this row
-					 * is zero, to avoid undoing previous
-					 * steps. */
-					if (q < k && ((y >= epsilon)
-						      || (y <= -epsilon))) {
-					} else {
-						zsl_mtx_sum_rows_d(mg, k, q);
-						zsl_mtx_sum_rows_d(mi, k, q);
-						break;
-					}
-				}
-			}
-		}
+	return 0;
+}
 
-		/* Perform the gaussian elimination in the column of the
-		 * diagonal element to get rid of all the values in the column
-		 * except for the diagonal one. */
-		zsl_mtx_gauss_elim_d(mg, mi, k, k);
+int
+zsl_mtx_band_from_mtx(struct zsl_mtx *m, struct zsl_mtx_band *b)
+{
+	size_t j0, j1;
 
-		/* Divide the diagonal element's row by the diagonal element. */
-		zsl_mtx_norm_elem_d(mg, mi, k, k);
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((m->sz_rows != b->sz_rows) || (m->sz_cols != b->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	memset(b->data, 0,
+	       b->sz_rows * (b->kl + b->ku + 1) * sizeof(zsl_real_t));
+	for (size_t i = 0; i < m->sz_rows; i++) {
+		j0 = (i > b->kl) ? i - b->kl : 0;
+		j1 = (i + b->ku < m->sz_cols) ? i + b->ku + 1 : m->sz_cols;
+		for (size_t j = j0; j < j1; j++) {
+			*zsl_mtx_band_at(b, i, j) =
+				m->data[(i * m->sz_cols) + j];
+		}
 	}
 
 	return 0;
 }
 
 int
-zsl_mtx_gram_schmidt(struct zsl_mtx *m, struct zsl_mtx *mort)
+zsl_mtx_band_to_mtx(struct zsl_mtx_band *b, struct zsl_mtx *m)
 {
-	ZSL_VECTOR_DEF(v, m->sz_rows);
-	ZSL_VECTOR_DEF(w, m->sz_rows);
-	ZSL_VECTOR_DEF(q, m->sz_rows);
+	size_t j0, j1;
 
-	for (size_t t = 0; t < m->sz_cols; t++) {
-		zsl_vec_init(&q);
-		zsl_mtx_get_col(m, t, v.data);
-		for (size_t g = 0; g < t; g++) {
-			zsl_mtx_get_col(mort, g, w.data);
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((m->sz_rows != b->sz_rows) || (m->sz_cols != b->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
 
-			/* Calculate the projection of every column vector
-			 * before 'g' on the 't'th column. */
-			zsl_vec_project(&w, &v, &w);
-			zsl_vec_add(&q, &w, &q);
+	zsl_mtx_init(m, NULL);
+	for (size_t i = 0; i < m->sz_rows; i++) {
+		j0 = (i > b->kl) ? i - b->kl : 0;
+		j1 = (i + b->ku < m->sz_cols) ? i + b->ku + 1 : m->sz_cols;
+		for (size_t j = j0; j < j1; j++) {
+			m->data[(i * m->sz_cols) + j] =
+				*zsl_mtx_band_at(b, i, j);
 		}
-
-		/* Substract the sum of the projections on the 't'th column from
-		 * the 't'th column and set this vector as the 't'th column of
-		 * the output matrix. */
-		zsl_vec_sub(&v, &q, &v);
-		zsl_mtx_set_col(mort, t, v.data);
 	}
 
 	return 0;
 }
 
 int
-zsl_mtx_cols_norm(struct zsl_mtx *m, struct zsl_mtx *mnorm)
+zsl_mtx_band_mult_vec(struct zsl_mtx_band *b, struct zsl_vec *v,
+		      struct zsl_vec *w)
 {
-	ZSL_VECTOR_DEF(v, m->sz_rows);
+	size_t j0, j1;
+	zsl_real_t sum;
+	zsl_real_t *bi;
 
-	for (size_t g = 0; g < m->sz_cols; g++) {
-		zsl_mtx_get_col(m, g, v.data);
-		zsl_vec_to_unit(&v);
-		zsl_mtx_set_col(mnorm, g, v.data);
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((v->sz != b->sz_cols) || (w->sz != b->sz_rows) ||
+	    (v->data == w->data)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < b->sz_rows; i++) {
+		j0 = (i > b->kl) ? i - b->kl : 0;
+		j1 = (i + b->ku < b->sz_cols) ? i + b->ku + 1 : b->sz_cols;
+		sum = 0.0;
+		if (j0 < j1) {
+			bi = zsl_mtx_band_at(b, i, j0);
+			for (size_t j = j0; j < j1; j++) {
+				sum += bi[j - j0] * v->data[j];
+			}
+		}
+		w->data[i] = sum;
 	}
 
 	return 0;
 }
 
 int
-zsl_mtx_norm_elem(struct zsl_mtx *m, struct zsl_mtx *mn, struct zsl_mtx *mi,
-		  size_t i, size_t j)
+zsl_mtx_band_tridiag_solve(struct zsl_mtx_band *t, struct zsl_vec *b,
+			   struct zsl_vec *x)
 {
-	int rc;
-	zsl_real_t x;
-	zsl_real_t epsilon = 1E-6;
+	size_t n = t->sz_rows;
+	zsl_real_t cp[n];
+	zsl_real_t den;
+	zsl_real_t *ti;
 
-	/* Make a copy of matrix m. */
-	rc = zsl_mtx_copy(mn, m);
-	if (rc) {
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((t->sz_cols != n) || (t->kl != 1) || (t->ku != 1) ||
+	    (b->sz != n) || (x->sz != n)) {
 		return -EINVAL;
 	}
+#endif
 
-	/* Get the value to normalise. */
-	rc = zsl_mtx_get(mn, i, j, &x);
-	if (rc) {
-		return rc;
+	/* Row 'i' of the band holds (a[i], d[i], c[i]), the subdiagonal,
+	 * diagonal and superdiagonal values. The forward sweep eliminates
+	 * a[i], scaling every row so its diagonal becomes one, which leaves
+	 * the new superdiagonal in 'cp' and the new right-hand side in 'x'. */
+	for (size_t i = 0; i < n; i++) {
+		ti = &t->data[i * 3];
+		den = ti[1];
+		if (i > 0) {
+			den -= ti[0] * cp[i - 1];
+		}
+		if (den == 0.0) {
+			return -ESINGULAR;
+		}
+		if (i + 1 < n) {
+			cp[i] = ti[2] / den;
+		}
+		x->data[i] = (i > 0) ?
+			     (b->data[i] - ti[0] * x->data[i - 1]) / den :
+			     b->data[i] / den;
 	}
 
-	/* If the value is 0.0, abort. */
-	if ((x >= 0 && x < epsilon) || (x <= 0 && x > -epsilon)) {
-		return 0;
+	/* Back substitution with the unit upper bidiagonal system. */
+	for (size_t i = n; i-- > 1;) {
+		x->data[i - 1] -= cp[i - 1] * x->data[i];
 	}
 
-	rc = zsl_mtx_scalar_mult_row_d(mn, i, (1.0 / x));
-	if (rc) {
+	return 0;
+}
+
+int
+zsl_mtx_band_lu(struct zsl_mtx_band *b, struct zsl_mtx_band *lu, size_t *p)
+{
+	size_t n = b->sz_rows;
+	size_t kl = b->kl;
+	size_t r, i1, j1, j0;
+	zsl_real_t x, max, piv;
+	zsl_real_t *rk, *ri;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((b->sz_cols != n) || (lu->sz_rows != n) || (lu->sz_cols != n) ||
+	    (lu->kl != kl) || (lu->ku != kl + b->ku)) {
 		return -EINVAL;
 	}
+#endif
 
-	rc = zsl_mtx_scalar_mult_row_d(mi, i, (1.0 / x));
-	if (rc) {
-		return -EINVAL;
+	/* Copy 'b', leaving the extra superdiagonals that hold the fill-in
+	 * from row interchanges at zero. */
+	memset(lu->data, 0, n * (2 * kl + b->ku + 1) * sizeof(zsl_real_t));
+	for (size_t i = 0; i < n; i++) {
+		j0 = (i > kl) ? i - kl : 0;
+		j1 = (i + b->ku < n) ? i + b->ku + 1 : n;
+		for (size_t j = j0; j < j1; j++) {
+			*zsl_mtx_band_at(lu, i, j) = *zsl_mtx_band_at(b, i, j);
+		}
 	}
 
-	return 0;
-}
+	for (size_t k = 0; k < n; k++) {
+		/* Only the 'kl' rows below the diagonal can be non-zero in
+		 * column 'k', and after a row interchange the pivot row can
+		 * reach up to column k + lu->ku. */
+		i1 = (k + kl < n) ? k + kl + 1 : n;
+		j1 = (k + lu->ku < n) ? k + lu->ku + 1 : n;
+
+		r = k;
+		max = ZSL_ABS(*zsl_mtx_band_at(lu, k, k));
+		for (size_t i = k + 1; i < i1; i++) {
+			x = ZSL_ABS(*zsl_mtx_band_at(lu, i, k));
+			if (x > max) {
+				max = x;
+				r = i;
+			}
+		}
 
-int
-zsl_mtx_norm_elem_d(struct zsl_mtx *m, struct zsl_mtx *mi, size_t i, size_t j)
-{
-	return zsl_mtx_norm_elem(m, m, mi, i, j);
+		/* Only columns 'k' onwards are swapped: the multipliers already
+		 * stored to the left aren't permuted, so L is kept as the
+		 * sequence of eliminations, as in LAPACK's dgbtrf. */
+		p[k] = r;
+		rk = zsl_mtx_band_at(lu, k, k);
+		if (r != k) {
+			ri = zsl_mtx_band_at(lu, r, k);
+			for (size_t j = 0; j < j1 - k; j++) {
+				x = rk[j];
+				rk[j] = ri[j];
+				ri[j] = x;
+			}
+		}
+
+		piv = rk[0];
+		if (piv == 0.0) {
+			continue;
+		}
+
+		for (size_t i = k + 1; i < i1; i++) {
+			ri = zsl_mtx_band_at(lu, i, k);
+			x = ri[0] / piv;
+			ri[0] = x;
+			if (x == 0.0) {
+				continue;
+			}
+			for (size_t j = 1; j < j1 - k; j++) {
+				ri[j] -= x * rk[j];
+			}
+		}
+	}
+
+	return 0;
 }
 
 int
-zsl_mtx_inv_3x3(struct zsl_mtx *m, struct zsl_mtx *mi)
+zsl_mtx_band_lu_solve(struct zsl_mtx_band *lu, size_t *p, struct zsl_vec *b,
+		      struct zsl_vec *x)
 {
-	int rc;
-	zsl_real_t d;   /* Determinant. */
-	zsl_real_t s;   /* Scale factor. */
-
-	/* Make sure these are square matrices. */
-	if ((m->sz_rows != m->sz_cols) || (mi->sz_rows != mi->sz_cols)) {
-		return -EINVAL;
-	}
+	size_t n = lu->sz_rows;
+	size_t i1, j1;
+	zsl_real_t w;
+	zsl_real_t *li;
 
 #if CONFIG_ZSL_BOUNDS_CHECKS
-	/* Make sure 'm' and 'mi' have the same shape. */
-	if (m->sz_rows != mi->sz_rows) {
-		return -EINVAL;
-	}
-	if (m->sz_cols != mi->sz_cols) {
-		return -EINVAL;
-	}
-	/* Make sure these are 3x3 matrices. */
-	if ((m->sz_cols != 3) || (mi->sz_cols != 3)) {
+	if ((lu->sz_cols != n) || (b->sz != n) || (x->sz != n)) {
 		return -EINVAL;
 	}
 #endif
 
-	/* Calculate the determinant. */
-	rc = zsl_mtx_deter_3x3(m, &d);
-	if (rc) {
-		goto err;
+	for (size_t i = 0; i < n; i++) {
+		if (*zsl_mtx_band_at(lu, i, i) == 0.0) {
+			return -ESINGULAR;
+		}
 	}
 
-	/* Calculate the adjoint matrix. */
-	rc = zsl_mtx_adjoint_3x3(m, mi);
-	if (rc) {
-		goto err;
+	if (x->data != b->data) {
+		memcpy(x->data, b->data, n * sizeof(zsl_real_t));
 	}
 
-	/* Scale the output using the determinant. */
-	if (d != 0) {
-		s = 1.0 / d;
-		rc = zsl_mtx_scalar_mult_d(mi, s);
-	} else {
-		/* Provide an identity matrix if the determinant is zero. */
-		rc = zsl_mtx_init(mi, zsl_mtx_entry_fn_identity);
-		if (rc) {
-			return -EINVAL;
+	/* Replay the interchanges and eliminations in order. */
+	for (size_t k = 0; k < n; k++) {
+		if (p[k] != k) {
+			w = x->data[k];
+			x->data[k] = x->data[p[k]];
+			x->data[p[k]] = w;
+		}
+		i1 = (k + lu->kl < n) ? k + lu->kl + 1 : n;
+		for (size_t i = k + 1; i < i1; i++) {
+			x->data[i] -= *zsl_mtx_band_at(lu, i, k) * x->data[k];
+		}
+	}
+
+	/* Back substitution with U, which has 'ku' superdiagonals. */
+	for (size_t i = n; i-- > 0;) {
+		j1 = (i + lu->ku < n) ? i + lu->ku + 1 : n;
+		li = zsl_mtx_band_at(lu, i, i);
+		w = x->data[i];
+		for (size_t j = i + 1; j < j1; j++) {
+			w -= li[j - i] * x->data[j];
 		}
+		x->data[i] = w / li[0];
 	}
 
 	return 0;
-err:
-	return rc;
 }
 
 int
-zsl_mtx_inv(struct zsl_mtx *m, struct zsl_mtx *mi)
+zsl_mtx_band_solve(struct zsl_mtx_band *m, struct zsl_vec *b,
+		   struct zsl_vec *x)
 {
 	int rc;
-	zsl_real_t d = 0.0;
 
-	/* Shortcut for 3x3 matrices. */
-	if (m->sz_rows == 3) {
-		return zsl_mtx_inv_3x3(m, mi);
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (m->sz_cols != m->sz_rows) {
+		return -EINVAL;
 	}
+#endif
 
-	/* Make sure we have square matrices. */
-	if ((m->sz_rows != m->sz_cols) || (mi->sz_rows != mi->sz_cols)) {
-		return -EINVAL;
+	size_t p[m->sz_rows];
+	zsl_real_t lud[m->sz_rows * ((2 * m->kl) + m->ku + 1)];
+	struct zsl_mtx_band lu = {
+		.sz_rows = m->sz_rows,
+		.sz_cols = m->sz_cols,
+		.kl = m->kl,
+		.ku = m->kl + m->ku,
+		.data = lud
+	};
+
+	rc = zsl_mtx_band_lu(m, &lu, p);
+	if (rc) {
+		return rc;
 	}
 
-#if CONFIG_ZSL_BOUNDS_CHECKS
-	/* Make sure 'm' and 'mi' have the same shape. */
-	if (m->sz_rows != mi->sz_rows) {
-		return -EINVAL;
+	return zsl_mtx_band_lu_solve(&lu, p, b, x);
+}
+
+/**
+ * @brief Returns the index of element (i, j) of packed matrix 'p' in its
+ *        data array. (i, j) must be in the stored triangle.
+ */
+static inline size_t
+zsl_mtx_packed_idx(struct zsl_mtx_packed *p, size_t i, size_t j)
+{
+	if (p->type == ZSL_MTX_PACKED_UPPER) {
+		return ((i * ((2 * p->sz) - i + 1)) / 2) + j - i;
 	}
-	if (m->sz_cols != mi->sz_cols) {
+
+	return ((i * (i + 1)) / 2) + j;
+}
+
+int
+zsl_mtx_packed_get(struct zsl_mtx_packed *p, size_t i, size_t j,
+		   zsl_real_t *x)
+{
+	size_t t;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((i >= p->sz) || (j >= p->sz)) {
 		return -EINVAL;
 	}
 #endif
 
-	/* Make a copy of matrix m on the stack to avoid modifying it. */
-	ZSL_MATRIX_DEF(m_tmp, mi->sz_rows, mi->sz_cols);
-	rc = zsl_mtx_copy(&m_tmp, m);
-	if (rc) {
-		return -EINVAL;
+	if (p->type == ZSL_MTX_PACKED_SYM && j > i) {
+		t = i;
+		i = j;
+		j = t;
 	}
 
-	/* Initialise 'mi' as an identity matrix. */
-	rc = zsl_mtx_init(mi, zsl_mtx_entry_fn_identity);
-	if (rc) {
+	if ((p->type == ZSL_MTX_PACKED_UPPER) ? (j < i) : (j > i)) {
+		*x = 0.0;
+	} else {
+		*x = p->data[zsl_mtx_packed_idx(p, i, j)];
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_packed_set(struct zsl_mtx_packed *p, size_t i, size_t j,
+		   zsl_real_t x)
+{
+	size_t t;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((i >= p->sz) || (j >= p->sz)) {
 		return -EINVAL;
 	}
+#endif
 
-	/* Make sure the determinant of 'm' is not zero. */
-	zsl_mtx_deter(m, &d);
+	if (p->type == ZSL_MTX_PACKED_SYM && j > i) {
+		t = i;
+		i = j;
+		j = t;
+	}
 
-	if (d == 0) {
-		return 0;
+	if ((p->type == ZSL_MTX_PACKED_UPPER) ? (j < i) : (j > i)) {
+		return -EINVAL;
 	}
 
-	/* Use Gauss-Jordan elimination for nxn matrices. */
-	zsl_mtx_gauss_reduc(m, mi, &m_tmp);
+	p->data[zsl_mtx_packed_idx(p, i, j)] = x;
 
 	return 0;
 }
 
 int
-zsl_mtx_cholesky(struct zsl_mtx *m, struct zsl_mtx *l)
+zsl_mtx_packed_from_mtx(struct zsl_mtx *m, struct zsl_mtx_packed *p)
 {
+	size_t n = p->sz;
+	zsl_real_t *d = p->data;
+
 #if CONFIG_ZSL_BOUNDS_CHECKS
-	/* Make sure 'm' is square. */
-	if (m->sz_rows != m->sz_cols) {
+	if ((m->sz_rows != n) || (m->sz_cols != n)) {
 		return -EINVAL;
 	}
+#endif
 
-	/* Make sure 'm' is symmetric. */
-	zsl_real_t a, b;
-	for (size_t i = 0; i < m->sz_rows; i++) {
-		for (size_t j = 0; j < m->sz_rows; j++) {
-			zsl_mtx_get(m, i, j, &a);
-			zsl_mtx_get(m, j, i, &b);
-			if (a != b) {
-				return -EINVAL;
-			}
+	/* Every stored row is contiguous in both matrices. */
+	for (size_t i = 0; i < n; i++) {
+		if (p->type == ZSL_MTX_PACKED_UPPER) {
+			memcpy(d, &m->data[(i * n) + i],
+			       (n - i) * sizeof(zsl_real_t));
+			d += n - i;
+		} else {
+			memcpy(d, &m->data[i * n],
+			       (i + 1) * sizeof(zsl_real_t));
+			d += i + 1;
 		}
 	}
 
-	/* Make sure 'm' and 'l' have the same shape. */
-	if (m->sz_rows != l->sz_rows) {
-		return -EINVAL;
-	}
-	if (m->sz_cols != l->sz_cols) {
+	return 0;
+}
+
+int
+zsl_mtx_packed_to_mtx(struct zsl_mtx_packed *p, struct zsl_mtx *m)
+{
+	size_t n = p->sz;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((m->sz_rows != n) || (m->sz_cols != n)) {
 		return -EINVAL;
 	}
 #endif
 
-	zsl_real_t sum, x, y;
-	zsl_mtx_init(l, zsl_mtx_entry_fn_empty);
-	for (size_t j = 0; j < m->sz_cols; j++) {
-		sum = 0.0;
-		for (size_t k = 0; k < j; k++) {
-			zsl_mtx_get(l, j, k, &x);
-			sum += x * x;
-		}
-		zsl_mtx_get(m, j, j, &x);
-		zsl_mtx_set(l, j, j, ZSL_SQRT(x - sum));
-
-		for (size_t i = j + 1; i < m->sz_cols; i++) {
-			sum = 0.0;
-			for (size_t k = 0; k < j; k++) {
-				zsl_mtx_get(l, j, k, &x);
-				zsl_mtx_get(l, i, k, &y);
-				sum += y * x;
-			}
-			zsl_mtx_get(l, j, j, &x);
-			zsl_mtx_get(m, i, j, &y);
-			zsl_mtx_set(l, i, j, (y - sum) / x);
+	for (size_t i = 0; i < n; i++) {
+		for (size_t j = 0; j < n; j++) {
+			zsl_mtx_packed_get(p, i, j, &m->data[(i * n) + j]);
 		}
 	}
 
@@ -1189,512 +1414,5152 @@ zsl_mtx_cholesky(struct zsl_mtx *m, struct zsl_mtx *l)
 }
 
 int
-zsl_mtx_balance(struct zsl_mtx *m, struct zsl_mtx *mout)
+zsl_mtx_packed_mult_vec(struct zsl_mtx_packed *p, struct zsl_vec *v,
+			struct zsl_vec *w)
 {
-	int rc;
-	bool done = false;
+	size_t n = p->sz;
+	zsl_real_t *d = p->data;
 	zsl_real_t sum;
-	zsl_real_t row, row2;
-	zsl_real_t col, col2;
-
-	/* Make sure we have square matrices. */
-	if ((m->sz_rows != m->sz_cols) || (mout->sz_rows != mout->sz_cols)) {
-		return -EINVAL;
-	}
 
 #if CONFIG_ZSL_BOUNDS_CHECKS
-	/* Make sure 'm' and 'mout' have the same shape. */
-	if (m->sz_rows != mout->sz_rows) {
-		return -EINVAL;
-	}
-	if (m->sz_cols != mout->sz_cols) {
+	if ((v->sz != n) || (w->sz != n) || (v->data == w->data)) {
 		return -EINVAL;
 	}
 #endif
 
-	rc = zsl_mtx_copy(mout, m);
-	if (rc) {
-		goto err;
-	}
-
-	while (!done) {
-		done = true;
-
-		for (size_t i = 0; i < m->sz_rows; i++) {
-			/* Calculate sum of components of each row, column. */
-			for (size_t j = 0; j < m->sz_cols; j++) {
-				row += ZSL_ABS(mout->data[(i * m->sz_rows) +
-							  j]);
-				col += ZSL_ABS(mout->data[(j * m->sz_rows) +
-							  i]);
+	if (p->type == ZSL_MTX_PACKED_UPPER) {
+		for (size_t i = 0; i < n; i++) {
+			sum = 0.0;
+			for (size_t j = i; j < n; j++) {
+				sum += *d++ * v->data[j];
 			}
+			w->data[i] = sum;
+		}
+		return 0;
+	}
 
-			/* TODO: Extend with a check against epsilon? */
-			if (col != 0.0 && row != 0.0) {
-				row2 = row / 2.0;
-				col2 = 1.0;
-				sum = col + row;
-
-				while (col < row2) {
-					col2 *= 2.0;
-					col *= 4.0;
-				}
-
-				row2 = row * 2.0;
-
-				while (col > row2) {
-					col2 /= 2.0;
-					col /= 4.0;
-				}
-
-				if ((col + row) / col2 < 0.95 * sum) {
-					done = false;
-					row2 = 1.0 / col2;
-
-					for (int k = 0; k < m->sz_rows; k++) {
-						mout->data[(i * m->sz_rows) + k]
-							*= row2;
-						mout->data[(k * m->sz_rows) + i]
-							*= col2;
-					}
-				}
+	/* Row 'i' of the lower triangle gives the start of w[i]. For a
+	 * symmetric matrix, it is also column 'i' of the upper triangle,
+	 * whose contribution is scattered into the earlier elements of 'w'. */
+	for (size_t i = 0; i < n; i++) {
+		sum = 0.0;
+		for (size_t j = 0; j < i; j++) {
+			sum += d[j] * v->data[j];
+			if (p->type == ZSL_MTX_PACKED_SYM) {
+				w->data[j] += d[j] * v->data[i];
 			}
-
-			row = 0.0;
-			col = 0.0;
 		}
+		w->data[i] = sum + d[i] * v->data[i];
+		d += i + 1;
 	}
 
-err:
-	return rc;
+	return 0;
 }
 
 int
-zsl_mtx_householder(struct zsl_mtx *m, struct zsl_mtx *h, bool hessenberg)
+zsl_mtx_packed_mult(struct zsl_mtx_packed *pa, struct zsl_mtx *mb,
+		    struct zsl_mtx *mc)
 {
-	size_t size = m->sz_rows;
-
-	if (hessenberg == true) {
-		size--;
-	}
-
-	ZSL_VECTOR_DEF(v, size);
-	ZSL_VECTOR_DEF(v2, m->sz_rows);
-	ZSL_VECTOR_DEF(e1, size);
-
-	ZSL_MATRIX_DEF(mv, size, 1);
-	ZSL_MATRIX_DEF(mvt, 1, size);
-	ZSL_MATRIX_DEF(id, size, size);
-	ZSL_MATRIX_DEF(vvt, size, size);
-	ZSL_MATRIX_DEF(h2, size, size);
-
-	/* Create the e1 vector, i.e. the vector (1, 0, 0, ...). */
-	zsl_vec_init(&e1);
-	e1.data[0] = 1.0;
+	size_t n = pa->sz;
+	size_t k = mb->sz_cols;
+	size_t j0, j1;
+	zsl_real_t x;
+	zsl_real_t *d = pa->data;
 
-	/* Get the first column of the input matrix. */
-	zsl_mtx_get_col(m, 0, v2.data);
-	if (hessenberg == true) {
-		zsl_vec_get_subset(&v2, 1, size, &v);
-	} else {
-		zsl_vec_copy(&v, &v2);
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((mb->sz_rows != n) || (mc->sz_rows != n) || (mc->sz_cols != k) ||
+	    (mb->data == mc->data)) {
+		return -EINVAL;
 	}
+#endif
 
-	/* Change the 'sign' value according to the sign of the first
-	 * coefficient of the matrix. */
-	zsl_real_t sign = 1.0;
-
-	if (v.data[0] < 0) {
-		sign = -1.0;
+	/* Every stored value a(i, j) adds a(i, j) * mb[j] to mc[i], plus
+	 * a(i, j) * mb[i] to mc[j] if it is mirrored. */
+	zsl_mtx_init(mc, NULL);
+	for (size_t i = 0; i < n; i++) {
+		j0 = (pa->type == ZSL_MTX_PACKED_UPPER) ? i : 0;
+		j1 = (pa->type == ZSL_MTX_PACKED_UPPER) ? n : i + 1;
+		for (size_t j = j0; j < j1; j++) {
+			x = *d++;
+			if (x == 0.0) {
+				continue;
+			}
+			for (size_t g = 0; g < k; g++) {
+				mc->data[(i * k) + g] +=
+					x * mb->data[(j * k) + g];
+			}
+			if (pa->type == ZSL_MTX_PACKED_SYM && j != i) {
+				for (size_t g = 0; g < k; g++) {
+					mc->data[(j * k) + g] +=
+						x * mb->data[(i * k) + g];
+				}
+			}
+		}
 	}
 
-	/* Calculate the vector 'v' that will later be used to calculate the
-	 * Householder matrix. */
-	zsl_vec_scalar_mult(&e1, -sign * zsl_vec_norm(&v));
-
-	zsl_vec_add(&v, &e1, &v);
-
-	zsl_vec_scalar_div(&v, zsl_vec_norm(&v));
-
-	/* Calculate the H householder matrix by doing:
-	 * H = IDENTITY - 2 * v * v^t. */
-	zsl_mtx_from_arr(&mv, v.data);
-	zsl_mtx_trans(&mv, &mvt);
-	zsl_mtx_mult(&mv, &mvt, &vvt);
-	zsl_mtx_init(&id, zsl_mtx_entry_fn_identity);
-	zsl_mtx_scalar_mult_d(&vvt, -2);
-	zsl_mtx_add(&id, &vvt, &h2);
-
-	/* If Hessenberg set to true, augment the output to the size of 'm'.
-	 * If Hessenberg set to false, this line of code will do nothing but
-	 * copy the matrix 'h2' into the output matrix 'h', */
-	zsl_mtx_augm_diag(&h2, h);
-
 	return 0;
 }
 
 int
-zsl_mtx_qrd(struct zsl_mtx *m, struct zsl_mtx *q, struct zsl_mtx *r,
-	    bool hessenberg)
+zsl_mtx_packed_congruence(struct zsl_mtx *f, struct zsl_mtx_packed *p,
+			  struct zsl_mtx_packed *po)
 {
-	ZSL_MATRIX_DEF(r2, m->sz_rows, m->sz_cols);
-	ZSL_MATRIX_DEF(hess, m->sz_rows, m->sz_cols);
-	ZSL_MATRIX_DEF(h, m->sz_rows, m->sz_rows);
-	ZSL_MATRIX_DEF(h2, m->sz_rows, m->sz_rows);
-	ZSL_MATRIX_DEF(qt, m->sz_rows, m->sz_rows);
-
-	zsl_mtx_init(&h, NULL);
-	zsl_mtx_init(&qt, zsl_mtx_entry_fn_identity);
-	zsl_mtx_copy(r, m);
-
-	for (size_t g = 0; g < (m->sz_rows - 1); g++) {
-
-		/* Reduce the matrix by 'g' rows and columns each time. */
-		ZSL_MATRIX_DEF(mred, (m->sz_rows - g), (m->sz_cols - g));
-		ZSL_MATRIX_DEF(hred, (m->sz_rows - g), (m->sz_rows - g));
-
-		/* allocate the placeholder matrices for the reduction loop */
-		ZSL_MATRIX_DEF(place1, r->sz_rows, r->sz_cols);
-		ZSL_MATRIX_DEF(place2, r->sz_rows, r->sz_cols);
-
-		while(zsl_mtx_reduce_iter(r, &mred, &place1, &place2) != 0);
+	size_t m = f->sz_rows;
+	size_t n = f->sz_cols;
+	zsl_real_t t[n];
+	zsl_real_t sum;
+	zsl_real_t *fi;
 
-		/* Calculate the reduced Householder matrix 'hred'. */
-		if (hessenberg == true) {
-			zsl_mtx_householder(&mred, &hred, true);
-		} else {
-			zsl_mtx_householder(&mred, &hred, false);
-		}
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((p->sz != n) || (po->sz != m) || (p->type != ZSL_MTX_PACKED_SYM) ||
+	    (po->type != ZSL_MTX_PACKED_SYM) || (p->data == po->data)) {
+		return -EINVAL;
+	}
+#endif
 
-		/* Augment the Householder matrix to the input matrix size. */
-		zsl_mtx_augm_diag(&hred, &h);
-		zsl_mtx_mult(&h, r, &r2);
+	struct zsl_vec vf = { .sz = n };
+	struct zsl_vec vt = { .sz = n, .data = t };
 
-		/* Multiply this Householder matrix by the previous ones,
-		 * stacked in 'qt'. */
-		zsl_mtx_mult(&h, &qt, &h2);
-		zsl_mtx_copy(&qt, &h2);
-		if (hessenberg == true) {
-			zsl_mtx_mult(&r2, &h, &hess);
-			zsl_mtx_copy(r, &hess);
-		} else {
-			zsl_mtx_copy(r, &r2);
+	/* Row 'i' of the output is f * (p * f[i]t), and only the elements up
+	 * to the diagonal are needed. */
+	for (size_t i = 0; i < m; i++) {
+		fi = &f->data[i * n];
+		vf.data = fi;
+		zsl_mtx_packed_mult_vec(p, &vf, &vt);
+		for (size_t j = 0; j <= i; j++) {
+			sum = 0.0;
+			for (size_t g = 0; g < n; g++) {
+				sum += f->data[(j * n) + g] * t[g];
+			}
+			po->data[((i * (i + 1)) / 2) + j] = sum;
 		}
 	}
 
-	/* Calculate the 'q' matrix by transposing 'qt'. */
-	zsl_mtx_trans(&qt, q);
-
 	return 0;
 }
 
-#ifndef CONFIG_ZSL_SINGLE_PRECISION
 int
-zsl_mtx_qrd_iter(struct zsl_mtx *m, struct zsl_mtx *mout, size_t iter)
+zsl_mtx_packed_cholesky(struct zsl_mtx_packed *p, struct zsl_mtx_packed *l)
 {
-	int rc;
-
-	ZSL_MATRIX_DEF(q, m->sz_rows, m->sz_rows);
-	ZSL_MATRIX_DEF(r, m->sz_rows, m->sz_rows);
-
+	size_t n = p->sz;
+	zsl_real_t sum;
+	zsl_real_t *li, *lj;
 
-	/* Make a copy of 'm'. */
-	rc = zsl_mtx_copy(mout, m);
-	if (rc) {
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((l->sz != n) || (p->type != ZSL_MTX_PACKED_SYM) ||
+	    (l->type != ZSL_MTX_PACKED_LOWER)) {
 		return -EINVAL;
 	}
+#endif
 
-	for (size_t g = 1; g <= iter; g++) {
-		/* Perform the QR decomposition. */
-		zsl_mtx_qrd(mout, &q, &r, false);
-
-		/* Multiply the results of the QR decomposition together but
-		 * changing its order. */
-		zsl_mtx_mult(&r, &q, mout);
+	/* Row by row (Cholesky-Banachiewicz), so that both triangles are
+	 * read and written in storage order. Each value of 'p' is read just
+	 * before the matching value of 'l' is written, so this also works in
+	 * place. */
+	for (size_t i = 0; i < n; i++) {
+		li = &l->data[(i * (i + 1)) / 2];
+		for (size_t j = 0; j <= i; j++) {
+			lj = &l->data[(j * (j + 1)) / 2];
+			sum = p->data[((i * (i + 1)) / 2) + j];
+			for (size_t k = 0; k < j; k++) {
+				sum -= li[k] * lj[k];
+			}
+			if (j < i) {
+				li[j] = sum / lj[j];
+			} else if (sum > 0.0) {
+				li[i] = ZSL_SQRT(sum);
+			} else {
+				return -ESINGULAR;
+			}
+		}
 	}
 
 	return 0;
 }
-#endif
 
-#ifndef CONFIG_ZSL_SINGLE_PRECISION
 int
-zsl_mtx_eigenvalues(struct zsl_mtx *m, struct zsl_vec *v, size_t iter)
+zsl_mtx_packed_cholesky_solve(struct zsl_mtx_packed *l, struct zsl_vec *b,
+			      struct zsl_vec *x)
 {
-	zsl_real_t diag;
-	zsl_real_t sdiag;
-	size_t real = 0;
-
-	/* Epsilon is used to check 0 values in the subdiagonal, to determine
-	 * if any coimplekx values were found. Increasing the number of
-	 * iterations will move these values closer to 0, but when using
-	 * single-precision floats the numbers can still be quite large, so
-	 * we need to set a delta of +/- 0.001 in this case. */
-
-	zsl_real_t epsilon = 1E-6;
-
-	ZSL_MATRIX_DEF(mout, m->sz_rows, m->sz_rows);
-	ZSL_MATRIX_DEF(mtemp, m->sz_rows, m->sz_rows);
-	ZSL_MATRIX_DEF(mtemp2, m->sz_rows, m->sz_rows);
-
-	/* Balance the matrix. */
-	zsl_mtx_balance(m, &mtemp);
-
-	/* Put the balanced matrix into hessenberg form. */
-	zsl_mtx_qrd(&mtemp, &mout, &mtemp2, true);
-
-	/* Calculate the upper triangular matrix by using the recursive QR
-	 * decomposition method. */
-	zsl_mtx_qrd_iter(&mtemp2, &mout, iter);
-
-	zsl_vec_init(v);
-
-	/* If the matrix is symmetric, then it will always have real
-	 * eigenvalues, so treat this case appart. */
-	if (zsl_mtx_is_sym(m) == true) {
-		for (size_t g = 0; g < m->sz_rows; g++) {
-			zsl_mtx_get(&mout, g, g, &diag);
-			v->data[g] = diag;
-		}
+	size_t n = l->sz;
+	zsl_real_t *li;
+	zsl_real_t w;
 
-		return 0;
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((b->sz != n) || (x->sz != n) ||
+	    (l->type != ZSL_MTX_PACKED_LOWER)) {
+		return -EINVAL;
 	}
+#endif
 
-	/*
-	 * If any value just below the diagonal is non-zero, it means that the
-	 * numbers above and to the right of the non-zero value are a pair of
-	 * complex values, a complex number and its conjugate.
-	 *
-	 * SVD will always return real numbers so this can be ignored, but if
-	 * you are calculating eigenvalues outside the SVD method, you may
-	 * get complex numbers, which will be indicated with the return error
-	 * code '-ECOMPLEXVAL'.
-	 *
-	 * If the imput matrix has complex eigenvalues, then these will be
-	 * ignored and the output vector will not include them.
-	 *
-	 * NOTE: The real and imaginary parts of the complex numbers are not
-	 * available. This only checks if there are any complex eigenvalues and
-	 * returns an appropriate error code to alert the user that there are
-	 * non-real eigenvalues present.
-	 */
-
-	for (size_t g = 0; g < (m->sz_rows - 1); g++) {
-		/* Check if any element just below the diagonal isn't zero. */
-		zsl_mtx_get(&mout, g + 1, g, &sdiag);
-		if ((sdiag >= epsilon) || (sdiag <= -epsilon)) {
-			/* Skip two elements if the element below
-			 * is not zero. */
-			g++;
-		} else {
-			/* Get the diagonal element if the element below
-			 * is zero. */
-			zsl_mtx_get(&mout, g, g, &diag);
-			v->data[real] = diag;
-			real++;
+	for (size_t i = 0; i < n; i++) {
+		if (l->data[((i * (i + 1)) / 2) + i] == 0.0) {
+			return -ESINGULAR;
 		}
 	}
 
-
-	/* Since it's not possible to check the coefficient below the last
-	 * diagonal element, then check the element to its left. */
-	zsl_mtx_get(&mout, (m->sz_rows - 1), (m->sz_rows - 2), &sdiag);
-	if ((sdiag >= epsilon) || (sdiag <= -epsilon)) {
-		/* Do nothing if the element to its left is not zero. */
-	} else {
-		/* Get the last diagonal element if the element to its left
-		 * is zero. */
-		zsl_mtx_get(&mout, (m->sz_rows - 1), (m->sz_rows - 1), &diag);
-		v->data[real] = diag;
-		real++;
+	/* L * y = b, one row of L at a time. */
+	for (size_t i = 0; i < n; i++) {
+		li = &l->data[(i * (i + 1)) / 2];
+		w = b->data[i];
+		for (size_t k = 0; k < i; k++) {
+			w -= li[k] * x->data[k];
+		}
+		x->data[i] = w / li[i];
 	}
 
-	/* If the number of real eigenvalues ('real' coefficient) is less than
-	 * the matrix dimensions, then there must be complex eigenvalues. */
-	v->sz = real;
-	if (real != m->sz_rows) {
-		return -ECOMPLEXVAL;
+	/* Lt * x = y. Row 'i' of L is column 'i' of Lt, so once x[i] is known
+	 * it is eliminated from the earlier elements. */
+	for (size_t i = n; i-- > 0;) {
+		li = &l->data[(i * (i + 1)) / 2];
+		x->data[i] /= li[i];
+		for (size_t k = 0; k < i; k++) {
+			x->data[k] -= li[k] * x->data[i];
+		}
 	}
 
-	/* Put the zeros to the end. */
-	zsl_vec_zte(v);
-
 	return 0;
 }
-#endif
 
-#ifndef CONFIG_ZSL_SINGLE_PRECISION
-int
-zsl_mtx_eigenvectors(struct zsl_mtx *m, struct zsl_mtx *mev, size_t iter,
-		     bool orthonormal)
+/**
+ * @brief Arguments of zsl_mtx_unary_op_range.
+ */
+struct zsl_mtx_unary_args {
+	struct zsl_mtx *m;
+	zsl_mtx_unary_op_t op;
+};
+
+/**
+ * @brief Applies a unary operation to elements 'start' to 'end' - 1 of a
+ *        matrix. Called through zsl_par_for.
+ */
+static int
+zsl_mtx_unary_op_range(void *arg, size_t start, size_t end)
 {
-	size_t b = 0;           /* Total number of eigenvectors. */
-	size_t e_vals = 0;      /* Number of unique eigenvalues. */
-	size_t count = 0;       /* Number of eigenvectors for an eigenvalue. */
-	size_t ga = 0;
-
-	zsl_real_t epsilon = 1E-6;
-	zsl_real_t x;
-
-	/* The vector where all eigenvalues will be stored. */
-	ZSL_VECTOR_DEF(k, m->sz_rows);
-	/* Temp vector to store column data. */
-	ZSL_VECTOR_DEF(f, m->sz_rows);
-	/* The vector where all UNIQUE eigenvalues will be stored. */
-	ZSL_VECTOR_DEF(o, m->sz_rows);
-	/* Temporary mxm identity matrix placeholder. */
-	ZSL_MATRIX_DEF(id, m->sz_rows, m->sz_rows);
-	/* 'm' minus the eigenvalues * the identity matrix (id). */
-	ZSL_MATRIX_DEF(mi, m->sz_rows, m->sz_rows);
-	/* Placeholder for zsl_mtx_gauss_reduc calls (required param). */
-	ZSL_MATRIX_DEF(mid, m->sz_rows, m->sz_rows);
-	/* Matrix containing all column eigenvectors for an eigenvalue. */
-	ZSL_MATRIX_DEF(evec, m->sz_rows, m->sz_rows);
-	/* Matrix containing all column eigenvectors for an eigenvalue.
-	* Two matrices are required for the Gramm-Schmidt operation. */
-	ZSL_MATRIX_DEF(evec2, m->sz_rows, m->sz_rows);
-	/* Matrix containing all column eigenvectors. */
-	ZSL_MATRIX_DEF(mev2, m->sz_rows, m->sz_rows);
-
-	/* TODO: Check that we have a SQUARE matrix, etc. */
-	zsl_mtx_init(&mev2, NULL);
-	zsl_vec_init(&o);
-	zsl_mtx_eigenvalues(m, &k, iter);
-
-	/* Copy every non-zero eigenvalue ONCE in the 'o' vector to get rid of
-	 * repeated values. */
-	for (size_t q = 0; q < m->sz_rows; q++) {
-		if ((k.data[q] >= epsilon) || (k.data[q] <= -epsilon)) {
-			if (zsl_vec_contains(&o, k.data[q], epsilon) == 0) {
-				o.data[e_vals] = k.data[q];
-				/* Increment the unique eigenvalue counter. */
-				e_vals++;
-			}
-		}
-	}
+	struct zsl_mtx_unary_args *p = arg;
+	struct zsl_mtx *m = p->m;
+	zsl_mtx_unary_op_t op = p->op;
 
-	/* If zero is also an eigenvalue, copy it once in 'o'. */
+	/* Execute the unary operation component by component. */
+	for (size_t i = start; i < end; i++) {
+		switch (op) {
+		case ZSL_MTX_UNARY_OP_INCREMENT:
+			m->data[i] += 1.0;
+			break;
+		case ZSL_MTX_UNARY_OP_DECREMENT:
+			m->data[i] -= 1.0;
+			break;
+		case ZSL_MTX_UNARY_OP_NEGATIVE:
+			m->data[i] = -m->data[i];
+			break;
+		case ZSL_MTX_UNARY_OP_ROUND:
+			m->data[i] = ZSL_ROUND(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_ABS:
+			m->data[i] = ZSL_ABS(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_FLOOR:
+			m->data[i] = ZSL_FLOOR(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_CEIL:
+			m->data[i] = ZSL_CEIL(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_EXP:
+			m->data[i] = ZSL_EXP(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_LOG:
+			m->data[i] = ZSL_LOG(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_LOG10:
+			m->data[i] = ZSL_LOG10(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_SQRT:
+			m->data[i] = ZSL_SQRT(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_SIN:
+			m->data[i] = ZSL_SIN(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_COS:
+			m->data[i] = ZSL_COS(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_TAN:
+			m->data[i] = ZSL_TAN(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_ASIN:
+			m->data[i] = ZSL_ASIN(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_ACOS:
+			m->data[i] = ZSL_ACOS(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_ATAN:
+			m->data[i] = ZSL_ATAN(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_SINH:
+			m->data[i] = ZSL_SINH(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_COSH:
+			m->data[i] = ZSL_COSH(m->data[i]);
+			break;
+		case ZSL_MTX_UNARY_OP_TANH:
+			m->data[i] = ZSL_TANH(m->data[i]);
+			break;
+		default:
+			/* Not yet implemented! */
+			return -ENOSYS;
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_unary_op(struct zsl_mtx *m, zsl_mtx_unary_op_t op)
+{
+	struct zsl_mtx_unary_args args = { .m = m, .op = op };
+	size_t n = m->sz_rows * m->sz_cols;
+
+	return zsl_par_for(n, n, zsl_mtx_unary_op_range, &args);
+}
+
+int
+zsl_mtx_unary_func(struct zsl_mtx *m, zsl_mtx_unary_fn_t fn)
+{
+	int rc;
+
+	for (size_t i = 0; i < m->sz_rows; i++) {
+		for (size_t j = 0; j < m->sz_cols; j++) {
+			/* If fn is NULL, do nothing. */
+			if (fn != NULL) {
+				rc = fn(m, i, j);
+				if (rc) {
+					return rc;
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Arguments of zsl_mtx_binary_op_range.
+ */
+struct zsl_mtx_binary_args {
+	struct zsl_mtx *ma;
+	struct zsl_mtx *mb;
+	struct zsl_mtx *mc;
+	zsl_mtx_binary_op_t op;
+};
+
+/**
+ * @brief Applies a binary operation to elements 'start' to 'end' - 1 of
+ *        three matrices. Called through zsl_par_for.
+ */
+static int
+zsl_mtx_binary_op_range(void *arg, size_t start, size_t end)
+{
+	struct zsl_mtx_binary_args *p = arg;
+	struct zsl_mtx *ma = p->ma;
+	struct zsl_mtx *mb = p->mb;
+	struct zsl_mtx *mc = p->mc;
+	zsl_mtx_binary_op_t op = p->op;
+
+#ifdef asm_mtx_add
+	/* The platform backend has kernels for the common operations. */
+	switch (op) {
+	case ZSL_MTX_BINARY_OP_ADD:
+		asm_mtx_add(&ma->data[start], &mb->data[start],
+			    &mc->data[start], end - start);
+		return 0;
+	case ZSL_MTX_BINARY_OP_SUB:
+		asm_mtx_sub(&ma->data[start], &mb->data[start],
+			    &mc->data[start], end - start);
+		return 0;
+	case ZSL_MTX_BINARY_OP_MULT:
+		asm_mtx_mul(&ma->data[start], &mb->data[start],
+			    &mc->data[start], end - start);
+		return 0;
+	default:
+		break;
+	}
+#endif
+
+	/* Execute the binary operation component by component. */
+	for (size_t i = start; i < end; i++) {
+		switch (op) {
+		case ZSL_MTX_BINARY_OP_ADD:
+			mc->data[i] = ma->data[i] + mb->data[i];
+			break;
+		case ZSL_MTX_BINARY_OP_SUB:
+			mc->data[i] = ma->data[i] - mb->data[i];
+			break;
+		case ZSL_MTX_BINARY_OP_MULT:
+			mc->data[i] = ma->data[i] * mb->data[i];
+			break;
+		case ZSL_MTX_BINARY_OP_DIV:
+			if (mb->data[i] == 0.0) {
+				mc->data[i] = 0.0;
+			} else {
+				mc->data[i] = ma->data[i] / mb->data[i];
+			}
+			break;
+		case ZSL_MTX_BINARY_OP_MEAN:
+			mc->data[i] = (ma->data[i] + mb->data[i]) / 2.0;
+		case ZSL_MTX_BINARY_OP_EXPON:
+			mc->data[i] = ZSL_POW(ma->data[i], mb->data[i]);
+		case ZSL_MTX_BINARY_OP_MIN:
+			mc->data[i] = ma->data[i] < mb->data[i] ?
+				      ma->data[i] : mb->data[i];
+		case ZSL_MTX_BINARY_OP_MAX:
+			mc->data[i] = ma->data[i] > mb->data[i] ?
+				      ma->data[i] : mb->data[i];
+		case ZSL_MTX_BINARY_OP_EQUAL:
+			mc->data[i] = ma->data[i] == mb->data[i] ? 1.0 : 0.0;
+		case ZSL_MTX_BINARY_OP_NEQUAL:
+			mc->data[i] = ma->data[i] != mb->data[i] ? 1.0 : 0.0;
+		case ZSL_MTX_BINARY_OP_LESS:
+			mc->data[i] = ma->data[i] < mb->data[i] ? 1.0 : 0.0;
+		case ZSL_MTX_BINARY_OP_GREAT:
+			mc->data[i] = ma->data[i] > mb->data[i] ? 1.0 : 0.0;
+		case ZSL_MTX_BINARY_OP_LEQ:
+			mc->data[i] = ma->data[i] <= mb->data[i] ? 1.0 : 0.0;
+		case ZSL_MTX_BINARY_OP_GEQ:
+			mc->data[i] = ma->data[i] >= mb->data[i] ? 1.0 : 0.0;
+		default:
+			/* Not yet implemented! */
+			return -ENOSYS;
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_binary_op(struct zsl_mtx *ma, struct zsl_mtx *mb, struct zsl_mtx *mc,
+		  zsl_mtx_binary_op_t op)
+{
+	struct zsl_mtx_binary_args args = {
+		.ma = ma, .mb = mb, .mc = mc, .op = op
+	};
+	size_t n = ma->sz_rows * ma->sz_cols;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((ma->sz_rows != mb->sz_rows) || (mb->sz_rows != mc->sz_rows) ||
+	    (ma->sz_cols != mb->sz_cols) || (mb->sz_cols != mc->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	return zsl_par_for(n, n, zsl_mtx_binary_op_range, &args);
+}
+
+int
+zsl_mtx_binary_func(struct zsl_mtx *ma, struct zsl_mtx *mb,
+		    struct zsl_mtx *mc, zsl_mtx_binary_fn_t fn)
+{
+	int rc;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((ma->sz_rows != mb->sz_rows) || (mb->sz_rows != mc->sz_rows) ||
+	    (ma->sz_cols != mb->sz_cols) || (mb->sz_cols != mc->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < ma->sz_rows; i++) {
+		for (size_t j = 0; j < ma->sz_cols; j++) {
+			/* If fn is NULL, do nothing. */
+			if (fn != NULL) {
+				rc = fn(ma, mb, mc, i, j);
+				if (rc) {
+					return rc;
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_add(struct zsl_mtx *ma, struct zsl_mtx *mb, struct zsl_mtx *mc)
+{
+	return zsl_mtx_binary_op(ma, mb, mc, ZSL_MTX_BINARY_OP_ADD);
+}
+
+int
+zsl_mtx_add_d(struct zsl_mtx *ma, struct zsl_mtx *mb)
+{
+	return zsl_mtx_binary_op(ma, mb, ma, ZSL_MTX_BINARY_OP_ADD);
+}
+
+int
+zsl_mtx_sum_rows_d(struct zsl_mtx *m, size_t i, size_t j)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((i >= m->sz_rows) || (j >= m->sz_rows)) {
+		return -EINVAL;
+	}
+#endif
+
+	/* Add row j to row i, element by element. */
+	for (size_t x = 0; x < m->sz_cols; x++) {
+		m->data[(i * m->sz_cols) + x] += m->data[(j * m->sz_cols) + x];
+	}
+
+	return 0;
+}
+
+int zsl_mtx_sum_rows_scaled_d(struct zsl_mtx *m,
+			      size_t i, size_t j, zsl_real_t s)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((i >= m->sz_rows) || (j >= m->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	/* Set the values in row 'i' to 'i[n] += j[n] * s' . */
+	for (size_t x = 0; x < m->sz_cols; x++) {
+		m->data[(i * m->sz_cols) + x] +=
+			(m->data[(j * m->sz_cols) + x] * s);
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_sub(struct zsl_mtx *ma, struct zsl_mtx *mb, struct zsl_mtx *mc)
+{
+	return zsl_mtx_binary_op(ma, mb, mc, ZSL_MTX_BINARY_OP_SUB);
+}
+
+int
+zsl_mtx_sub_d(struct zsl_mtx *ma, struct zsl_mtx *mb)
+{
+	return zsl_mtx_binary_op(ma, mb, ma, ZSL_MTX_BINARY_OP_SUB);
+}
+
+/*
+ * Register block sizes for the matrix multiplication micro-kernel. The
+ * kernel keeps an MR x NR tile of the output in local accumulators, so these
+ * values are fixed by the unrolled code in zsl_mtx_mult_kernel.
+ */
+#define ZSL_MTX_MULT_MR 4
+#define ZSL_MTX_MULT_NR 4
+
+/*
+ * Depth of the packed 'mb' panel (KC x NR values). This bounds the extra stack
+ * used by zsl_mtx_mult, independent of the size of the input matrices.
+ */
+#ifndef CONFIG_ZSL_MTX_MULT_KC
+#define CONFIG_ZSL_MTX_MULT_KC 64
+#endif
+
+/**
+ * @brief Checks if the data arrays of matrices 'ma' and 'mb' overlap in memory.
+ */
+static bool
+zsl_mtx_overlaps(struct zsl_mtx *ma, struct zsl_mtx *mb)
+{
+	zsl_real_t *a_end = ma->data + (ma->sz_rows * ma->sz_cols);
+	zsl_real_t *b_end = mb->data + (mb->sz_rows * mb->sz_cols);
+
+	return (ma->data < b_end) && (mb->data < a_end);
+}
+
+/**
+ * @brief Copies a kc x nr block of 'b' (row stride 'rsb', column stride
+ *        'csb'), scaled by 'alpha', into the packed panel 'bp', where every
+ *        row of the panel is ZSL_MTX_MULT_NR values wide. Unused columns at
+ *        the right edge are zero-filled.
+ */
+static void
+zsl_mtx_mult_pack(const zsl_real_t *b, size_t rsb, size_t csb, size_t kc,
+		  size_t nr, zsl_real_t alpha, zsl_real_t *bp)
+{
+	for (size_t p = 0; p < kc; p++) {
+		for (size_t j = 0; j < ZSL_MTX_MULT_NR; j++) {
+			bp[j] = j < nr ? alpha * b[j * csb] : 0.0;
+		}
+		b += rsb;
+		bp += ZSL_MTX_MULT_NR;
+	}
+}
+
+#ifdef asm_mtx_mult_kernel
+/* Use the platform micro-kernel, which has the same contract. */
+#define zsl_mtx_mult_kernel asm_mtx_mult_kernel
+#else
+/**
+ * @brief Computes a full 4x4 tile of 'c' from four rows of 'a' and a packed
+ *        panel of 'b'. When 'acc' is true, the result is added to 'c',
+ *        otherwise 'c' is overwritten.
+ */
+static void
+zsl_mtx_mult_kernel(size_t kc, const zsl_real_t *a, size_t lda,
+		    const zsl_real_t *bp, zsl_real_t *c, size_t ldc, bool acc)
+{
+	const zsl_real_t *a0 = a;
+	const zsl_real_t *a1 = a0 + lda;
+	const zsl_real_t *a2 = a1 + lda;
+	const zsl_real_t *a3 = a2 + lda;
+	zsl_real_t c00 = 0.0, c01 = 0.0, c02 = 0.0, c03 = 0.0;
+	zsl_real_t c10 = 0.0, c11 = 0.0, c12 = 0.0, c13 = 0.0;
+	zsl_real_t c20 = 0.0, c21 = 0.0, c22 = 0.0, c23 = 0.0;
+	zsl_real_t c30 = 0.0, c31 = 0.0, c32 = 0.0, c33 = 0.0;
+	zsl_real_t b0, b1, b2, b3, x;
+
+	for (size_t p = 0; p < kc; p++) {
+		b0 = bp[0];
+		b1 = bp[1];
+		b2 = bp[2];
+		b3 = bp[3];
+		bp += ZSL_MTX_MULT_NR;
+
+		x = a0[p];
+		c00 += x * b0;
+		c01 += x * b1;
+		c02 += x * b2;
+		c03 += x * b3;
+
+		x = a1[p];
+		c10 += x * b0;
+		c11 += x * b1;
+		c12 += x * b2;
+		c13 += x * b3;
+
+		x = a2[p];
+		c20 += x * b0;
+		c21 += x * b1;
+		c22 += x * b2;
+		c23 += x * b3;
+
+		x = a3[p];
+		c30 += x * b0;
+		c31 += x * b1;
+		c32 += x * b2;
+		c33 += x * b3;
+	}
+
+	if (!acc) {
+		c[0] = 0.0;
+		c[1] = 0.0;
+		c[2] = 0.0;
+		c[3] = 0.0;
+		c[ldc] = 0.0;
+		c[ldc + 1] = 0.0;
+		c[ldc + 2] = 0.0;
+		c[ldc + 3] = 0.0;
+		c[2 * ldc] = 0.0;
+		c[2 * ldc + 1] = 0.0;
+		c[2 * ldc + 2] = 0.0;
+		c[2 * ldc + 3] = 0.0;
+		c[3 * ldc] = 0.0;
+		c[3 * ldc + 1] = 0.0;
+		c[3 * ldc + 2] = 0.0;
+		c[3 * ldc + 3] = 0.0;
+	}
+
+	c[0] += c00;
+	c[1] += c01;
+	c[2] += c02;
+	c[3] += c03;
+	c += ldc;
+	c[0] += c10;
+	c[1] += c11;
+	c[2] += c12;
+	c[3] += c13;
+	c += ldc;
+	c[0] += c20;
+	c[1] += c21;
+	c[2] += c22;
+	c[3] += c23;
+	c += ldc;
+	c[0] += c30;
+	c[1] += c31;
+	c[2] += c32;
+	c[3] += c33;
+}
+#endif
+
+/**
+ * @brief Computes a partial mr x nr tile of 'c' (mr, nr <= 4) at the bottom
+ *        or right edge of the output matrix.
+ */
+static void
+zsl_mtx_mult_kernel_edge(size_t mr, size_t nr, size_t kc, const zsl_real_t *a,
+			 size_t lda, const zsl_real_t *bp, zsl_real_t *c,
+			 size_t ldc, bool acc)
+{
+	zsl_real_t t[ZSL_MTX_MULT_MR][ZSL_MTX_MULT_NR] = { 0 };
+	zsl_real_t x;
+
+	for (size_t p = 0; p < kc; p++) {
+		for (size_t i = 0; i < mr; i++) {
+			x = a[i * lda + p];
+			for (size_t j = 0; j < nr; j++) {
+				t[i][j] += x * bp[j];
+			}
+		}
+		bp += ZSL_MTX_MULT_NR;
+	}
+
+	for (size_t i = 0; i < mr; i++) {
+		for (size_t j = 0; j < nr; j++) {
+			if (acc) {
+				c[i * ldc + j] += t[i][j];
+			} else {
+				c[i * ldc + j] = t[i][j];
+			}
+		}
+	}
+}
+
+/**
+ * @brief Blocked matrix multiplication kernel, vc = alpha * va * vb, or
+ *        vc += alpha * va * vb when 'acc' is true. 'vc' must not share
+ *        memory with 'va' or 'vb', and both 'va' and 'vc' must have a unit
+ *        column stride. 'vb' may have any strides.
+ *
+ * The shared dimension is split into blocks of CONFIG_ZSL_MTX_MULT_KC, so the
+ * rows of 'ma' being read stay in cache while every column panel of 'mb' is
+ * applied to them. Each panel of 'mb' is packed into a small contiguous
+ * buffer so the micro-kernel reads it sequentially instead of striding down
+ * the columns of 'mb'.
+ */
+static void
+zsl_mtx_mult_panel(struct zsl_mtx_view *va, struct zsl_mtx_view *vb,
+		   struct zsl_mtx_view *vc, zsl_real_t alpha, bool acc_c)
+{
+	zsl_real_t bp[CONFIG_ZSL_MTX_MULT_KC * ZSL_MTX_MULT_NR];
+	size_t m = va->sz_rows;
+	size_t n = vb->sz_cols;
+	size_t k = va->sz_cols;
+	size_t lda = va->row_stride;
+	size_t ldc = vc->row_stride;
+	size_t kc, mr, nr;
+	bool acc;
+
+	/* An empty inner dimension yields a zero product. */
+	if (k == 0) {
+		for (size_t i = 0; i < m && !acc_c; i++) {
+			memset(&vc->data[i * ldc], 0, n * sizeof(zsl_real_t));
+		}
+		return;
+	}
+
+	for (size_t pc = 0; pc < k; pc += CONFIG_ZSL_MTX_MULT_KC) {
+		kc = k - pc;
+		if (kc > CONFIG_ZSL_MTX_MULT_KC) {
+			kc = CONFIG_ZSL_MTX_MULT_KC;
+		}
+		/* Unless accumulating into 'vc', the first block initialises
+		 * it and the others accumulate. */
+		acc = acc_c || pc != 0;
+
+		for (size_t jc = 0; jc < n; jc += ZSL_MTX_MULT_NR) {
+			nr = n - jc;
+			if (nr > ZSL_MTX_MULT_NR) {
+				nr = ZSL_MTX_MULT_NR;
+			}
+			zsl_mtx_mult_pack(&vb->data[pc * vb->row_stride +
+						    jc * vb->col_stride],
+					  vb->row_stride, vb->col_stride, kc,
+					  nr, alpha, bp);
+
+			for (size_t ic = 0; ic < m; ic += ZSL_MTX_MULT_MR) {
+				mr = m - ic;
+				if (mr > ZSL_MTX_MULT_MR) {
+					mr = ZSL_MTX_MULT_MR;
+				}
+				if (mr == ZSL_MTX_MULT_MR &&
+				    nr == ZSL_MTX_MULT_NR) {
+					zsl_mtx_mult_kernel(kc,
+						&va->data[ic * lda + pc], lda,
+						bp, &vc->data[ic * ldc + jc],
+						ldc, acc);
+				} else {
+					zsl_mtx_mult_kernel_edge(mr, nr, kc,
+						&va->data[ic * lda + pc], lda,
+						bp, &vc->data[ic * ldc + jc],
+						ldc, acc);
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @brief Arguments of zsl_mtx_mult_rows.
+ */
+struct zsl_mtx_mult_args {
+	struct zsl_mtx_view *va;
+	struct zsl_mtx_view *vb;
+	struct zsl_mtx_view *vc;
+	zsl_real_t alpha;
+	bool acc;
+};
+
+/**
+ * @brief Computes blocks of ZSL_MTX_MULT_MR rows 'start' to 'end' - 1 of a
+ *        blocked multiplication. Called through zsl_par_for.
+ */
+static int
+zsl_mtx_mult_rows(void *arg, size_t start, size_t end)
+{
+	struct zsl_mtx_mult_args *p = arg;
+	struct zsl_mtx_view va = *p->va;
+	struct zsl_mtx_view vc = *p->vc;
+	size_t r0 = start * ZSL_MTX_MULT_MR;
+	size_t r1 = end * ZSL_MTX_MULT_MR;
+
+	if (r1 > va.sz_rows) {
+		r1 = va.sz_rows;
+	}
+
+	va.data += r0 * va.row_stride;
+	va.sz_rows = r1 - r0;
+	vc.data += r0 * vc.row_stride;
+	vc.sz_rows = r1 - r0;
+	zsl_mtx_mult_panel(&va, p->vb, &vc, p->alpha, p->acc);
+
+	return 0;
+}
+
+/**
+ * @brief Blocked matrix multiplication, with the same contract as
+ *        zsl_mtx_mult_panel. Large products are split by rows of 'vc'
+ *        between the threads of the parallel pool, if enabled.
+ */
+static void
+zsl_mtx_mult_blocked(struct zsl_mtx_view *va, struct zsl_mtx_view *vb,
+		     struct zsl_mtx_view *vc, zsl_real_t alpha, bool acc_c)
+{
+	struct zsl_mtx_mult_args args = {
+		.va = va, .vb = vb, .vc = vc, .alpha = alpha, .acc = acc_c
+	};
+	size_t blocks = (va->sz_rows + ZSL_MTX_MULT_MR - 1) / ZSL_MTX_MULT_MR;
+
+	zsl_par_for(blocks, va->sz_rows * va->sz_cols * vb->sz_cols,
+		    zsl_mtx_mult_rows, &args);
+}
+
+int
+zsl_mtx_mult(struct zsl_mtx *ma, struct zsl_mtx *mb, struct zsl_mtx *mc)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Ensure that ma has the same number as columns as mb has rows. */
+	if (ma->sz_cols != mb->sz_rows) {
+		return -EINVAL;
+	}
+
+	/* Ensure that mc has ma rows and mb cols */
+	if ((mc->sz_rows != ma->sz_rows) || (mc->sz_cols != mb->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	struct zsl_mtx_view va, vb, vc;
+
+	/* Small square operands use the unrolled kernels, which also accept
+	 * an output that aliases an input. 'mb' is either square as well, or
+	 * a single column. */
+	if (ma->sz_rows == ma->sz_cols && mb->sz_rows == ma->sz_rows) {
+		if (mb->sz_cols == ma->sz_rows) {
+			switch (ma->sz_rows) {
+			case 2:
+				return zsl_mtx22_mult(ma->data, mb->data,
+						      mc->data);
+			case 3:
+				return zsl_mtx33_mult(ma->data, mb->data,
+						      mc->data);
+			case 4:
+				return zsl_mtx44_mult(ma->data, mb->data,
+						      mc->data);
+			default:
+				break;
+			}
+		} else if (mb->sz_cols == 1) {
+			switch (ma->sz_rows) {
+			case 2:
+				return zsl_mtx22_mult_vec(ma->data, mb->data,
+							  mc->data);
+			case 3:
+				return zsl_mtx33_mult_vec(ma->data, mb->data,
+							  mc->data);
+			case 4:
+				return zsl_mtx44_mult_vec(ma->data, mb->data,
+							  mc->data);
+			default:
+				break;
+			}
+		}
+	}
+
+	zsl_mtx_view_init(ma, &va);
+	zsl_mtx_view_init(mb, &vb);
+
+	/* Only use a temporary output matrix if 'mc' aliases an input. */
+	if (zsl_mtx_overlaps(mc, ma) || zsl_mtx_overlaps(mc, mb)) {
+		ZSL_MATRIX_DEF(mc_tmp, mc->sz_rows, mc->sz_cols);
+		zsl_mtx_view_init(&mc_tmp, &vc);
+		zsl_mtx_mult_blocked(&va, &vb, &vc, 1.0, false);
+		memcpy(mc->data, mc_tmp.data,
+		       mc->sz_rows * mc->sz_cols * sizeof(zsl_real_t));
+		return 0;
+	}
+
+	zsl_mtx_view_init(mc, &vc);
+	zsl_mtx_mult_blocked(&va, &vb, &vc, 1.0, false);
+
+	return 0;
+}
+
+int
+zsl_mtx_mult_d(struct zsl_mtx *ma, struct zsl_mtx *mb)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Ensure that ma has the same number as columns as mb has rows. */
+	if (ma->sz_cols != mb->sz_rows) {
+		return -EINVAL;
+	}
+
+	/* Ensure that mb is a square matrix. */
+	if (mb->sz_rows != mb->sz_cols) {
+		return -EINVAL;
+	}
+#endif
+
+	zsl_mtx_mult(ma, mb, ma);
+
+	return 0;
+}
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+/**
+ * @brief Checks if the memory spanned by views 'va' and 'vb' overlaps. Since
+ *        both strides are positive, a view spans from its first to its last
+ *        element, so interleaved views are reported as overlapping.
+ */
+static bool
+zsl_mtx_view_overlaps(struct zsl_mtx_view *va, struct zsl_mtx_view *vb)
+{
+	zsl_real_t *a_end, *b_end;
+
+	if (va->sz_rows == 0 || va->sz_cols == 0 ||
+	    vb->sz_rows == 0 || vb->sz_cols == 0) {
+		return false;
+	}
+
+	a_end = &ZSL_MTX_VIEW_AT(va, va->sz_rows - 1, va->sz_cols - 1) + 1;
+	b_end = &ZSL_MTX_VIEW_AT(vb, vb->sz_rows - 1, vb->sz_cols - 1) + 1;
+
+	return (va->data < b_end) && (vb->data < a_end);
+}
+#endif
+
+int
+zsl_mtx_view_copy(struct zsl_mtx_view *vdest, struct zsl_mtx_view *vsrc)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((vdest->sz_rows != vsrc->sz_rows) ||
+	    (vdest->sz_cols != vsrc->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < vsrc->sz_rows; i++) {
+		for (size_t j = 0; j < vsrc->sz_cols; j++) {
+			ZSL_MTX_VIEW_AT(vdest, i, j) =
+				ZSL_MTX_VIEW_AT(vsrc, i, j);
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_view_add(struct zsl_mtx_view *va, struct zsl_mtx_view *vb,
+		 struct zsl_mtx_view *vc)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((va->sz_rows != vb->sz_rows) || (va->sz_cols != vb->sz_cols) ||
+	    (va->sz_rows != vc->sz_rows) || (va->sz_cols != vc->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < va->sz_rows; i++) {
+		for (size_t j = 0; j < va->sz_cols; j++) {
+			ZSL_MTX_VIEW_AT(vc, i, j) = ZSL_MTX_VIEW_AT(va, i, j) +
+						    ZSL_MTX_VIEW_AT(vb, i, j);
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Multiplies every element of view 'v' by 's'. A zero 's' clears the
+ *        view without reading it, so any NaN values it held are discarded.
+ */
+static void
+zsl_mtx_view_scale(struct zsl_mtx_view *v, zsl_real_t s)
+{
+	for (size_t i = 0; i < v->sz_rows; i++) {
+		for (size_t j = 0; j < v->sz_cols; j++) {
+			if (s == 0.0) {
+				ZSL_MTX_VIEW_AT(v, i, j) = 0.0;
+			} else {
+				ZSL_MTX_VIEW_AT(v, i, j) *= s;
+			}
+		}
+	}
+}
+
+/**
+ * @brief Computes vc = alpha * va * vb + beta * vc. 'vc' must not share
+ *        memory with 'va' or 'vb', and the shapes must already be checked.
+ */
+static void
+zsl_mtx_view_gemm(struct zsl_mtx_view *va, struct zsl_mtx_view *vb,
+		  zsl_real_t alpha, zsl_real_t beta, struct zsl_mtx_view *vc)
+{
+	zsl_real_t x;
+
+	/* The blocked kernel walks the rows of 'va' and 'vc' contiguously, so
+	 * it can handle any 'vb', including a transposed one. It overwrites
+	 * 'vc' itself when beta is zero. */
+	if (va->col_stride == 1 && vc->col_stride == 1 && alpha != 0.0) {
+		if (beta != 0.0 && beta != 1.0) {
+			zsl_mtx_view_scale(vc, beta);
+		}
+		zsl_mtx_mult_blocked(va, vb, vc, alpha, beta != 0.0);
+		return;
+	}
+
+	if (beta != 1.0) {
+		zsl_mtx_view_scale(vc, beta);
+	}
+	if (alpha == 0.0) {
+		return;
+	}
+
+	/* Otherwise add one rank-1 update per column of 'va', so the inner
+	 * loop runs along the rows of 'vb' and 'vc'. */
+	for (size_t p = 0; p < va->sz_cols; p++) {
+		for (size_t i = 0; i < vc->sz_rows; i++) {
+			x = alpha * ZSL_MTX_VIEW_AT(va, i, p);
+			for (size_t j = 0; j < vc->sz_cols; j++) {
+				ZSL_MTX_VIEW_AT(vc, i, j) +=
+					x * ZSL_MTX_VIEW_AT(vb, p, j);
+			}
+		}
+	}
+}
+
+int
+zsl_mtx_view_mult(struct zsl_mtx_view *va, struct zsl_mtx_view *vb,
+		  struct zsl_mtx_view *vc)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((va->sz_cols != vb->sz_rows) || (vc->sz_rows != va->sz_rows) ||
+	    (vc->sz_cols != vb->sz_cols)) {
+		return -EINVAL;
+	}
+
+	if (zsl_mtx_view_overlaps(vc, va) || zsl_mtx_view_overlaps(vc, vb)) {
+		return -EINVAL;
+	}
+#endif
+
+	zsl_mtx_view_gemm(va, vb, 1.0, 0.0, vc);
+
+	return 0;
+}
+
+int
+zsl_mtx_mult_ex(struct zsl_mtx *ma, bool trans_a, struct zsl_mtx *mb,
+		bool trans_b, zsl_real_t alpha, zsl_real_t beta,
+		struct zsl_mtx *mc)
+{
+	struct zsl_mtx_view va, vb, vc, vt;
+
+	zsl_mtx_view_init(ma, &va);
+	zsl_mtx_view_init(mb, &vb);
+	zsl_mtx_view_init(mc, &vc);
+	if (trans_a) {
+		zsl_mtx_view_trans(&va, &va);
+	}
+	if (trans_b) {
+		zsl_mtx_view_trans(&vb, &vb);
+	}
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((va.sz_cols != vb.sz_rows) || (vc.sz_rows != va.sz_rows) ||
+	    (vc.sz_cols != vb.sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	/* Only use a temporary product if 'mc' aliases an input. */
+	if (zsl_mtx_overlaps(mc, ma) || zsl_mtx_overlaps(mc, mb)) {
+		ZSL_MATRIX_DEF(mc_tmp, mc->sz_rows, mc->sz_cols);
+		zsl_mtx_view_init(&mc_tmp, &vt);
+		zsl_mtx_view_gemm(&va, &vb, alpha, 0.0, &vt);
+		if (beta != 1.0) {
+			zsl_mtx_view_scale(&vc, beta);
+		}
+		return zsl_mtx_view_add(&vc, &vt, &vc);
+	}
+
+	zsl_mtx_view_gemm(&va, &vb, alpha, beta, &vc);
+
+	return 0;
+}
+
+int
+zsl_mtx_syrk(struct zsl_mtx *ma, bool trans, zsl_real_t alpha,
+	     zsl_real_t beta, struct zsl_mtx *mc)
+{
+	size_t n = trans ? ma->sz_cols : ma->sz_rows;
+	size_t k = trans ? ma->sz_rows : ma->sz_cols;
+	zsl_real_t *a = ma->data;
+	zsl_real_t *c = mc->data;
+	zsl_real_t x;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((mc->sz_rows != n) || (mc->sz_cols != n)) {
+		return -EINVAL;
+	}
+
+	if (zsl_mtx_overlaps(mc, ma)) {
+		return -EINVAL;
+	}
+#endif
+
+	/* Only the lower triangle is computed, then mirrored. */
+	for (size_t i = 0; i < n; i++) {
+		for (size_t j = 0; j <= i; j++) {
+			c[(i * n) + j] = beta == 0.0 ? 0.0 :
+					 beta * c[(i * n) + j];
+		}
+	}
+
+	if (trans) {
+		/* A^T * A, as one rank-1 update per row of 'ma'. */
+		for (size_t p = 0; p < k; p++) {
+			for (size_t i = 0; i < n; i++) {
+				x = alpha * a[(p * n) + i];
+				for (size_t j = 0; j <= i; j++) {
+					c[(i * n) + j] += x * a[(p * n) + j];
+				}
+			}
+		}
+	} else {
+		/* A * A^T, as dot products between the rows of 'ma'. */
+		for (size_t i = 0; i < n; i++) {
+			for (size_t j = 0; j <= i; j++) {
+				x = 0.0;
+				for (size_t p = 0; p < k; p++) {
+					x += a[(i * k) + p] * a[(j * k) + p];
+				}
+				c[(i * n) + j] += alpha * x;
+			}
+		}
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		for (size_t j = 0; j < i; j++) {
+			c[(j * n) + i] = c[(i * n) + j];
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Arguments of zsl_mtx_gemv_range.
+ */
+struct zsl_mtx_gemv_args {
+	struct zsl_mtx *ma;
+	bool trans;
+	zsl_real_t alpha;
+	struct zsl_vec *x;
+	zsl_real_t beta;
+	struct zsl_vec *y;
+};
+
+/**
+ * @brief Computes elements 'start' to 'end' - 1 of the output of
+ *        zsl_mtx_gemv. Called through zsl_par_for.
+ */
+static int
+zsl_mtx_gemv_range(void *arg, size_t start, size_t end)
+{
+	struct zsl_mtx_gemv_args *p = arg;
+	size_t m = p->ma->sz_rows;
+	size_t n = p->ma->sz_cols;
+	zsl_real_t *a = p->ma->data;
+	zsl_real_t *x = p->x->data;
+	zsl_real_t *y = p->y->data;
+	zsl_real_t sum;
+
+	if (!p->trans) {
+		/* One dot product per row of 'ma'. */
+		for (size_t i = start; i < end; i++) {
+			sum = 0.0;
+			for (size_t j = 0; j < n; j++) {
+				sum += a[(i * n) + j] * x[j];
+			}
+			y[i] = p->beta == 0.0 ? p->alpha * sum :
+			       p->alpha * sum + p->beta * y[i];
+		}
+		return 0;
+	}
+
+	/* At * x, adding one scaled row of 'ma' at a time so that 'ma' is
+	 * still read along its rows. */
+	for (size_t j = start; j < end; j++) {
+		y[j] = p->beta == 0.0 ? 0.0 : p->beta * y[j];
+	}
+	for (size_t i = 0; i < m; i++) {
+		sum = p->alpha * x[i];
+		if (sum == 0.0) {
+			continue;
+		}
+		for (size_t j = start; j < end; j++) {
+			y[j] += sum * a[(i * n) + j];
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_gemv(struct zsl_mtx *ma, bool trans, zsl_real_t alpha,
+	     struct zsl_vec *x, zsl_real_t beta, struct zsl_vec *y)
+{
+	struct zsl_mtx_gemv_args args = {
+		.ma = ma, .trans = trans, .alpha = alpha,
+		.x = x, .beta = beta, .y = y
+	};
+	size_t m = trans ? ma->sz_cols : ma->sz_rows;
+	size_t n = trans ? ma->sz_rows : ma->sz_cols;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((x->sz != n) || (y->sz != m)) {
+		return -EINVAL;
+	}
+
+	if ((x->data < y->data + y->sz) && (y->data < x->data + x->sz)) {
+		return -EINVAL;
+	}
+#endif
+
+	return zsl_par_for(m, m * n, zsl_mtx_gemv_range, &args);
+}
+
+/**
+ * @brief Arguments of zsl_mtx_ger_rows.
+ */
+struct zsl_mtx_ger_args {
+	struct zsl_mtx *ma;
+	zsl_real_t alpha;
+	struct zsl_vec *x;
+	struct zsl_vec *y;
+};
+
+/**
+ * @brief Applies the rank-1 update of zsl_mtx_ger to rows 'start' to
+ *        'end' - 1. Called through zsl_par_for.
+ */
+static int
+zsl_mtx_ger_rows(void *arg, size_t start, size_t end)
+{
+	struct zsl_mtx_ger_args *p = arg;
+	size_t n = p->ma->sz_cols;
+	zsl_real_t *y = p->y->data;
+	zsl_real_t *ri;
+	zsl_real_t s;
+
+	for (size_t i = start; i < end; i++) {
+		s = p->alpha * p->x->data[i];
+		if (s == 0.0) {
+			continue;
+		}
+		ri = &p->ma->data[i * n];
+		for (size_t j = 0; j < n; j++) {
+			ri[j] += s * y[j];
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_ger(struct zsl_mtx *ma, zsl_real_t alpha, struct zsl_vec *x,
+	    struct zsl_vec *y)
+{
+	struct zsl_mtx_ger_args args = {
+		.ma = ma, .alpha = alpha, .x = x, .y = y
+	};
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((x->sz != ma->sz_rows) || (y->sz != ma->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	return zsl_par_for(ma->sz_rows, ma->sz_rows * ma->sz_cols,
+			   zsl_mtx_ger_rows, &args);
+}
+
+/**
+ * @brief Arguments of zsl_mtx_scalar_mult_range.
+ */
+struct zsl_mtx_scalar_args {
+	struct zsl_mtx *m;
+	zsl_real_t s;
+};
+
+/**
+ * @brief Multiplies elements 'start' to 'end' - 1 of a matrix by a scalar.
+ *        Called through zsl_par_for.
+ */
+static int
+zsl_mtx_scalar_mult_range(void *arg, size_t start, size_t end)
+{
+	struct zsl_mtx_scalar_args *p = arg;
+	zsl_real_t *d = p->m->data;
+
+#ifdef asm_mtx_scale
+	asm_mtx_scale(&d[start], p->s, end - start);
+#else
+	for (size_t i = start; i < end; i++) {
+		d[i] *= p->s;
+	}
+#endif
+
+	return 0;
+}
+
+int
+zsl_mtx_scalar_mult_d(struct zsl_mtx *m, zsl_real_t s)
+{
+	struct zsl_mtx_scalar_args args = { .m = m, .s = s };
+	size_t n = m->sz_rows * m->sz_cols;
+
+	return zsl_par_for(n, n, zsl_mtx_scalar_mult_range, &args);
+}
+
+int
+zsl_mtx_scalar_mult_row_d(struct zsl_mtx *m, size_t i, zsl_real_t s)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (i >= m->sz_rows) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t k = 0; k < m->sz_cols; k++) {
+		m->data[(i * m->sz_cols) + k] *= s;
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_trans(struct zsl_mtx *ma, struct zsl_mtx *mb)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Ensure that ma and mb have the same shape. */
+	if ((ma->sz_rows != mb->sz_cols) || (ma->sz_cols != mb->sz_rows)) {
+		return -EINVAL;
+	}
+#endif
+
+	struct zsl_mtx_view va, vb;
+
+	/* Small square matrices use the unrolled kernels. */
+	if (ma->sz_rows == ma->sz_cols) {
+		switch (ma->sz_rows) {
+		case 2:
+			return zsl_mtx22_trans(ma->data, mb->data);
+		case 3:
+			return zsl_mtx33_trans(ma->data, mb->data);
+		case 4:
+			return zsl_mtx44_trans(ma->data, mb->data);
+		default:
+			break;
+		}
+	}
+
+	zsl_mtx_view_init(ma, &va);
+	zsl_mtx_view_trans(&va, &va);
+	zsl_mtx_view_init(mb, &vb);
+
+	return zsl_mtx_view_copy(&vb, &va);
+}
+
+int
+zsl_mtx_adjoint_3x3(struct zsl_mtx *m, struct zsl_mtx *ma)
+{
+	/* Make sure this is a square matrix. */
+	if ((m->sz_rows != m->sz_cols) || (ma->sz_rows != ma->sz_cols)) {
+		return -EINVAL;
+	}
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure this is a 3x3 matrix. */
+	if ((m->sz_rows != 3) || (ma->sz_rows != 3)) {
+		return -EINVAL;
+	}
+#endif
+
+	/*
+	 * 3x3 matrix element to array table:
+	 *
+	 * 1,1 = 0  1,2 = 1  1,3 = 2
+	 * 2,1 = 3  2,2 = 4  2,3 = 5
+	 * 3,1 = 6  3,2 = 7  3,3 = 8
+	 */
+
+	ma->data[0] = m->data[4] * m->data[8] - m->data[7] * m->data[5];
+	ma->data[1] = m->data[7] * m->data[2] - m->data[1] * m->data[8];
+	ma->data[2] = m->data[1] * m->data[5] - m->data[4] * m->data[2];
+
+	ma->data[3] = m->data[6] * m->data[5] - m->data[3] * m->data[8];
+	ma->data[4] = m->data[0] * m->data[8] - m->data[6] * m->data[2];
+	ma->data[5] = m->data[3] * m->data[2] - m->data[0] * m->data[5];
+
+	ma->data[6] = m->data[3] * m->data[7] - m->data[6] * m->data[4];
+	ma->data[7] = m->data[6] * m->data[1] - m->data[0] * m->data[7];
+	ma->data[8] = m->data[0] * m->data[4] - m->data[3] * m->data[1];
+
+	return 0;
+}
+
+int
+zsl_mtx_adjoint(struct zsl_mtx *m, struct zsl_mtx *ma)
+{
+	/* Shortcut for 3x3 matrices. */
+	if (m->sz_rows == 3) {
+		return zsl_mtx_adjoint_3x3(m, ma);
+	}
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure this is a square matrix. */
+	if (m->sz_rows != m->sz_cols) {
+		return -EINVAL;
+	}
+#endif
+
+	zsl_real_t sign;
+	zsl_real_t d;
+	ZSL_MATRIX_DEF(mr, (m->sz_cols - 1), (m->sz_cols - 1));
+
+	for (size_t i = 0; i < m->sz_cols; i++) {
+		for (size_t j = 0; j < m->sz_cols; j++) {
+			sign = 1.0;
+			if ((i + j) % 2 != 0) {
+				sign = -1.0;
+			}
+			zsl_mtx_reduce(m, &mr, i, j);
+			zsl_mtx_deter(&mr, &d);
+			d *= sign;
+			zsl_mtx_set(ma, i, j, d);
+		}
+	}
+
+	return 0;
+}
+
+#ifndef CONFIG_ZSL_SINGLE_PRECISION
+int zsl_mtx_vec_wedge(struct zsl_mtx *m, struct zsl_vec *v)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure the dimensions of 'm' and 'v' match. */
+	if (v->sz != m->sz_cols || v->sz < 4 || m->sz_rows != (m->sz_cols - 1)) {
+		return -EINVAL;
+	}
+#endif
+
+	zsl_real_t d;
+	size_t p[m->sz_cols];
+
+	ZSL_MATRIX_DEF(A, m->sz_cols, m->sz_cols);
+	ZSL_VECTOR_DEF(Av, m->sz_cols);
+	ZSL_MATRIX_DEF(b, m->sz_cols, 1);
+
+	zsl_mtx_init(&A, NULL);
+	A.data[(m->sz_cols * m->sz_cols - 1)] = 1.0;
+
+	for (size_t i = 0; i < m->sz_rows; i++) {
+		zsl_mtx_get_row(m, i, Av.data);
+		zsl_mtx_set_row(&A, i, Av.data);
+	}
+
+	/* Factorise 'A' once, to get both its determinant and the solution
+	 * of A * v = (0, ..., 0, d). */
+	zsl_mtx_lu(&A, &A, p);
+	zsl_mtx_lu_det(&A, p, &d);
+	zsl_mtx_init(&b, NULL);
+	b.data[(m->sz_cols - 1)] = d;
+
+	/* Linearly dependent vectors have the null vector as wedge product. */
+	if (d != 0.0) {
+		zsl_mtx_lu_solve(&A, p, &b, &b);
+	}
+
+	zsl_vec_from_arr(v, b.data);
+
+	return 0;
+}
+#endif
+
+int
+zsl_mtx_reduce(struct zsl_mtx *m, struct zsl_mtx *mr, size_t i, size_t j)
+{
+	struct zsl_mtx_view vm, vr, src, dst;
+	size_t r = m->sz_rows;
+	size_t c = m->sz_cols;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure mr is 1 less than m. */
+	if (mr->sz_rows != m->sz_rows - 1) {
+		return -EINVAL;
+	}
+	if (mr->sz_cols != m->sz_cols - 1) {
+		return -EINVAL;
+	}
+	if ((i >= m->sz_rows) || (j >= m->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	zsl_mtx_view_init(m, &vm);
+	zsl_mtx_view_init(mr, &vr);
+
+	/* Copy the four blocks around row 'i' and column 'j'. */
+	zsl_mtx_view_block(&vm, &src, 0, 0, i, j);
+	zsl_mtx_view_block(&vr, &dst, 0, 0, i, j);
+	zsl_mtx_view_copy(&dst, &src);
+
+	zsl_mtx_view_block(&vm, &src, 0, j + 1, i, c - j - 1);
+	zsl_mtx_view_block(&vr, &dst, 0, j, i, c - j - 1);
+	zsl_mtx_view_copy(&dst, &src);
+
+	zsl_mtx_view_block(&vm, &src, i + 1, 0, r - i - 1, j);
+	zsl_mtx_view_block(&vr, &dst, i, 0, r - i - 1, j);
+	zsl_mtx_view_copy(&dst, &src);
+
+	zsl_mtx_view_block(&vm, &src, i + 1, j + 1, r - i - 1, c - j - 1);
+	zsl_mtx_view_block(&vr, &dst, i, j, r - i - 1, c - j - 1);
+	zsl_mtx_view_copy(&dst, &src);
+
+	return 0;
+}
+
+int
+zsl_mtx_reduce_iter(struct zsl_mtx *m, struct zsl_mtx *mred, 
+				struct zsl_mtx *place1, struct zsl_mtx *place2)
+{
+	/* TODO: Properly check if matrix is square. */
+	if (m->sz_rows == place1->sz_rows) {
+		zsl_mtx_copy(place1, m);
+	}
+
+	if (place1->sz_rows == mred->sz_rows) {
+		zsl_mtx_copy(mred, place1);
+
+		/* restore the original placeholder size */
+		place1->sz_rows = m->sz_rows;
+		place1->sz_cols = m->sz_cols;
+		place2->sz_rows = m->sz_rows;
+		place2->sz_cols = m->sz_cols;
+		return 0;
+	}
+	
+	/* trick the iterative method by generating the inner
+	 * call intermediate matrix, adjusting its size
+	 */
+	place2->sz_rows = place1->sz_rows - 1;
+	place2->sz_cols = place1->sz_cols - 1;
+	zsl_mtx_reduce(place1, place2, 0, 0);
+
+	/* Do the same with the second placeholder matrix */
+	place1->sz_rows--;
+	place1->sz_cols--;
+	zsl_mtx_copy(place1, place2);
+
+	return -EAGAIN;
+}
+
+int
+zsl_mtx_augm_diag(struct zsl_mtx *m, struct zsl_mtx *maug)
+{
+	zsl_real_t x;
+	/* TODO: Properly check if matrix is square, and diff > 0. */
+	size_t diff = (maug->sz_rows) - (m->sz_rows);
+
+	zsl_mtx_init(maug, zsl_mtx_entry_fn_identity);
+	for (size_t i = 0; i < m->sz_rows; i++) {
+		for (size_t j = 0; j < m->sz_rows; j++) {
+			zsl_mtx_get(m, i, j, &x);
+			zsl_mtx_set(maug, i + diff, j + diff, x);
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_deter_3x3(struct zsl_mtx *m, zsl_real_t *d)
+{
+	/* Make sure this is a square matrix. */
+	if (m->sz_rows != m->sz_cols) {
+		return -EINVAL;
+	}
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure this is a 3x3 matrix. */
+	if (m->sz_rows != 3) {
+		return -EINVAL;
+	}
+#endif
+
+	/*
+	 * 3x3 matrix element to array table:
+	 *
+	 * 1,1 = 0  1,2 = 1  1,3 = 2
+	 * 2,1 = 3  2,2 = 4  2,3 = 5
+	 * 3,1 = 6  3,2 = 7  3,3 = 8
+	 */
+
+	*d = m->data[0] * (m->data[4] * m->data[8] - m->data[7] * m->data[5]);
+	*d -= m->data[3] * (m->data[1] * m->data[8] - m->data[7] * m->data[2]);
+	*d += m->data[6] * (m->data[1] * m->data[5] - m->data[4] * m->data[2]);
+
+	return 0;
+}
+
+int
+zsl_mtx_deter(struct zsl_mtx *m, zsl_real_t *d)
+{
+	/* Shortcut for 1x1 matrices. */
+	if (m->sz_rows == 1) {
+		*d = m->data[0];
+		return 0;
+	}
+
+	/* Shortcut for 2x2 matrices. */
+	if (m->sz_rows == 2) {
+		*d = m->data[0] * m->data[3] - m->data[2] * m->data[1];
+		return 0;
+	}
+
+	/* Shortcut for 3x3 matrices. */
+	if (m->sz_rows == 3) {
+		return zsl_mtx_deter_3x3(m, d);
+	}
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure this is a square matrix. */
+	if (m->sz_rows != m->sz_cols) {
+		return -EINVAL;
+	}
+#endif
+
+	/* Use the LU decomposition for larger matrices. */
+	int rc;
+	size_t p[m->sz_rows];
+	ZSL_MATRIX_DEF(lu, m->sz_rows, m->sz_cols);
+
+	rc = zsl_mtx_lu(m, &lu, p);
+	if (rc) {
+		return rc;
+	}
+
+	return zsl_mtx_lu_det(&lu, p, d);
+}
+
+/**
+ * @brief Adds row 'j' of view 'v', scaled by 's', to row 'i'.
+ */
+static void
+zsl_mtx_view_sum_rows_scaled(struct zsl_mtx_view *v, size_t i, size_t j,
+			     zsl_real_t s)
+{
+	for (size_t g = 0; g < v->sz_cols; g++) {
+		ZSL_MTX_VIEW_AT(v, i, g) += ZSL_MTX_VIEW_AT(v, j, g) * s;
+	}
+}
+
+int
+zsl_mtx_view_gauss_elim(struct zsl_mtx_view *v, struct zsl_mtx_view *vi,
+			size_t i, size_t j)
+{
+	zsl_real_t x, y;
+	zsl_real_t epsilon = 1E-6;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((i >= v->sz_rows) || (j >= v->sz_cols) ||
+	    (vi->sz_rows != v->sz_rows)) {
+		return -EINVAL;
+	}
+#endif
+
+	/* If the pivot is a zero value, don't do anything. */
+	y = ZSL_MTX_VIEW_AT(v, i, j);
+	if ((y >= 0 && y < epsilon) || (y <= 0 && y > -epsilon)) {
+		return 0;
+	}
+
+	/* Cycle through the view row by row, skipping row 'i'. */
+	for (size_t p = 0; p < v->sz_rows; p++) {
+		if (p == i) {
+			continue;
+		}
+		/* Get the value of (p, j), skipping the row if it is zero. */
+		x = ZSL_MTX_VIEW_AT(v, p, j);
+		if ((x >= epsilon) || (x <= -epsilon)) {
+			zsl_mtx_view_sum_rows_scaled(v, p, i, -(x / y));
+			zsl_mtx_view_sum_rows_scaled(vi, p, i, -(x / y));
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_gauss_elim(struct zsl_mtx *m, struct zsl_mtx *mg, struct zsl_mtx *mi,
+		   size_t i, size_t j)
+{
+	int rc;
+	struct zsl_mtx_view vg, vi;
+
+	/* Make a copy of matrix m. */
+	rc = zsl_mtx_copy(mg, m);
+	if (rc) {
+		return -EINVAL;
+	}
+
+	zsl_mtx_view_init(mg, &vg);
+	zsl_mtx_view_init(mi, &vi);
+
+	return zsl_mtx_view_gauss_elim(&vg, &vi, i, j);
+}
+
+int
+zsl_mtx_gauss_elim_d(struct zsl_mtx *m, struct zsl_mtx *mi, size_t i, size_t j)
+{
+	return zsl_mtx_gauss_elim(m, m, mi, i, j);
+}
+
+int
+zsl_mtx_gauss_reduc(struct zsl_mtx *m, struct zsl_mtx *mi,
+		    struct zsl_mtx *mg)
+{
+	zsl_real_t v[m->sz_rows];
+	zsl_real_t epsilon = 1E-6;
+	zsl_real_t x;
+	zsl_real_t y;
+
+	/* Copy the input matrix into 'mg' so all the changes will be done to
+	 * 'mg' and the input matrix will not be destroyed. */
+	zsl_mtx_copy(mg, m);
+
+	for (size_t k = 0; k < m->sz_rows; k++) {
+
+		/* Get every element in the diagonal. */
+		zsl_mtx_get(mg, k, k, &x);
+
+		/* If the diagonal element is zero, find another value in the
+		 * same column that isn't zero and add the row containing
+		 * the non-zero element to the diagonal element's row. */
+		if ((x >= 0 && x < epsilon) || (x <= 0 && x > -epsilon)) {
+			zsl_mtx_get_col(mg, k, v);
+			for (size_t q = 0; q < m->sz_rows; q++) {
+				zsl_mtx_get(mg, q, q, &y);
+				if ((v[q] >= epsilon) || (v[q] <= -epsilon)) {
+
+					/* If the non-zero element found is
+					 * above the diagonal, only add its row
+					 * if the diagonal element in this row
+					 * is zero, to avoid undoing previous
+					 * steps. */
+					if (q < k && ((y >= epsilon)
+						      || (y <= -epsilon))) {
+					} else {
+						zsl_mtx_sum_rows_d(mg, k, q);
+						zsl_mtx_sum_rows_d(mi, k, q);
+						break;
+					}
+				}
+			}
+		}
+
+		/* Perform the gaussian elimination in the column of the
+		 * diagonal element to get rid of all the values in the column
+		 * except for the diagonal one. */
+		zsl_mtx_gauss_elim_d(mg, mi, k, k);
+
+		/* Divide the diagonal element's row by the diagonal element. */
+		zsl_mtx_norm_elem_d(mg, mi, k, k);
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_gram_schmidt(struct zsl_mtx *m, struct zsl_mtx *mort)
+{
+	ZSL_VECTOR_DEF(v, m->sz_rows);
+	ZSL_VECTOR_DEF(w, m->sz_rows);
+	ZSL_VECTOR_DEF(q, m->sz_rows);
+
+	for (size_t t = 0; t < m->sz_cols; t++) {
+		zsl_vec_init(&q);
+		zsl_mtx_get_col(m, t, v.data);
+		for (size_t g = 0; g < t; g++) {
+			zsl_mtx_get_col(mort, g, w.data);
+
+			/* Calculate the projection of every column vector
+			 * before 'g' on the 't'th column. */
+			zsl_vec_project(&w, &v, &w);
+			zsl_vec_add(&q, &w, &q);
+		}
+
+		/* Substract the sum of the projections on the 't'th column from
+		 * the 't'th column and set this vector as the 't'th column of
+		 * the output matrix. */
+		zsl_vec_sub(&v, &q, &v);
+		zsl_mtx_set_col(mort, t, v.data);
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_view_norm(struct zsl_mtx_view *v, zsl_real_t *x)
+{
+	zsl_real_t sum = 0.0;
+
+	for (size_t i = 0; i < v->sz_rows; i++) {
+		for (size_t j = 0; j < v->sz_cols; j++) {
+			sum += ZSL_MTX_VIEW_AT(v, i, j) *
+			       ZSL_MTX_VIEW_AT(v, i, j);
+		}
+	}
+
+	*x = ZSL_SQRT(sum);
+
+	return 0;
+}
+
+int
+zsl_mtx_view_cols_norm(struct zsl_mtx_view *v, struct zsl_mtx_view *vnorm)
+{
+	struct zsl_mtx_view src, dst;
+	zsl_real_t norm;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((v->sz_rows != vnorm->sz_rows) || (v->sz_cols != vnorm->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t g = 0; g < v->sz_cols; g++) {
+		if (zsl_mtx_view_col(v, &src, g) ||
+		    zsl_mtx_view_col(vnorm, &dst, g)) {
+			return -EINVAL;
+		}
+		zsl_mtx_view_norm(&src, &norm);
+
+		/* Match zsl_vec_to_unit, which maps a zero vector to the
+		 * first unit vector. */
+		if (norm == 0.0) {
+			for (size_t i = 0; i < v->sz_rows; i++) {
+				ZSL_MTX_VIEW_AT(&dst, i, 0) = 0.0;
+			}
+			ZSL_MTX_VIEW_AT(&dst, 0, 0) = 1.0;
+			continue;
+		}
+
+		norm = 1.0 / norm;
+		for (size_t i = 0; i < v->sz_rows; i++) {
+			ZSL_MTX_VIEW_AT(&dst, i, 0) =
+				ZSL_MTX_VIEW_AT(&src, i, 0) * norm;
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_cols_norm(struct zsl_mtx *m, struct zsl_mtx *mnorm)
+{
+	struct zsl_mtx_view v, vnorm;
+
+	zsl_mtx_view_init(m, &v);
+	zsl_mtx_view_init(mnorm, &vnorm);
+
+	return zsl_mtx_view_cols_norm(&v, &vnorm);
+}
+
+int
+zsl_mtx_norm_elem(struct zsl_mtx *m, struct zsl_mtx *mn, struct zsl_mtx *mi,
+		  size_t i, size_t j)
+{
+	int rc;
+	zsl_real_t x;
+	zsl_real_t epsilon = 1E-6;
+
+	/* Make a copy of matrix m. */
+	rc = zsl_mtx_copy(mn, m);
+	if (rc) {
+		return -EINVAL;
+	}
+
+	/* Get the value to normalise. */
+	rc = zsl_mtx_get(mn, i, j, &x);
+	if (rc) {
+		return rc;
+	}
+
+	/* If the value is 0.0, abort. */
+	if ((x >= 0 && x < epsilon) || (x <= 0 && x > -epsilon)) {
+		return 0;
+	}
+
+	rc = zsl_mtx_scalar_mult_row_d(mn, i, (1.0 / x));
+	if (rc) {
+		return -EINVAL;
+	}
+
+	rc = zsl_mtx_scalar_mult_row_d(mi, i, (1.0 / x));
+	if (rc) {
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_norm_elem_d(struct zsl_mtx *m, struct zsl_mtx *mi, size_t i, size_t j)
+{
+	return zsl_mtx_norm_elem(m, m, mi, i, j);
+}
+
+int
+zsl_mtx_inv_3x3(struct zsl_mtx *m, struct zsl_mtx *mi)
+{
+	/* Make sure these are square matrices. */
+	if ((m->sz_rows != m->sz_cols) || (mi->sz_rows != mi->sz_cols)) {
+		return -EINVAL;
+	}
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure 'm' and 'mi' have the same shape. */
+	if (m->sz_rows != mi->sz_rows) {
+		return -EINVAL;
+	}
+	if (m->sz_cols != mi->sz_cols) {
+		return -EINVAL;
+	}
+	/* Make sure these are 3x3 matrices. */
+	if ((m->sz_cols != 3) || (mi->sz_cols != 3)) {
+		return -EINVAL;
+	}
+#endif
+
+	/* Provide an identity matrix if the determinant is zero. */
+	if (zsl_mtx33_inv(m->data, mi->data) == -ESINGULAR) {
+		return zsl_mtx_init(mi, zsl_mtx_entry_fn_identity);
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_inv(struct zsl_mtx *m, struct zsl_mtx *mi)
+{
+	int rc;
+
+	/* Make sure we have square matrices. */
+	if ((m->sz_rows != m->sz_cols) || (mi->sz_rows != mi->sz_cols)) {
+		return -EINVAL;
+	}
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure 'm' and 'mi' have the same shape. */
+	if (m->sz_rows != mi->sz_rows) {
+		return -EINVAL;
+	}
+	if (m->sz_cols != mi->sz_cols) {
+		return -EINVAL;
+	}
+#endif
+
+	/* Small matrices use the closed-form kernels. */
+	if (m->sz_rows >= 2 && m->sz_rows <= 4) {
+		if (m->sz_rows == 2) {
+			rc = zsl_mtx22_inv(m->data, mi->data);
+		} else if (m->sz_rows == 3) {
+			rc = zsl_mtx33_inv(m->data, mi->data);
+		} else {
+			rc = zsl_mtx44_inv(m->data, mi->data);
+		}
+		if (rc == -ESINGULAR) {
+			/* Provide an identity matrix if 'm' is singular. */
+			return zsl_mtx_init(mi, zsl_mtx_entry_fn_identity);
+		}
+		return rc;
+	}
+
+	/* Factorise a copy of matrix m on the stack to avoid modifying it. */
+	size_t p[m->sz_rows];
+	ZSL_MATRIX_DEF(lu, m->sz_rows, m->sz_cols);
+
+	rc = zsl_mtx_lu(m, &lu, p);
+	if (rc) {
+		return rc;
+	}
+
+	rc = zsl_mtx_lu_inv(&lu, p, mi);
+	if (rc == -ESINGULAR) {
+		/* Provide an identity matrix if 'm' is singular. */
+		return zsl_mtx_init(mi, zsl_mtx_entry_fn_identity);
+	}
+
+	return rc;
+}
+
+/**
+ * @brief Swaps rows 'i' and 'j' in matrix 'm'.
+ */
+static void
+zsl_mtx_swap_rows(struct zsl_mtx *m, size_t i, size_t j)
+{
+	zsl_real_t t;
+	zsl_real_t *ri = &m->data[i * m->sz_cols];
+	zsl_real_t *rj = &m->data[j * m->sz_cols];
+
+	for (size_t g = 0; g < m->sz_cols; g++) {
+		t = ri[g];
+		ri[g] = rj[g];
+		rj[g] = t;
+	}
+}
+
+/**
+ * @brief Arguments of zsl_mtx_lu_update.
+ */
+struct zsl_mtx_lu_args {
+	struct zsl_mtx *lu;
+	size_t k;
+};
+
+/**
+ * @brief Eliminates column 'k' from rows k + 1 + 'start' to k + 'end' of the
+ *        matrix being factorised by zsl_mtx_lu, storing the multipliers in
+ *        column 'k'. Called through zsl_par_for.
+ */
+static int
+zsl_mtx_lu_update(void *arg, size_t start, size_t end)
+{
+	struct zsl_mtx_lu_args *p = arg;
+	size_t n = p->lu->sz_cols;
+	size_t k = p->k;
+	zsl_real_t *rk = &p->lu->data[k * n];
+	zsl_real_t *ri;
+	zsl_real_t x;
+
+	for (size_t i = k + 1 + start; i < k + 1 + end; i++) {
+		ri = &p->lu->data[i * n];
+		x = ri[k] / rk[k];
+		ri[k] = x;
+		if (x == 0.0) {
+			continue;
+		}
+		for (size_t j = k + 1; j < n; j++) {
+			ri[j] -= x * rk[j];
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_lu(struct zsl_mtx *m, struct zsl_mtx *lu, size_t *p)
+{
+	struct zsl_mtx_lu_args args = { .lu = lu };
+	size_t n = m->sz_rows;
+	size_t r;
+	zsl_real_t x, max, piv;
+	zsl_real_t *rk;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure 'm' is square, and 'lu' has the same shape. */
+	if ((m->sz_rows != m->sz_cols) || (lu->sz_rows != m->sz_rows) ||
+	    (lu->sz_cols != m->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	/* Factorise in place if 'lu' and 'm' are the same matrix. */
+	if (lu->data != m->data) {
+		zsl_mtx_copy(lu, m);
+	}
+
+	for (size_t k = 0; k < n; k++) {
+		/* Find the largest element in column 'k' on or below the
+		 * diagonal, and use its row as the pivot row. */
+		r = k;
+		max = ZSL_ABS(lu->data[k * n + k]);
+		for (size_t i = k + 1; i < n; i++) {
+			x = ZSL_ABS(lu->data[i * n + k]);
+			if (x > max) {
+				max = x;
+				r = i;
+			}
+		}
+
+		p[k] = r;
+		if (r != k) {
+			zsl_mtx_swap_rows(lu, k, r);
+		}
+
+		/* A zero pivot means the whole column below the diagonal is
+		 * already zero, and 'm' is singular. Nothing to eliminate. */
+		rk = &lu->data[k * n];
+		piv = rk[k];
+		if (piv == 0.0) {
+			continue;
+		}
+
+		/* Store the multipliers (L) below the diagonal and update the
+		 * trailing submatrix (U). */
+		args.k = k;
+		zsl_par_for(n - k - 1, (n - k - 1) * (n - k - 1),
+			    zsl_mtx_lu_update, &args);
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Solves L * x = x in place by forward substitution, where L is the
+ *        lower triangle of 'l'. If 'unit' is true, the diagonal of 'l' is
+ *        ignored and assumed to be one.
+ */
+static void
+zsl_mtx_subst_fwd(struct zsl_mtx *l, struct zsl_mtx *x, bool unit)
+{
+	size_t n = l->sz_rows;
+	size_t nc = x->sz_cols;
+	zsl_real_t f;
+	zsl_real_t *xi, *xj;
+
+	for (size_t i = 0; i < n; i++) {
+		xi = &x->data[i * nc];
+		for (size_t j = 0; j < i; j++) {
+			f = l->data[i * n + j];
+			if (f == 0.0) {
+				continue;
+			}
+			xj = &x->data[j * nc];
+			for (size_t g = 0; g < nc; g++) {
+				xi[g] -= f * xj[g];
+			}
+		}
+		if (unit == false) {
+			f = l->data[i * n + i];
+			for (size_t g = 0; g < nc; g++) {
+				xi[g] /= f;
+			}
+		}
+	}
+}
+
+/**
+ * @brief Solves U * x = x in place by back substitution, where U is the
+ *        upper triangle of 'u'.
+ */
+static void
+zsl_mtx_subst_back(struct zsl_mtx *u, struct zsl_mtx *x)
+{
+	size_t n = u->sz_rows;
+	size_t nc = x->sz_cols;
+	zsl_real_t f;
+	zsl_real_t *xi, *xj;
+
+	for (size_t i = n; i-- > 0;) {
+		xi = &x->data[i * nc];
+		for (size_t j = i + 1; j < n; j++) {
+			f = u->data[i * n + j];
+			if (f == 0.0) {
+				continue;
+			}
+			xj = &x->data[j * nc];
+			for (size_t g = 0; g < nc; g++) {
+				xi[g] -= f * xj[g];
+			}
+		}
+		f = u->data[i * n + i];
+		for (size_t g = 0; g < nc; g++) {
+			xi[g] /= f;
+		}
+	}
+}
+
+/**
+ * @brief Solves Lt * x = x in place by back substitution, where L is the
+ *        lower triangle of 'l', without forming its transpose. If 'unit' is
+ *        true, the diagonal of 'l' is ignored and assumed to be one.
+ */
+static void
+zsl_mtx_subst_back_trans(struct zsl_mtx *l, struct zsl_mtx *x, bool unit)
+{
+	size_t n = l->sz_rows;
+	size_t nc = x->sz_cols;
+	zsl_real_t f;
+	zsl_real_t *xi, *xj;
+
+	for (size_t i = n; i-- > 0;) {
+		xi = &x->data[i * nc];
+		for (size_t j = i + 1; j < n; j++) {
+			f = l->data[j * n + i];
+			if (f == 0.0) {
+				continue;
+			}
+			xj = &x->data[j * nc];
+			for (size_t g = 0; g < nc; g++) {
+				xi[g] -= f * xj[g];
+			}
+		}
+		if (unit == false) {
+			f = l->data[i * n + i];
+			for (size_t g = 0; g < nc; g++) {
+				xi[g] /= f;
+			}
+		}
+	}
+}
+
+/**
+ * @brief Solves Ut * x = x in place by forward substitution, where U is the
+ *        upper triangle of 'u', without forming its transpose.
+ */
+static void
+zsl_mtx_subst_fwd_trans(struct zsl_mtx *u, struct zsl_mtx *x)
+{
+	size_t n = u->sz_rows;
+	size_t nc = x->sz_cols;
+	zsl_real_t f;
+	zsl_real_t *xi, *xj;
+
+	for (size_t i = 0; i < n; i++) {
+		xi = &x->data[i * nc];
+		for (size_t j = 0; j < i; j++) {
+			f = u->data[j * n + i];
+			if (f == 0.0) {
+				continue;
+			}
+			xj = &x->data[j * nc];
+			for (size_t g = 0; g < nc; g++) {
+				xi[g] -= f * xj[g];
+			}
+		}
+		f = u->data[i * n + i];
+		for (size_t g = 0; g < nc; g++) {
+			xi[g] /= f;
+		}
+	}
+}
+
+/**
+ * @brief Checks the shapes passed to the solve functions, and returns
+ *        -ESINGULAR if the diagonal of the square matrix 't' has a zero.
+ */
+static int
+zsl_mtx_solve_check(struct zsl_mtx *t, struct zsl_mtx *b, struct zsl_mtx *x)
+{
+	size_t n = t->sz_rows;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure 't' is square, and 'b' and 'x' have matching shapes. */
+	if ((t->sz_rows != t->sz_cols) || (b->sz_rows != n) ||
+	    (x->sz_rows != n) || (x->sz_cols != b->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	/* A zero on the diagonal means there is no unique solution. */
+	for (size_t i = 0; i < n; i++) {
+		if (t->data[i * n + i] == 0.0) {
+			return -ESINGULAR;
+		}
+	}
+
+	/* Solve in place if 'x' and 'b' are the same matrix. */
+	if (x->data != b->data) {
+		zsl_mtx_copy(x, b);
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_lu_solve(struct zsl_mtx *lu, size_t *p, struct zsl_mtx *b,
+		 struct zsl_mtx *x)
+{
+	int rc;
+
+	rc = zsl_mtx_solve_check(lu, b, x);
+	if (rc) {
+		return rc;
+	}
+
+	/* Apply the row interchanges to the right-hand side. */
+	for (size_t i = 0; i < lu->sz_rows; i++) {
+		if (p[i] != i) {
+			zsl_mtx_swap_rows(x, i, p[i]);
+		}
+	}
+
+	/* Forward substitution with the unit lower triangular factor L, then
+	 * back substitution with the upper triangular factor U. */
+	zsl_mtx_subst_fwd(lu, x, true);
+	zsl_mtx_subst_back(lu, x);
+
+	return 0;
+}
+
+int
+zsl_mtx_lu_det(struct zsl_mtx *lu, size_t *p, zsl_real_t *d)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure 'lu' is square. */
+	if (lu->sz_rows != lu->sz_cols) {
+		return -EINVAL;
+	}
+#endif
+
+	/* The determinant is the product of the diagonal of U, with the sign
+	 * flipped once for every row interchange. */
+	*d = 1.0;
+	for (size_t i = 0; i < lu->sz_rows; i++) {
+		*d *= lu->data[i * lu->sz_cols + i];
+		if (p[i] != i) {
+			*d = -*d;
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_lu_inv(struct zsl_mtx *lu, size_t *p, struct zsl_mtx *mi)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure 'lu' is square, and 'mi' has the same shape. */
+	if ((lu->sz_rows != lu->sz_cols) || (mi->sz_rows != lu->sz_rows) ||
+	    (mi->sz_cols != lu->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	/* Solve LU * mi = P * I, one column of the identity at a time. */
+	zsl_mtx_init(mi, zsl_mtx_entry_fn_identity);
+
+	return zsl_mtx_lu_solve(lu, p, mi, mi);
+}
+
+int
+zsl_mtx_solve(struct zsl_mtx *a, struct zsl_mtx *b, struct zsl_mtx *x)
+{
+	int rc;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure 'a' is square, and 'b' and 'x' have matching shapes. */
+	if ((a->sz_rows != a->sz_cols) || (b->sz_rows != a->sz_rows) ||
+	    (x->sz_rows != a->sz_rows) || (x->sz_cols != b->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	size_t p[a->sz_rows];
+
+	ZSL_MATRIX_DEF(lu, a->sz_rows, a->sz_cols);
+
+	/* Factorise a copy of 'a', so that the input is left untouched. */
+	rc = zsl_mtx_lu(a, &lu, p);
+	if (rc) {
+		return rc;
+	}
+
+	return zsl_mtx_lu_solve(&lu, p, b, x);
+}
+
+int
+zsl_mtx_norm_1(struct zsl_mtx *m, zsl_real_t *norm)
+{
+	zsl_real_t sum;
+
+	*norm = 0.0;
+	for (size_t j = 0; j < m->sz_cols; j++) {
+		sum = 0.0;
+		for (size_t i = 0; i < m->sz_rows; i++) {
+			sum += ZSL_ABS(m->data[(i * m->sz_cols) + j]);
+		}
+		/* Also stops at the first NaN, so that it is returned. */
+		if (!(sum <= *norm)) {
+			*norm = sum;
+			if (isnan(sum)) {
+				break;
+			}
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Function type used by 'zsl_mtx_inv_norm_est' to solve a * x = x
+ *        in place, or at * x = x if 'trans' is true.
+ */
+typedef void (*zsl_mtx_inv_solve_fn_t)(void *arg, struct zsl_mtx *x,
+				       bool trans);
+
+/**
+ * @brief Estimates the 1-norm of the inverse of an nxn matrix 'a' using only
+ *        solves with 'a' and its transpose, with Hager's method as refined
+ *        by Higham (the algorithm behind LAPACK's xLACON).
+ *
+ * Each step costs two solves, and at most five steps are taken. The result
+ * is a lower bound, which is nearly always within a factor of three of the
+ * true norm.
+ */
+static zsl_real_t
+zsl_mtx_inv_norm_est(size_t n, zsl_mtx_inv_solve_fn_t solve, void *arg)
+{
+	zsl_real_t est = 0.0;
+	zsl_real_t y, zx, zmax;
+	size_t j = n;
+	size_t jmax;
+
+	ZSL_MATRIX_DEF(v, n, 1);
+
+	for (size_t iter = 0; iter < 5; iter++) {
+		/* v = inv(a) * x, where x is e(j), or the vector of 1/n on the
+		 * first step, shown by j == n. */
+		for (size_t i = 0; i < n; i++) {
+			if (j == n) {
+				v.data[i] = 1.0 / (zsl_real_t)n;
+			} else {
+				v.data[i] = (i == j) ? 1.0 : 0.0;
+			}
+		}
+		solve(arg, &v, false);
+
+		/* Stop once the estimate no longer increases. */
+		y = 0.0;
+		for (size_t i = 0; i < n; i++) {
+			y += ZSL_ABS(v.data[i]);
+		}
+		if (iter > 0 && y <= est) {
+			break;
+		}
+		est = y;
+
+		/* v = inv(at) * sign(v), the gradient of the estimate. */
+		for (size_t i = 0; i < n; i++) {
+			v.data[i] = (v.data[i] < 0.0) ? -1.0 : 1.0;
+		}
+		solve(arg, &v, true);
+
+		/* Move to the unit vector with the steepest gradient, unless
+		 * that can't improve on x. */
+		jmax = 0;
+		zmax = 0.0;
+		zx = 0.0;
+		for (size_t i = 0; i < n; i++) {
+			if (ZSL_ABS(v.data[i]) > zmax) {
+				zmax = ZSL_ABS(v.data[i]);
+				jmax = i;
+			}
+			zx += v.data[i];
+		}
+		zx = (j == n) ? zx / (zsl_real_t)n : v.data[j];
+		if (zmax <= zx || jmax == j) {
+			break;
+		}
+		j = jmax;
+	}
+
+	/* Higham's extra test vector, which catches the matrices for which
+	 * the steps above are known to underestimate. */
+	for (size_t i = 0; i < n; i++) {
+		y = (n > 1) ? 1.0 + (zsl_real_t)i / (zsl_real_t)(n - 1) : 1.0;
+		v.data[i] = (i % 2) ? -y : y;
+	}
+	solve(arg, &v, false);
+	y = 0.0;
+	for (size_t i = 0; i < n; i++) {
+		y += ZSL_ABS(v.data[i]);
+	}
+	y = 2.0 * y / (3.0 * (zsl_real_t)n);
+
+	return (y > est) ? y : est;
+}
+
+/**
+ * @brief Arguments of zsl_mtx_lu_inv_solve.
+ */
+struct zsl_mtx_lu_inv_args {
+	struct zsl_mtx *lu;
+	size_t *p;
+};
+
+/**
+ * @brief Solves with the LU decomposition in 'arg', or with its transpose,
+ *        for zsl_mtx_inv_norm_est. Since P * m = L * U, mt = Ut * Lt * P.
+ */
+static void
+zsl_mtx_lu_inv_solve(void *arg, struct zsl_mtx *x, bool trans)
+{
+	struct zsl_mtx_lu_inv_args *a = arg;
+	size_t n = a->lu->sz_rows;
+
+	if (trans == false) {
+		for (size_t i = 0; i < n; i++) {
+			if (a->p[i] != i) {
+				zsl_mtx_swap_rows(x, i, a->p[i]);
+			}
+		}
+		zsl_mtx_subst_fwd(a->lu, x, true);
+		zsl_mtx_subst_back(a->lu, x);
+	} else {
+		zsl_mtx_subst_fwd_trans(a->lu, x);
+		zsl_mtx_subst_back_trans(a->lu, x, true);
+		for (size_t i = n; i-- > 0;) {
+			if (a->p[i] != i) {
+				zsl_mtx_swap_rows(x, i, a->p[i]);
+			}
+		}
+	}
+}
+
+int
+zsl_mtx_lu_rcond(struct zsl_mtx *lu, size_t *p, zsl_real_t anorm,
+		 zsl_real_t *rcond)
+{
+	struct zsl_mtx_lu_inv_args args = { .lu = lu, .p = p };
+	size_t n = lu->sz_rows;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure 'lu' is square. */
+	if (lu->sz_rows != lu->sz_cols) {
+		return -EINVAL;
+	}
+#endif
+
+	/* An exactly singular matrix has no inverse to estimate. */
+	*rcond = 0.0;
+	if (n == 0 || !(anorm > 0.0)) {
+		return 0;
+	}
+	for (size_t i = 0; i < n; i++) {
+		if (lu->data[i * n + i] == 0.0) {
+			return 0;
+		}
+	}
+
+	*rcond = 1.0 / (anorm * zsl_mtx_inv_norm_est(n, zsl_mtx_lu_inv_solve,
+						      &args));
+
+	return 0;
+}
+
+int
+zsl_mtx_solve_rcond(struct zsl_mtx *a, struct zsl_mtx *b, struct zsl_mtx *x,
+		    zsl_real_t *rcond)
+{
+	int rc;
+	zsl_real_t anorm;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure 'a' is square, and 'b' and 'x' have matching shapes. */
+	if ((a->sz_rows != a->sz_cols) || (b->sz_rows != a->sz_rows) ||
+	    (x->sz_rows != a->sz_rows) || (x->sz_cols != b->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	size_t p[a->sz_rows];
+
+	ZSL_MATRIX_DEF(lu, a->sz_rows, a->sz_cols);
+
+	zsl_mtx_norm_1(a, &anorm);
+	rc = zsl_mtx_lu(a, &lu, p);
+	if (rc) {
+		return rc;
+	}
+
+	/* The estimate only needs O(n^2) solves with the factors. */
+	rc = zsl_mtx_lu_rcond(&lu, p, anorm, rcond);
+	if (rc) {
+		return rc;
+	}
+
+	return zsl_mtx_lu_solve(&lu, p, b, x);
+}
+
+int
+zsl_mtx_residual_rel(struct zsl_mtx *a, struct zsl_mtx *x, struct zsl_mtx *b,
+		     zsl_real_t *res)
+{
+	zsl_real_t r, rnorm, anorm, xnorm, bnorm, sum;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if ((x->sz_rows != a->sz_cols) || (b->sz_rows != a->sz_rows) ||
+	    (b->sz_cols != x->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	/* The 1-norm of b - a * x, one column at a time, so that no
+	 * temporary matrix is needed. */
+	rnorm = 0.0;
+	for (size_t j = 0; j < b->sz_cols; j++) {
+		sum = 0.0;
+		for (size_t i = 0; i < a->sz_rows; i++) {
+			r = b->data[(i * b->sz_cols) + j];
+			for (size_t k = 0; k < a->sz_cols; k++) {
+				r -= a->data[(i * a->sz_cols) + k] *
+				     x->data[(k * x->sz_cols) + j];
+			}
+			sum += ZSL_ABS(r);
+		}
+		if (!(sum <= rnorm)) {
+			rnorm = sum;
+		}
+	}
+
+	zsl_mtx_norm_1(a, &anorm);
+	zsl_mtx_norm_1(x, &xnorm);
+	zsl_mtx_norm_1(b, &bnorm);
+
+	/* A zero denominator means a * x and b are both zero. */
+	sum = anorm * xnorm + bnorm;
+	*res = (sum > 0.0) ? rnorm / sum : rnorm;
+
+	return 0;
+}
+
+/*
+ * Maximum number of refinement steps taken by the mixed-precision solvers
+ * before giving up on the single-precision factorisation.
+ */
+#ifndef CONFIG_ZSL_MTX_MIXED_ITER_MAX
+#define CONFIG_ZSL_MTX_MIXED_ITER_MAX 10
+#endif
+
+/**
+ * @brief LU decomposition with partial pivoting of the nxn row-major single
+ *        precision matrix 'lu', in place. Same layout as @ref zsl_mtx_lu.
+ *
+ * @return 0 on success, or -ESINGULAR if a pivot is zero or not finite.
+ */
+static int
+zsl_mtx_lu_f32(float *lu, size_t n, size_t *p)
+{
+	size_t r;
+	float x, max, piv;
+	float *rk, *ri;
+
+	for (size_t k = 0; k < n; k++) {
+		r = k;
+		max = fabsf(lu[k * n + k]);
+		for (size_t i = k + 1; i < n; i++) {
+			x = fabsf(lu[i * n + k]);
+			if (x > max) {
+				max = x;
+				r = i;
+			}
+		}
+
+		/* Also catches an overflow when 'a' was rounded to float. */
+		if (!(max > 0.0f) || !isfinite(max)) {
+			return -ESINGULAR;
+		}
+
+		p[k] = r;
+		rk = &lu[k * n];
+		if (r != k) {
+			ri = &lu[r * n];
+			for (size_t j = 0; j < n; j++) {
+				x = rk[j];
+				rk[j] = ri[j];
+				ri[j] = x;
+			}
+		}
+
+		piv = rk[k];
+		for (size_t i = k + 1; i < n; i++) {
+			ri = &lu[i * n];
+			x = ri[k] / piv;
+			ri[k] = x;
+			if (x == 0.0f) {
+				continue;
+			}
+			for (size_t j = k + 1; j < n; j++) {
+				ri[j] -= x * rk[j];
+			}
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Solves LU * y = P * y in place, where 'lu' and 'p' come from
+ *        @ref zsl_mtx_lu_f32.
+ */
+static void
+zsl_mtx_lu_solve_f32(const float *lu, const size_t *p, size_t n, float *y)
+{
+	float w;
+
+	for (size_t i = 0; i < n; i++) {
+		if (p[i] != i) {
+			w = y[i];
+			y[i] = y[p[i]];
+			y[p[i]] = w;
+		}
+	}
+
+	for (size_t i = 0; i < n; i++) {
+		w = y[i];
+		for (size_t j = 0; j < i; j++) {
+			w -= lu[i * n + j] * y[j];
+		}
+		y[i] = w;
+	}
+
+	for (size_t i = n; i-- > 0;) {
+		w = y[i];
+		for (size_t j = i + 1; j < n; j++) {
+			w -= lu[i * n + j] * y[j];
+		}
+		y[i] = w / lu[i * n + i];
+	}
+}
+
+/**
+ * @brief Compact Householder QR decomposition of the mxn row-major single
+ *        precision matrix 'qr', with m >= n, in place. Same layout as
+ *        @ref zsl_mtx_qr.
+ *
+ * @return 0 on success, or -ESINGULAR if R has a zero or non-finite value on
+ *         its diagonal.
+ */
+static int
+zsl_mtx_qr_f32(float *qr, size_t m, size_t n, float *tau)
+{
+	float alpha, beta, xn, w;
+
+	for (size_t k = 0; k < n; k++) {
+		alpha = qr[k * n + k];
+		xn = 0.0f;
+		for (size_t i = k + 1; i < m; i++) {
+			xn += qr[i * n + k] * qr[i * n + k];
+		}
+
+		tau[k] = 0.0f;
+		if (xn != 0.0f) {
+			/* Reflect the column onto -sign(alpha) * ||x|| * e1,
+			 * storing v below the diagonal with v[0] = 1. */
+			beta = -copysignf(sqrtf(alpha * alpha + xn), alpha);
+			tau[k] = (beta - alpha) / beta;
+			w = 1.0f / (alpha - beta);
+			for (size_t i = k + 1; i < m; i++) {
+				qr[i * n + k] *= w;
+			}
+			qr[k * n + k] = beta;
+
+			for (size_t j = k + 1; j < n; j++) {
+				w = qr[k * n + j];
+				for (size_t i = k + 1; i < m; i++) {
+					w += qr[i * n + k] * qr[i * n + j];
+				}
+				w *= tau[k];
+				qr[k * n + j] -= w;
+				for (size_t i = k + 1; i < m; i++) {
+					qr[i * n + j] -= w * qr[i * n + k];
+				}
+			}
+		}
+
+		w = qr[k * n + k];
+		if (w == 0.0f || !isfinite(w)) {
+			return -ESINGULAR;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Applies the reflectors of @ref zsl_mtx_qr_f32 to the m-element
+ *        vector 'y' in place, computing Qt * y if 'trans' is true, and
+ *        Q * y otherwise.
+ */
+static void
+zsl_mtx_qr_apply_q_f32(const float *qr, const float *tau, size_t m,
+		       size_t n, bool trans, float *y)
+{
+	float w;
+
+	for (size_t s = 0; s < n; s++) {
+		size_t k = trans ? s : n - 1 - s;
+
+		if (tau[k] == 0.0f) {
+			continue;
+		}
+		w = y[k];
+		for (size_t i = k + 1; i < m; i++) {
+			w += qr[i * n + k] * y[i];
+		}
+		w *= tau[k];
+		y[k] -= w;
+		for (size_t i = k + 1; i < m; i++) {
+			y[i] -= w * qr[i * n + k];
+		}
+	}
+}
+
+/**
+ * @brief Solves the augmented least-squares system
+ *
+ *        | I   a | | dr |   | f |
+ *        | at  0 | | dx | = | g |
+ *
+ *        in place with the QR decomposition from @ref zsl_mtx_qr_f32, where
+ *        'f' has m elements and 'g' has n. On return, 'f' holds dr and 'g'
+ *        holds dx.
+ *
+ * With a = Q * R, this is Rt * h = g, [d1; d2] = Qt * f, R * dx = d1 - h
+ * and dr = Q * [h; d2], as described by Bjorck.
+ */
+static void
+zsl_mtx_qr_aug_f32(const float *qr, const float *tau, size_t m, size_t n,
+		   float *f, float *g)
+{
+	float w;
+
+	/* Rt * h = g, by forward substitution. */
+	for (size_t i = 0; i < n; i++) {
+		w = g[i];
+		for (size_t k = 0; k < i; k++) {
+			w -= qr[k * n + i] * g[k];
+		}
+		g[i] = w / qr[i * n + i];
+	}
+
+	zsl_mtx_qr_apply_q_f32(qr, tau, m, n, true, f);
+
+	/* Swap d1 - h into 'g' and h into 'f', then R * dx = d1 - h by back
+	 * substitution. */
+	for (size_t i = 0; i < n; i++) {
+		w = f[i] - g[i];
+		f[i] = g[i];
+		g[i] = w;
+	}
+	for (size_t i = n; i-- > 0;) {
+		w = g[i];
+		for (size_t k = i + 1; k < n; k++) {
+			w -= qr[i * n + k] * g[k];
+		}
+		g[i] = w / qr[i * n + i];
+	}
+
+	zsl_mtx_qr_apply_q_f32(qr, tau, m, n, false, f);
+}
+
+/**
+ * @brief Iterative refinement shared by the mixed-precision solvers.
+ *
+ * Each column of 'x' starts at zero, and is repeatedly corrected using the
+ * single-precision factorisation in 'f', from residuals accumulated in
+ * double precision. If 'p' is set, 'f' is an LU decomposition and the
+ * correction solves a * d = b - a * x. Otherwise, 'f' and 'tau' are a QR
+ * decomposition, and the least-squares residual is refined alongside 'x'
+ * using the augmented system, as refining 'x' alone stalls at single
+ * precision when the residual isn't zero. 'b' must not alias 'x'.
+ *
+ * A column has converged once the correction falls below the working
+ * precision of 'x'. If the corrections stop contracting first, the column is
+ * accepted as long as they are already below single-precision rounding:
+ * the error is then limited by the conditioning of 'a' rather than by the
+ * factorisation, as it would be for a direct solve in working precision.
+ *
+ * @return 0 if every column converged, or -ECONVERGE if the refinement
+ *         diverged or ran out of iterations.
+ */
+static int
+zsl_mtx_mixed_refine(struct zsl_mtx *a, struct zsl_mtx *b, struct zsl_mtx *x,
+		     const float *f, const size_t *p, const float *tau)
+{
+	size_t m = a->sz_rows;
+	size_t n = a->sz_cols;
+	size_t k = b->sz_cols;
+	bool aug = (p == NULL);
+	size_t ng = aug ? n : 0;
+	double rd[m + ng];
+	float r[m + ng];
+	zsl_real_t res[aug ? m : 1];
+	double acc, rn, dn, dprev, xn;
+	zsl_real_t *xj;
+	float *d;
+	bool done;
+
+	/* With the augmented system, the first m elements of 'r' hold the
+	 * correction to the residual, and the next n the correction to 'x'. */
+	d = &r[aug ? m : 0];
+
+	for (size_t j = 0; j < k; j++) {
+		for (size_t i = 0; i < n; i++) {
+			x->data[i * k + j] = 0.0;
+		}
+		for (size_t i = 0; i < m && aug; i++) {
+			res[i] = 0.0;
+		}
+
+		done = false;
+		dprev = 0.0;
+		for (size_t it = 0; it <= CONFIG_ZSL_MTX_MIXED_ITER_MAX; it++) {
+			/* b - res - a * x, and -at * res for the augmented
+			 * system, in double precision. */
+			rn = 0.0;
+			xj = &x->data[j];
+			for (size_t i = 0; i < m; i++) {
+				acc = b->data[i * k + j];
+				if (aug) {
+					acc -= res[i];
+				}
+				for (size_t g = 0; g < n; g++) {
+					acc -= (double)a->data[i * n + g] *
+					       (double)xj[g * k];
+				}
+				rd[i] = acc;
+				rn = fmax(rn, fabs(acc));
+			}
+			for (size_t g = 0; g < ng; g++) {
+				acc = 0.0;
+				for (size_t i = 0; i < m; i++) {
+					acc -= (double)a->data[i * n + g] *
+					       (double)res[i];
+				}
+				rd[m + g] = acc;
+				rn = fmax(rn, fabs(acc));
+			}
+			if (rn == 0.0) {
+				done = true;
+				break;
+			}
+
+			/* Scale the residuals before rounding them to float, so
+			 * they don't underflow as 'x' converges. */
+			for (size_t i = 0; i < m + ng; i++) {
+				r[i] = (float)(rd[i] / rn);
+			}
+			if (aug) {
+				zsl_mtx_qr_aug_f32(f, tau, m, n, r, d);
+				for (size_t i = 0; i < m; i++) {
+					res[i] += (zsl_real_t)((double)r[i] *
+							       rn);
+				}
+			} else {
+				zsl_mtx_lu_solve_f32(f, p, n, d);
+			}
+
+			/* x += d, tracking the norms of both. */
+			dn = 0.0;
+			xn = 0.0;
+			for (size_t i = 0; i < n; i++) {
+				acc = (double)d[i] * rn;
+				xj[i * k] += (zsl_real_t)acc;
+				dn = fmax(dn, fabs(acc));
+				xn = fmax(xn, fabs(xj[i * k]));
+			}
+
+			if (dn <= ZSL_EPSILON * xn) {
+				done = true;
+				break;
+			}
+			if (it > 0 && !(dn < 0.5 * dprev)) {
+				done = (dn <= FLT_EPSILON * xn);
+				break;
+			}
+			dprev = dn;
+		}
+
+		if (!done) {
+			return -ECONVERGE;
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_solve_mixed(struct zsl_mtx *a, struct zsl_mtx *b, struct zsl_mtx *x)
+{
+	size_t n = a->sz_rows;
+	int rc;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure 'a' is square, and 'b' and 'x' have matching shapes. */
+	if ((a->sz_rows != a->sz_cols) || (b->sz_rows != n) ||
+	    (x->sz_rows != n) || (x->sz_cols != b->sz_cols)) {
+		return -EINVAL;
+	}
+#endif
+
+	size_t p[n];
+	float lu[n * n];
+
+	zsl_real_t bd[(x->data == b->data) ? n * b->sz_cols : 1];
+	struct zsl_mtx bc = {
+		.sz_rows = n,
+		.sz_cols = b->sz_cols,
+		.data = bd
+	};
+
+	/* The refinement needs 'b' until the end, so keep a copy of it when
+	 * solving in place. */
+	if (x->data == b->data) {
+		zsl_mtx_copy(&bc, b);
+		b = &bc;
+	}
+
+	/* The O(n^3) factorisation is done in single precision ... */
+	for (size_t i = 0; i < n * n; i++) {
+		lu[i] = (float)a->data[i];
+	}
+	rc = zsl_mtx_lu_f32(lu, n, p);
+
+	/* ... and only the O(n^2) refinement steps in double precision. */
+	if (rc == 0) {
+		rc = zsl_mtx_mixed_refine(a, b, x, lu, p, NULL);
+	}
+
+	/* Fall back to a working-precision solve if 'a' is too badly
+	 * conditioned, or out of range, for a single-precision
+	 * factorisation. */
+	if (rc == -ESINGULAR || rc == -ECONVERGE) {
+		rc = zsl_mtx_solve(a, b, x);
+	}
+
+	return rc;
+}
+
+int
+zsl_mtx_solve_lower(struct zsl_mtx *l, struct zsl_mtx *b, struct zsl_mtx *x)
+{
+	int rc;
+
+	rc = zsl_mtx_solve_check(l, b, x);
+	if (rc) {
+		return rc;
+	}
+
+	zsl_mtx_subst_fwd(l, x, false);
+
+	return 0;
+}
+
+int
+zsl_mtx_solve_upper(struct zsl_mtx *u, struct zsl_mtx *b, struct zsl_mtx *x)
+{
+	int rc;
+
+	rc = zsl_mtx_solve_check(u, b, x);
+	if (rc) {
+		return rc;
+	}
+
+	zsl_mtx_subst_back(u, x);
+
+	return 0;
+}
+
+int
+zsl_mtx_cholesky(struct zsl_mtx *m, struct zsl_mtx *l)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure 'm' is square. */
+	if (m->sz_rows != m->sz_cols) {
+		return -EINVAL;
+	}
+
+	/* Make sure 'm' is symmetric. */
+	zsl_real_t a, b;
+	for (size_t i = 0; i < m->sz_rows; i++) {
+		for (size_t j = 0; j < m->sz_rows; j++) {
+			zsl_mtx_get(m, i, j, &a);
+			zsl_mtx_get(m, j, i, &b);
+			if (a != b) {
+				return -EINVAL;
+			}
+		}
+	}
+
+	/* Make sure 'm' and 'l' have the same shape. */
+	if (m->sz_rows != l->sz_rows) {
+		return -EINVAL;
+	}
+	if (m->sz_cols != l->sz_cols) {
+		return -EINVAL;
+	}
+#endif
+
+	zsl_real_t sum, x, y;
+	zsl_mtx_init(l, zsl_mtx_entry_fn_empty);
+	for (size_t j = 0; j < m->sz_cols; j++) {
+		sum = 0.0;
+		for (size_t k = 0; k < j; k++) {
+			zsl_mtx_get(l, j, k, &x);
+			sum += x * x;
+		}
+		zsl_mtx_get(m, j, j, &x);
+		zsl_mtx_set(l, j, j, ZSL_SQRT(x - sum));
+
+		for (size_t i = j + 1; i < m->sz_cols; i++) {
+			sum = 0.0;
+			for (size_t k = 0; k < j; k++) {
+				zsl_mtx_get(l, j, k, &x);
+				zsl_mtx_get(l, i, k, &y);
+				sum += y * x;
+			}
+			zsl_mtx_get(l, j, j, &x);
+			zsl_mtx_get(m, i, j, &y);
+			zsl_mtx_set(l, i, j, (y - sum) / x);
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_cholesky_solve(struct zsl_mtx *l, struct zsl_mtx *b,
+		       struct zsl_mtx *x)
+{
+	int rc;
+
+	rc = zsl_mtx_solve_check(l, b, x);
+	if (rc) {
+		return rc;
+	}
+
+	/* Solve L * y = b, followed by Lt * x = y. */
+	zsl_mtx_subst_fwd(l, x, false);
+	zsl_mtx_subst_back_trans(l, x, false);
+
+	return 0;
+}
+
+/**
+ * @brief Applies the rank-1 modification L * Lt + sign * v * vt to the
+ *        Cholesky factor 'l' in place, with 'sign' set to 1.0 or -1.0.
+ */
+static int
+zsl_mtx_cholesky_rank1(struct zsl_mtx *l, struct zsl_vec *v, zsl_real_t sign)
+{
+	size_t n = l->sz_rows;
+	zsl_real_t w[n];
+	zsl_real_t r, c, s, lkk;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure 'l' is square and 'v' has a matching size. */
+	if ((l->sz_rows != l->sz_cols) || (v->sz != n)) {
+		return -EINVAL;
+	}
+#endif
+
+	/* A zero on the diagonal means 'l' isn't a valid Cholesky factor. */
+	for (size_t k = 0; k < n; k++) {
+		if (l->data[k * n + k] == 0.0) {
+			return -ESINGULAR;
+		}
+	}
+
+	memcpy(w, v->data, n * sizeof(zsl_real_t));
+
+	/* When downdating, L * Lt - v * vt stays positive definite only if
+	 * the solution p of L * p = v has a norm lower than one. Check this
+	 * before modifying 'l', so that it is left untouched on failure. */
+	if (sign < 0.0) {
+		struct zsl_mtx p = {
+			.sz_rows = n,
+			.sz_cols = 1,
+			.data = w
+		};
+
+		zsl_mtx_subst_fwd(l, &p, false);
+		r = 0.0;
+		for (size_t k = 0; k < n; k++) {
+			r += w[k] * w[k];
+		}
+		if (r >= 1.0) {
+			return -ESINGULAR;
+		}
+
+		memcpy(w, v->data, n * sizeof(zsl_real_t));
+	}
+
+	/* Rotate 'w' into 'l' one column at a time. */
+	for (size_t k = 0; k < n; k++) {
+		lkk = l->data[k * n + k];
+		r = ZSL_SQRT(lkk * lkk + sign * w[k] * w[k]);
+		c = r / lkk;
+		s = w[k] / lkk;
+		l->data[k * n + k] = r;
+		for (size_t i = k + 1; i < n; i++) {
+			l->data[i * n + k] = (l->data[i * n + k] +
+					      sign * s * w[i]) / c;
+			w[i] = c * w[i] - s * l->data[i * n + k];
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_cholesky_update(struct zsl_mtx *l, struct zsl_vec *v)
+{
+	return zsl_mtx_cholesky_rank1(l, v, 1.0);
+}
+
+int
+zsl_mtx_cholesky_downdate(struct zsl_mtx *l, struct zsl_vec *v)
+{
+	return zsl_mtx_cholesky_rank1(l, v, -1.0);
+}
+
+int
+zsl_mtx_balance(struct zsl_mtx *m, struct zsl_mtx *mout)
+{
+	int rc;
+	bool done = false;
+	zsl_real_t sum;
+	zsl_real_t row = 0.0, row2;
+	zsl_real_t col = 0.0, col2;
+
+	/* Make sure we have square matrices. */
+	if ((m->sz_rows != m->sz_cols) || (mout->sz_rows != mout->sz_cols)) {
+		return -EINVAL;
+	}
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure 'm' and 'mout' have the same shape. */
+	if (m->sz_rows != mout->sz_rows) {
+		return -EINVAL;
+	}
+	if (m->sz_cols != mout->sz_cols) {
+		return -EINVAL;
+	}
+#endif
+
+	rc = zsl_mtx_copy(mout, m);
+	if (rc) {
+		goto err;
+	}
+
+	while (!done) {
+		done = true;
+
+		for (size_t i = 0; i < m->sz_rows; i++) {
+			/* Calculate sum of components of each row, column. */
+			for (size_t j = 0; j < m->sz_cols; j++) {
+				row += ZSL_ABS(mout->data[(i * m->sz_rows) +
+							  j]);
+				col += ZSL_ABS(mout->data[(j * m->sz_rows) +
+							  i]);
+			}
+
+			/* TODO: Extend with a check against epsilon? */
+			if (col != 0.0 && row != 0.0) {
+				row2 = row / 2.0;
+				col2 = 1.0;
+				sum = col + row;
+
+				while (col < row2) {
+					col2 *= 2.0;
+					col *= 4.0;
+				}
+
+				row2 = row * 2.0;
+
+				while (col > row2) {
+					col2 /= 2.0;
+					col /= 4.0;
+				}
+
+				if ((col + row) / col2 < 0.95 * sum) {
+					done = false;
+					row2 = 1.0 / col2;
+
+					for (int k = 0; k < m->sz_rows; k++) {
+						mout->data[(i * m->sz_rows) + k]
+							*= row2;
+						mout->data[(k * m->sz_rows) + i]
+							*= col2;
+					}
+				}
+			}
+
+			row = 0.0;
+			col = 0.0;
+		}
+	}
+
+err:
+	return rc;
+}
+
+zsl_real_t
+zsl_mtx_house(zsl_real_t *x, size_t stride, size_t len)
+{
+	zsl_real_t sigma = 0.0;
+	zsl_real_t beta, v0;
+
+	for (size_t i = 1; i < len; i++) {
+		sigma += x[i * stride] * x[i * stride];
+	}
+
+	/* Nothing to zero, at least not to working precision, so no reflection
+	 * is needed. Going ahead anyway would square values that are too
+	 * small to be represented accurately. */
+	if (sigma == 0.0 || sigma <= ZSL_EPSILON * ZSL_EPSILON * x[0] * x[0]) {
+		return 0.0;
+	}
+
+	beta = ZSL_SQRT(x[0] * x[0] + sigma);
+	if (x[0] < 0.0) {
+		beta = -beta;
+	}
+	v0 = -sigma / (x[0] + beta);
+
+	for (size_t i = 1; i < len; i++) {
+		x[i * stride] /= v0;
+	}
+	x[0] = beta;
+
+	/* Same as 2 * v0^2 / (sigma + v0^2), without squaring v0, which
+	 * could underflow. */
+	return -v0 / beta;
+}
+
+/**
+ * @brief Arguments of zsl_mtx_house_cols.
+ */
+struct zsl_mtx_house_args {
+	struct zsl_mtx *qr;
+	size_t k;
+	size_t r0;
+	zsl_real_t tau;
+	struct zsl_mtx *a;
+	size_t c0;
+};
+
+/**
+ * @brief Applies a reflector to columns c0 + 'start' to c0 + 'end' - 1, for
+ *        zsl_mtx_house_left. Called through zsl_par_for.
+ */
+static int
+zsl_mtx_house_cols(void *arg, size_t start, size_t end)
+{
+	struct zsl_mtx_house_args *p = arg;
+	struct zsl_mtx *qr = p->qr;
+	struct zsl_mtx *a = p->a;
+	size_t qc = qr->sz_cols;
+	size_t ac = a->sz_cols;
+	size_t k = p->k;
+	size_t r0 = p->r0;
+	zsl_real_t tau = p->tau;
+	zsl_real_t w;
+
+	for (size_t j = p->c0 + start; j < p->c0 + end; j++) {
+		w = a->data[(r0 * ac) + j];
+		for (size_t i = r0 + 1; i < a->sz_rows; i++) {
+			w += qr->data[(i * qc) + k] * a->data[(i * ac) + j];
+		}
+		w *= tau;
+		a->data[(r0 * ac) + j] -= w;
+		for (size_t i = r0 + 1; i < a->sz_rows; i++) {
+			a->data[(i * ac) + j] -= w * qr->data[(i * qc) + k];
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Applies the reflector stored by zsl_mtx_house in column 'k' of
+ *        'qr', starting at row 'r0', to rows 'r0' and below of columns 'c0'
+ *        to 'c1' - 1 of 'a', from the left. Column 'k' of 'qr' must not be
+ *        one of the columns being updated.
+ */
+static void
+zsl_mtx_house_left(struct zsl_mtx *qr, size_t k, size_t r0, zsl_real_t tau,
+		   struct zsl_mtx *a, size_t c0, size_t c1)
+{
+	struct zsl_mtx_house_args args = {
+		.qr = qr, .k = k, .r0 = r0, .tau = tau, .a = a, .c0 = c0
+	};
+
+	/* Every column is reflected independently. */
+	zsl_par_for(c1 - c0, (c1 - c0) * (a->sz_rows - r0) * 2,
+		    zsl_mtx_house_cols, &args);
+}
+
+/**
+ * @brief Reduces the square matrix 'h' to upper Hessenberg form in place,
+ *        H = Qt * h * Q. The reflectors that make up Q are stored below the
+ *        subdiagonal of 'h', with their coefficients in 'tau', which must
+ *        hold at least 'h->sz_rows' values.
+ */
+static void
+zsl_mtx_hessenberg(struct zsl_mtx *h, zsl_real_t *tau)
+{
+	size_t n = h->sz_rows;
+	zsl_real_t *a = h->data;
+	zsl_real_t w;
+
+	for (size_t k = 0; k < n; k++) {
+		tau[k] = 0.0;
+	}
+
+	for (size_t k = 0; k + 2 < n; k++) {
+		tau[k] = zsl_mtx_house(&a[((k + 1) * n) + k], n, n - k - 1);
+		if (tau[k] == 0.0) {
+			continue;
+		}
+
+		/* Apply it from the left, H = (I - tau * v * vt) * H ... */
+		zsl_mtx_house_left(h, k, k + 1, tau[k], h, k + 1, n);
+
+		/* ... and from the right, H = H * (I - tau * v * vt). */
+		for (size_t i = 0; i < n; i++) {
+			w = a[(i * n) + k + 1];
+			for (size_t j = k + 2; j < n; j++) {
+				w += a[(i * n) + j] * a[(j * n) + k];
+			}
+			w *= tau[k];
+			a[(i * n) + k + 1] -= w;
+			for (size_t j = k + 2; j < n; j++) {
+				a[(i * n) + j] -= w * a[(j * n) + k];
+			}
+		}
+	}
+}
+
+int
+zsl_mtx_householder(struct zsl_mtx *m, struct zsl_mtx *h, bool hessenberg)
+{
+	size_t off = hessenberg ? 1 : 0;
+	size_t len = m->sz_rows - off;
+	size_t diff = h->sz_rows - len;
+	zsl_real_t v[m->sz_rows];
+	zsl_real_t tau;
+
+	/* Get the part of the first column that should be reflected. */
+	for (size_t i = 0; i < len; i++) {
+		v[i] = m->data[(i + off) * m->sz_cols];
+	}
+	tau = zsl_mtx_house(v, 1, len);
+	v[0] = 1.0;
+
+	/* H = I - tau * v * vt, in the bottom-right corner of the identity
+	 * matrix 'h'. */
+	zsl_mtx_init(h, zsl_mtx_entry_fn_identity);
+	for (size_t i = 0; i < len; i++) {
+		for (size_t j = 0; j < len; j++) {
+			h->data[((i + diff) * h->sz_cols) + j + diff] -=
+				tau * v[i] * v[j];
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_qr(struct zsl_mtx *m, struct zsl_mtx *qr, struct zsl_vec *tau)
+{
+	size_t steps = m->sz_rows - 1;
+	size_t c = m->sz_cols;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (qr->sz_rows != m->sz_rows || qr->sz_cols != m->sz_cols ||
+	    tau->sz < (m->sz_rows < c ? m->sz_rows : c)) {
+		return -EINVAL;
+	}
+#endif
+
+	if (qr->data != m->data) {
+		zsl_mtx_copy(qr, m);
+	}
+
+	/* A tall matrix only needs one reflection per column. */
+	if (steps > c) {
+		steps = c;
+	}
+
+	for (size_t k = 0; k < tau->sz; k++) {
+		tau->data[k] = 0.0;
+	}
+
+	for (size_t k = 0; k < steps; k++) {
+		tau->data[k] = zsl_mtx_house(&qr->data[(k * c) + k], c,
+					     m->sz_rows - k);
+		if (tau->data[k] != 0.0) {
+			zsl_mtx_house_left(qr, k, k, tau->data[k], qr, k + 1,
+					   c);
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_qr_apply_q(struct zsl_mtx *qr, struct zsl_vec *tau, bool trans,
+		   struct zsl_mtx *b)
+{
+	size_t steps = qr->sz_rows - 1;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (b->sz_rows != qr->sz_rows) {
+		return -EINVAL;
+	}
+#endif
+
+	if (steps > qr->sz_cols) {
+		steps = qr->sz_cols;
+	}
+
+	/* Q = H0 * H1 * ... * Hk, and every reflector is symmetric, so Qt
+	 * applies them in increasing order and Q in decreasing order. */
+	for (size_t s = 0; s < steps; s++) {
+		size_t k = trans ? s : steps - 1 - s;
+
+		if (tau->data[k] != 0.0) {
+			zsl_mtx_house_left(qr, k, k, tau->data[k], b, 0,
+					   b->sz_cols);
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_qr_solve(struct zsl_mtx *qr, struct zsl_vec *tau, struct zsl_mtx *b,
+		 struct zsl_mtx *x)
+{
+	size_t n = qr->sz_cols;
+	size_t steps = qr->sz_rows - 1;
+	zsl_real_t y[qr->sz_rows];
+	zsl_real_t w;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (qr->sz_rows < n || b->sz_rows != qr->sz_rows ||
+	    x->sz_rows != n || x->sz_cols != b->sz_cols) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < n; i++) {
+		if (qr->data[(i * n) + i] == 0.0) {
+			return -ESINGULAR;
+		}
+	}
+
+	if (steps > n) {
+		steps = n;
+	}
+
+	for (size_t j = 0; j < b->sz_cols; j++) {
+		/* y = Qt * b, one column at a time. */
+		for (size_t i = 0; i < qr->sz_rows; i++) {
+			y[i] = b->data[(i * b->sz_cols) + j];
+		}
+		for (size_t k = 0; k < steps; k++) {
+			if (tau->data[k] == 0.0) {
+				continue;
+			}
+			w = y[k];
+			for (size_t i = k + 1; i < qr->sz_rows; i++) {
+				w += qr->data[(i * n) + k] * y[i];
+			}
+			w *= tau->data[k];
+			y[k] -= w;
+			for (size_t i = k + 1; i < qr->sz_rows; i++) {
+				y[i] -= w * qr->data[(i * n) + k];
+			}
+		}
+
+		/* Back substitution with the top n rows of R. The remaining
+		 * rows of 'y' are the residual. */
+		for (size_t i = n; i-- > 0;) {
+			w = y[i];
+			for (size_t k = i + 1; k < n; k++) {
+				w -= qr->data[(i * n) + k] * y[k];
+			}
+			y[i] = w / qr->data[(i * n) + i];
+			x->data[(i * x->sz_cols) + j] = y[i];
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Solves with the upper triangular matrix in 'arg', or with its
+ *        transpose, for zsl_mtx_inv_norm_est.
+ */
+static void
+zsl_mtx_tri_inv_solve(void *arg, struct zsl_mtx *x, bool trans)
+{
+	if (trans == false) {
+		zsl_mtx_subst_back(arg, x);
+	} else {
+		zsl_mtx_subst_fwd_trans(arg, x);
+	}
+}
+
+int
+zsl_mtx_qr_rcond(struct zsl_mtx *qr, zsl_real_t *rcond)
+{
+	size_t n = qr->sz_cols;
+	zsl_real_t rnorm, sum;
+
+	/* R is the upper triangle of the top n rows of 'qr', which is also
+	 * an nxn matrix on its own. */
+	struct zsl_mtx r = {
+		.sz_rows = n,
+		.sz_cols = n,
+		.data = qr->data
+	};
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (qr->sz_rows < n) {
+		return -EINVAL;
+	}
+#endif
+
+	*rcond = 0.0;
+	rnorm = 0.0;
+	for (size_t j = 0; j < n; j++) {
+		if (r.data[(j * n) + j] == 0.0) {
+			return 0;
+		}
+		sum = 0.0;
+		for (size_t i = 0; i <= j; i++) {
+			sum += ZSL_ABS(r.data[(i * n) + j]);
+		}
+		if (!(sum <= rnorm)) {
+			rnorm = sum;
+		}
+	}
+	if (n == 0) {
+		return 0;
+	}
+
+	*rcond = 1.0 / (rnorm * zsl_mtx_inv_norm_est(n, zsl_mtx_tri_inv_solve,
+						      &r));
+
+	return 0;
+}
+
+int
+zsl_mtx_lstsq_mixed(struct zsl_mtx *a, struct zsl_mtx *b, struct zsl_mtx *x)
+{
+	size_t m = a->sz_rows;
+	size_t n = a->sz_cols;
+	int rc;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* 'a' must be square or tall, and 'b' and 'x' compatibly shaped. */
+	if ((m < n) || (b->sz_rows != m) || (x->sz_rows != n) ||
+	    (x->sz_cols != b->sz_cols) || (x->data == b->data)) {
+		return -EINVAL;
+	}
+#endif
+
+	float qr[m * n];
+	float tau[n];
+
+	/* The O(m * n^2) factorisation is done in single precision ... */
+	for (size_t i = 0; i < m * n; i++) {
+		qr[i] = (float)a->data[i];
+	}
+	rc = zsl_mtx_qr_f32(qr, m, n, tau);
+
+	/* ... and only the O(m * n) refinement steps in double precision. */
+	if (rc == 0) {
+		rc = zsl_mtx_mixed_refine(a, b, x, qr, NULL, tau);
+	}
+
+	/* Fall back to a working-precision solve if 'a' is too badly
+	 * conditioned, or out of range, for a single-precision
+	 * factorisation. */
+	if (rc == -ESINGULAR || rc == -ECONVERGE) {
+		ZSL_MATRIX_DEF(qrw, m, n);
+		ZSL_VECTOR_DEF(tauw, n);
+
+		rc = zsl_mtx_qr(a, &qrw, &tauw);
+		if (rc == 0) {
+			rc = zsl_mtx_qr_solve(&qrw, &tauw, b, x);
+		}
+	}
+
+	return rc;
+}
+
+size_t
+zsl_mtx_qrd_ws_size(size_t rows, size_t cols)
+{
+	/* The reflector coefficients. The Hessenberg path needs one per row,
+	 * which also covers the min(rows, cols) used by the compact QR. */
+	(void)cols;
+
+	return sizeof(zsl_real_t) * rows;
+}
+
+int
+zsl_mtx_qrd_ws(struct zsl_mtx *m, struct zsl_mtx *q, struct zsl_mtx *r,
+	       bool hessenberg, struct zsl_workspace *ws)
+{
+	size_t mark = ws->used;
+	size_t n = m->sz_rows;
+	struct zsl_vec tau;
+
+	if (zsl_ws_avail(ws) < zsl_mtx_qrd_ws_size(m->sz_rows, m->sz_cols)) {
+		return -ENOMEM;
+	}
+
+	if (zsl_ws_vec(ws, &tau, n)) {
+		ws->used = mark;
+		return -ENOMEM;
+	}
+
+	zsl_mtx_init(q, zsl_mtx_entry_fn_identity);
+
+	if (hessenberg == true) {
+		/* r = Qt * m * Q, with the reflectors stored below the
+		 * subdiagonal of 'r'. Q is built by applying them to the
+		 * identity matrix, last one first. */
+		zsl_mtx_copy(r, m);
+		zsl_mtx_hessenberg(r, tau.data);
+		for (size_t s = 0; s + 2 < n; s++) {
+			size_t k = n - 3 - s;
+
+			if (tau.data[k] != 0.0) {
+				zsl_mtx_house_left(r, k, k + 1, tau.data[k], q,
+						   k + 1, n);
+			}
+		}
+		for (size_t i = 2; i < n; i++) {
+			for (size_t j = 0; j + 1 < i; j++) {
+				r->data[(i * n) + j] = 0.0;
+			}
+		}
+	} else {
+		tau.sz = (n < m->sz_cols) ? n : m->sz_cols;
+		zsl_mtx_qr(m, r, &tau);
+		zsl_mtx_qr_apply_q(r, &tau, false, q);
+		for (size_t i = 1; i < n; i++) {
+			for (size_t j = 0; j < i && j < r->sz_cols; j++) {
+				r->data[(i * r->sz_cols) + j] = 0.0;
+			}
+		}
+	}
+
+	ws->used = mark;
+
+	return 0;
+}
+
+int
+zsl_mtx_qrd(struct zsl_mtx *m, struct zsl_mtx *q, struct zsl_mtx *r,
+	    bool hessenberg)
+{
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_qrd_ws_size(m->sz_rows, m->sz_cols));
+
+	return zsl_mtx_qrd_ws(m, q, r, hessenberg, &ws);
+}
+
+#ifndef CONFIG_ZSL_SINGLE_PRECISION
+size_t
+zsl_mtx_qrd_iter_ws_size(size_t n)
+{
+	/* q and r, plus the QR decomposition itself. */
+	return sizeof(zsl_real_t) * (2 * n * n) + zsl_mtx_qrd_ws_size(n, n);
+}
+
+int
+zsl_mtx_qrd_iter_ws(struct zsl_mtx *m, struct zsl_mtx *mout, size_t iter,
+		    struct zsl_workspace *ws)
+{
+	int rc;
+	size_t mark = ws->used;
+	struct zsl_mtx q;
+	struct zsl_mtx r;
+
+	if (zsl_ws_avail(ws) < zsl_mtx_qrd_iter_ws_size(m->sz_rows)) {
+		return -ENOMEM;
+	}
+
+	if (zsl_ws_mtx(ws, &q, m->sz_rows, m->sz_rows) ||
+	    zsl_ws_mtx(ws, &r, m->sz_rows, m->sz_rows)) {
+		ws->used = mark;
+		return -ENOMEM;
+	}
+
+	/* Make a copy of 'm'. */
+	rc = zsl_mtx_copy(mout, m);
+	if (rc) {
+		ws->used = mark;
+		return -EINVAL;
+	}
+
+	for (size_t g = 1; g <= iter; g++) {
+		/* Perform the QR decomposition. */
+		zsl_mtx_qrd_ws(mout, &q, &r, false, ws);
+
+		/* Multiply the results of the QR decomposition together but
+		 * changing its order. */
+		zsl_mtx_mult(&r, &q, mout);
+	}
+
+	ws->used = mark;
+
+	return 0;
+}
+
+int
+zsl_mtx_qrd_iter(struct zsl_mtx *m, struct zsl_mtx *mout, size_t iter)
+{
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_qrd_iter_ws_size(m->sz_rows));
+
+	return zsl_mtx_qrd_iter_ws(m, mout, iter, &ws);
+}
+#endif
+
+size_t
+zsl_mtx_eigenvalues_ws_size(size_t n)
+{
+	/* The Hessenberg matrix, a Householder vector, and the real and
+	 * imaginary parts of the eigenvalues. */
+	return sizeof(zsl_real_t) * (n * n + 3 * n);
+}
+
+/**
+ * @brief Computes the eigenvalues of 'm' into the 'm->sz_rows' long arrays
+ *        'wr' and 'wi', sorted by descending modulus. 'h' and 'v' are
+ *        scratch space for the balanced Hessenberg matrix.
+ */
+static int
+zsl_mtx_eigenvalues_core(struct zsl_mtx *m, struct zsl_mtx *h, zsl_real_t *v,
+			 zsl_real_t *wr, zsl_real_t *wi, size_t iter)
+{
+	int rc;
+	size_t n = m->sz_rows;
+	zsl_real_t re, im, mod;
+	size_t j;
+
+	if (iter == 0) {
+		iter = 30;
+	}
+
+	/* Balance the matrix and put it into Hessenberg form. */
+	rc = zsl_mtx_balance(m, h);
+	if (rc) {
+		return rc;
+	}
+	zsl_mtx_hessenberg(h, v);
+
+	/* Only the Hessenberg matrix is needed, so drop the reflectors. */
+	for (size_t i = 2; i < n; i++) {
+		for (size_t k = 0; k + 1 < i; k++) {
+			h->data[(i * n) + k] = 0.0;
+		}
+	}
+
+	rc = zsl_mtx_francis(h, wr, wi, iter);
+	if (rc) {
+		return rc;
+	}
+
+	/* Stable insertion sort by descending modulus. Conjugate pairs have
+	 * the same modulus and are adjacent, so they stay together. */
+	for (size_t i = 1; i < n; i++) {
+		re = wr[i];
+		im = wi[i];
+		mod = re * re + im * im;
+		for (j = i; j > 0 &&
+		     wr[j - 1] * wr[j - 1] + wi[j - 1] * wi[j - 1] < mod; j--) {
+			wr[j] = wr[j - 1];
+			wi[j] = wi[j - 1];
+		}
+		wr[j] = re;
+		wi[j] = im;
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_eigenvalues_ws(struct zsl_mtx *m, struct zsl_vec *v, size_t iter,
+		       struct zsl_workspace *ws)
+{
+	int rc;
+	size_t real = 0;
+	size_t mark = ws->used;
+	struct zsl_mtx h;
+	struct zsl_vec hv;
+	struct zsl_vec wr;
+	struct zsl_vec wi;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (m->sz_rows != m->sz_cols || v->sz < m->sz_rows) {
+		return -EINVAL;
+	}
+#endif
+
+	if (zsl_ws_avail(ws) < zsl_mtx_eigenvalues_ws_size(m->sz_rows)) {
+		return -ENOMEM;
+	}
+
+	if (zsl_ws_mtx(ws, &h, m->sz_rows, m->sz_rows) ||
+	    zsl_ws_vec(ws, &hv, m->sz_rows) ||
+	    zsl_ws_vec(ws, &wr, m->sz_rows) ||
+	    zsl_ws_vec(ws, &wi, m->sz_rows)) {
+		ws->used = mark;
+		return -ENOMEM;
+	}
+
+	rc = zsl_mtx_eigenvalues_core(m, &h, hv.data, wr.data, wi.data, iter);
+	if (rc) {
+		ws->used = mark;
+		return rc;
+	}
+
+	zsl_vec_init(v);
+
+	/* A symmetric matrix only has real eigenvalues, so any imaginary
+	 * part is rounding noise from a pair of close eigenvalues. */
+	if (zsl_mtx_is_sym(m) == true) {
+		for (size_t g = 0; g < m->sz_rows; g++) {
+			v->data[g] = wr.data[g];
+		}
+
+		ws->used = mark;
+		return 0;
+	}
+
+	/* Complex values are left out of 'v'. Use
+	 * 'zsl_mtx_eigenvalues_cplx' to get their real and imaginary parts. */
+	for (size_t g = 0; g < m->sz_rows; g++) {
+		if (wi.data[g] == 0.0) {
+			v->data[real] = wr.data[g];
+			real++;
+		}
+	}
+
+	ws->used = mark;
+
+	/* If the number of real eigenvalues ('real' coefficient) is less than
+	 * the matrix dimensions, then there must be complex eigenvalues. */
+	v->sz = real;
+	if (real != m->sz_rows) {
+		return -ECOMPLEXVAL;
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_eigenvalues(struct zsl_mtx *m, struct zsl_vec *v, size_t iter)
+{
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_eigenvalues_ws_size(m->sz_rows));
+
+	return zsl_mtx_eigenvalues_ws(m, v, iter, &ws);
+}
+
+int
+zsl_mtx_eigenvalues_cplx_ws(struct zsl_mtx *m, struct zsl_vec *re,
+			    struct zsl_vec *im, size_t iter,
+			    struct zsl_workspace *ws)
+{
+	int rc;
+	size_t mark = ws->used;
+	struct zsl_mtx h;
+	struct zsl_vec hv;
+	struct zsl_vec wr;
+	struct zsl_vec wi;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (m->sz_rows != m->sz_cols || re->sz != m->sz_rows ||
+	    im->sz != m->sz_rows) {
+		return -EINVAL;
+	}
+#endif
+
+	if (zsl_ws_avail(ws) < zsl_mtx_eigenvalues_ws_size(m->sz_rows)) {
+		return -ENOMEM;
+	}
+
+	if (zsl_ws_mtx(ws, &h, m->sz_rows, m->sz_rows) ||
+	    zsl_ws_vec(ws, &hv, m->sz_rows) ||
+	    zsl_ws_vec(ws, &wr, m->sz_rows) ||
+	    zsl_ws_vec(ws, &wi, m->sz_rows)) {
+		ws->used = mark;
+		return -ENOMEM;
+	}
+
+	rc = zsl_mtx_eigenvalues_core(m, &h, hv.data, wr.data, wi.data, iter);
+	if (rc == 0) {
+		zsl_vec_copy(re, &wr);
+		zsl_vec_copy(im, &wi);
+	}
+
+	ws->used = mark;
+
+	return rc;
+}
+
+int
+zsl_mtx_eigenvalues_cplx(struct zsl_mtx *m, struct zsl_vec *re,
+			 struct zsl_vec *im, size_t iter)
+{
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_eigenvalues_ws_size(m->sz_rows));
+
+	return zsl_mtx_eigenvalues_cplx_ws(m, re, im, iter, &ws);
+}
+
+#ifndef CONFIG_ZSL_SINGLE_PRECISION
+size_t
+zsl_mtx_eigenvectors_ws_size(size_t n)
+{
+	size_t sz = zsl_mtx_eigenvalues_ws_size(n);
+
+	/* The eigenvalues are calculated before the remaining vectors and
+	 * matrices are allocated, so only the largest of both is needed. */
+	if (sz < sizeof(zsl_real_t) * ((2 * n) + (6 * n * n))) {
+		sz = sizeof(zsl_real_t) * ((2 * n) + (6 * n * n));
+	}
+
+	return sizeof(zsl_real_t) * n + sz;
+}
+
+int
+zsl_mtx_eigenvectors_ws(struct zsl_mtx *m, struct zsl_mtx *mev,
+			size_t iter, bool orthonormal,
+			struct zsl_workspace *ws)
+{
+	size_t b = 0;           /* Total number of eigenvectors. */
+	size_t e_vals = 0;      /* Number of unique eigenvalues. */
+	size_t count = 0;       /* Number of eigenvectors for an eigenvalue. */
+	size_t ga = 0;
+	size_t mark = ws->used;
+
+	zsl_real_t epsilon = 1E-6;
+	zsl_real_t x;
+
+	/* The vector where all eigenvalues will be stored. */
+	struct zsl_vec k;
+	/* Temp vector to store column data. */
+	struct zsl_vec f;
+	/* The vector where all UNIQUE eigenvalues will be stored. */
+	struct zsl_vec o;
+	/* Temporary mxm identity matrix placeholder. */
+	struct zsl_mtx id;
+	/* 'm' minus the eigenvalues * the identity matrix (id). */
+	struct zsl_mtx mi;
+	/* Placeholder for zsl_mtx_gauss_reduc calls (required param). */
+	struct zsl_mtx mid;
+	/* Matrix containing all column eigenvectors for an eigenvalue. */
+	struct zsl_mtx evec;
+	/* Matrix containing all column eigenvectors for an eigenvalue.
+	* Two matrices are required for the Gramm-Schmidt operation. */
+	struct zsl_mtx evec2;
+	/* Matrix containing all column eigenvectors. */
+	struct zsl_mtx mev2;
+
+	if (zsl_ws_avail(ws) < zsl_mtx_eigenvectors_ws_size(m->sz_rows)) {
+		return -ENOMEM;
+	}
+
+	/* TODO: Check that we have a SQUARE matrix, etc. */
+	if (zsl_ws_vec(ws, &k, m->sz_rows)) {
+		ws->used = mark;
+		return -ENOMEM;
+	}
+	zsl_mtx_eigenvalues_ws(m, &k, iter, ws);
+
+	if (zsl_ws_vec(ws, &f, m->sz_rows) ||
+	    zsl_ws_vec(ws, &o, m->sz_rows) ||
+	    zsl_ws_mtx(ws, &id, m->sz_rows, m->sz_rows) ||
+	    zsl_ws_mtx(ws, &mi, m->sz_rows, m->sz_rows) ||
+	    zsl_ws_mtx(ws, &mid, m->sz_rows, m->sz_rows) ||
+	    zsl_ws_mtx(ws, &evec, m->sz_rows, m->sz_rows) ||
+	    zsl_ws_mtx(ws, &evec2, m->sz_rows, m->sz_rows) ||
+	    zsl_ws_mtx(ws, &mev2, m->sz_rows, m->sz_rows)) {
+		ws->used = mark;
+		return -ENOMEM;
+	}
+
+	zsl_mtx_init(&mev2, NULL);
+	zsl_vec_init(&o);
+
+	/* Copy every non-zero eigenvalue ONCE in the 'o' vector to get rid of
+	 * repeated values. */
+	for (size_t q = 0; q < m->sz_rows; q++) {
+		if ((k.data[q] >= epsilon) || (k.data[q] <= -epsilon)) {
+			if (zsl_vec_contains(&o, k.data[q], epsilon) == 0) {
+				o.data[e_vals] = k.data[q];
+				/* Increment the unique eigenvalue counter. */
+				e_vals++;
+			}
+		}
+	}
+
+	/* If zero is also an eigenvalue, copy it once in 'o'. */
 	if (zsl_vec_contains(&k, 0.0, epsilon) > 0) {
 		e_vals++;
 	}
 
-	/* Calculates the null space of 'm' minus each eigenvalue times
-	 * the identity matrix by performing the gaussian reduction. */
-	for (size_t g = 0; g < e_vals; g++) {
-		count = 0;
-		ga = 0;
+	/* Calculates the null space of 'm' minus each eigenvalue times
+	 * the identity matrix by performing the gaussian reduction. */
+	for (size_t g = 0; g < e_vals; g++) {
+		count = 0;
+		ga = 0;
+
+		zsl_mtx_init(&id, zsl_mtx_entry_fn_identity);
+		zsl_mtx_scalar_mult_d(&id, -o.data[g]);
+		zsl_mtx_add_d(&id, m);
+		zsl_mtx_gauss_reduc(&id, &mid, &mi);
+
+		/* If 'orthonormal' is true, perform the following process. */
+		if (orthonormal == true) {
+			/* Count how many eigenvectors ('count' coefficient)
+			 * there are for each eigenvalue. */
+			for (size_t h = 0; h < m->sz_rows; h++) {
+				zsl_mtx_get(&mi, h, h, &x);
+				if ((x >= 0.0 && x < epsilon) ||
+				    (x <= 0.0 && x > -epsilon)) {
+					count++;
+				}
+			}
+
+			/* Resize evec* placeholders to have 'count' cols. */
+			evec.sz_cols = count;
+			evec2.sz_cols = count;
+
+			/* Get all the eigenvectors for each eigenvalue and set
+			 * them as the columns of 'evec'. */
+			for (size_t h = 0; h < m->sz_rows; h++) {
+				zsl_mtx_get(&mi, h, h, &x);
+				if ((x >= 0.0 && x < epsilon) ||
+				    (x <= 0.0 && x > -epsilon)) {
+					zsl_mtx_set(&mi, h, h, -1);
+					zsl_mtx_get_col(&mi, h, f.data);
+					zsl_vec_neg(&f);
+					zsl_mtx_set_col(&evec, ga, f.data);
+					ga++;
+				}
+			}
+			/* Orthonormalize the set of eigenvectors for each
+			 * eigenvalue using the Gram-Schmidt process. */
+			zsl_mtx_gram_schmidt(&evec, &evec2);
+			zsl_mtx_cols_norm(&evec2, &evec);
+
+			/* Place these eigenvectors in the 'mev2' matrix,
+			 * that will hold all the eigenvectors for different
+			 * eigenvalues. */
+			for (size_t gi = 0; gi < count; gi++) {
+				zsl_mtx_get_col(&evec, gi, f.data);
+				zsl_mtx_set_col(&mev2, b, f.data);
+				b++;
+			}
+
+		} else {
+			/* Orthonormal is false. */
+			/* Get the eigenvectors for every eigenvalue and place
+			 * them in 'mev2'. */
+			for (size_t h = 0; h < m->sz_rows; h++) {
+				zsl_mtx_get(&mi, h, h, &x);
+				if ((x >= 0.0 && x < epsilon) ||
+				    (x <= 0.0 && x > -epsilon)) {
+					zsl_mtx_set(&mi, h, h, -1);
+					zsl_mtx_get_col(&mi, h, f.data);
+					zsl_vec_neg(&f);
+					zsl_mtx_set_col(&mev2, b, f.data);
+					b++;
+				}
+			}
+		}
+	}
+
+	/* Since 'b' is the number of eigenvectors, reduce 'mev' (of size
+	 * m->sz_rows times b) to erase columns of zeros. */
+	mev->sz_cols = b;
+
+	for (size_t s = 0; s < b; s++) {
+		zsl_mtx_get_col(&mev2, s, f.data);
+		zsl_mtx_set_col(mev, s, f.data);
+	}
+
+	ws->used = mark;
+
+	/* Checks if the number of eigenvectors is the same as the shape of
+	 * the input matrix. If the number of eigenvectors is less than
+	 * the number of columns in the input matrix 'm', this will be
+	 * indicated by EEIGENSIZE as a return code. */
+	if (b != m->sz_cols) {
+		return -EEIGENSIZE;
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_eigenvectors(struct zsl_mtx *m, struct zsl_mtx *mev, size_t iter,
+		     bool orthonormal)
+{
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_eigenvectors_ws_size(m->sz_rows));
+
+	return zsl_mtx_eigenvectors_ws(m, mev, iter, orthonormal, &ws);
+}
+#endif
+
+/*
+ * Largest matrix handled with the cyclic Jacobi method by zsl_mtx_eigen_sym.
+ * Bigger matrices are tridiagonalised and iterated with implicit QL instead.
+ */
+#ifndef CONFIG_ZSL_MTX_EIGEN_SYM_JACOBI_MAX
+#define CONFIG_ZSL_MTX_EIGEN_SYM_JACOBI_MAX 4
+#endif
+
+/**
+ * @brief Cyclic Jacobi eigenvalue iteration on the symmetric matrix 'a',
+ *        which is destroyed. The eigenvalues are left in 'd', and the
+ *        rotations are accumulated in 'z', which must start as identity.
+ */
+static int
+zsl_mtx_eigen_sym_jacobi(struct zsl_mtx *a, zsl_real_t *d, struct zsl_mtx *z)
+{
+	size_t n = a->sz_rows;
+	zsl_real_t *x = a->data;
+	zsl_real_t *zd = z->data;
+	zsl_real_t app, aqq, apq;
+	zsl_real_t theta, t, c, s;
+	zsl_real_t xkp, xkq;
+	bool rotated;
+
+	for (size_t sweep = 0; sweep < 50; sweep++) {
+		rotated = false;
+
+		for (size_t p = 0; p + 1 < n; p++) {
+			for (size_t q = p + 1; q < n; q++) {
+				apq = x[(p * n) + q];
+				app = x[(p * n) + p];
+				aqq = x[(q * n) + q];
+
+				/* Skip elements that are negligible next to
+				 * both diagonal entries (Golub and Van Loan,
+				 * section 8.5). */
+				if (ZSL_ABS(apq) <= ZSL_EPSILON *
+				    ZSL_SQRT(ZSL_ABS(app)) *
+				    ZSL_SQRT(ZSL_ABS(aqq))) {
+					x[(p * n) + q] = 0.0;
+					x[(q * n) + p] = 0.0;
+					continue;
+				}
+
+				/* Rotation angle that zeroes x[p][q]. */
+				theta = (aqq - app) / (2.0 * apq);
+				t = 1.0 / (ZSL_ABS(theta) +
+					   ZSL_SQRT(theta * theta + 1.0));
+				if (theta < 0.0) {
+					t = -t;
+				}
+				c = 1.0 / ZSL_SQRT(t * t + 1.0);
+				s = t * c;
+
+				/* x = jt * x * j, z = z * j. */
+				for (size_t k = 0; k < n; k++) {
+					xkp = x[(k * n) + p];
+					xkq = x[(k * n) + q];
+					x[(k * n) + p] = c * xkp - s * xkq;
+					x[(k * n) + q] = s * xkp + c * xkq;
+				}
+				for (size_t k = 0; k < n; k++) {
+					xkp = x[(p * n) + k];
+					xkq = x[(q * n) + k];
+					x[(p * n) + k] = c * xkp - s * xkq;
+					x[(q * n) + k] = s * xkp + c * xkq;
+				}
+				for (size_t k = 0; k < n; k++) {
+					xkp = zd[(k * n) + p];
+					xkq = zd[(k * n) + q];
+					zd[(k * n) + p] = c * xkp - s * xkq;
+					zd[(k * n) + q] = s * xkp + c * xkq;
+				}
+
+				x[(p * n) + q] = 0.0;
+				x[(q * n) + p] = 0.0;
+				rotated = true;
+			}
+		}
+
+		if (!rotated) {
+			for (size_t i = 0; i < n; i++) {
+				d[i] = x[(i * n) + i];
+			}
+			return 0;
+		}
+	}
+
+	return -ECONVERGE;
+}
+
+size_t
+zsl_mtx_eigen_sym_ws_size(size_t n)
+{
+	/* A copy of the input for Jacobi, or the subdiagonal and the
+	 * reflector coefficients for QL. */
+	if (n <= CONFIG_ZSL_MTX_EIGEN_SYM_JACOBI_MAX) {
+		return sizeof(zsl_real_t) * n * n;
+	}
+
+	return sizeof(zsl_real_t) * 2 * n;
+}
+
+int
+zsl_mtx_eigen_sym_ws(struct zsl_mtx *m, struct zsl_vec *v,
+		     struct zsl_mtx *mev, struct zsl_workspace *ws)
+{
+	int rc;
+	size_t n = m->sz_rows;
+	size_t mark = ws->used;
+	size_t big;
+	zsl_real_t x;
+	zsl_real_t *ev = mev->data;
+	struct zsl_mtx a;
+	struct zsl_vec e, tau;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (m->sz_rows != m->sz_cols || v->sz != n || mev->sz_rows != n ||
+	    mev->sz_cols != n) {
+		return -EINVAL;
+	}
+#endif
+
+	if (zsl_ws_avail(ws) < zsl_mtx_eigen_sym_ws_size(n)) {
+		return -ENOMEM;
+	}
+
+	if (n <= CONFIG_ZSL_MTX_EIGEN_SYM_JACOBI_MAX) {
+		/* Rebuild the full matrix from its lower triangle. */
+		if (zsl_ws_mtx(ws, &a, n, n)) {
+			ws->used = mark;
+			return -ENOMEM;
+		}
+		for (size_t i = 0; i < n; i++) {
+			for (size_t j = 0; j <= i; j++) {
+				x = m->data[(i * n) + j];
+				a.data[(i * n) + j] = x;
+				a.data[(j * n) + i] = x;
+			}
+		}
+		zsl_mtx_init(mev, zsl_mtx_entry_fn_identity);
+		rc = zsl_mtx_eigen_sym_jacobi(&a, v->data, mev);
+	} else {
+		if (zsl_ws_vec(ws, &e, n) ||
+		    zsl_ws_vec(ws, &tau, n)) {
+			ws->used = mark;
+			return -ENOMEM;
+		}
+		if (mev->data != m->data) {
+			zsl_mtx_copy(mev, m);
+		}
+
+		rc = zsl_mtx_eigen_sym_ql(mev, v->data, e.data, tau.data);
+	}
+
+	ws->used = mark;
+	if (rc) {
+		return rc;
+	}
+
+	/* Sort by descending absolute value, as zsl_mtx_eigenvalues does,
+	 * and make the largest component of each eigenvector positive. */
+	for (size_t i = 0; i < n; i++) {
+		big = i;
+		for (size_t j = i + 1; j < n; j++) {
+			if (ZSL_ABS(v->data[j]) > ZSL_ABS(v->data[big])) {
+				big = j;
+			}
+		}
+		if (big != i) {
+			x = v->data[i];
+			v->data[i] = v->data[big];
+			v->data[big] = x;
+			for (size_t k = 0; k < n; k++) {
+				x = ev[(k * n) + i];
+				ev[(k * n) + i] = ev[(k * n) + big];
+				ev[(k * n) + big] = x;
+			}
+		}
+
+		big = 0;
+		for (size_t k = 1; k < n; k++) {
+			if (ZSL_ABS(ev[(k * n) + i]) >
+			    ZSL_ABS(ev[(big * n) + i])) {
+				big = k;
+			}
+		}
+		if (ev[(big * n) + i] < 0.0) {
+			for (size_t k = 0; k < n; k++) {
+				ev[(k * n) + i] = -ev[(k * n) + i];
+			}
+		}
+	}
+
+	return 0;
+}
 
-		zsl_mtx_init(&id, zsl_mtx_entry_fn_identity);
-		zsl_mtx_scalar_mult_d(&id, -o.data[g]);
-		zsl_mtx_add_d(&id, m);
-		zsl_mtx_gauss_reduc(&id, &mid, &mi);
+int
+zsl_mtx_eigen_sym(struct zsl_mtx *m, struct zsl_vec *v, struct zsl_mtx *mev)
+{
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_eigen_sym_ws_size(m->sz_rows));
 
-		/* If 'orthonormal' is true, perform the following process. */
-		if (orthonormal == true) {
-			/* Count how many eigenvectors ('count' coefficient)
-			 * there are for each eigenvalue. */
-			for (size_t h = 0; h < m->sz_rows; h++) {
-				zsl_mtx_get(&mi, h, h, &x);
-				if ((x >= 0.0 && x < epsilon) ||
-				    (x <= 0.0 && x > -epsilon)) {
-					count++;
-				}
+	return zsl_mtx_eigen_sym_ws(m, v, mev, &ws);
+}
+
+/**
+ * @brief Fills column 'j' of 'v' with pseudo-random values in [-1, 1), from
+ *        a hash of the element's index and 'seed', so that the starting
+ *        vectors of zsl_mtx_eigen_topk are repeatable.
+ */
+static void
+zsl_mtx_topk_fill(struct zsl_mtx *v, size_t j, uint32_t seed)
+{
+	uint32_t h;
+
+	for (size_t i = 0; i < v->sz_rows; i++) {
+		h = (uint32_t)((i * v->sz_cols) + j + 1) * 2654435761u;
+		h ^= seed * 2246822519u;
+		h ^= h >> 15;
+		h *= 2246822519u;
+		h ^= h >> 13;
+		v->data[(i * v->sz_cols) + j] =
+			(zsl_real_t)(h >> 8) / 8388608.0 - 1.0;
+	}
+}
+
+/**
+ * @brief Orthonormalises the columns of 'v' in place with modified
+ *        Gram-Schmidt, applied twice for accuracy. Columns that are
+ *        numerically dependent on the previous ones are replaced with new
+ *        pseudo-random values.
+ */
+static void
+zsl_mtx_topk_orth(struct zsl_mtx *v)
+{
+	size_t n = v->sz_rows;
+	size_t k = v->sz_cols;
+	zsl_real_t *d = v->data;
+	zsl_real_t dot, norm, norm0;
+
+	for (size_t j = 0; j < k; j++) {
+		for (uint32_t seed = 1; seed <= 4; seed++) {
+			norm0 = 0.0;
+			for (size_t i = 0; i < n; i++) {
+				norm0 += d[(i * k) + j] * d[(i * k) + j];
 			}
 
-			/* Resize evec* placeholders to have 'count' cols. */
-			evec.sz_cols = count;
-			evec2.sz_cols = count;
+			for (size_t pass = 0; pass < 2; pass++) {
+				for (size_t c = 0; c < j; c++) {
+					dot = 0.0;
+					for (size_t i = 0; i < n; i++) {
+						dot += d[(i * k) + c] *
+						       d[(i * k) + j];
+					}
+					for (size_t i = 0; i < n; i++) {
+						d[(i * k) + j] -=
+							dot * d[(i * k) + c];
+					}
+				}
+			}
 
-			/* Get all the eigenvectors for each eigenvalue and set
-			 * them as the columns of 'evec'. */
-			for (size_t h = 0; h < m->sz_rows; h++) {
-				zsl_mtx_get(&mi, h, h, &x);
-				if ((x >= 0.0 && x < epsilon) ||
-				    (x <= 0.0 && x > -epsilon)) {
-					zsl_mtx_set(&mi, h, h, -1);
-					zsl_mtx_get_col(&mi, h, f.data);
-					zsl_vec_neg(&f);
-					zsl_mtx_set_col(&evec, ga, f.data);
-					ga++;
+			norm = 0.0;
+			for (size_t i = 0; i < n; i++) {
+				norm += d[(i * k) + j] * d[(i * k) + j];
+			}
+			if (norm > 0.0 && norm > ZSL_EPSILON * norm0) {
+				norm = ZSL_SQRT(norm);
+				for (size_t i = 0; i < n; i++) {
+					d[(i * k) + j] /= norm;
 				}
+				break;
 			}
-			/* Orthonormalize the set of eigenvectors for each
-			 * eigenvalue using the Gram-Schmidt process. */
-			zsl_mtx_gram_schmidt(&evec, &evec2);
-			zsl_mtx_cols_norm(&evec2, &evec);
 
-			/* Place these eigenvectors in the 'mev2' matrix,
-			 * that will hold all the eigenvectors for different
-			 * eigenvalues. */
-			for (size_t gi = 0; gi < count; gi++) {
-				zsl_mtx_get_col(&evec, gi, f.data);
-				zsl_mtx_set_col(&mev2, b, f.data);
-				b++;
+			zsl_mtx_topk_fill(v, j, seed);
+		}
+	}
+}
+
+/**
+ * @brief Multiplies every row of 'm' by the kxk matrix 'z' in place, using
+ *        'row' to hold the k results of one row.
+ */
+static void
+zsl_mtx_topk_rotate(struct zsl_mtx *m, struct zsl_mtx *z, zsl_real_t *row)
+{
+	size_t k = z->sz_rows;
+	zsl_real_t *mi;
+
+	for (size_t i = 0; i < m->sz_rows; i++) {
+		mi = &m->data[i * k];
+		for (size_t j = 0; j < k; j++) {
+			row[j] = 0.0;
+			for (size_t g = 0; g < k; g++) {
+				row[j] += mi[g] * z->data[(g * k) + j];
 			}
+		}
+		memcpy(mi, row, k * sizeof(zsl_real_t));
+	}
+}
+
+/**
+ * @brief Subspace iteration shared by zsl_mtx_eigen_topk_ws and
+ *        zsl_mtx_eigen_topk_fn, multiplying by 'm' if it isn't NULL, and
+ *        calling 'fn' otherwise.
+ */
+static int
+zsl_mtx_eigen_topk_core(struct zsl_mtx *m, zsl_mtx_matvec_fn_t fn, void *arg,
+			struct zsl_vec *v, struct zsl_mtx *mev, size_t iter,
+			struct zsl_workspace *ws)
+{
+	int rc = 0;
+	size_t n = mev->sz_rows;
+	size_t k = v->sz;
+	size_t mark = ws->used;
+	size_t big;
+	bool done = false;
+	zsl_real_t r, x, tol;
+	struct zsl_mtx w, h, z;
+	struct zsl_vec d, row, vx, vy;
+
+	if (iter == 0) {
+		iter = 2000;
+	}
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (mev->sz_cols != k || k > n) {
+		return -EINVAL;
+	}
+#endif
+
+	if (zsl_ws_avail(ws) < zsl_mtx_eigen_topk_ws_size(n, k)) {
+		return -ENOMEM;
+	}
+
+	if (zsl_ws_mtx(ws, &w, n, k) ||
+	    zsl_ws_mtx(ws, &h, k, k) ||
+	    zsl_ws_mtx(ws, &z, k, k) ||
+	    zsl_ws_vec(ws, &d, k) ||
+	    zsl_ws_vec(ws, &row, k) ||
+	    zsl_ws_vec(ws, &vx, n) ||
+	    zsl_ws_vec(ws, &vy, n)) {
+		ws->used = mark;
+		return -ENOMEM;
+	}
+
+	for (size_t j = 0; j < k; j++) {
+		zsl_mtx_topk_fill(mev, j, 0);
+	}
+	zsl_mtx_topk_orth(mev);
 
+	for (size_t it = 0; it < iter && !done; it++) {
+		/* w = a * mev. Without a matrix, one column at a time. */
+		if (m != NULL) {
+			zsl_mtx_mult(m, mev, &w);
 		} else {
-			/* Orthonormal is false. */
-			/* Get the eigenvectors for every eigenvalue and place
-			 * them in 'mev2'. */
-			for (size_t h = 0; h < m->sz_rows; h++) {
-				zsl_mtx_get(&mi, h, h, &x);
-				if ((x >= 0.0 && x < epsilon) ||
-				    (x <= 0.0 && x > -epsilon)) {
-					zsl_mtx_set(&mi, h, h, -1);
-					zsl_mtx_get_col(&mi, h, f.data);
-					zsl_vec_neg(&f);
-					zsl_mtx_set_col(&mev2, b, f.data);
-					b++;
+			for (size_t j = 0; j < k; j++) {
+				zsl_mtx_get_col(mev, j, vx.data);
+				rc = fn(arg, &vx, &vy);
+				if (rc) {
+					ws->used = mark;
+					return rc;
+				}
+				zsl_mtx_set_col(&w, j, vy.data);
+			}
+		}
+
+		/* Rayleigh-Ritz: the eigenpairs of h = mevt * a * mev are the
+		 * best approximations to those of 'a' within span(mev). */
+		for (size_t p = 0; p < k; p++) {
+			for (size_t q = 0; q <= p; q++) {
+				x = 0.0;
+				for (size_t i = 0; i < n; i++) {
+					x += mev->data[(i * k) + p] *
+					     w.data[(i * k) + q];
+				}
+				h.data[(p * k) + q] = x;
+			}
+		}
+		rc = zsl_mtx_eigen_sym_ws(&h, &d, &z, ws);
+		if (rc) {
+			ws->used = mark;
+			return rc;
+		}
+		zsl_mtx_topk_rotate(mev, &z, row.data);
+		zsl_mtx_topk_rotate(&w, &z, row.data);
+
+		/* Done once every residual a * v - lambda * v is below
+		 * sqrt(eps) times the largest eigenvalue. The error in the Ritz
+		 * values is about the squared residual over the eigenvalue
+		 * gap, so a tighter bound only costs iterations when
+		 * eigenvalues are close. */
+		tol = ZSL_SQRT(ZSL_EPSILON) * ZSL_ABS(d.data[0]);
+		done = true;
+		for (size_t j = 0; j < k && done; j++) {
+			r = 0.0;
+			for (size_t i = 0; i < n; i++) {
+				x = w.data[(i * k) + j] -
+				    d.data[j] * mev->data[(i * k) + j];
+				r += x * x;
+			}
+			done = (r <= tol * tol);
+		}
+
+		/* Otherwise take a power step, keeping the last Ritz vectors
+		 * if the iterations run out. */
+		if (!done && it + 1 < iter) {
+			zsl_mtx_copy(mev, &w);
+			zsl_mtx_topk_orth(mev);
+		}
+	}
+
+	/* Make the largest component of each eigenvector positive, as
+	 * zsl_mtx_eigen_sym does. */
+	for (size_t j = 0; j < k; j++) {
+		v->data[j] = d.data[j];
+		big = 0;
+		for (size_t i = 1; i < n; i++) {
+			if (ZSL_ABS(mev->data[(i * k) + j]) >
+			    ZSL_ABS(mev->data[(big * k) + j])) {
+				big = i;
+			}
+		}
+		if (mev->data[(big * k) + j] < 0.0) {
+			for (size_t i = 0; i < n; i++) {
+				mev->data[(i * k) + j] *= -1.0;
+			}
+		}
+	}
+
+	ws->used = mark;
+
+	return done ? 0 : -ECONVERGE;
+}
+
+size_t
+zsl_mtx_eigen_topk_ws_size(size_t n, size_t k)
+{
+	/* a * mev, the projected matrix and its eigenpairs, a row buffer,
+	 * two vectors for the callback, and the projected eigenproblem. */
+	return sizeof(zsl_real_t) * ((n * k) + (2 * k * k) + (2 * k) +
+				     (2 * n)) +
+	       zsl_mtx_eigen_sym_ws_size(k);
+}
+
+int
+zsl_mtx_eigen_topk_ws(struct zsl_mtx *m, struct zsl_vec *v,
+		      struct zsl_mtx *mev, size_t iter,
+		      struct zsl_workspace *ws)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (m->sz_rows != m->sz_cols || mev->sz_rows != m->sz_rows) {
+		return -EINVAL;
+	}
+#endif
+
+	return zsl_mtx_eigen_topk_core(m, NULL, NULL, v, mev, iter, ws);
+}
+
+int
+zsl_mtx_eigen_topk(struct zsl_mtx *m, struct zsl_vec *v, struct zsl_mtx *mev,
+		   size_t iter)
+{
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_eigen_topk_ws_size(mev->sz_rows, v->sz));
+
+	return zsl_mtx_eigen_topk_ws(m, v, mev, iter, &ws);
+}
+
+int
+zsl_mtx_eigen_topk_fn(zsl_mtx_matvec_fn_t fn, void *arg, struct zsl_vec *v,
+		      struct zsl_mtx *mev, size_t iter,
+		      struct zsl_workspace *ws)
+{
+	return zsl_mtx_eigen_topk_core(NULL, fn, arg, v, mev, iter, ws);
+}
+
+/**
+ * @brief One-sided (Hestenes) Jacobi iteration on the r x c matrix 'w',
+ *        r >= c. Pairs of columns are rotated until they are all mutually
+ *        orthogonal, leaving 'w' = U * S. The rotations are accumulated in
+ *        the c x c matrix 'v', which must start as identity.
+ */
+static int
+zsl_mtx_svd_jacobi(struct zsl_mtx *w, struct zsl_mtx *v, size_t iter)
+{
+	size_t r = w->sz_rows;
+	size_t c = w->sz_cols;
+	zsl_real_t *wd = w->data;
+	zsl_real_t *vd = v->data;
+	zsl_real_t alpha, beta, gamma;
+	zsl_real_t zeta, t, cs, sn;
+	zsl_real_t xp, xq;
+	zsl_real_t tiny = 0.0;
+	bool rotated;
+
+	/* The Frobenius norm is preserved by the rotations. */
+	for (size_t k = 0; k < r * c; k++) {
+		tiny += wd[k] * wd[k];
+	}
+	tiny *= ZSL_EPSILON * ZSL_EPSILON;
+
+	for (size_t sweep = 0; sweep < iter; sweep++) {
+		rotated = false;
+
+		for (size_t p = 0; p + 1 < c; p++) {
+			for (size_t q = p + 1; q < c; q++) {
+				alpha = beta = gamma = 0.0;
+				for (size_t k = 0; k < r; k++) {
+					xp = wd[(k * c) + p];
+					xq = wd[(k * c) + q];
+					alpha += xp * xp;
+					beta += xq * xq;
+					gamma += xp * xq;
+				}
+
+				/* Skip columns that are already orthogonal to
+				 * working precision, or that are numerically
+				 * zero compared to the whole matrix. */
+				if (ZSL_ABS(gamma) <=
+				    ZSL_EPSILON * ZSL_SQRT(alpha * beta) ||
+				    alpha <= tiny || beta <= tiny) {
+					continue;
+				}
+
+				zeta = (beta - alpha) / (2.0 * gamma);
+				t = 1.0 / (ZSL_ABS(zeta) +
+					   ZSL_SQRT(1.0 + zeta * zeta));
+				if (zeta < 0.0) {
+					t = -t;
+				}
+				cs = 1.0 / ZSL_SQRT(1.0 + t * t);
+				sn = cs * t;
+
+				for (size_t k = 0; k < r; k++) {
+					xp = wd[(k * c) + p];
+					xq = wd[(k * c) + q];
+					wd[(k * c) + p] = cs * xp - sn * xq;
+					wd[(k * c) + q] = sn * xp + cs * xq;
+				}
+				for (size_t k = 0; k < c; k++) {
+					xp = vd[(k * c) + p];
+					xq = vd[(k * c) + q];
+					vd[(k * c) + p] = cs * xp - sn * xq;
+					vd[(k * c) + q] = sn * xp + cs * xq;
+				}
+				rotated = true;
+			}
+		}
+
+		if (!rotated) {
+			return 0;
+		}
+	}
+
+	return -ECONVERGE;
+}
+
+/**
+ * @brief Fills the zeroed columns of 'q', starting from column 'k', with
+ *        unit vectors orthogonal to every other column. Columns before 'k'
+ *        that are entirely zero are filled as well.
+ */
+static void
+zsl_mtx_svd_complete(struct zsl_mtx *q, size_t k)
+{
+	size_t r = q->sz_rows;
+	size_t c = q->sz_cols;
+	zsl_real_t d;
+	zsl_real_t norm = 0.0;
+
+	for (size_t j = 0; j < c; j++) {
+		if (j < k) {
+			norm = 0.0;
+			for (size_t i = 0; i < r; i++) {
+				norm += ZSL_ABS(q->data[(i * c) + j]);
+			}
+			if (norm != 0.0) {
+				continue;
+			}
+		}
+
+		/* Try the unit vectors in turn until one has a large enough
+		 * component outside of the span of the other columns. One
+		 * always exists, since they can't all be in that span. */
+		for (size_t e = 0; e < r; e++) {
+			for (size_t i = 0; i < r; i++) {
+				q->data[(i * c) + j] = (i == e) ? 1.0 : 0.0;
+			}
+
+			/* Classical Gram-Schmidt, applied twice. The unfilled
+			 * columns are zero and don't contribute. */
+			for (size_t pass = 0; pass < 2; pass++) {
+				for (size_t l = 0; l < c; l++) {
+					if (l == j) {
+						continue;
+					}
+					d = 0.0;
+					for (size_t i = 0; i < r; i++) {
+						d += q->data[(i * c) + l] *
+						     q->data[(i * c) + j];
+					}
+					for (size_t i = 0; i < r; i++) {
+						q->data[(i * c) + j] -= d *
+							q->data[(i * c) + l];
+					}
 				}
 			}
+
+			norm = 0.0;
+			for (size_t i = 0; i < r; i++) {
+				norm += q->data[(i * c) + j] *
+					q->data[(i * c) + j];
+			}
+			if (norm * 2.0 * (zsl_real_t)r > 1.0) {
+				break;
+			}
+		}
+
+		norm = ZSL_SQRT(norm);
+		for (size_t i = 0; i < r; i++) {
+			q->data[(i * c) + j] /= norm;
+		}
+	}
+}
+
+/**
+ * @brief Flips the sign of column 'j' of 'a' and, if not NULL, 'b'.
+ */
+static void
+zsl_mtx_svd_flip(struct zsl_mtx *a, struct zsl_mtx *b, size_t j)
+{
+	for (size_t i = 0; i < a->sz_rows; i++) {
+		a->data[(i * a->sz_cols) + j] = -a->data[(i * a->sz_cols) + j];
+	}
+
+	if (b != NULL) {
+		for (size_t i = 0; i < b->sz_rows; i++) {
+			b->data[(i * b->sz_cols) + j] =
+				-b->data[(i * b->sz_cols) + j];
+		}
+	}
+}
+
+/**
+ * @brief Returns true if the last non-zero entry of column 'j' of 'a' is
+ *        negative.
+ */
+static bool
+zsl_mtx_svd_col_neg(struct zsl_mtx *a, size_t j)
+{
+	for (size_t i = a->sz_rows; i > 0; i--) {
+		if (a->data[((i - 1) * a->sz_cols) + j] != 0.0) {
+			return a->data[((i - 1) * a->sz_cols) + j] < 0.0;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @brief Computes the SVD of 'm' into the singular values 's', the left
+ *        singular vectors 'u' and the right singular vectors 'v'. Either 'u'
+ *        or 'v' may have more columns than min(rows, cols), in which case
+ *        the extra columns are completed into an orthonormal basis.
+ */
+static int
+zsl_mtx_svd_core(struct zsl_mtx *m, struct zsl_mtx *u, zsl_real_t *s,
+		 struct zsl_mtx *v, size_t iter, struct zsl_workspace *ws)
+{
+	int rc;
+	size_t mark = ws->used;
+	bool tall = m->sz_rows >= m->sz_cols;
+	size_t k = tall ? m->sz_cols : m->sz_rows;
+	size_t big;
+	zsl_real_t x, tol;
+	struct zsl_mtx w;
+	struct zsl_mtx *acc;
+	struct zsl_mtx *out;
+
+	if (iter == 0) {
+		iter = 30;
+	}
+
+	/* Work on whichever of 'm' and its transpose has fewer columns, so
+	 * that only min(rows, cols) columns need to be orthogonalised. */
+	if (tall) {
+		if (zsl_ws_mtx(ws, &w, m->sz_rows, m->sz_cols)) {
+			ws->used = mark;
+			return -ENOMEM;
+		}
+		zsl_mtx_copy(&w, m);
+		acc = v;
+		out = u;
+	} else {
+		if (zsl_ws_mtx(ws, &w, m->sz_cols, m->sz_rows)) {
+			ws->used = mark;
+			return -ENOMEM;
+		}
+		zsl_mtx_trans(m, &w);
+		acc = u;
+		out = v;
+	}
+
+	/* 'acc' is square, with 'k' rows and columns. */
+	zsl_mtx_init(acc, zsl_mtx_entry_fn_identity);
+	rc = zsl_mtx_svd_jacobi(&w, acc, iter);
+	if (rc) {
+		ws->used = mark;
+		return rc;
+	}
+
+	/* The singular values are the column norms of 'w'. */
+	for (size_t j = 0; j < k; j++) {
+		x = 0.0;
+		for (size_t i = 0; i < w.sz_rows; i++) {
+			x += w.data[(i * k) + j] * w.data[(i * k) + j];
+		}
+		s[j] = ZSL_SQRT(x);
+	}
+
+	/* Sort in descending order, moving the matching vectors along. */
+	for (size_t j = 0; j < k; j++) {
+		big = j;
+		for (size_t l = j + 1; l < k; l++) {
+			if (s[l] > s[big]) {
+				big = l;
+			}
+		}
+		if (big == j) {
+			continue;
+		}
+		x = s[j];
+		s[j] = s[big];
+		s[big] = x;
+		for (size_t i = 0; i < w.sz_rows; i++) {
+			x = w.data[(i * k) + j];
+			w.data[(i * k) + j] = w.data[(i * k) + big];
+			w.data[(i * k) + big] = x;
+		}
+		for (size_t i = 0; i < k; i++) {
+			x = acc->data[(i * k) + j];
+			acc->data[(i * k) + j] = acc->data[(i * k) + big];
+			acc->data[(i * k) + big] = x;
+		}
+	}
+
+	/* Normalise the columns of 'w' into 'out'. Columns belonging to
+	 * negligible singular values are left at zero for now. */
+	tol = s[0] * ZSL_EPSILON * (zsl_real_t)w.sz_rows;
+	zsl_mtx_init(out, NULL);
+	for (size_t j = 0; j < k; j++) {
+		if (s[j] <= tol) {
+			continue;
+		}
+		for (size_t i = 0; i < w.sz_rows; i++) {
+			out->data[(i * out->sz_cols) + j] =
+				w.data[(i * k) + j] / s[j];
 		}
 	}
+	zsl_mtx_svd_complete(out, k);
+
+	ws->used = mark;
+
+	/* Make the last non-zero entry of each column of 'v' positive. */
+	for (size_t j = 0; j < v->sz_cols; j++) {
+		if (zsl_mtx_svd_col_neg(v, j)) {
+			zsl_mtx_svd_flip(v, j < k ? u : NULL, j);
+		}
+	}
+	for (size_t j = k; j < u->sz_cols; j++) {
+		if (zsl_mtx_svd_col_neg(u, j)) {
+			zsl_mtx_svd_flip(u, NULL, j);
+		}
+	}
+
+	return 0;
+}
+
+size_t
+zsl_mtx_svd_ws_size(size_t rows, size_t cols)
+{
+	size_t min = cols;
+
+	if (rows <= cols) {
+		min = rows;
+	}
+
+	/* A working copy of 'm' and the singular values. */
+	return sizeof(zsl_real_t) * ((rows * cols) + min);
+}
+
+int
+zsl_mtx_svd_ws(struct zsl_mtx *m, struct zsl_mtx *u, struct zsl_mtx *e,
+	       struct zsl_mtx *v, size_t iter, struct zsl_workspace *ws)
+{
+	int rc;
+	size_t mark = ws->used;
+	size_t min = m->sz_cols;
+	struct zsl_vec s;
+
+	if (m->sz_rows <= m->sz_cols) {
+		min = m->sz_rows;
+	}
 
-	/* Since 'b' is the number of eigenvectors, reduce 'mev' (of size
-	 * m->sz_rows times b) to erase columns of zeros. */
-	mev->sz_cols = b;
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (u->sz_rows != m->sz_rows || u->sz_cols != m->sz_rows ||
+	    e->sz_rows != m->sz_rows || e->sz_cols != m->sz_cols ||
+	    v->sz_rows != m->sz_cols || v->sz_cols != m->sz_cols) {
+		return -EINVAL;
+	}
+#endif
 
-	for (size_t s = 0; s < b; s++) {
-		zsl_mtx_get_col(&mev2, s, f.data);
-		zsl_mtx_set_col(mev, s, f.data);
+	if (zsl_ws_avail(ws) < zsl_mtx_svd_ws_size(m->sz_rows, m->sz_cols)) {
+		return -ENOMEM;
 	}
 
-	/* Checks if the number of eigenvectors is the same as the shape of
-	 * the input matrix. If the number of eigenvectors is less than
-	 * the number of columns in the input matrix 'm', this will be
-	 * indicated by EEIGENSIZE as a return code. */
-	if (b != m->sz_cols) {
-		return -EEIGENSIZE;
+	if (zsl_ws_vec(ws, &s, min)) {
+		ws->used = mark;
+		return -ENOMEM;
 	}
 
-	return 0;
+	rc = zsl_mtx_svd_core(m, u, s.data, v, iter, ws);
+	if (rc == 0) {
+		/* Place the singular values in the diagonal entries of 'e',
+		 * the sigma matrix. */
+		zsl_mtx_init(e, NULL);
+		for (size_t g = 0; g < min; g++) {
+			zsl_mtx_set(e, g, g, s.data[g]);
+		}
+	}
+
+	ws->used = mark;
+
+	return rc;
 }
-#endif
 
-#ifndef CONFIG_ZSL_SINGLE_PRECISION
 int
 zsl_mtx_svd(struct zsl_mtx *m, struct zsl_mtx *u, struct zsl_mtx *e,
 	    struct zsl_mtx *v, size_t iter)
 {
-	ZSL_MATRIX_DEF(aat, m->sz_rows, m->sz_rows);
-	ZSL_MATRIX_DEF(upri, m->sz_rows, m->sz_rows);
-	ZSL_MATRIX_DEF(ata, m->sz_cols, m->sz_cols);
-	ZSL_MATRIX_DEF(at, m->sz_cols, m->sz_rows);
-	ZSL_VECTOR_DEF(ui, m->sz_rows);
-	ZSL_MATRIX_DEF(ui2, m->sz_cols, 1);
-	ZSL_MATRIX_DEF(ui3, m->sz_rows, 1);
-	ZSL_VECTOR_DEF(hu, m->sz_rows);
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_svd_ws_size(m->sz_rows, m->sz_cols));
 
-	zsl_real_t d;
-	size_t pu = 0;
+	return zsl_mtx_svd_ws(m, u, e, v, iter, &ws);
+}
+
+int
+zsl_mtx_svd_thin_ws(struct zsl_mtx *m, struct zsl_mtx *u, struct zsl_vec *s,
+		    struct zsl_mtx *v, size_t iter, struct zsl_workspace *ws)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
 	size_t min = m->sz_cols;
-	zsl_real_t epsilon = 1E-6;
 
-	zsl_mtx_trans(m, &at);
+	if (m->sz_rows <= m->sz_cols) {
+		min = m->sz_rows;
+	}
+
+	if (u->sz_rows != m->sz_rows || u->sz_cols != min || s->sz != min ||
+	    v->sz_rows != m->sz_cols || v->sz_cols != min) {
+		return -EINVAL;
+	}
+#endif
+
+	if (zsl_ws_avail(ws) < zsl_mtx_svd_ws_size(m->sz_rows, m->sz_cols)) {
+		return -ENOMEM;
+	}
+
+	return zsl_mtx_svd_core(m, u, s->data, v, iter, ws);
+}
+
+int
+zsl_mtx_svd_thin(struct zsl_mtx *m, struct zsl_mtx *u, struct zsl_vec *s,
+		 struct zsl_mtx *v, size_t iter)
+{
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_svd_ws_size(m->sz_rows, m->sz_cols));
+
+	return zsl_mtx_svd_thin_ws(m, u, s, v, iter, &ws);
+}
+
+size_t
+zsl_mtx_pinv_ws_size(size_t rows, size_t cols)
+{
+	size_t min = cols;
+
+	if (rows <= cols) {
+		min = rows;
+	}
+
+	/* The thin SVD output, followed by the SVD itself. */
+	return sizeof(zsl_real_t) * ((rows + cols + 1) * min) +
+	       zsl_mtx_svd_ws_size(rows, cols);
+}
+
+int
+zsl_mtx_pinv_ws(struct zsl_mtx *m, struct zsl_mtx *pinv, size_t iter,
+		struct zsl_workspace *ws)
+{
+	int rc;
+	zsl_real_t x, tol;
+	size_t min = m->sz_cols;
+	size_t mark = ws->used;
+	struct zsl_mtx u;
+	struct zsl_vec s;
+	struct zsl_mtx v;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (pinv->sz_rows != m->sz_cols || pinv->sz_cols != m->sz_rows) {
+		return -EINVAL;
+	}
+#endif
 
-	/* Calculate 'm' times 'm' transposed and viceversa. */
-	zsl_mtx_mult(m, &at, &aat);
-	zsl_mtx_mult(&at, m, &ata);
+	if (zsl_ws_avail(ws) < zsl_mtx_pinv_ws_size(m->sz_rows, m->sz_cols)) {
+		return -ENOMEM;
+	}
 
 	/* Set the value 'min' as the minimum of number of columns and number
 	 * of rows. */
@@ -1702,107 +6567,548 @@ zsl_mtx_svd(struct zsl_mtx *m, struct zsl_mtx *u, struct zsl_mtx *e,
 		min = m->sz_rows;
 	}
 
-	/* Calculate the eigenvalues of the square matrix 'm' times 'm'
-	 * transposed or the square matrix 'm' transposed times 'm', whichever
-	 * is smaller in dimensions. */
-	ZSL_VECTOR_DEF(ev, min);
-	if (min < m->sz_cols) {
-		zsl_mtx_eigenvalues(&aat, &ev, iter);
-	} else {
-		zsl_mtx_eigenvalues(&ata, &ev, iter);
+	if (zsl_ws_mtx(ws, &u, m->sz_rows, min) ||
+	    zsl_ws_vec(ws, &s, min) ||
+	    zsl_ws_mtx(ws, &v, m->sz_cols, min)) {
+		ws->used = mark;
+		return -ENOMEM;
+	}
+
+	/* Determine the thin SVD decomposition of 'm'. */
+	rc = zsl_mtx_svd_thin_ws(m, &u, &s, &v, iter, ws);
+	if (rc) {
+		ws->used = mark;
+		return rc;
 	}
 
-	/* Place the square root of these eigenvalues in the diagonal entries
-	 * of 'e', the sigma matrix. */
-	zsl_mtx_init(e, NULL);
+	/* Scale the columns of 'v' by the inverted singular values. Values
+	 * that are negligible compared to the largest one are treated as
+	 * zero, and their columns dropped. */
+	tol = s.data[0] * ZSL_EPSILON *
+	      (zsl_real_t)(m->sz_rows > m->sz_cols ? m->sz_rows : m->sz_cols);
 	for (size_t g = 0; g < min; g++) {
-		zsl_mtx_set(e, g, g, ZSL_SQRT(ev.data[g]));
-	}
-
-	/* Calculate the eigenvectors of 'm' times 'm' transposed and set them
-	 * as the columns of the 'v' matrix. */
-	zsl_mtx_eigenvectors(&ata, v, iter, true);
-	for (size_t i = 0; i < min; i++) {
-		zsl_mtx_get_col(v, i, ui.data);
-		zsl_mtx_from_arr(&ui2, ui.data);
-		zsl_mtx_get(e, i, i, &d);
-
-		/* Calculate the column vectors of 'u' by dividing these
-		 * eniegnvectors by the square root its eigenvalue and
-		 * multiplying them by the input matrix. */
-		zsl_mtx_mult(m, &ui2, &ui3);
-		if ((d >= 0.0 && d < epsilon) || (d <= 0.0 && d > -epsilon)) {
-			pu++;
-		} else {
-			zsl_mtx_scalar_mult_d(&ui3, (1 / d));
-			zsl_vec_from_arr(&ui, ui3.data);
-			zsl_mtx_set_col(u, i, ui.data);
+		x = (s.data[g] > tol) ? 1.0 / s.data[g] : 0.0;
+		for (size_t i = 0; i < m->sz_cols; i++) {
+			v.data[(i * min) + g] *= x;
 		}
 	}
 
-	/* Expand the columns of 'u' into an orthonormal basis if there are
-	 * zero eigenvalues or if the number of columns in 'm' is less than the
-	 * number of rows. */
-	zsl_mtx_eigenvectors(&aat, &upri, iter, true);
-	for (size_t f = min - pu; f < m->sz_rows; f++) {
-		zsl_mtx_get_col(&upri, f, hu.data);
-		zsl_mtx_set_col(u, f, hu.data);
+	/* pinv = v * inverted sigma * u transposed. */
+	for (size_t i = 0; i < m->sz_cols; i++) {
+		for (size_t j = 0; j < m->sz_rows; j++) {
+			x = 0.0;
+			for (size_t g = 0; g < min; g++) {
+				x += v.data[(i * min) + g] *
+				     u.data[(j * min) + g];
+			}
+			pinv->data[(i * m->sz_rows) + j] = x;
+		}
 	}
 
+	ws->used = mark;
+
 	return 0;
 }
-#endif
 
-#ifndef CONFIG_ZSL_SINGLE_PRECISION
 int
 zsl_mtx_pinv(struct zsl_mtx *m, struct zsl_mtx *pinv, size_t iter)
 {
-	zsl_real_t x;
-	size_t min = m->sz_cols;
-	zsl_real_t epsilon = 1E-6;
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_pinv_ws_size(m->sz_rows, m->sz_cols));
 
-	ZSL_MATRIX_DEF(u, m->sz_rows, m->sz_rows);
-	ZSL_MATRIX_DEF(e, m->sz_rows, m->sz_cols);
-	ZSL_MATRIX_DEF(v, m->sz_cols, m->sz_cols);
-	ZSL_MATRIX_DEF(et, m->sz_cols, m->sz_rows);
-	ZSL_MATRIX_DEF(ut, m->sz_rows, m->sz_rows);
-	ZSL_MATRIX_DEF(pas, m->sz_cols, m->sz_rows);
+	return zsl_mtx_pinv_ws(m, pinv, iter, &ws);
+}
 
-	/* Determine the SVD decomposition of 'm'. */
-	zsl_mtx_svd(m, &u, &e, &v, iter);
+size_t
+zsl_mtx_rank_ws_size(size_t rows, size_t cols)
+{
+	/* The same thin SVD as the pseudo-inverse. */
+	return zsl_mtx_pinv_ws_size(rows, cols);
+}
 
-	/* Transpose the 'u' matrix. */
-	zsl_mtx_trans(&u, &ut);
+int
+zsl_mtx_rank_ws(struct zsl_mtx *m, zsl_real_t tol, size_t *rank,
+		struct zsl_workspace *ws)
+{
+	int rc;
+	size_t min = m->sz_cols;
+	size_t mark = ws->used;
+	struct zsl_mtx u;
+	struct zsl_vec s;
+	struct zsl_mtx v;
+
+	if (zsl_ws_avail(ws) < zsl_mtx_rank_ws_size(m->sz_rows, m->sz_cols)) {
+		return -ENOMEM;
+	}
 
-	/* Set the value 'min' as the minimum of number of columns and number
-	 * of rows. */
 	if (m->sz_rows <= m->sz_cols) {
 		min = m->sz_rows;
 	}
 
-	for (size_t g = 0; g < min; g++) {
+	if (zsl_ws_mtx(ws, &u, m->sz_rows, min) ||
+	    zsl_ws_vec(ws, &s, min) ||
+	    zsl_ws_mtx(ws, &v, m->sz_cols, min)) {
+		ws->used = mark;
+		return -ENOMEM;
+	}
+
+	rc = zsl_mtx_svd_thin_ws(m, &u, &s, &v, 0, ws);
+	if (rc) {
+		ws->used = mark;
+		return rc;
+	}
+
+	/* Use the same default threshold as 'zsl_mtx_pinv'. The singular
+	 * values are sorted, largest first. */
+	if (tol <= 0.0 && min > 0) {
+		tol = s.data[0] * ZSL_EPSILON *
+		      (zsl_real_t)(m->sz_rows > m->sz_cols ? m->sz_rows :
+				   m->sz_cols);
+	}
+	*rank = 0;
+	while (*rank < min && s.data[*rank] > tol) {
+		(*rank)++;
+	}
+
+	ws->used = mark;
+
+	return 0;
+}
+
+int
+zsl_mtx_rank(struct zsl_mtx *m, zsl_real_t tol, size_t *rank)
+{
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_rank_ws_size(m->sz_rows, m->sz_cols));
+
+	return zsl_mtx_rank_ws(m, tol, rank, &ws);
+}
+
+/**
+ * @brief A diagonal Padé approximant of exp(x), and the largest 1-norm of
+ *        'x' it may be used for without losing precision (Higham, 2005).
+ */
+struct zsl_mtx_exp_pade {
+	/** Maximum 1-norm of the input. */
+	zsl_real_t theta;
+	/** Degree of the numerator and denominator polynomials. */
+	size_t deg;
+	/** The deg + 1 coefficients, lowest order first. */
+	const zsl_real_t *b;
+};
+
+static const zsl_real_t zsl_mtx_exp_b3[] = { 120.0, 60.0, 12.0, 1.0 };
+
+static const zsl_real_t zsl_mtx_exp_b5[] = {
+	30240.0, 15120.0, 3360.0, 420.0, 30.0, 1.0
+};
+
+static const zsl_real_t zsl_mtx_exp_b7[] = {
+	17297280.0, 8648640.0, 1995840.0, 277200.0, 25200.0, 1512.0, 56.0, 1.0
+};
+
+#ifndef CONFIG_ZSL_SINGLE_PRECISION
+static const zsl_real_t zsl_mtx_exp_b9[] = {
+	17643225600.0, 8821612800.0, 2075673600.0, 302702400.0, 30270240.0,
+	2162160.0, 110880.0, 3960.0, 90.0, 1.0
+};
+
+static const zsl_real_t zsl_mtx_exp_b13[] = {
+	64764752532480000.0, 32382376266240000.0, 7771770303897600.0,
+	1187353796428800.0, 129060195264000.0, 10559470521600.0,
+	670442572800.0, 33522128640.0, 1323241920.0, 40840800.0, 960960.0,
+	16380.0, 182.0, 1.0
+};
+
+static const struct zsl_mtx_exp_pade zsl_mtx_exp_pade[] = {
+	{ 1.495585217958292e-2, 3, zsl_mtx_exp_b3 },
+	{ 2.539398330063230e-1, 5, zsl_mtx_exp_b5 },
+	{ 9.504178996162932e-1, 7, zsl_mtx_exp_b7 },
+	{ 2.097847961257068e0, 9, zsl_mtx_exp_b9 },
+	{ 5.371920351148152e0, 13, zsl_mtx_exp_b13 },
+};
+#else
+static const struct zsl_mtx_exp_pade zsl_mtx_exp_pade[] = {
+	{ 4.258730016922831e-1, 3, zsl_mtx_exp_b3 },
+	{ 1.880152677804762e0, 5, zsl_mtx_exp_b5 },
+	{ 3.925724783138660e0, 7, zsl_mtx_exp_b7 },
+};
+#endif
+
+/**
+ * @brief Sets 'out' to b[0] * I + b[2] * pw[0] + ... + b[2k] * pw[k - 1],
+ *        leaving out the identity term if 'id' is false, and adds the sum to
+ *        the current contents of 'out' if 'acc' is true.
+ */
+static void
+zsl_mtx_exp_sum(struct zsl_mtx *out, const zsl_real_t *b, struct zsl_mtx *pw,
+		size_t k, bool id, bool acc)
+{
+	size_t n = out->sz_rows;
+	zsl_real_t x;
+
+	for (size_t g = 0; g < n * n; g++) {
+		x = acc ? out->data[g] : 0.0;
+		for (size_t j = 1; j <= k; j++) {
+			x += b[2 * j] * pw[j - 1].data[g];
+		}
+		out->data[g] = x;
+	}
+
+	if (id) {
+		for (size_t i = 0; i < n; i++) {
+			out->data[(i * n) + i] += b[0];
+		}
+	}
+}
+
+/**
+ * @brief Solves a * x = b by Gaussian elimination with partial pivoting,
+ *        leaving 'x' in 'b' and destroying 'a'. Unlike 'zsl_mtx_lu_solve',
+ *        this doesn't need a pivot array.
+ */
+static int
+zsl_mtx_exp_solve(struct zsl_mtx *a, struct zsl_mtx *b)
+{
+	size_t n = a->sz_rows;
+	size_t nc = b->sz_cols;
+	size_t p;
+	zsl_real_t f, max;
+	zsl_real_t *ak, *ai, *bk, *bi;
+
+	for (size_t k = 0; k < n; k++) {
+		p = k;
+		max = ZSL_ABS(a->data[(k * n) + k]);
+		for (size_t i = k + 1; i < n; i++) {
+			if (ZSL_ABS(a->data[(i * n) + k]) > max) {
+				max = ZSL_ABS(a->data[(i * n) + k]);
+				p = i;
+			}
+		}
+		if (max == 0.0) {
+			return -ESINGULAR;
+		}
+		if (p != k) {
+			zsl_mtx_swap_rows(a, k, p);
+			zsl_mtx_swap_rows(b, k, p);
+		}
+
+		ak = &a->data[k * n];
+		bk = &b->data[k * nc];
+		for (size_t i = k + 1; i < n; i++) {
+			ai = &a->data[i * n];
+			bi = &b->data[i * nc];
+			f = ai[k] / ak[k];
+			for (size_t j = k + 1; j < n; j++) {
+				ai[j] -= f * ak[j];
+			}
+			for (size_t j = 0; j < nc; j++) {
+				bi[j] -= f * bk[j];
+			}
+		}
+	}
+
+	for (size_t k = n; k-- > 0;) {
+		ak = &a->data[k * n];
+		bk = &b->data[k * nc];
+		for (size_t j = 0; j < nc; j++) {
+			f = bk[j];
+			for (size_t i = k + 1; i < n; i++) {
+				f -= ak[i] * b->data[(i * nc) + j];
+			}
+			bk[j] = f / ak[k];
+		}
+	}
+
+	return 0;
+}
+
+size_t
+zsl_mtx_exp_ws_size(size_t n)
+{
+	/* The scaled input, its even powers up to the eighth, U, V and a
+	 * temporary matrix. */
+	return sizeof(zsl_real_t) * 8 * n * n;
+}
+
+int
+zsl_mtx_exp_ws(struct zsl_mtx *m, struct zsl_mtx *me, struct zsl_workspace *ws)
+{
+	size_t n = m->sz_rows;
+	size_t mark = ws->used;
+	size_t npade = sizeof(zsl_mtx_exp_pade) / sizeof(zsl_mtx_exp_pade[0]);
+	const struct zsl_mtx_exp_pade *pade;
+	size_t npw, s, d;
+	zsl_real_t norm, scale, x;
+	struct zsl_mtx a, u, v, t;
+	struct zsl_mtx pw[4];
+	struct zsl_mtx *r, *tmp, *sw;
+	int rc;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (m->sz_rows != m->sz_cols || me->sz_rows != n ||
+	    me->sz_cols != n) {
+		return -EINVAL;
+	}
+#endif
+
+	if (zsl_ws_avail(ws) < zsl_mtx_exp_ws_size(n)) {
+		return -ENOMEM;
+	}
+
+	zsl_mtx_norm_1(m, &norm);
+	if (!isfinite(norm)) {
+		return -EINVAL;
+	}
 
-		/* Invert the diagonal values in 'e'. If a value is zero, do
-		 * nothing to it. */
-		zsl_mtx_get(&e, g, g, &x);
-		if ((x < epsilon) || (x > -epsilon)) {
-			x = 1 / x;
-			zsl_mtx_set(&e, g, g, x);
+	/* Use the lowest degree that is accurate enough for 'm', or else
+	 * scale 'm' by 1/2^s so the highest one is, and square the result s
+	 * times at the end. */
+	for (d = 0; d < npade - 1; d++) {
+		if (norm <= zsl_mtx_exp_pade[d].theta) {
+			break;
 		}
 	}
+	pade = &zsl_mtx_exp_pade[d];
+	s = 0;
+	scale = 1.0;
+	while (norm * scale > pade->theta) {
+		scale *= 0.5;
+		s++;
+	}
+
+	if (zsl_ws_mtx(ws, &a, n, n) ||
+	    zsl_ws_mtx(ws, &pw[0], n, n) ||
+	    zsl_ws_mtx(ws, &pw[1], n, n) ||
+	    zsl_ws_mtx(ws, &pw[2], n, n) ||
+	    zsl_ws_mtx(ws, &pw[3], n, n) ||
+	    zsl_ws_mtx(ws, &u, n, n) ||
+	    zsl_ws_mtx(ws, &v, n, n) ||
+	    zsl_ws_mtx(ws, &t, n, n)) {
+		ws->used = mark;
+		return -ENOMEM;
+	}
 
-	/* Transpose the sigma matrix. */
-	zsl_mtx_trans(&e, &et);
+	for (size_t g = 0; g < n * n; g++) {
+		a.data[g] = m->data[g] * scale;
+	}
+
+	/* Even powers of 'a', up to the sixth for degree 13. */
+	npw = (pade->deg == 13) ? 3 : pade->deg / 2;
+	zsl_mtx_mult(&a, &a, &pw[0]);
+	for (size_t g = 1; g < npw; g++) {
+		zsl_mtx_mult(&pw[g - 1], &pw[0], &pw[g]);
+	}
+
+	/* The odd part of the numerator, U, is 'a' times a polynomial in the
+	 * even powers, and the even part is V. Degree 13 evaluates the terms
+	 * above a^6 as a^6 times a second polynomial. */
+	if (pade->deg == 13) {
+		zsl_mtx_exp_sum(&t, pade->b + 7, pw, 3, false, false);
+		zsl_mtx_mult(&pw[2], &t, &u);
+		zsl_mtx_exp_sum(&u, pade->b + 1, pw, 3, true, true);
+		zsl_mtx_exp_sum(&t, pade->b + 6, pw, 3, false, false);
+		zsl_mtx_mult(&pw[2], &t, &v);
+		zsl_mtx_exp_sum(&v, pade->b, pw, 3, true, true);
+	} else {
+		zsl_mtx_exp_sum(&u, pade->b + 1, pw, npw, true, false);
+		zsl_mtx_exp_sum(&v, pade->b, pw, npw, true, false);
+	}
+	zsl_mtx_mult(&a, &u, &t);
+
+	/* Solve (V - U) * r = V + U. */
+	for (size_t g = 0; g < n * n; g++) {
+		x = v.data[g];
+		u.data[g] = x - t.data[g];
+		v.data[g] = x + t.data[g];
+	}
+	rc = zsl_mtx_exp_solve(&u, &v);
+	if (rc) {
+		ws->used = mark;
+		return rc;
+	}
+
+	/* Undo the scaling by squaring. */
+	r = &v;
+	tmp = &t;
+	for (size_t g = 0; g < s; g++) {
+		zsl_mtx_mult(r, r, tmp);
+		sw = r;
+		r = tmp;
+		tmp = sw;
+	}
+	zsl_mtx_copy(me, r);
 
-	/* Multiply 'u' (transposed) times sigma (transposed and with inverted
-	 * eigenvalues) times 'v'. */
-	zsl_mtx_mult(&v, &et, &pas);
-	zsl_mtx_mult(&pas, &ut, pinv);
+	ws->used = mark;
 
 	return 0;
 }
+
+int
+zsl_mtx_exp(struct zsl_mtx *m, struct zsl_mtx *me)
+{
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_exp_ws_size(m->sz_rows));
+
+	return zsl_mtx_exp_ws(m, me, &ws);
+}
+
+size_t
+zsl_mtx_discretize_ws_size(size_t n, size_t p)
+{
+	size_t sz = 2 * n;
+
+	if (n + p > sz) {
+		sz = n + p;
+	}
+
+	/* The larger of the two block matrices, and its exponential. */
+	return sizeof(zsl_real_t) * sz * sz + zsl_mtx_exp_ws_size(sz);
+}
+
+int
+zsl_mtx_discretize_ws(struct zsl_mtx *a, struct zsl_mtx *b,
+		      struct zsl_mtx *q, zsl_real_t dt, struct zsl_mtx *ad,
+		      struct zsl_mtx *bd, struct zsl_mtx *qd,
+		      struct zsl_workspace *ws)
+{
+	size_t n = a->sz_rows;
+	size_t p = (b == NULL) ? 0 : b->sz_cols;
+	size_t sz, mark = ws->used;
+	zsl_real_t sum;
+	struct zsl_mtx mb, e12;
+	int rc;
+
+	if ((b == NULL) != (bd == NULL) || (q == NULL) != (qd == NULL)) {
+		return -EINVAL;
+	}
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (a->sz_cols != n || ad->sz_rows != n || ad->sz_cols != n ||
+	    zsl_mtx_overlaps(ad, a)) {
+		return -EINVAL;
+	}
+	if (b != NULL && (b->sz_rows != n || bd->sz_rows != n ||
+			  bd->sz_cols != p || zsl_mtx_overlaps(bd, a) ||
+			  zsl_mtx_overlaps(bd, b))) {
+		return -EINVAL;
+	}
+	if (q != NULL && (q->sz_rows != n || q->sz_cols != n ||
+			  qd->sz_rows != n || qd->sz_cols != n ||
+			  zsl_mtx_overlaps(qd, a) || zsl_mtx_overlaps(qd, q) ||
+			  zsl_mtx_overlaps(qd, ad))) {
+		return -EINVAL;
+	}
 #endif
 
+	if (zsl_ws_avail(ws) < zsl_mtx_discretize_ws_size(n, p)) {
+		return -ENOMEM;
+	}
+
+	/* exp([[A, B], [0, 0]] * dt) = [[Ad, Bd], [0, I]]. Without 'b' this
+	 * is just exp(A * dt), and it isn't needed at all if the Van Loan
+	 * matrix below already provides Ad. */
+	if (b != NULL || q == NULL) {
+		sz = n + p;
+		if (zsl_ws_mtx(ws, &mb, sz, sz)) {
+			ws->used = mark;
+			return -ENOMEM;
+		}
+		zsl_mtx_init(&mb, NULL);
+		for (size_t i = 0; i < n; i++) {
+			for (size_t j = 0; j < n; j++) {
+				mb.data[(i * sz) + j] =
+					a->data[(i * n) + j] * dt;
+			}
+			for (size_t j = 0; j < p; j++) {
+				mb.data[(i * sz) + n + j] =
+					b->data[(i * p) + j] * dt;
+			}
+		}
+
+		rc = zsl_mtx_exp_ws(&mb, &mb, ws);
+		if (rc) {
+			ws->used = mark;
+			return rc;
+		}
+
+		for (size_t i = 0; i < n; i++) {
+			for (size_t j = 0; j < n; j++) {
+				ad->data[(i * n) + j] = mb.data[(i * sz) + j];
+			}
+			for (size_t j = 0; j < p; j++) {
+				bd->data[(i * p) + j] =
+					mb.data[(i * sz) + n + j];
+			}
+		}
+		ws->used = mark;
+	}
+
+	/* Van Loan's method: exp([[-A, Q], [0, At]] * dt) = [[F11, F12],
+	 * [0, F22]], where F22 = Adt and Qd = Ad * F12. */
+	if (q != NULL) {
+		sz = 2 * n;
+		if (zsl_ws_mtx(ws, &mb, sz, sz)) {
+			ws->used = mark;
+			return -ENOMEM;
+		}
+		zsl_mtx_init(&mb, NULL);
+		for (size_t i = 0; i < n; i++) {
+			for (size_t j = 0; j < n; j++) {
+				mb.data[(i * sz) + j] =
+					-a->data[(i * n) + j] * dt;
+				mb.data[(i * sz) + n + j] =
+					q->data[(i * n) + j] * dt;
+				mb.data[((n + i) * sz) + n + j] =
+					a->data[(j * n) + i] * dt;
+			}
+		}
+
+		rc = zsl_mtx_exp_ws(&mb, &mb, ws);
+		if (rc) {
+			ws->used = mark;
+			return rc;
+		}
+
+		if (zsl_ws_mtx(ws, &e12, n, n)) {
+			ws->used = mark;
+			return -ENOMEM;
+		}
+		for (size_t i = 0; i < n; i++) {
+			for (size_t j = 0; j < n; j++) {
+				e12.data[(i * n) + j] =
+					mb.data[(i * sz) + n + j];
+				if (b == NULL) {
+					ad->data[(i * n) + j] =
+						mb.data[((n + j) * sz) + n + i];
+				}
+			}
+		}
+		zsl_mtx_mult(ad, &e12, qd);
+
+		/* Remove the rounding errors that make 'qd' asymmetric. */
+		for (size_t i = 0; i < n; i++) {
+			for (size_t j = i + 1; j < n; j++) {
+				sum = (qd->data[(i * n) + j] +
+				       qd->data[(j * n) + i]) / 2.0;
+				qd->data[(i * n) + j] = sum;
+				qd->data[(j * n) + i] = sum;
+			}
+		}
+		ws->used = mark;
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_discretize(struct zsl_mtx *a, struct zsl_mtx *b, struct zsl_mtx *q,
+		   zsl_real_t dt, struct zsl_mtx *ad, struct zsl_mtx *bd,
+		   struct zsl_mtx *qd)
+{
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_discretize_ws_size(a->sz_rows,
+			  (b == NULL) ? 0 : b->sz_cols));
+
+	return zsl_mtx_discretize_ws(a, b, q, dt, ad, bd, qd, &ws);
+}
+
 int
 zsl_mtx_min(struct zsl_mtx *m, zsl_real_t *x)
 {
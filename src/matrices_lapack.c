@@ -0,0 +1,923 @@
+/*
+ * Copyright (c) 2026 Kevin Townsend
+ * Copyright (c) 1992-2013 The University of Tennessee and The University
+ *                         of Tennessee Research Foundation. All rights
+ *                         reserved.
+ * Copyright (c) 2000-2013 The University of California Berkeley. All
+ *                         rights reserved.
+ * Copyright (c) 2006-2013 The University of Colorado Denver. All rights
+ *                         reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause-Open-MPI
+ */
+
+/*
+ * Matrix routines derived from LAPACK 3.x, and distributed under the LAPACK
+ * license reproduced in NOTICE:
+ *
+ * - zsl_mtx_schur_2x2: dlanv2
+ * - zsl_mtx_francis_house: dlarfg
+ * - zsl_mtx_francis: dlahqr
+ * - zsl_mtx_tridiag: dsytd2 and dorgtr
+ * - zsl_mtx_eigen_sym_2x2: dlaev2
+ * - zsl_mtx_tridiag_rot: dlasr
+ * - zsl_mtx_tridiag_givens: dlartg
+ * - zsl_mtx_tridiag_ql: dsteqr
+ * - zsl_mtx_eigen_sym_ql: dsyev
+ */
+
+#include <errno.h>
+#include <zsl/zsl.h>
+#include <zsl/matrices.h>
+#include "matrices_lapack.h"
+
+/**
+ * @brief Computes the eigenvalues of the 2x2 matrix [a b; c d] into 'wr' and
+ *        'wi', which must hold two values each. A complex conjugate pair is
+ *        stored with the positive imaginary part first.
+ *
+ * Like LAPACK's dlanv2, the block is first rotated into standard Schur form,
+ * which keeps nearly equal real eigenvalues and complex pairs with a small
+ * imaginary part accurate.
+ */
+static void
+zsl_mtx_schur_2x2(zsl_real_t a, zsl_real_t b, zsl_real_t c, zsl_real_t d,
+		  zsl_real_t *wr, zsl_real_t *wi)
+{
+	zsl_real_t p, z, bc_max, bc_min, scale, sigma, tau, cs, sn;
+	zsl_real_t aa, bb, cc, dd;
+
+	if (c == 0.0) {
+		/* Already upper triangular. */
+	} else if (b == 0.0) {
+		/* Lower triangular, so swap the rows and columns. */
+		p = a;
+		a = d;
+		d = p;
+		b = -c;
+		c = 0.0;
+	} else if (a == d && (b < 0.0) != (c < 0.0)) {
+		/* Already in standard form, with a complex pair. */
+	} else {
+		p = 0.5 * (a - d);
+		bc_max = ZSL_MAX(ZSL_ABS(b), ZSL_ABS(c));
+		bc_min = ZSL_MIN(ZSL_ABS(b), ZSL_ABS(c));
+		if ((b < 0.0) != (c < 0.0)) {
+			bc_min = -bc_min;
+		}
+		scale = ZSL_MAX(ZSL_ABS(p), bc_max);
+		z = (p / scale) * p + (bc_max / scale) * bc_min;
+
+		if (z >= 4.0 * ZSL_EPSILON) {
+			/* Distinct real eigenvalues. Taking the root with the
+			 * sign of 'p' avoids cancellation. */
+			z = ZSL_SQRT(scale) * ZSL_SQRT(z);
+			z = p + (p < 0.0 ? -z : z);
+			a = d + z;
+			d -= (bc_max / z) * bc_min;
+			c = 0.0;
+		} else {
+			/* Complex or nearly equal eigenvalues. Rotate the
+			 * block so its diagonal elements are equal. */
+			sigma = b + c;
+			tau = ZSL_SQRT(sigma * sigma + 4.0 * p * p);
+			cs = ZSL_SQRT(0.5 * (1.0 + ZSL_ABS(sigma) / tau));
+			sn = -(p / (tau * cs));
+			if (sigma < 0.0) {
+				sn = -sn;
+			}
+
+			aa = a * cs + b * sn;
+			bb = -a * sn + b * cs;
+			cc = c * cs + d * sn;
+			dd = -c * sn + d * cs;
+			b = bb * cs + dd * sn;
+			c = -aa * sn + cc * cs;
+			a = 0.5 * ((aa * cs + cc * sn) + (-bb * sn + dd * cs));
+			d = a;
+
+			if (b == 0.0) {
+				c = 0.0;
+			} else if (c != 0.0 && (b < 0.0) == (c < 0.0)) {
+				/* The eigenvalues are real after all. */
+				z = ZSL_SQRT(ZSL_ABS(b)) * ZSL_SQRT(ZSL_ABS(c));
+				if (c < 0.0) {
+					z = -z;
+				}
+				a += z;
+				d -= z;
+				c = 0.0;
+			}
+		}
+	}
+
+	wr[0] = a;
+	wr[1] = d;
+	if (c == 0.0) {
+		wi[0] = 0.0;
+		wi[1] = 0.0;
+	} else {
+		wi[0] = ZSL_SQRT(ZSL_ABS(b)) * ZSL_SQRT(ZSL_ABS(c));
+		wi[1] = -wi[0];
+	}
+}
+
+/**
+ * @brief Computes the Householder reflector H = I - tau * v * vt that maps
+ *        the 'len' values of 'v', at most three, to beta * e1, like LAPACK's
+ *        dlarfg. On return v[0] holds beta, and the rest of 'v' holds the
+ *        reflector, whose first value is an implicit 1.
+ *
+ * Unlike zsl_mtx_house, this only skips the reflection if the rest of 'v' is
+ * exactly zero. The QR sweeps depend on tiny reflections to keep shrinking
+ * subdiagonal elements that are just above the deflation threshold.
+ */
+static zsl_real_t
+zsl_mtx_francis_house(zsl_real_t *v, size_t len)
+{
+	zsl_real_t scale = 0.0;
+	zsl_real_t norm = 0.0;
+	zsl_real_t beta;
+
+	for (size_t i = 1; i < len; i++) {
+		scale = ZSL_MAX(scale, ZSL_ABS(v[i]));
+	}
+	if (scale == 0.0) {
+		return 0.0;
+	}
+
+	/* Scale before squaring, to avoid overflow and underflow. */
+	scale = ZSL_MAX(scale, ZSL_ABS(v[0]));
+	for (size_t i = 0; i < len; i++) {
+		norm += (v[i] / scale) * (v[i] / scale);
+	}
+	beta = scale * ZSL_SQRT(norm);
+	if (v[0] >= 0.0) {
+		beta = -beta;
+	}
+
+	for (size_t i = 1; i < len; i++) {
+		v[i] /= v[0] - beta;
+	}
+	norm = (beta - v[0]) / beta;
+	v[0] = beta;
+
+	return norm;
+}
+
+int
+zsl_mtx_francis(struct zsl_mtx *h, zsl_real_t *wr, zsl_real_t *wi,
+		size_t iter)
+{
+	size_t n = h->sz_rows;
+	zsl_real_t *a = h->data;
+	size_t top = n;
+	size_t lo, hi, k, m, sweeps, len, last;
+	zsl_real_t v[3];
+	zsl_real_t sub, tst, ab, ba, aa, bb, s, tau, t1, t2, sum;
+	zsl_real_t h11, h12, h21, h22, tr, det, disc;
+	zsl_real_t re1, im1, re2, im2;
+
+#ifdef CONFIG_ZSL_SINGLE_PRECISION
+	zsl_real_t small = FLT_MIN * ((zsl_real_t)n / ZSL_EPSILON);
+#else
+	zsl_real_t small = DBL_MIN * ((zsl_real_t)n / ZSL_EPSILON);
+#endif
+
+	/* Rows 'top' and below have converged. The active window is rows and
+	 * columns 'lo' to 'hi'. */
+	while (top > 0) {
+		hi = top - 1;
+		lo = 0;
+
+		for (sweeps = 0;; sweeps++) {
+			/* Look for a negligible subdiagonal element. */
+			for (k = hi; k > lo; k--) {
+				sub = ZSL_ABS(a[(k * n) + k - 1]);
+				if (sub <= small) {
+					break;
+				}
+				tst = ZSL_ABS(a[((k - 1) * n) + k - 1]) +
+				      ZSL_ABS(a[(k * n) + k]);
+				if (tst == 0.0) {
+					/* Fall back on the neighbouring
+					 * subdiagonal elements. */
+					t1 = (k >= 2) ?
+					     a[((k - 1) * n) + k - 2] : 0.0;
+					t2 = (k + 1 < n) ?
+					     a[((k + 1) * n) + k] : 0.0;
+					tst = ZSL_ABS(t1) + ZSL_ABS(t2);
+				}
+				if (sub > ZSL_EPSILON * tst) {
+					continue;
+				}
+
+				/* Only split if the element is also small next
+				 * to the 2x2 block it belongs to. */
+				t1 = ZSL_ABS(a[((k - 1) * n) + k]);
+				ab = ZSL_MAX(sub, t1);
+				ba = ZSL_MIN(sub, t1);
+				t1 = ZSL_ABS(a[(k * n) + k]);
+				t2 = ZSL_ABS(a[((k - 1) * n) + k - 1] -
+					     a[(k * n) + k]);
+				aa = ZSL_MAX(t1, t2);
+				bb = ZSL_MIN(t1, t2);
+				s = aa + ab;
+				t1 = ZSL_EPSILON * (bb * (aa / s));
+				if (ba * (ab / s) <= ZSL_MAX(small, t1)) {
+					break;
+				}
+			}
+			lo = k;
+			if (lo > 0) {
+				a[(lo * n) + lo - 1] = 0.0;
+			}
+
+			/* A 1x1 or 2x2 block has split off at the bottom. */
+			if (lo + 1 >= hi) {
+				break;
+			}
+
+			if (sweeps == iter) {
+				return -ECONVERGE;
+			}
+
+			/* Take the eigenvalues of the trailing 2x2 block as the
+			 * shifts, or make up exceptional ones to break cycles
+			 * if nothing has deflated for a while. */
+			if ((sweeps + 1) % 20 == 0) {
+				s = ZSL_ABS(a[(hi * n) + hi - 1]) +
+				    ZSL_ABS(a[((hi - 1) * n) + hi - 2]);
+				h11 = 0.75 * s + a[(hi * n) + hi];
+				h12 = -0.4375 * s;
+				h21 = s;
+				h22 = h11;
+			} else if ((sweeps + 1) % 10 == 0) {
+				s = ZSL_ABS(a[((lo + 1) * n) + lo]) +
+				    ZSL_ABS(a[((lo + 2) * n) + lo + 1]);
+				h11 = 0.75 * s + a[(lo * n) + lo];
+				h12 = -0.4375 * s;
+				h21 = s;
+				h22 = h11;
+			} else {
+				h11 = a[((hi - 1) * n) + hi - 1];
+				h12 = a[((hi - 1) * n) + hi];
+				h21 = a[(hi * n) + hi - 1];
+				h22 = a[(hi * n) + hi];
+			}
+
+			s = ZSL_ABS(h11) + ZSL_ABS(h12) + ZSL_ABS(h21) +
+			    ZSL_ABS(h22);
+			if (s == 0.0) {
+				re1 = im1 = re2 = im2 = 0.0;
+			} else {
+				h11 /= s;
+				h12 /= s;
+				h21 /= s;
+				h22 /= s;
+				tr = 0.5 * (h11 + h22);
+				det = (h11 - tr) * (h22 - tr) - h12 * h21;
+				disc = ZSL_SQRT(ZSL_ABS(det));
+				if (det >= 0.0) {
+					/* A complex conjugate pair. */
+					re1 = re2 = tr * s;
+					im1 = disc * s;
+					im2 = -im1;
+				} else {
+					/* Two real shifts, of which only the
+					 * one closer to h22 is used, twice. */
+					re1 = tr + disc;
+					re2 = tr - disc;
+					if (ZSL_ABS(re1 - h22) <=
+					    ZSL_ABS(re2 - h22)) {
+						re2 = re1;
+					} else {
+						re1 = re2;
+					}
+					re1 *= s;
+					re2 = re1;
+					im1 = im2 = 0.0;
+				}
+			}
+
+			/* Start the bulge at the lowest row 'm' where it
+			 * doesn't disturb the subdiagonal above it, at
+			 * working precision. 'v' is the first column of
+			 * (H - s1 * I) * (H - s2 * I), scaled. */
+			for (m = hi - 2;; m--) {
+				sub = a[((m + 1) * n) + m];
+				s = ZSL_ABS(a[(m * n) + m] - re2) +
+				    ZSL_ABS(im2) + ZSL_ABS(sub);
+				sub /= s;
+				v[0] = sub * a[(m * n) + m + 1] +
+				       (a[(m * n) + m] - re1) *
+				       ((a[(m * n) + m] - re2) / s) -
+				       im1 * (im2 / s);
+				v[1] = sub * (a[(m * n) + m] +
+					      a[((m + 1) * n) + m + 1] -
+					      re1 - re2);
+				v[2] = sub * a[((m + 2) * n) + m + 1];
+				s = ZSL_ABS(v[0]) + ZSL_ABS(v[1]) +
+				    ZSL_ABS(v[2]);
+				v[0] /= s;
+				v[1] /= s;
+				v[2] /= s;
+				if (m == lo) {
+					break;
+				}
+				t1 = ZSL_ABS(a[(m * n) + m - 1]) *
+				     (ZSL_ABS(v[1]) + ZSL_ABS(v[2]));
+				t2 = ZSL_ABS(v[0]) *
+				     (ZSL_ABS(a[((m - 1) * n) + m - 1]) +
+				      ZSL_ABS(a[(m * n) + m]) +
+				      ZSL_ABS(a[((m + 1) * n) + m + 1]));
+				if (t1 <= ZSL_EPSILON * t2) {
+					break;
+				}
+			}
+
+			/* Chase the bulge down to the bottom of the window. */
+			for (k = m; k < hi; k++) {
+				len = (hi - k + 1 < 3) ? hi - k + 1 : 3;
+				if (k > m) {
+					for (size_t r = 0; r < len; r++) {
+						v[r] = a[((k + r) * n) + k - 1];
+					}
+				}
+				tau = zsl_mtx_francis_house(v, len);
+				if (k > m) {
+					/* The reflector clears the bulge left
+					 * behind by the previous one. */
+					a[(k * n) + k - 1] = v[0];
+					for (size_t r = 1; r < len; r++) {
+						a[((k + r) * n) + k - 1] = 0.0;
+					}
+				} else if (m > lo) {
+					/* The first reflector also scales the
+					 * subdiagonal element above it. */
+					a[(k * n) + k - 1] *= 1.0 - tau;
+				}
+				if (tau == 0.0) {
+					continue;
+				}
+				t1 = tau * v[1];
+				t2 = (len == 3) ? tau * v[2] : 0.0;
+
+				/* H = (I - tau * v * vt) * H ... */
+				for (size_t j = k; j <= hi; j++) {
+					sum = a[(k * n) + j] +
+					      v[1] * a[((k + 1) * n) + j];
+					if (len == 3) {
+						sum += v[2] *
+						       a[((k + 2) * n) + j];
+						a[((k + 2) * n) + j] -=
+							sum * t2;
+					}
+					a[((k + 1) * n) + j] -= sum * t1;
+					a[(k * n) + j] -= sum * tau;
+				}
+
+				/* ... * (I - tau * v * vt). */
+				last = (k + 3 < hi) ? k + 3 : hi;
+				for (size_t i = lo; i <= last; i++) {
+					sum = a[(i * n) + k] +
+					      v[1] * a[(i * n) + k + 1];
+					if (len == 3) {
+						sum += v[2] *
+						       a[(i * n) + k + 2];
+						a[(i * n) + k + 2] -=
+							sum * t2;
+					}
+					a[(i * n) + k + 1] -= sum * t1;
+					a[(i * n) + k] -= sum * tau;
+				}
+			}
+		}
+
+		/* Store the eigenvalues of the block that split off. */
+		if (lo == hi) {
+			wr[hi] = a[(hi * n) + hi];
+			wi[hi] = 0.0;
+		} else {
+			zsl_mtx_schur_2x2(a[(lo * n) + lo], a[(lo * n) + hi],
+					  a[(hi * n) + lo], a[(hi * n) + hi],
+					  &wr[lo], &wi[lo]);
+		}
+		top = lo;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Reduces the symmetric matrix 'z' to tridiagonal form T = Qt * z * Q
+ *        with Householder reflectors, and overwrites 'z' with Q. On exit 'd'
+ *        holds the diagonal of T, and e[0..n-2] its subdiagonal. 'tau' is
+ *        scratch space for n values. Only the lower triangle of 'z' is read.
+ *
+ * This follows LAPACK's dsytd2 and dorgtr for the lower triangle. Reflector
+ * 'i' clears column 'i' below the subdiagonal and is stored there, and Q is
+ * then built in place by applying the reflectors to the identity, last one
+ * first.
+ */
+static void
+zsl_mtx_tridiag(struct zsl_mtx *z, zsl_real_t *d, zsl_real_t *e,
+		zsl_real_t *tau)
+{
+	size_t n = z->sz_rows;
+	zsl_real_t *a = z->data;
+	zsl_real_t x;
+
+	/* The part of 'd' below row 'i' is free until the end, so it holds
+	 * the vector w of the rank-2 update. */
+	zsl_real_t *w = d;
+
+	for (size_t i = 0; i + 1 < n; i++) {
+		tau[i] = zsl_mtx_house(&a[((i + 1) * n) + i], n, n - i - 1);
+		e[i] = a[((i + 1) * n) + i];
+
+		if (tau[i] != 0.0) {
+			a[((i + 1) * n) + i] = 1.0;
+
+			/* w = tau * A * v, with A the trailing submatrix. */
+			for (size_t r = i + 1; r < n; r++) {
+				w[r] = 0.0;
+			}
+			for (size_t r = i + 1; r < n; r++) {
+				for (size_t c = i + 1; c < r; c++) {
+					w[r] += a[(r * n) + c] * a[(c * n) + i];
+					w[c] += a[(r * n) + c] * a[(r * n) + i];
+				}
+				w[r] += a[(r * n) + r] * a[(r * n) + i];
+			}
+
+			/* w = w - (tau / 2) * (wt * v) * v. */
+			x = 0.0;
+			for (size_t r = i + 1; r < n; r++) {
+				w[r] *= tau[i];
+				x += w[r] * a[(r * n) + i];
+			}
+			x *= -0.5 * tau[i];
+			for (size_t r = i + 1; r < n; r++) {
+				w[r] += x * a[(r * n) + i];
+			}
+
+			/* A = A - v * wt - w * vt, in the lower triangle. */
+			for (size_t r = i + 1; r < n; r++) {
+				for (size_t c = i + 1; c <= r; c++) {
+					a[(r * n) + c] -=
+						a[(r * n) + i] * w[c] +
+						w[r] * a[(c * n) + i];
+				}
+			}
+
+			a[((i + 1) * n) + i] = e[i];
+		}
+		d[i] = a[(i * n) + i];
+	}
+	if (n > 0) {
+		d[n - 1] = a[(n * n) - 1];
+	}
+
+	/* Move reflector 'i' one column to the right, to where it acts in
+	 * the trailing n - 1 rows and columns of Q. */
+	for (size_t i = n - 1; i-- > 1;) {
+		for (size_t r = i + 1; r < n; r++) {
+			a[(r * n) + i] = a[(r * n) + i - 1];
+		}
+	}
+
+	/* Build Q = H(0) * ... * H(n - 2) in the trailing block, starting from
+	 * the identity. Column 'c' holds reflector c - 1 until it is used. */
+	for (size_t c = n; c-- > 1;) {
+		x = tau[c - 1];
+		if (c + 1 < n) {
+			a[(c * n) + c] = 1.0;
+			for (size_t j = c + 1; j < n; j++) {
+				zsl_real_t s = 0.0;
+
+				for (size_t r = c; r < n; r++) {
+					s += a[(r * n) + c] * a[(r * n) + j];
+				}
+				s *= x;
+				for (size_t r = c; r < n; r++) {
+					a[(r * n) + j] -= s * a[(r * n) + c];
+				}
+			}
+			for (size_t r = c + 1; r < n; r++) {
+				a[(r * n) + c] *= -x;
+			}
+		}
+		a[(c * n) + c] = 1.0 - x;
+		for (size_t r = 0; r < c; r++) {
+			a[(r * n) + c] = 0.0;
+		}
+	}
+
+	/* The first row and column of Q are those of the identity. */
+	if (n > 0) {
+		a[0] = 1.0;
+		for (size_t j = 1; j < n; j++) {
+			a[j * n] = 0.0;
+		}
+	}
+}
+
+/**
+ * @brief Computes the eigenvalues of the symmetric 2x2 matrix [a b; b c],
+ *        'rt1' being the one with the larger absolute value, and the unit
+ *        eigenvector (cs, sn) of 'rt1', like LAPACK's dlaev2.
+ */
+static void
+zsl_mtx_eigen_sym_2x2(zsl_real_t a, zsl_real_t b, zsl_real_t c,
+		      zsl_real_t *rt1, zsl_real_t *rt2, zsl_real_t *cs,
+		      zsl_real_t *sn)
+{
+	zsl_real_t sum = a + c;
+	zsl_real_t df = a - c;
+	zsl_real_t adf = ZSL_ABS(df);
+	zsl_real_t tb = b + b;
+	zsl_real_t ab = ZSL_ABS(tb);
+	zsl_real_t big = ZSL_ABS(a) > ZSL_ABS(c) ? a : c;
+	zsl_real_t small = ZSL_ABS(a) > ZSL_ABS(c) ? c : a;
+	zsl_real_t rt, t, v;
+	bool neg1, neg2;
+
+	/* rt = sqrt(df^2 + tb^2), without overflow. */
+	if (adf > ab) {
+		rt = adf * ZSL_SQRT(1.0 + (ab / adf) * (ab / adf));
+	} else if (adf < ab) {
+		rt = ab * ZSL_SQRT(1.0 + (adf / ab) * (adf / ab));
+	} else {
+		rt = ab * ZSL_SQRT(2.0);
+	}
+
+	/* The smaller eigenvalue follows from the determinant, which avoids
+	 * cancellation. */
+	if (sum != 0.0) {
+		*rt1 = 0.5 * (sum + (sum < 0.0 ? -rt : rt));
+		*rt2 = (big / *rt1) * small - (b / *rt1) * b;
+	} else {
+		*rt1 = 0.5 * rt;
+		*rt2 = -0.5 * rt;
+	}
+	neg1 = sum < 0.0;
+
+	/* Eigenvector of rt1. */
+	neg2 = df < 0.0;
+	v = neg2 ? df - rt : df + rt;
+	if (ZSL_ABS(v) > ab) {
+		t = -tb / v;
+		*sn = 1.0 / ZSL_SQRT(1.0 + t * t);
+		*cs = t * *sn;
+	} else if (ab == 0.0) {
+		*cs = 1.0;
+		*sn = 0.0;
+	} else {
+		t = -v / tb;
+		*cs = 1.0 / ZSL_SQRT(1.0 + t * t);
+		*sn = t * *cs;
+	}
+	if (neg1 == neg2) {
+		t = *cs;
+		*cs = -*sn;
+		*sn = t;
+	}
+}
+
+/**
+ * @brief Applies the plane rotation (c, s) to columns 'j' and 'j' + 1 of
+ *        the square matrix 'z', as LAPACK's dlasr does for a single pivot.
+ */
+static inline void
+zsl_mtx_tridiag_rot(struct zsl_mtx *z, size_t j, zsl_real_t c, zsl_real_t s)
+{
+	size_t n = z->sz_rows;
+	zsl_real_t *zd = z->data;
+	zsl_real_t t;
+
+	for (size_t k = 0; k < n; k++) {
+		t = zd[(k * n) + j + 1];
+		zd[(k * n) + j + 1] = c * t - s * zd[(k * n) + j];
+		zd[(k * n) + j] = s * t + c * zd[(k * n) + j];
+	}
+}
+
+/**
+ * @brief Computes the rotation (c, s) with c * f + s * g = r and
+ *        -s * f + c * g = 0, like LAPACK's dlartg, returning r.
+ */
+static zsl_real_t
+zsl_mtx_tridiag_givens(zsl_real_t f, zsl_real_t g, zsl_real_t *c,
+		       zsl_real_t *s)
+{
+	zsl_real_t scale = ZSL_MAX(ZSL_ABS(f), ZSL_ABS(g));
+	zsl_real_t r;
+
+	if (g == 0.0) {
+		*c = 1.0;
+		*s = 0.0;
+		return f;
+	}
+	if (f == 0.0) {
+		*c = 0.0;
+		*s = 1.0;
+		return g;
+	}
+
+	r = scale * ZSL_SQRT((f / scale) * (f / scale) +
+			     (g / scale) * (g / scale));
+	*c = f / r;
+	*s = g / r;
+
+	return r;
+}
+
+/**
+ * @brief Implicit QL or QR iteration on the symmetric tridiagonal matrix
+ *        with diagonal 'd' and subdiagonal e[0..n-2], as left by
+ *        zsl_mtx_tridiag. The eigenvalues are left in 'd', and the rotations
+ *        are applied to the columns of 'z'. 'e' is destroyed.
+ *
+ * This follows LAPACK's dsteqr. The matrix is split wherever a subdiagonal
+ * element is negligible, and every unreduced block is scaled into a safe
+ * range and then iterated with Wilkinson shifts. QL is used when the larger
+ * end of the block is at the bottom, and QR otherwise, so the eigenvalues
+ * converge from the end that is best for accuracy. Returns -ECONVERGE if
+ * the iteration needs more than 30 sweeps per eigenvalue on average.
+ */
+static int
+zsl_mtx_tridiag_ql(zsl_real_t *d, zsl_real_t *e, struct zsl_mtx *z)
+{
+	size_t n = z->sz_rows;
+	size_t sweeps = 0;
+	size_t start = 0;
+	size_t l, m, end, blk0, blk1, i;
+	zsl_real_t eps2 = ZSL_EPSILON * ZSL_EPSILON;
+	zsl_real_t norm, scale, p, g, r, c, s, f, b, rt1, rt2;
+
+#ifdef CONFIG_ZSL_SINGLE_PRECISION
+	zsl_real_t safmin = FLT_MIN;
+	zsl_real_t safmax = FLT_MAX;
+#else
+	zsl_real_t safmin = DBL_MIN;
+	zsl_real_t safmax = DBL_MAX;
+#endif
+	zsl_real_t hi_lim = ZSL_SQRT(safmax) / 3.0;
+	zsl_real_t lo_lim = ZSL_SQRT(safmin) / eps2;
+
+	while (start < n) {
+		/* Find the next unreduced block, rows 'blk0' to 'blk1'. */
+		if (start > 0) {
+			e[start - 1] = 0.0;
+		}
+		for (m = start; m + 1 < n; m++) {
+			f = ZSL_ABS(e[m]);
+			if (f == 0.0) {
+				break;
+			}
+			if (f <= ZSL_SQRT(ZSL_ABS(d[m])) *
+				 ZSL_SQRT(ZSL_ABS(d[m + 1])) * ZSL_EPSILON) {
+				e[m] = 0.0;
+				break;
+			}
+		}
+		blk0 = start;
+		blk1 = m;
+		start = m + 1;
+		if (blk1 == blk0) {
+			continue;
+		}
+
+		/* Scale the block if its elements are close to overflow or
+		 * underflow. */
+		norm = 0.0;
+		for (i = blk0; i <= blk1; i++) {
+			norm = ZSL_MAX(norm, ZSL_ABS(d[i]));
+			if (i < blk1) {
+				norm = ZSL_MAX(norm, ZSL_ABS(e[i]));
+			}
+		}
+		if (norm == 0.0) {
+			continue;
+		}
+		scale = 1.0;
+		if (norm > hi_lim) {
+			scale = hi_lim / norm;
+		} else if (norm < lo_lim) {
+			scale = lo_lim / norm;
+		}
+		for (i = blk0; scale != 1.0 && i <= blk1; i++) {
+			d[i] *= scale;
+			if (i < blk1) {
+				e[i] *= scale;
+			}
+		}
+
+		if (ZSL_ABS(d[blk1]) >= ZSL_ABS(d[blk0])) {
+			/* QL iteration, converging from the top. */
+			l = blk0;
+			end = blk1;
+			while (l <= end) {
+				for (m = l; m < end; m++) {
+					f = ZSL_ABS(e[m]);
+					if (f * f <= (eps2 * ZSL_ABS(d[m])) *
+						     ZSL_ABS(d[m + 1]) +
+						     safmin) {
+						break;
+					}
+				}
+				if (m < end) {
+					e[m] = 0.0;
+				}
+
+				if (m == l) {
+					/* d[l] has converged. */
+					l++;
+					continue;
+				}
+
+				if (m == l + 1) {
+					/* Solve a 2x2 block directly. */
+					zsl_mtx_eigen_sym_2x2(d[l], e[l],
+							      d[l + 1], &rt1,
+							      &rt2, &c, &s);
+					zsl_mtx_tridiag_rot(z, l, c, s);
+					d[l] = rt1;
+					d[l + 1] = rt2;
+					e[l] = 0.0;
+					l += 2;
+					continue;
+				}
+
+				if (sweeps == 30 * n) {
+					return -ECONVERGE;
+				}
+				sweeps++;
+
+				/* Wilkinson shift from the top 2x2 block. */
+				p = d[l];
+				g = (d[l + 1] - p) / (2.0 * e[l]);
+				r = zsl_mtx_tridiag_givens(g, 1.0, &c, &s);
+				r = ZSL_ABS(r);
+				g = d[m] - p + e[l] / (g + (g < 0.0 ? -r : r));
+
+				/* Chase the bulge from the bottom up. */
+				s = 1.0;
+				c = 1.0;
+				p = 0.0;
+				for (i = m; i-- > l;) {
+					f = s * e[i];
+					b = c * e[i];
+					r = zsl_mtx_tridiag_givens(g, f, &c,
+								   &s);
+					if (i + 1 != m) {
+						e[i + 1] = r;
+					}
+					g = d[i + 1] - p;
+					r = (d[i] - g) * s + 2.0 * c * b;
+					p = s * r;
+					d[i + 1] = g + p;
+					g = c * r - b;
+					zsl_mtx_tridiag_rot(z, i, c, -s);
+				}
+				d[l] -= p;
+				e[l] = g;
+			}
+		} else {
+			/* QR iteration, converging from the bottom. */
+			l = blk1;
+			end = blk0;
+			while (l + 1 > end) {
+				for (m = l; m > end; m--) {
+					f = ZSL_ABS(e[m - 1]);
+					if (f * f <= (eps2 * ZSL_ABS(d[m])) *
+						     ZSL_ABS(d[m - 1]) +
+						     safmin) {
+						break;
+					}
+				}
+				if (m > end) {
+					e[m - 1] = 0.0;
+				}
+
+				if (m == l) {
+					/* d[l] has converged. */
+					if (l == end) {
+						break;
+					}
+					l--;
+					continue;
+				}
+
+				if (m + 1 == l) {
+					/* Solve a 2x2 block directly. */
+					zsl_mtx_eigen_sym_2x2(d[m], e[m], d[l],
+							      &rt1, &rt2, &c,
+							      &s);
+					zsl_mtx_tridiag_rot(z, m, c, s);
+					d[m] = rt1;
+					d[l] = rt2;
+					e[m] = 0.0;
+					if (m == end) {
+						break;
+					}
+					l -= 2;
+					continue;
+				}
+
+				if (sweeps == 30 * n) {
+					return -ECONVERGE;
+				}
+				sweeps++;
+
+				/* Wilkinson shift from the bottom 2x2 block. */
+				p = d[l];
+				g = (d[l - 1] - p) / (2.0 * e[l - 1]);
+				r = zsl_mtx_tridiag_givens(g, 1.0, &c, &s);
+				r = ZSL_ABS(r);
+				g = d[m] - p +
+				    e[l - 1] / (g + (g < 0.0 ? -r : r));
+
+				/* Chase the bulge from the top down. */
+				s = 1.0;
+				c = 1.0;
+				p = 0.0;
+				for (i = m; i < l; i++) {
+					f = s * e[i];
+					b = c * e[i];
+					r = zsl_mtx_tridiag_givens(g, f, &c,
+								   &s);
+					if (i != m) {
+						e[i - 1] = r;
+					}
+					g = d[i] - p;
+					r = (d[i + 1] - g) * s + 2.0 * c * b;
+					p = s * r;
+					d[i] = g + p;
+					g = c * r - b;
+					zsl_mtx_tridiag_rot(z, i, c, s);
+				}
+				d[l] -= p;
+				e[l - 1] = g;
+			}
+		}
+
+		/* Undo the scaling. */
+		for (i = blk0; scale != 1.0 && i <= blk1; i++) {
+			d[i] /= scale;
+			if (i < blk1) {
+				e[i] /= scale;
+			}
+		}
+	}
+
+	return 0;
+}
+
+int
+zsl_mtx_eigen_sym_ql(struct zsl_mtx *z, zsl_real_t *d, zsl_real_t *e,
+		     zsl_real_t *tau)
+{
+	int rc;
+	size_t n = z->sz_rows;
+	zsl_real_t *a = z->data;
+	zsl_real_t x, sigma;
+
+#ifdef CONFIG_ZSL_SINGLE_PRECISION
+	zsl_real_t rmin = ZSL_SQRT(FLT_MIN / ZSL_EPSILON);
+#else
+	zsl_real_t rmin = ZSL_SQRT(DBL_MIN / ZSL_EPSILON);
+#endif
+	zsl_real_t rmax = 1.0 / rmin;
+
+	/* Scale the lower triangle into [rmin, rmax] first, so the reflector
+	 * norms can neither overflow nor underflow. */
+	x = 0.0;
+	for (size_t i = 0; i < n; i++) {
+		for (size_t j = 0; j <= i; j++) {
+			x = ZSL_MAX(x, ZSL_ABS(a[(i * n) + j]));
+		}
+	}
+	sigma = 1.0;
+	if (x > 0.0 && x < rmin) {
+		sigma = rmin / x;
+	} else if (x > rmax) {
+		sigma = rmax / x;
+	}
+	if (sigma != 1.0) {
+		for (size_t i = 0; i < n; i++) {
+			for (size_t j = 0; j <= i; j++) {
+				a[(i * n) + j] *= sigma;
+			}
+		}
+	}
+
+	zsl_mtx_tridiag(z, d, e, tau);
+	rc = zsl_mtx_tridiag_ql(d, e, z);
+	for (size_t i = 0; i < n; i++) {
+		d[i] /= sigma;
+	}
+
+	return rc;
+}
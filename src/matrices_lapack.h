@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Kevin Townsend
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Internal matrix routines shared by matrices.c and matrices_lapack.c.
+ *
+ * The routines derived from LAPACK are implemented in matrices_lapack.c, which
+ * is distributed under the LAPACK license (see NOTICE), so that matrices.c
+ * stays Apache-2.0 only. zsl_mtx_house is implemented in matrices.c.
+ */
+
+#ifndef ZSL_SRC_MATRICES_LAPACK_H_
+#define ZSL_SRC_MATRICES_LAPACK_H_
+
+#include <zsl/zsl.h>
+#include <zsl/matrices.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Computes the Householder reflector H = I - tau * v * vt that maps
+ *        the 'len' values of 'x', spaced 'stride' apart, to beta * e1, where
+ *        beta has the sign of x[0]. On return x[0] holds beta, and the rest of
+ *        'x' holds v, whose first value is an implicit 1.
+ *
+ * v[0] is calculated as -sigma / (x[0] + beta) rather than x[0] - beta, to
+ * avoid cancellation when 'x' is almost parallel to e1.
+ */
+zsl_real_t zsl_mtx_house(zsl_real_t *x, size_t stride, size_t len);
+
+/**
+ * @brief Calculates every eigenvalue of the upper Hessenberg matrix 'h'
+ *        using the implicit double-shift (Francis) QR algorithm, storing the
+ *        real and imaginary parts in 'wr' and 'wi'. 'h' is destroyed.
+ *
+ * This follows the eigenvalue-only path of LAPACK's dlahqr. The active
+ * window is split wherever a subdiagonal element becomes negligible, using
+ * the conservative test of Ahues and Tisseur, and every sweep chases a 3x1
+ * bulge down the window with Householder reflectors. Exceptional shifts are
+ * used every ten sweeps without a deflation. Complex conjugate pairs are
+ * stored in consecutive entries, with the positive imaginary part first.
+ * Returns -ECONVERGE if an eigenvalue hasn't converged after 'iter' sweeps.
+ */
+int zsl_mtx_francis(struct zsl_mtx *h, zsl_real_t *wr, zsl_real_t *wi,
+		    size_t iter);
+
+/**
+ * @brief Calculates the eigenvalues and eigenvectors of the symmetric matrix
+ *        'z', reading only its lower triangle. On exit 'd' holds the
+ *        unsorted eigenvalues and 'z' the eigenvectors, one per column. 'e'
+ *        and 'tau' are scratch space for n values each.
+ *
+ * This follows LAPACK's dsyev. The input is scaled so the Householder
+ * reduction to tridiagonal form can neither overflow nor underflow, and the
+ * tridiagonal matrix is then diagonalised with implicit QL/QR sweeps.
+ * Returns -ECONVERGE if the iteration needs more than 30 sweeps per
+ * eigenvalue on average.
+ */
+int zsl_mtx_eigen_sym_ql(struct zsl_mtx *z, zsl_real_t *d, zsl_real_t *e,
+			 zsl_real_t *tau);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZSL_SRC_MATRICES_LAPACK_H_ */
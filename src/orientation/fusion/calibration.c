@@ -59,13 +59,14 @@ int zsl_fus_cal_rot_mtx(struct zsl_vec *v, struct zsl_mtx *m,
 	}
 #endif
 
-	ZSL_MATRIX_DEF(vm, 3, 1);
-	zsl_mtx_from_arr(&vm, v->data);
-
-	ZSL_MATRIX_DEF(mv, 3, 1);
-	zsl_mtx_mult(m, &vm, &mv);
+	/* Rotating in place needs a copy of the input vector. */
+	ZSL_VECTOR_DEF(vc, 3);
+	if (v->data == v_rot->data) {
+		zsl_vec_copy(&vc, v);
+		v = &vc;
+	}
 
-	zsl_vec_from_arr(v_rot, mv.data);
+	zsl_mtx_gemv(m, false, 1.0, v, 0.0, v_rot);
 
 err:
 	return rc;
@@ -134,10 +135,10 @@ int zsl_fus_cal_magn(struct zsl_mtx *m, zsl_real_t *l, zsl_real_t *mu,
 	/* Define needed variables. */
 	ZSL_VECTOR_DEF(H, 3);
 	ZSL_MATRIX_DEF(J, 1, 4);
-	ZSL_MATRIX_DEF(Jt, 4, 1);
 	ZSL_MATRIX_DEF(JtJ, 4, 4);
 	ZSL_MATRIX_DEF(idx, 4, 4);
-	ZSL_MATRIX_DEF(t, 4, 1);
+	ZSL_VECTOR_DEF(t, 4);
+	struct zsl_vec Jt = { .sz = 4, .data = J.data };
 	zsl_real_t f, S = 0.0, S2;
 
 	/* Initialize the identity matrix. */
@@ -156,21 +157,17 @@ int zsl_fus_cal_magn(struct zsl_mtx *m, zsl_real_t *l, zsl_real_t *mu,
 			J.data[3] += -(H.data[2] - b->data[2]) / f;
 		}
 
-		/* Compute the transpose of J. */
-		zsl_mtx_trans(&J, &Jt);
-
 		/* Calculate the value of tau ('t'). */
 		zsl_mtx_get_row(m, j, H.data);
 		f = zsl_fus_cal_magn_f_shp(&H, b);
-		zsl_mtx_mult(&Jt, &J, &JtJ);
+		zsl_mtx_syrk(&J, true, 1.0, 0.0, &JtJ);
 		idx.data[0] = *l * JtJ.data[0];
 		idx.data[5] = *l * JtJ.data[5];
 		idx.data[10] = *l * JtJ.data[10];
 		idx.data[15] = *l * JtJ.data[15];
 		zsl_mtx_add_d(&JtJ, &idx);
 		zsl_mtx_inv(&JtJ, &idx);
-		zsl_mtx_mult(&idx, &Jt, &t);
-		zsl_mtx_scalar_mult_d(&t, -(R - f));
+		zsl_mtx_gemv(&idx, false, -(R - f), &Jt, 0.0, &t);
 
 		/* Calculate the new pair (R, b) by adding tau to the old values of R
 		 * and b. */
@@ -222,10 +219,10 @@ int zsl_fus_cal_magn(struct zsl_mtx *m, zsl_real_t *l, zsl_real_t *mu,
 
 	/* Define needed variables. */
 	ZSL_MATRIX_DEF(N, 1, 9);
-	ZSL_MATRIX_DEF(Nt, 9, 1);
 	ZSL_MATRIX_DEF(NtN, 9, 9);
 	ZSL_MATRIX_DEF(idxN, 9, 9);
-	ZSL_MATRIX_DEF(tN, 9, 1);
+	struct zsl_vec Nt = { .sz = 9, .data = N.data };
+	struct zsl_vec gv = { .sz = 9, .data = g.data };
 	zsl_real_t A, B, C;
 
 	/* Initialize the identity matrix. */
@@ -265,13 +262,10 @@ int zsl_fus_cal_magn(struct zsl_mtx *m, zsl_real_t *l, zsl_real_t *mu,
 			N.data[8] += -C / f;
 		}
 
-		/* Calculate the transpose of N. */
-		zsl_mtx_trans(&N, &Nt);
-
-		/* Calculate the value of tau (tN). */
+		/* Calculate the value of tau (tN), and add it to gamma. */
 		zsl_mtx_get_row(m, j, H.data);
 		f = zsl_fus_cal_magn_f_elli(&H, &g);
-		zsl_mtx_mult(&Nt, &N, &NtN);
+		zsl_mtx_syrk(&N, true, 1.0, 0.0, &NtN);
 		idxN.data[0] = *l * NtN.data[0];
 		idxN.data[10] = *l * NtN.data[10];
 		idxN.data[20] = *l * NtN.data[20];
@@ -283,19 +277,7 @@ int zsl_fus_cal_magn(struct zsl_mtx *m, zsl_real_t *l, zsl_real_t *mu,
 		idxN.data[80] = *l * NtN.data[80];
 		zsl_mtx_add_d(&NtN, &idxN);
 		zsl_mtx_inv(&NtN, &idxN);
-		zsl_mtx_mult(&idxN, &Nt, &tN);
-		zsl_mtx_scalar_mult_d(&tN, -(R - f));
-
-		/* Calculate the new vector gamma. */
-		g.data[0] += tN.data[0];
-		g.data[1] += tN.data[1];
-		g.data[2] += tN.data[2];
-		g.data[3] += tN.data[3];
-		g.data[4] += tN.data[4];
-		g.data[5] += tN.data[5];
-		g.data[6] += tN.data[6];
-		g.data[7] += tN.data[7];
-		g.data[8] += tN.data[8];
+		zsl_mtx_gemv(&idxN, false, -(R - f), &Nt, 1.0, &gv);
 
 		if (j < (m->sz_rows - 1)) {
 
@@ -375,7 +357,6 @@ int zsl_fus_cal_magn_fast(struct zsl_mtx *m, zsl_real_t *me, struct zsl_mtx *K,
 	ZSL_MATRIX_DEF(X0, 3, 1);
 	ZSL_MATRIX_DEF(L, 3, 3);
 	ZSL_MATRIX_DEF(G, 3, 3);
-	ZSL_MATRIX_DEF(Ai, 3, 3);
 
 	zsl_mtx_cholesky(&A, &L);
 
@@ -383,8 +364,7 @@ int zsl_fus_cal_magn_fast(struct zsl_mtx *m, zsl_real_t *me, struct zsl_mtx *K,
 	zsl_mtx_scalar_mult_d(&G, *me);
 	zsl_mtx_copy(K, &G);
 
-	zsl_mtx_inv(&A, &Ai);
-	zsl_mtx_mult(&Ai, &v, &X0);
+	zsl_mtx_solve(&A, &v, &X0);
 
 	b->data[0] = X0.data[0];
 	b->data[1] = X0.data[1];
@@ -417,13 +397,9 @@ int zsl_fus_cal_corr_vec(struct zsl_vec *v, struct zsl_mtx *K,
 #endif
 
 	ZSL_VECTOR_DEF(vb, v->sz);
-	ZSL_MATRIX_DEF(VB, v->sz, 1);
-	ZSL_MATRIX_DEF(KVB, v->sz, 1);
 
 	zsl_vec_add(v, b, &vb);
-	zsl_mtx_from_arr(&VB, vb.data);
-	zsl_mtx_mult(K, &VB, &KVB);
-	zsl_vec_from_arr(v_out, KVB.data);
+	zsl_mtx_gemv(K, false, 1.0, &vb, 0.0, v_out);
 
 	return 0;
 }
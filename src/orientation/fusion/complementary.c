@@ -110,6 +110,31 @@ int zsl_fus_comp_feed(struct zsl_vec *a, struct zsl_vec *m,
 	return zsl_fus_comp(a, m, g, &(mcfg->alpha), q);
 }
 
+int zsl_fus_comp_q31(struct zsl_vec_q31 *wt, struct zsl_quat_q31 *q_am,
+		     zsl_q31_t alpha, struct zsl_quat_q31 *q)
+{
+	int rc;
+
+	/* Make sure alpha is between zero and one. */
+	if (alpha < 0) {
+		return -EINVAL;
+	}
+
+	/* Estimate the orientation using the gyroscope data. */
+	rc = zsl_quat_q31_from_ang_vel(wt, q, q);
+	if (rc) {
+		return rc;
+	}
+
+	/* Blend in the accel/mag orientation if available. The result is
+	 * already normalised. */
+	if (q_am != NULL) {
+		rc = zsl_quat_q31_lerp(q, q_am, alpha, q);
+	}
+
+	return rc;
+}
+
 void zsl_fus_comp_error(int error)
 {
 	/* ToDo: Log error in default handler. */
@@ -33,9 +33,8 @@ static int zsl_fus_kalman(struct zsl_vec *g, struct zsl_vec *a,
 	/* Useful constant to reduce the code. */
 	zsl_real_t if2 = 1.0 / (2.0 * zsl_fus_kalm_freq);
 
-	/* Calculate the matrix F and its transpose. */
+	/* Calculate the matrix F. */
 	ZSL_MATRIX_DEF(F, 4, 4);
-	ZSL_MATRIX_DEF(Ft, 4, 4);
 
 	zsl_real_t F_data[16] = {
 		1.0, -if2 * g->data[0], -if2 * g->data[1], -if2 * g->data[2],
@@ -45,11 +44,9 @@ static int zsl_fus_kalman(struct zsl_vec *g, struct zsl_vec *a,
 	};
 
 	zsl_mtx_from_arr(&F, F_data);
-	zsl_mtx_trans(&F, &Ft);
 
-	/* Calculate the matrix W and its transpose. */
+	/* Calculate the matrix W. */
 	ZSL_MATRIX_DEF(W, 4, 3);
-	ZSL_MATRIX_DEF(Wt, 3, 4);
 
 	zsl_real_t W_data[12] = {
 		-q->i, -q->j, -q->k,
@@ -59,18 +56,14 @@ static int zsl_fus_kalman(struct zsl_vec *g, struct zsl_vec *a,
 	};
 
 	zsl_mtx_from_arr(&W, W_data);
-	zsl_mtx_trans(&W, &Wt);
 
-	/* Calculate the matrix Q. */
-	ZSL_MATRIX_DEF(Q, 4, 4);
-	zsl_mtx_mult(&W, &Wt, &Q);
-	zsl_mtx_scalar_mult_d(&Q, *var_g * if2 * if2);
-
-	/* Calculate the matrix P. */
+	/* Calculate the matrix P = F * P * Ft + Q, where Q = W * Wt scaled
+	 * by the gyroscope variance. Q is written straight into P once F * P
+	 * has been computed. */
 	ZSL_MATRIX_DEF(FP, 4, 4);
 	zsl_mtx_mult(&F, P, &FP);
-	zsl_mtx_mult(&FP, &Ft, P);
-	zsl_mtx_add_d(P, &Q);
+	zsl_mtx_syrk(&W, false, *var_g * if2 * if2, 0.0, P);
+	zsl_mtx_mult_ex(&FP, false, &F, true, 1.0, 1.0, P);
 
 	/* Calculate an estimation of the orientation using only the data of the
 	 * gyroscope and quaternion integration. */
@@ -131,10 +124,8 @@ static int zsl_fus_kalman(struct zsl_vec *g, struct zsl_vec *a,
 	h.data[4] = 2.0 * m2.j;
 	h.data[5] = 2.0 * m2.k;
 
-	/* Calculate H, which is the Jacobian matrix of h. Calculate its
-	 * transpose too. */
+	/* Calculate H, which is the Jacobian matrix of h. */
 	ZSL_MATRIX_DEF(H, 6, 4);
-	ZSL_MATRIX_DEF(Ht, 4, 6);
 
 	zsl_real_t H_data[24] = {
 		/* Fisrt 3 rows of the H matrix. */
@@ -157,7 +148,6 @@ static int zsl_fus_kalman(struct zsl_vec *g, struct zsl_vec *a,
 
 	zsl_mtx_from_arr(&H, H_data);
 	zsl_mtx_scalar_mult_d(&H, 2.0);
-	zsl_mtx_trans(&H, &Ht);
 
 	/* Define the R matrix with the variance of the accelerometer
 	 * and magnetometer. */
@@ -170,44 +160,43 @@ static int zsl_fus_kalman(struct zsl_vec *g, struct zsl_vec *a,
 	zsl_mtx_set(&R, 4, 4, *var_m);
 	zsl_mtx_set(&R, 5, 5, *var_m);
 
-	/* Define the vector v, the matrix S and the matrix K. */
+	/* Define the vector v and the matrix S. */
 	ZSL_MATRIX_DEF(v, 6, 1);
 	ZSL_MATRIX_DEF(S, 6, 6);
-	ZSL_MATRIX_DEF(K, 4, 6);
 
 	/* Calculation of v. */
 	zsl_mtx_sub(&z, &h, &v);
 
-	/* Calculation of S. */
+	/* Calculation of S = H * P * Ht + R. */
 	ZSL_MATRIX_DEF(HP, 6, 4);
-	ZSL_MATRIX_DEF(HPHt, 6, 6);
 	zsl_mtx_mult(&H, P, &HP);
-	zsl_mtx_mult(&HP, &Ht, &HPHt);
-	zsl_mtx_add(&HPHt, &R, &S);
-
-	/* Calculation of K. */
-	ZSL_MATRIX_DEF(S_inv, 6, 6);
-	ZSL_MATRIX_DEF(PHt, 4, 6);
-	zsl_mtx_inv(&S, &S_inv);
-	zsl_mtx_mult(P, &Ht, &PHt);
-	zsl_mtx_mult(&PHt, &S_inv, &K);
+	zsl_mtx_copy(&S, &R);
+	zsl_mtx_mult_ex(&HP, false, &H, true, 1.0, 1.0, &S);
+
+	/* Calculation of K, by solving St * Kt = (P * Ht)t = H * Pt rather
+	 * than inverting S. Only Kt is kept, K is used through its
+	 * transpose. */
+	ZSL_MATRIX_DEF(St, 6, 6);
+	ZSL_MATRIX_DEF(HPt, 6, 4);
+	ZSL_MATRIX_DEF(Kt, 6, 4);
+	zsl_mtx_mult_ex(&H, false, P, true, 1.0, 0.0, &HPt);
+	zsl_mtx_trans(&S, &St);
+	rc = zsl_mtx_solve(&St, &HPt, &Kt);
+	if (rc) {
+		goto err;
+	}
 
-	/* Calculate the corrected matrix P. */
+	/* Calculate the corrected matrix P = (I - K * H) * P. */
 	ZSL_MATRIX_DEF(idx, 4, 4);
-	ZSL_MATRIX_DEF(KH, 4, 4);
 	zsl_mtx_init(&idx, zsl_mtx_entry_fn_identity);
-	zsl_mtx_mult(&K, &H, &KH);
-	zsl_mtx_sub_d(&idx, &KH);
+	zsl_mtx_mult_ex(&Kt, true, &H, false, -1.0, 1.0, &idx);
 	zsl_mtx_mult(&idx, P, P);
 
-	/* Calculate the corrected orientation quaternion q. */
-	ZSL_MATRIX_DEF(Kv, 4, 1);
-	zsl_mtx_mult(&K, &v, &Kv);
+	/* Calculate the corrected orientation quaternion q = q + K * v. */
+	struct zsl_vec vv = { .sz = 6, .data = v.data };
+	struct zsl_vec qv = { .sz = 4, .data = q->idx };
 
-	q->r += Kv.data[0];
-	q->i += Kv.data[1];
-	q->j += Kv.data[2];
-	q->k += Kv.data[3];
+	zsl_mtx_gemv(&Kt, true, 1.0, &vv, 1.0, &qv);
 
 	/* Normalize the output quaternion. */
 	zsl_quat_to_unit_d(q);
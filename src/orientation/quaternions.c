@@ -596,6 +596,33 @@ err:
 	return rc;
 }
 
+int zsl_quat_to_rot_mtx_batched(struct zsl_quat *q, struct zsl_mtx_batch *m)
+{
+	size_t nb = m->sz_batch;
+	zsl_real_t *d = m->data;
+
+	/* Make sure that the rotation matrices have an appropriate shape. */
+	if ((m->sz_cols != 3) || (m->sz_rows != 3)) {
+		return -EINVAL;
+	}
+
+	/* Element 'e' of matrix 'k' is at d[e * nb + k], so each store below
+	 * walks the batch with a unit stride. */
+	for (size_t k = 0; k < nb; k++) {
+		d[k] = 1.0 - 2.0 * (q[k].j * q[k].j + q[k].k * q[k].k);
+		d[nb + k] = 2.0 * (q[k].i * q[k].j - q[k].k * q[k].r);
+		d[2 * nb + k] = 2.0 * (q[k].i * q[k].k + q[k].j * q[k].r);
+		d[3 * nb + k] = 2.0 * (q[k].i * q[k].j + q[k].k * q[k].r);
+		d[4 * nb + k] = 1.0 - 2.0 * (q[k].i * q[k].i + q[k].k * q[k].k);
+		d[5 * nb + k] = 2.0 * (q[k].j * q[k].k - q[k].i * q[k].r);
+		d[6 * nb + k] = 2.0 * (q[k].i * q[k].k - q[k].j * q[k].r);
+		d[7 * nb + k] = 2.0 * (q[k].j * q[k].k + q[k].i * q[k].r);
+		d[8 * nb + k] = 1.0 - 2.0 * (q[k].i * q[k].i + q[k].j * q[k].j);
+	}
+
+	return 0;
+}
+
 int zsl_quat_from_rot_mtx(struct zsl_mtx *m, struct zsl_quat *q)
 {
 	int rc = 0;
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2026 Kevin Townsend
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <zsl/zsl.h>
+#include <zsl/parallel.h>
+
+#if CONFIG_ZSL_PARALLEL
+
+#if defined(CONFIG_ZSL_PARALLEL_PTHREAD) || !defined(__ZEPHYR__)
+#define ZSL_PAR_PTHREAD 1
+#include <pthread.h>
+#include <unistd.h>
+#else
+#include <zephyr/kernel.h>
+#endif
+
+/**
+ * @brief Returns the start of chunk 'c' when [0, n) is split into 'chunks'
+ *        chunks of nearly equal size.
+ */
+static inline size_t zsl_par_split(size_t n, size_t chunks, size_t c)
+{
+	return (size_t)(((uint64_t)n * c) / chunks);
+}
+
+#ifdef ZSL_PAR_PTHREAD
+
+/*
+ * The pool is shared by every caller, so 'zsl_par_busy' is held for the whole
+ * operation. Workers sleep on 'zsl_par_start' until 'zsl_par_gen' changes,
+ * run their chunk of the current job, and count down 'zsl_par_pending'.
+ */
+static pthread_mutex_t zsl_par_busy = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t zsl_par_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t zsl_par_start = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t zsl_par_done = PTHREAD_COND_INITIALIZER;
+static pthread_once_t zsl_par_once = PTHREAD_ONCE_INIT;
+
+static size_t zsl_par_workers;
+static unsigned long zsl_par_gen;
+static size_t zsl_par_pending;
+
+static struct {
+	zsl_par_fn_t fn;
+	void *arg;
+	size_t n;
+	size_t chunks;
+	int rc;
+} zsl_par_job;
+
+/**
+ * @brief Body of worker thread 'p', which runs chunk 'p' + 1 of every job,
+ *        since the calling thread runs chunk 0.
+ */
+static void *zsl_par_worker(void *p)
+{
+	size_t c = (size_t)(uintptr_t)p + 1;
+	unsigned long seen = 0;
+	size_t chunks, n;
+	int rc;
+
+	for (;;) {
+		pthread_mutex_lock(&zsl_par_lock);
+		while (zsl_par_gen == seen) {
+			pthread_cond_wait(&zsl_par_start, &zsl_par_lock);
+		}
+		seen = zsl_par_gen;
+		chunks = zsl_par_job.chunks;
+		n = zsl_par_job.n;
+		pthread_mutex_unlock(&zsl_par_lock);
+
+		if (c >= chunks) {
+			continue;
+		}
+
+		rc = zsl_par_job.fn(zsl_par_job.arg,
+				    zsl_par_split(n, chunks, c),
+				    zsl_par_split(n, chunks, c + 1));
+
+		pthread_mutex_lock(&zsl_par_lock);
+		if (rc && !zsl_par_job.rc) {
+			zsl_par_job.rc = rc;
+		}
+		if (--zsl_par_pending == 0) {
+			pthread_cond_signal(&zsl_par_done);
+		}
+		pthread_mutex_unlock(&zsl_par_lock);
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Starts the worker threads. If some of them can't be created, the
+ *        pool is simply smaller.
+ */
+static void zsl_par_init(void)
+{
+	size_t threads = CONFIG_ZSL_PARALLEL_THREADS;
+	pthread_t t;
+
+#if !defined(__ZEPHYR__) && defined(_SC_NPROCESSORS_ONLN)
+	if (threads == 0) {
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+		threads = cpus > 0 ? (size_t)cpus : 1;
+	}
+#endif
+
+	for (size_t w = 0; w + 1 < threads; w++) {
+		if (pthread_create(&t, NULL, zsl_par_worker,
+				   (void *)(uintptr_t)w) != 0) {
+			break;
+		}
+		pthread_detach(t);
+		zsl_par_workers++;
+	}
+}
+
+int zsl_par_for(size_t n, size_t ops, zsl_par_fn_t fn, void *arg)
+{
+	size_t chunks;
+	int rc;
+
+	if (n < 2 || ops < CONFIG_ZSL_PARALLEL_MIN_OPS) {
+		return fn(arg, 0, n);
+	}
+
+	pthread_once(&zsl_par_once, zsl_par_init);
+
+	/* Run serially if the pool is in use, rather than waiting for it or
+	 * deadlocking when called from one of the workers. */
+	if (zsl_par_workers == 0 || pthread_mutex_trylock(&zsl_par_busy)) {
+		return fn(arg, 0, n);
+	}
+
+	chunks = zsl_par_workers + 1;
+	if (chunks > n) {
+		chunks = n;
+	}
+
+	pthread_mutex_lock(&zsl_par_lock);
+	zsl_par_job.fn = fn;
+	zsl_par_job.arg = arg;
+	zsl_par_job.n = n;
+	zsl_par_job.chunks = chunks;
+	zsl_par_job.rc = 0;
+	zsl_par_pending = chunks - 1;
+	zsl_par_gen++;
+	pthread_cond_broadcast(&zsl_par_start);
+	pthread_mutex_unlock(&zsl_par_lock);
+
+	rc = fn(arg, 0, zsl_par_split(n, chunks, 1));
+
+	pthread_mutex_lock(&zsl_par_lock);
+	while (zsl_par_pending) {
+		pthread_cond_wait(&zsl_par_done, &zsl_par_lock);
+	}
+	if (!rc) {
+		rc = zsl_par_job.rc;
+	}
+	pthread_mutex_unlock(&zsl_par_lock);
+
+	pthread_mutex_unlock(&zsl_par_busy);
+
+	return rc;
+}
+
+#else /* Zephyr work queues */
+
+#define ZSL_PAR_WORKERS (CONFIG_ZSL_PARALLEL_THREADS - 1)
+
+#if ZSL_PAR_WORKERS > 0
+
+/*
+ * Every worker has its own work queue, so the chunks of one operation run
+ * concurrently. 'zsl_par_busy' is taken for the whole operation, and also
+ * guards starting the queues the first time.
+ */
+K_THREAD_STACK_ARRAY_DEFINE(zsl_par_stacks, ZSL_PAR_WORKERS,
+			    CONFIG_ZSL_PARALLEL_STACK_SIZE);
+static struct k_work_q zsl_par_queues[ZSL_PAR_WORKERS];
+static K_SEM_DEFINE(zsl_par_busy, 1, 1);
+static bool zsl_par_started;
+
+/**
+ * @brief One chunk of an operation, submitted to a worker queue.
+ */
+struct zsl_par_task {
+	struct k_work work;
+	zsl_par_fn_t fn;
+	void *arg;
+	size_t start;
+	size_t end;
+	int rc;
+};
+
+/**
+ * @brief Work handler that runs the chunk of a @ref zsl_par_task.
+ */
+static void zsl_par_handler(struct k_work *work)
+{
+	struct zsl_par_task *t = CONTAINER_OF(work, struct zsl_par_task, work);
+
+	t->rc = t->fn(t->arg, t->start, t->end);
+}
+
+int zsl_par_for(size_t n, size_t ops, zsl_par_fn_t fn, void *arg)
+{
+	struct zsl_par_task tasks[ZSL_PAR_WORKERS];
+	struct k_work_sync sync;
+	size_t chunks;
+	int rc;
+
+	if (n < 2 || ops < CONFIG_ZSL_PARALLEL_MIN_OPS || k_is_in_isr()) {
+		return fn(arg, 0, n);
+	}
+
+	/* Run serially if the pool is in use, rather than waiting for it or
+	 * deadlocking when called from one of the workers. */
+	if (k_sem_take(&zsl_par_busy, K_NO_WAIT)) {
+		return fn(arg, 0, n);
+	}
+
+	if (!zsl_par_started) {
+		for (size_t w = 0; w < ZSL_PAR_WORKERS; w++) {
+			k_work_queue_start(&zsl_par_queues[w],
+				zsl_par_stacks[w],
+				K_THREAD_STACK_SIZEOF(zsl_par_stacks[w]),
+				CONFIG_ZSL_PARALLEL_PRIORITY, NULL);
+		}
+		zsl_par_started = true;
+	}
+
+	chunks = ZSL_PAR_WORKERS + 1;
+	if (chunks > n) {
+		chunks = n;
+	}
+
+	for (size_t c = 1; c < chunks; c++) {
+		struct zsl_par_task *t = &tasks[c - 1];
+
+		k_work_init(&t->work, zsl_par_handler);
+		t->fn = fn;
+		t->arg = arg;
+		t->start = zsl_par_split(n, chunks, c);
+		t->end = zsl_par_split(n, chunks, c + 1);
+		t->rc = 0;
+		k_work_submit_to_queue(&zsl_par_queues[c - 1], &t->work);
+	}
+
+	rc = fn(arg, 0, zsl_par_split(n, chunks, 1));
+
+	/* Flushing, rather than signalling from the handler, guarantees the
+	 * queues are done with the tasks before they leave the stack. */
+	for (size_t c = 1; c < chunks; c++) {
+		k_work_flush(&tasks[c - 1].work, &sync);
+		if (!rc) {
+			rc = tasks[c - 1].rc;
+		}
+	}
+
+	k_sem_give(&zsl_par_busy);
+
+	return rc;
+}
+
+#else /* ZSL_PAR_WORKERS > 0 */
+
+int zsl_par_for(size_t n, size_t ops, zsl_par_fn_t fn, void *arg)
+{
+	(void)ops;
+
+	return fn(arg, 0, n);
+}
+
+#endif /* ZSL_PAR_WORKERS > 0 */
+
+#endif /* ZSL_PAR_PTHREAD */
+
+#endif /* CONFIG_ZSL_PARALLEL */
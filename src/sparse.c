@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2026 Kevin Townsend
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <zsl/zsl.h>
+#include <zsl/sparse.h>
+
+/**
+ * @brief Empties sparse matrix 's', so it is left in a valid state when
+ *        building it fails part way through.
+ */
+static void zsl_spmtx_clear(struct zsl_spmtx *s)
+{
+	for (size_t i = 0; i <= s->sz_rows; i++) {
+		s->row_ptr[i] = 0;
+	}
+	s->nnz = 0;
+}
+
+int zsl_spmtx_from_coo(struct zsl_spmtx *s, const size_t *rows,
+		       const size_t *cols, const zsl_real_t *vals, size_t n)
+{
+	size_t *rp = s->row_ptr;
+	size_t start, end, w, c, d;
+	zsl_real_t x;
+
+	if (n > s->sz_nnz) {
+		zsl_spmtx_clear(s);
+		return -ENOMEM;
+	}
+
+	/* Count the entries in each row, in row_ptr[i + 1]. */
+	for (size_t i = 0; i <= s->sz_rows; i++) {
+		rp[i] = 0;
+	}
+	for (size_t g = 0; g < n; g++) {
+		if (rows[g] >= s->sz_rows || cols[g] >= s->sz_cols) {
+			zsl_spmtx_clear(s);
+			return -EINVAL;
+		}
+		rp[rows[g] + 1]++;
+	}
+
+	/* Turn the counts into the start of each row ... */
+	for (size_t i = 0; i < s->sz_rows; i++) {
+		rp[i + 1] += rp[i];
+	}
+
+	/* ... and bucket the triplets, using row_ptr[i] as the insertion
+	 * point of row 'i'. This leaves row_ptr[i] at the end of row 'i', so
+	 * everything is shifted back by one row afterwards. */
+	for (size_t g = 0; g < n; g++) {
+		d = rp[rows[g]]++;
+		s->col_idx[d] = cols[g];
+		s->data[d] = vals[g];
+	}
+	for (size_t i = s->sz_rows; i > 0; i--) {
+		rp[i] = rp[i - 1];
+	}
+	rp[0] = 0;
+
+	/* Sort every row by column with an insertion sort, since rows are
+	 * typically short, then merge duplicates while compacting. */
+	w = 0;
+	end = 0;
+	for (size_t i = 0; i < s->sz_rows; i++) {
+		start = end;
+		end = rp[i + 1];
+
+		for (size_t g = start + 1; g < end; g++) {
+			c = s->col_idx[g];
+			x = s->data[g];
+			d = g;
+			while (d > start && s->col_idx[d - 1] > c) {
+				s->col_idx[d] = s->col_idx[d - 1];
+				s->data[d] = s->data[d - 1];
+				d--;
+			}
+			s->col_idx[d] = c;
+			s->data[d] = x;
+		}
+
+		rp[i] = w;
+		for (size_t g = start; g < end; g++) {
+			if (w > rp[i] && s->col_idx[w - 1] == s->col_idx[g]) {
+				s->data[w - 1] += s->data[g];
+				continue;
+			}
+			s->col_idx[w] = s->col_idx[g];
+			s->data[w] = s->data[g];
+			w++;
+		}
+	}
+	rp[s->sz_rows] = w;
+	s->nnz = w;
+
+	return 0;
+}
+
+int zsl_spmtx_from_mtx(struct zsl_mtx *m, struct zsl_spmtx *s)
+{
+	size_t w = 0;
+	zsl_real_t x;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (m->sz_rows != s->sz_rows || m->sz_cols != s->sz_cols) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < m->sz_rows; i++) {
+		s->row_ptr[i] = w;
+		for (size_t j = 0; j < m->sz_cols; j++) {
+			x = m->data[(i * m->sz_cols) + j];
+			if (x == 0.0) {
+				continue;
+			}
+			if (w == s->sz_nnz) {
+				zsl_spmtx_clear(s);
+				return -ENOMEM;
+			}
+			s->col_idx[w] = j;
+			s->data[w] = x;
+			w++;
+		}
+	}
+	s->row_ptr[m->sz_rows] = w;
+	s->nnz = w;
+
+	return 0;
+}
+
+int zsl_spmtx_to_mtx(struct zsl_spmtx *s, struct zsl_mtx *m)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (m->sz_rows != s->sz_rows || m->sz_cols != s->sz_cols) {
+		return -EINVAL;
+	}
+#endif
+
+	zsl_mtx_init(m, NULL);
+	for (size_t i = 0; i < s->sz_rows; i++) {
+		for (size_t g = s->row_ptr[i]; g < s->row_ptr[i + 1]; g++) {
+			m->data[(i * m->sz_cols) + s->col_idx[g]] = s->data[g];
+		}
+	}
+
+	return 0;
+}
+
+int zsl_spmtx_get(struct zsl_spmtx *s, size_t i, size_t j, zsl_real_t *x)
+{
+	size_t lo, hi, mid;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (i >= s->sz_rows || j >= s->sz_cols) {
+		return -EINVAL;
+	}
+#endif
+
+	*x = 0.0;
+	lo = s->row_ptr[i];
+	hi = s->row_ptr[i + 1];
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (s->col_idx[mid] < j) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	if (lo < s->row_ptr[i + 1] && s->col_idx[lo] == j) {
+		*x = s->data[lo];
+	}
+
+	return 0;
+}
+
+int zsl_spmtx_mult_vec(struct zsl_spmtx *s, struct zsl_vec *v,
+		       struct zsl_vec *w)
+{
+	zsl_real_t sum;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (v->sz != s->sz_cols || w->sz != s->sz_rows ||
+	    v->data == w->data) {
+		return -EINVAL;
+	}
+#endif
+
+	/* One sparse dot product per row. */
+	for (size_t i = 0; i < s->sz_rows; i++) {
+		sum = 0.0;
+		for (size_t g = s->row_ptr[i]; g < s->row_ptr[i + 1]; g++) {
+			sum += s->data[g] * v->data[s->col_idx[g]];
+		}
+		w->data[i] = sum;
+	}
+
+	return 0;
+}
+
+int zsl_spmtx_mult_vec_trans(struct zsl_spmtx *s, struct zsl_vec *v,
+			     struct zsl_vec *w)
+{
+	zsl_real_t x;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (v->sz != s->sz_rows || w->sz != s->sz_cols ||
+	    v->data == w->data) {
+		return -EINVAL;
+	}
+#endif
+
+	/* Scatter each row of 's', scaled by the matching element of 'v'. */
+	zsl_vec_init(w);
+	for (size_t i = 0; i < s->sz_rows; i++) {
+		x = v->data[i];
+		if (x == 0.0) {
+			continue;
+		}
+		for (size_t g = s->row_ptr[i]; g < s->row_ptr[i + 1]; g++) {
+			w->data[s->col_idx[g]] += s->data[g] * x;
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Solves row 'i' of a sparse triangular system, using the entries
+ *        before the diagonal if 'lower' is true, and those after it
+ *        otherwise.
+ *
+ * @return 0 on success, or -ESINGULAR if the diagonal entry of row 'i' is
+ *         zero or missing.
+ */
+static int zsl_spmtx_solve_row(struct zsl_spmtx *t, size_t i, bool lower,
+			       struct zsl_vec *b, struct zsl_vec *x)
+{
+	zsl_real_t sum = b->data[i];
+	zsl_real_t diag = 0.0;
+	size_t c;
+
+	for (size_t g = t->row_ptr[i]; g < t->row_ptr[i + 1]; g++) {
+		c = t->col_idx[g];
+		if (c == i) {
+			diag = t->data[g];
+		} else if ((c < i) == lower) {
+			sum -= t->data[g] * x->data[c];
+		}
+	}
+
+	if (diag == 0.0) {
+		return -ESINGULAR;
+	}
+	x->data[i] = sum / diag;
+
+	return 0;
+}
+
+int zsl_spmtx_solve_lower(struct zsl_spmtx *l, struct zsl_vec *b,
+			  struct zsl_vec *x)
+{
+	int rc;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (l->sz_rows != l->sz_cols || b->sz != l->sz_rows ||
+	    x->sz != l->sz_rows) {
+		return -EINVAL;
+	}
+#endif
+
+	/* Row 'i' only needs the elements of 'x' before it, and only reads
+	 * element 'i' of 'b', so this also works in place. */
+	for (size_t i = 0; i < l->sz_rows; i++) {
+		rc = zsl_spmtx_solve_row(l, i, true, b, x);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+int zsl_spmtx_solve_upper(struct zsl_spmtx *u, struct zsl_vec *b,
+			  struct zsl_vec *x)
+{
+	int rc;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	if (u->sz_rows != u->sz_cols || b->sz != u->sz_rows ||
+	    x->sz != u->sz_rows) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = u->sz_rows; i-- > 0;) {
+		rc = zsl_spmtx_solve_row(u, i, false, b, x);
+		if (rc) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
@@ -431,6 +431,34 @@ int zsl_sta_covar_mtx(struct zsl_mtx *m, struct zsl_mtx *mc)
 	return 0;
 }
 
+int zsl_sta_covar_mtx_packed(struct zsl_mtx *m, struct zsl_mtx_packed *pc)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure 'pc' is symmetric, with as many rows as 'm' has columns. */
+	if (pc->sz != m->sz_cols || pc->type != ZSL_MTX_PACKED_SYM) {
+		return -EINVAL;
+	}
+#endif
+
+	zsl_real_t c;
+
+	ZSL_VECTOR_DEF(v1, m->sz_rows);
+	ZSL_VECTOR_DEF(v2, m->sz_rows);
+
+	/* The covariance matrix is symmetric, so only the lower triangle is
+	 * calculated. */
+	for (size_t i = 0; i < m->sz_cols; i++) {
+		zsl_mtx_get_col(m, i, v1.data);
+		for (size_t j = 0; j <= i; j++) {
+			zsl_mtx_get_col(m, j, v2.data);
+			zsl_sta_covar(&v1, &v2, &c);
+			pc->data[((i * (i + 1)) / 2) + j] = c;
+		}
+	}
+
+	return 0;
+}
+
 int zsl_sta_linear_reg(struct zsl_vec *x, struct zsl_vec *y,
 		       struct zsl_sta_linreg *c)
 {
@@ -475,11 +503,8 @@ int zsl_sta_mult_linear_reg(struct zsl_mtx *x, struct zsl_vec *y,
 #endif
 
 	ZSL_MATRIX_DEF(x_exp, x->sz_rows, (x->sz_cols + 1));
-	ZSL_MATRIX_DEF(x_trans, (x->sz_cols + 1), x->sz_rows);
 	ZSL_MATRIX_DEF(xx, (x->sz_cols + 1), (x->sz_cols + 1));
-	ZSL_MATRIX_DEF(xinv, (x->sz_cols + 1), (x->sz_cols + 1));
 	ZSL_MATRIX_DEF(ymtx, y->sz, 1);
-	ZSL_MATRIX_DEF(xtemp, (x->sz_cols + 1), x->sz_rows);
 	ZSL_MATRIX_DEF(bmtx, (x->sz_cols + 1), 1);
 	ZSL_MATRIX_DEF(xtemp2, x->sz_rows, 1);
 	ZSL_MATRIX_DEF(emtx, x->sz_rows, 1);
@@ -496,8 +521,7 @@ int zsl_sta_mult_linear_reg(struct zsl_mtx *x, struct zsl_vec *y,
 		zsl_mtx_set_col(&x_exp, j + 1, v);
 	}
 
-	zsl_mtx_trans(&x_exp, &x_trans);
-	zsl_mtx_mult(&x_trans, &x_exp, &xx);
+	zsl_mtx_syrk(&x_exp, true, 1.0, 0.0, &xx);
 
 	zsl_real_t det;
 	zsl_mtx_deter(&xx, &det);
@@ -507,13 +531,12 @@ int zsl_sta_mult_linear_reg(struct zsl_mtx *x, struct zsl_vec *y,
 		 * but is too resource-intensive to add at the momemt.
 		 */
 		return -EINVAL;
-	} else {
-		zsl_mtx_inv(&xx, &xinv);
 	}
 
+	/* Solve the normal equations (Xt * X) * b = Xt * y. */
 	zsl_mtx_from_arr(&ymtx, y->data);
-	zsl_mtx_mult(&xinv, &x_trans, &xtemp);
-	zsl_mtx_mult(&xtemp, &ymtx, &bmtx);
+	zsl_mtx_mult_ex(&x_exp, true, &ymtx, false, 1.0, 0.0, &bmtx);
+	zsl_mtx_solve(&xx, &bmtx, &bmtx);
 	zsl_vec_from_arr(b, bmtx.data);
 
 	zsl_mtx_mult(&x_exp, &bmtx, &xtemp2);
@@ -549,12 +572,9 @@ int zsl_sta_weighted_mult_linear_reg(struct zsl_mtx *x, struct zsl_vec *y,
 #endif
 
 	ZSL_MATRIX_DEF(x_exp, x->sz_rows, (x->sz_cols + 1));
-	ZSL_MATRIX_DEF(x_trans, (x->sz_cols + 1), x->sz_rows);
 	ZSL_MATRIX_DEF(xw, (x->sz_cols + 1), x->sz_rows);
 	ZSL_MATRIX_DEF(xx, (x->sz_cols + 1), (x->sz_cols + 1));
-	ZSL_MATRIX_DEF(xinv, (x->sz_cols + 1), (x->sz_cols + 1));
 	ZSL_MATRIX_DEF(ymtx, y->sz, 1);
-	ZSL_MATRIX_DEF(xtemp, (x->sz_cols + 1), x->sz_rows);
 	ZSL_MATRIX_DEF(bmtx, (x->sz_cols + 1), 1);
 	ZSL_MATRIX_DEF(xtemp2, x->sz_rows, 1);
 	ZSL_MATRIX_DEF(emtx, x->sz_rows, 1);
@@ -578,8 +598,7 @@ int zsl_sta_weighted_mult_linear_reg(struct zsl_mtx *x, struct zsl_vec *y,
 		zsl_mtx_set_col(&x_exp, j + 1, v);
 	}
 
-	zsl_mtx_trans(&x_exp, &x_trans);
-	zsl_mtx_mult(&x_trans, &idx, &xw);
+	zsl_mtx_mult_ex(&x_exp, true, &idx, false, 1.0, 0.0, &xw);
 	zsl_mtx_mult(&xw, &x_exp, &xx);
 
 	zsl_real_t det;
@@ -590,13 +609,12 @@ int zsl_sta_weighted_mult_linear_reg(struct zsl_mtx *x, struct zsl_vec *y,
 		 * but is too resource-intensive to add at the momemt.
 		 */
 		return -EINVAL;
-	} else {
-		zsl_mtx_inv(&xx, &xinv);
 	}
 
+	/* Solve the weighted normal equations (Xt * W * X) * b = Xt * W * y. */
 	zsl_mtx_from_arr(&ymtx, y->data);
-	zsl_mtx_mult(&xinv, &xw, &xtemp);
-	zsl_mtx_mult(&xtemp, &ymtx, &bmtx);
+	zsl_mtx_mult(&xw, &ymtx, &bmtx);
+	zsl_mtx_solve(&xx, &bmtx, &bmtx);
 	zsl_vec_from_arr(b, bmtx.data);
 
 	zsl_mtx_mult(&x_exp, &bmtx, &xtemp2);
@@ -617,6 +635,8 @@ int zsl_sta_weighted_mult_linear_reg(struct zsl_mtx *x, struct zsl_vec *y,
 #ifndef CONFIG_ZSL_SINGLE_PRECISION
 int zsl_sta_quad_fit(struct zsl_mtx *m, struct zsl_vec *b)
 {
+	int rc;
+
 #if CONFIG_ZSL_BOUNDS_CHECKS
 	/* Make sure matrices and vectors' sizes are adequate. */
 	if (m->sz_cols != 3 || b->sz != 9) {
@@ -644,17 +664,16 @@ int zsl_sta_quad_fit(struct zsl_mtx *m, struct zsl_vec *b)
 		y.data[i] = 1.0;
 	}
 
-	ZSL_MATRIX_DEF(xt, 9, m->sz_rows);
 	ZSL_MATRIX_DEF(xtx, 9, 9);
-	ZSL_MATRIX_DEF(inv, 9, 9);
-	ZSL_MATRIX_DEF(xtmp, 9, (m->sz_rows));
 	ZSL_MATRIX_DEF(btmp, 9, 1);
 
-	zsl_mtx_trans(&x, &xt);
-	zsl_mtx_mult(&xt, &x, &xtx);
-	zsl_mtx_inv(&xtx, &inv);
-	zsl_mtx_mult(&inv, &xt, &xtmp);
-	zsl_mtx_mult(&xtmp, &y, &btmp);
+	/* Solve the normal equations (Xt * X) * b = Xt * y. */
+	zsl_mtx_syrk(&x, true, 1.0, 0.0, &xtx);
+	zsl_mtx_mult_ex(&x, true, &y, false, 1.0, 0.0, &btmp);
+	rc = zsl_mtx_solve(&xtx, &btmp, &btmp);
+	if (rc) {
+		return rc;
+	}
 
 	zsl_vec_from_arr(b, btmp.data);
 
@@ -16,6 +16,11 @@
 #include <zsl/asm/arm/asm_arm_vectors.h>
 #endif
 
+/* Enable optimised x86 SSE2/AVX2 functions if available. */
+#if (CONFIG_ZSL_PLATFORM_OPT == 3)
+#include <zsl/asm/x86/asm_x86_vectors.h>
+#endif
+
 int zsl_vec_init(struct zsl_vec *v)
 {
 	memset(v->data, 0, v->sz * sizeof(zsl_real_t));
@@ -178,6 +183,22 @@ int zsl_vec_scalar_div(struct zsl_vec *v, zsl_real_t s)
 }
 #endif
 
+int zsl_vec_axpy(zsl_real_t a, struct zsl_vec *x, struct zsl_vec *y)
+{
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Make sure x and y are equal length. */
+	if (x->sz != y->sz) {
+		return -EINVAL;
+	}
+#endif
+
+	for (size_t i = 0; i < x->sz; i++) {
+		y->data[i] += a * x->data[i];
+	}
+
+	return 0;
+}
+
 zsl_real_t zsl_vec_dist(struct zsl_vec *v, struct zsl_vec *w)
 {
 	int rc = 0;
@@ -196,6 +217,7 @@ zsl_real_t zsl_vec_dist(struct zsl_vec *v, struct zsl_vec *w)
 	return zsl_vec_norm(&x);
 }
 
+#if !asm_vec_dot
 int zsl_vec_dot(struct zsl_vec *v, struct zsl_vec *w, zsl_real_t *d)
 {
 	zsl_real_t res = 0.0;
@@ -215,6 +237,7 @@ int zsl_vec_dot(struct zsl_vec *v, struct zsl_vec *w, zsl_real_t *d)
 
 	return 0;
 }
+#endif
 
 zsl_real_t zsl_vec_norm(struct zsl_vec *v)
 {
@@ -293,9 +316,27 @@ int zsl_vec_cross(struct zsl_vec *v, struct zsl_vec *w, struct zsl_vec *c)
 	 *   Cz = VxWy - VyWx
 	 */
 
-	c->data[0] = v->data[1] * w->data[2] - v->data[2] * w->data[1];
-	c->data[1] = v->data[2] * w->data[0] - v->data[0] * w->data[2];
-	c->data[2] = v->data[0] * w->data[1] - v->data[1] * w->data[0];
+	return zsl_vec3_cross(v->data, w->data, c->data);
+}
+
+int zsl_vec3_cross(const zsl_real_t *v, const zsl_real_t *w, zsl_real_t *c)
+{
+	/* Compute into locals first, so 'c' may be the same array as 'v' or
+	 * 'w'. */
+	zsl_real_t cx = v[1] * w[2] - v[2] * w[1];
+	zsl_real_t cy = v[2] * w[0] - v[0] * w[2];
+	zsl_real_t cz = v[0] * w[1] - v[1] * w[0];
+
+	c[0] = cx;
+	c[1] = cy;
+	c[2] = cz;
+
+	return 0;
+}
+
+int zsl_vec3_dot(const zsl_real_t *v, const zsl_real_t *w, zsl_real_t *d)
+{
+	*d = v[0] * w[0] + v[1] * w[1] + v[2] * w[2];
 
 	return 0;
 }
@@ -0,0 +1,38 @@
+/*
+ * Copyright (c) 2026 Kevin Townsend
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Test hooks for the x86 SSE2/AVX2 kernels.
+ *
+ * This file declares the functions that src/asm/x86/asm_x86.c only builds
+ * for ztest, so that they stay out of the public API.
+ */
+
+#ifndef ZEPHYR_INCLUDE_ZSL_ASM_X86_TEST_H_
+#define ZEPHYR_INCLUDE_ZSL_ASM_X86_TEST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Forces the kernel level, so that tests can cover the SSE2 kernels
+ *        on processors with AVX2.
+ *
+ * @param level 1 for the SSE2 kernels, 2 for the AVX2/FMA kernels, or 0 to
+ *              probe the processor again on the next call.
+ *
+ * @return 0 on success, -EINVAL for an unknown level, or -ENOSYS if level 2
+ *         is requested and the processor doesn't support AVX2 and FMA.
+ */
+int zsl_asm_x86_force_level(int level);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_ZSL_ASM_X86_TEST_H_ */
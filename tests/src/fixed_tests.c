@@ -0,0 +1,311 @@
+/*
+ * Copyright (c) 2026 Kevin Townsend
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zsl/zsl.h>
+#include <zsl/fixed.h>
+#include <zsl/orientation/quaternions.h>
+#include <zsl/orientation/fusion/complementary.h>
+#include "floatcheck.h"
+
+ZTEST(zsl_tests, test_fixed_scalar)
+{
+	/* Conversions round to nearest and saturate. */
+	zassert_equal(zsl_q31_from_real(0.5), 0x40000000);
+	zassert_equal(zsl_q31_from_real(-1.0), ZSL_Q31_MIN);
+	zassert_equal(zsl_q31_from_real(1.0), ZSL_Q31_MAX);
+	zassert_equal(zsl_q31_from_real(0.99999999999), ZSL_Q31_MAX);
+	zassert_equal(zsl_q15_from_real(0.99999), ZSL_Q15_MAX);
+	zassert_equal(zsl_q31_from_real(-3.0), ZSL_Q31_MIN);
+	zassert_equal(zsl_q15_from_real(0.25), 0x2000);
+	zassert_equal(zsl_q15_from_real(2.0), ZSL_Q15_MAX);
+	zassert_true(val_is_equal(zsl_q15_to_real(-16384), -0.5, 1E-8));
+
+	/* Additions saturate instead of wrapping. */
+	zassert_equal(zsl_q31_add(0x60000000, 0x60000000), ZSL_Q31_MAX);
+	zassert_equal(zsl_q31_sub(ZSL_Q31_MIN, 1), ZSL_Q31_MIN);
+	zassert_equal(zsl_q15_add(-0x6000, -0x6000), ZSL_Q15_MIN);
+
+	/* Products round, and -1 * -1 saturates. */
+	zassert_equal(zsl_q31_mult(0x40000000, 0x40000000), 0x20000000);
+	zassert_equal(zsl_q31_mult(ZSL_Q31_MIN, ZSL_Q31_MIN), ZSL_Q31_MAX);
+	zassert_equal(zsl_q15_mult(0x4000, -0x4000), -0x2000);
+	zassert_equal(zsl_q15_mult(ZSL_Q15_MIN, ZSL_Q15_MIN), ZSL_Q15_MAX);
+}
+
+ZTEST(zsl_tests, test_fixed_vec)
+{
+	int rc;
+	zsl_q31_t d31;
+	zsl_q15_t d15;
+	zsl_real_t d = 0.0;
+
+	ZSL_VECTOR_DEF(v, 5);
+	ZSL_VECTOR_DEF(w, 5);
+	ZSL_VECTOR_DEF(r, 5);
+	ZSL_VECTOR_Q31_DEF(v31, 5);
+	ZSL_VECTOR_Q31_DEF(w31, 5);
+	ZSL_VECTOR_Q31_DEF(x31, 5);
+	ZSL_VECTOR_Q31_DEF(e31, 4);
+	ZSL_VECTOR_Q15_DEF(v15, 5);
+	ZSL_VECTOR_Q15_DEF(w15, 5);
+
+	zsl_real_t va[5] = { 0.5, -0.25, 0.125, 0.75, -0.9 };
+	zsl_real_t wa[5] = { 0.3, 0.6, -0.7, 0.4, -0.2 };
+
+	zsl_vec_from_arr(&v, va);
+	zsl_vec_from_arr(&w, wa);
+	for (size_t i = 0; i < 5; i++) {
+		d += va[i] * wa[i];
+	}
+
+	/* Round trip through Q31. */
+	rc = zsl_vec_q31_from_real(&v, &v31);
+	zassert_equal(rc, 0);
+	rc = zsl_vec_q31_from_real(&w, &w31);
+	zassert_equal(rc, 0);
+	rc = zsl_vec_q31_to_real(&v31, &r);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 5; i++) {
+		zassert_true(val_is_equal(r.data[i], va[i], 1E-6));
+	}
+
+	/* Dot product. */
+	rc = zsl_vec_q31_dot(&v31, &w31, &d31);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(zsl_q31_to_real(d31), d, 1E-6));
+
+	/* Saturating sum: 0.75 + 0.4 clips to the largest Q31 value. */
+	rc = zsl_vec_q31_add(&v31, &w31, &x31);
+	zassert_equal(rc, 0);
+	zassert_equal(x31.data[3], ZSL_Q31_MAX);
+	zassert_true(val_is_equal(zsl_q31_to_real(x31.data[1]), 0.35, 1E-6));
+	rc = zsl_vec_q31_sub(&v31, &w31, &x31);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(zsl_q31_to_real(x31.data[2]), 0.825, 1E-6));
+
+	/* Scalar multiply, in place. */
+	rc = zsl_vec_q31_scalar_mult(&v31, zsl_q31_from_real(-0.5));
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(zsl_q31_to_real(v31.data[4]), 0.45, 1E-6));
+
+	/* Q15 versions, with the coarser Q15 resolution. */
+	rc = zsl_vec_q15_from_real(&v, &v15);
+	zassert_equal(rc, 0);
+	rc = zsl_vec_q15_from_real(&w, &w15);
+	zassert_equal(rc, 0);
+	rc = zsl_vec_q15_dot(&v15, &w15, &d15);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(zsl_q15_to_real(d15), d, 1E-3));
+	rc = zsl_vec_q15_add(&v15, &w15, &v15);
+	zassert_equal(rc, 0);
+	zassert_equal(v15.data[3], ZSL_Q15_MAX);
+	rc = zsl_vec_q15_to_real(&v15, &r);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(r.data[0], 0.8, 1E-3));
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Mismatched sizes are rejected. */
+	rc = zsl_vec_q31_dot(&v31, &e31, &d31);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+ZTEST(zsl_tests, test_fixed_mtx)
+{
+	int rc;
+
+	ZSL_MATRIX_DEF(ma, 3, 4);
+	ZSL_MATRIX_DEF(mb, 4, 2);
+	ZSL_MATRIX_DEF(mc, 3, 2);
+	ZSL_MATRIX_DEF(mr, 3, 2);
+	ZSL_MATRIX_Q31_DEF(qa, 3, 4);
+	ZSL_MATRIX_Q31_DEF(qb, 4, 2);
+	ZSL_MATRIX_Q31_DEF(qc, 3, 2);
+	ZSL_MATRIX_Q15_DEF(sa, 3, 4);
+	ZSL_MATRIX_Q15_DEF(sb, 4, 2);
+	ZSL_MATRIX_Q15_DEF(sc, 3, 2);
+
+	zsl_real_t a[12] = { 0.1, -0.2, 0.3, 0.15,
+			     0.45, 0.05, -0.35, 0.2,
+			     -0.4, 0.25, 0.1, -0.3 };
+	zsl_real_t b[8] = { 0.5, -0.1,
+			    0.2, 0.3,
+			    -0.6, 0.4,
+			    0.1, 0.7 };
+
+	zsl_mtx_from_arr(&ma, a);
+	zsl_mtx_from_arr(&mb, b);
+	zsl_mtx_mult(&ma, &mb, &mc);
+
+	/* GEMM in Q31. */
+	zassert_equal(zsl_mtx_q31_from_real(&ma, &qa), 0);
+	zassert_equal(zsl_mtx_q31_from_real(&mb, &qb), 0);
+	rc = zsl_mtx_q31_mult(&qa, &qb, &qc);
+	zassert_equal(rc, 0);
+	zassert_equal(zsl_mtx_q31_to_real(&qc, &mr), 0);
+	for (size_t i = 0; i < 6; i++) {
+		zassert_true(val_is_equal(mr.data[i], mc.data[i], 1E-6));
+	}
+
+	/* GEMM in Q15. */
+	zassert_equal(zsl_mtx_q15_from_real(&ma, &sa), 0);
+	zassert_equal(zsl_mtx_q15_from_real(&mb, &sb), 0);
+	rc = zsl_mtx_q15_mult(&sa, &sb, &sc);
+	zassert_equal(rc, 0);
+	zassert_equal(zsl_mtx_q15_to_real(&sc, &mr), 0);
+	for (size_t i = 0; i < 6; i++) {
+		zassert_true(val_is_equal(mr.data[i], mc.data[i], 1E-3));
+	}
+
+	/* Saturating element-wise sum. */
+	rc = zsl_mtx_q31_add(&qc, &qc, &qc);
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_q15_add(&sc, &sc, &sc);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 6; i++) {
+		zassert_true(val_is_equal(zsl_q31_to_real(qc.data[i]),
+					  2.0 * mc.data[i], 1E-6));
+		zassert_true(val_is_equal(zsl_q15_to_real(sc.data[i]),
+					  2.0 * mc.data[i], 1E-3));
+	}
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Mismatched shapes are rejected. */
+	rc = zsl_mtx_q31_mult(&qb, &qa, &qc);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+ZTEST(zsl_tests, test_fixed_quat)
+{
+	int rc;
+	struct zsl_quat a, b, m, r;
+	struct zsl_quat_q31 qa, qb, qm;
+
+	ZSL_VECTOR_DEF(w, 3);
+	ZSL_VECTOR_Q31_DEF(wt, 3);
+
+	a.r = 0.5443311;
+	a.i = 0.4082483;
+	a.j = 0.6804138;
+	a.k = 0.2721655;
+	b.r = 0.7071068;
+	b.i = 0.0;
+	b.j = -0.5;
+	b.k = 0.5;
+	zsl_quat_to_unit_d(&a);
+	zsl_quat_to_unit_d(&b);
+	zsl_quat_q31_from_real(&a, &qa);
+	zsl_quat_q31_from_real(&b, &qb);
+
+	/* Hamilton product, written over the first input. */
+	zsl_quat_mult(&a, &b, &m);
+	qm = qa;
+	rc = zsl_quat_q31_mult(&qm, &qb, &qm);
+	zassert_equal(rc, 0);
+	zsl_quat_q31_to_real(&qm, &r);
+	zassert_true(val_is_equal(r.r, m.r, 1E-6));
+	zassert_true(val_is_equal(r.i, m.i, 1E-6));
+	zassert_true(val_is_equal(r.j, m.j, 1E-6));
+	zassert_true(val_is_equal(r.k, m.k, 1E-6));
+
+	/* Normalisation of a non-unit quaternion. */
+	qm.r = 0x30000000;
+	qm.i = 0;
+	qm.j = -0x40000000;
+	qm.k = 0;
+	rc = zsl_quat_q31_to_unit_d(&qm);
+	zassert_equal(rc, 0);
+	zsl_quat_q31_to_real(&qm, &r);
+	zassert_true(val_is_equal(r.r, 0.6, 1E-6));
+	zassert_true(val_is_equal(r.j, -0.8, 1E-6));
+	qm.r = 0;
+	qm.j = 0;
+	rc = zsl_quat_q31_to_unit_d(&qm);
+	zassert_equal(rc, -EINVAL);
+
+	/* Linear interpolation. */
+	zsl_quat_lerp(&a, &b, 0.3, &m);
+	rc = zsl_quat_q31_lerp(&qa, &qb, zsl_q31_from_real(0.3), &qm);
+	zassert_equal(rc, 0);
+	zsl_quat_q31_to_real(&qm, &r);
+	zassert_true(val_is_equal(r.r, m.r, 1E-6));
+	zassert_true(val_is_equal(r.i, m.i, 1E-6));
+	zassert_true(val_is_equal(r.j, m.j, 1E-6));
+	zassert_true(val_is_equal(r.k, m.k, 1E-6));
+
+	/* Integration of the angular velocity over one 10 ms period. */
+	w.data[0] = 1.5;
+	w.data[1] = -0.8;
+	w.data[2] = 2.2;
+	for (size_t i = 0; i < 3; i++) {
+		wt.data[i] = zsl_q31_from_real(w.data[i] * 0.01);
+	}
+	zsl_quat_from_ang_vel(&w, &a, 0.01, &m);
+	rc = zsl_quat_q31_from_ang_vel(&wt, &qa, &qm);
+	zassert_equal(rc, 0);
+	zsl_quat_q31_to_real(&qm, &r);
+	zassert_true(val_is_equal(r.r, m.r, 1E-6));
+	zassert_true(val_is_equal(r.i, m.i, 1E-6));
+	zassert_true(val_is_equal(r.j, m.j, 1E-6));
+	zassert_true(val_is_equal(r.k, m.k, 1E-6));
+}
+
+ZTEST(zsl_tests, test_fixed_fus_comp)
+{
+	int rc;
+	struct zsl_quat q, qw, qam, r;
+	struct zsl_quat_q31 qq, qqam;
+	zsl_real_t alpha = 0.02;
+
+	ZSL_VECTOR_DEF(w, 3);
+	ZSL_VECTOR_Q31_DEF(wt, 3);
+
+	q.r = 1.0;
+	q.i = 0.0;
+	q.j = 0.0;
+	q.k = 0.0;
+	qam.r = 0.9238795;
+	qam.i = 0.0;
+	qam.j = 0.0;
+	qam.k = 0.3826834;
+	zsl_quat_q31_from_real(&q, &qq);
+	zsl_quat_q31_from_real(&qam, &qqam);
+
+	w.data[0] = 0.2;
+	w.data[1] = -0.1;
+	w.data[2] = 0.5;
+	for (size_t i = 0; i < 3; i++) {
+		wt.data[i] = zsl_q31_from_real(w.data[i] * 0.01);
+	}
+
+	/* Run 100 steps at 100 Hz against the same steps in floating point. */
+	for (size_t n = 0; n < 100; n++) {
+		zsl_quat_from_ang_vel(&w, &q, 0.01, &qw);
+		zsl_quat_lerp(&qw, &qam, alpha, &q);
+		rc = zsl_fus_comp_q31(&wt, &qqam, zsl_q31_from_real(alpha),
+				      &qq);
+		zassert_equal(rc, 0);
+	}
+
+	zsl_quat_q31_to_real(&qq, &r);
+	zassert_true(val_is_equal(r.r, q.r, 1E-5));
+	zassert_true(val_is_equal(r.i, q.i, 1E-5));
+	zassert_true(val_is_equal(r.j, q.j, 1E-5));
+	zassert_true(val_is_equal(r.k, q.k, 1E-5));
+
+	/* Without an accel/mag estimate, only the gyroscope is integrated. */
+	zsl_quat_from_ang_vel(&w, &q, 0.01, &qw);
+	rc = zsl_fus_comp_q31(&wt, NULL, 0, &qq);
+	zassert_equal(rc, 0);
+	zsl_quat_q31_to_real(&qq, &r);
+	zassert_true(val_is_equal(r.r, qw.r, 1E-5));
+	zassert_true(val_is_equal(r.k, qw.k, 1E-5));
+
+	rc = zsl_fus_comp_q31(&wt, &qqam, -1, &qq);
+	zassert_equal(rc, -EINVAL);
+}
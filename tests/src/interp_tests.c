@@ -505,3 +505,34 @@ ZTEST(zsl_tests, test_interp_cubic_arr)
 	rc = zsl_interp_cubic_arr(xyc, 2, x, &y);
 	zassert_equal(rc, -EINVAL);
 }
+
+ZTEST(zsl_tests, test_interp_cubic_clamped)
+{
+	int rc;
+	zsl_real_t y;
+	struct zsl_interp_xyc xyc[5];
+	zsl_real_t xs[5] = { 0.0, 0.5, 1.5, 2.0, 3.5 };
+
+	/* A spline with the end slopes of y = x^3 reproduces it exactly, even
+	 * with uneven spacing. */
+	for (size_t i = 0; i < 5; i++) {
+		xyc[i].x = xs[i];
+		xyc[i].y = xs[i] * xs[i] * xs[i];
+	}
+
+	rc = zsl_interp_cubic_calc(xyc, 5, 0.0, 3.0 * 3.5 * 3.5);
+	zassert_equal(rc, 0);
+
+	/* The second derivatives are 6x. */
+	for (size_t i = 0; i < 5; i++) {
+		zassert_true(val_is_equal(xyc[i].y2, 6.0 * xs[i], 1E-4));
+	}
+
+	rc = zsl_interp_cubic_arr(xyc, 5, 2.7, &y);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(y, 2.7 * 2.7 * 2.7, 1E-4));
+
+	/* Not enough samples. */
+	rc = zsl_interp_cubic_calc(xyc, 2, 0.0, 0.0);
+	zassert_equal(rc, -EINVAL);
+}
@@ -10,6 +10,10 @@
 #include <zsl/vectors.h>
 #include "floatcheck.h"
 
+#if (CONFIG_ZSL_PLATFORM_OPT == 3)
+#include "asm_x86_test.h"
+#endif
+
 /**
  * @brief zsl_mtx_init unit tests.
  *
@@ -128,6 +132,53 @@ ZTEST(zsl_tests, test_matrix_copy)
 	zassert_true(zsl_mtx_is_equal(&m, &msrc));
 }
 
+/**
+ * @brief zsl_ws_* unit tests.
+ *
+ * This test verifies the zsl_ws_init, zsl_ws_mtx, zsl_ws_vec, zsl_ws_avail
+ * and zsl_ws_reset functions.
+ */
+ZTEST(zsl_tests, test_matrix_ws)
+{
+	int rc;
+	struct zsl_workspace ws;
+	struct zsl_mtx m;
+	struct zsl_vec v;
+	zsl_real_t buf[8];
+
+	/* Initialise over a misaligned buffer, losing the first element. */
+	rc = zsl_ws_init(&ws, (uint8_t *)buf + 1, sizeof(buf) - 1);
+	zassert_equal(rc, 0);
+	zassert_equal(zsl_ws_avail(&ws), 7 * sizeof(zsl_real_t));
+	zassert_true(ws.data == &buf[1]);
+
+	rc = zsl_ws_init(&ws, NULL, sizeof(buf));
+	zassert_equal(rc, -EINVAL);
+
+	/* Allocate a matrix followed by a vector. */
+	rc = zsl_ws_init(&ws, buf, sizeof(buf));
+	zassert_equal(rc, 0);
+	rc = zsl_ws_mtx(&ws, &m, 2, 3);
+	zassert_equal(rc, 0);
+	zassert_equal(m.sz_rows, 2);
+	zassert_equal(m.sz_cols, 3);
+	zassert_true(m.data == &buf[0]);
+	zassert_equal(zsl_ws_avail(&ws), 2 * sizeof(zsl_real_t));
+
+	rc = zsl_ws_vec(&ws, &v, 3);
+	zassert_equal(rc, -ENOMEM);
+	rc = zsl_ws_vec(&ws, &v, 2);
+	zassert_equal(rc, 0);
+	zassert_equal(v.sz, 2);
+	zassert_true(v.data == &buf[6]);
+	zassert_equal(zsl_ws_avail(&ws), 0);
+
+	/* Release everything. */
+	rc = zsl_ws_reset(&ws);
+	zassert_equal(rc, 0);
+	zassert_equal(zsl_ws_avail(&ws), sizeof(buf));
+}
+
 /**
  * @brief zsl_mtx_get unit tests.
  *
@@ -358,6 +409,200 @@ ZTEST(zsl_tests, test_matrix_row_from_vec)
 	zassert_true(val_is_equal(v.data[2], 0.0, 1E-5));
 }
 
+ZTEST(zsl_tests, test_matrix_view)
+{
+	int rc;
+	zsl_real_t x;
+	struct zsl_mtx_view v, w;
+
+	zsl_real_t data[12] = { 1.0,  2.0,  3.0,  4.0,
+				5.0,  6.0,  7.0,  8.0,
+				9.0, 10.0, 11.0, 12.0 };
+
+	struct zsl_mtx m = {
+		.sz_rows = 3,
+		.sz_cols = 4,
+		.data = data
+	};
+
+	rc = zsl_mtx_view_init(&m, &v);
+	zassert_equal(rc, 0);
+	zassert_equal(v.sz_rows, 3);
+	zassert_equal(v.sz_cols, 4);
+
+	/* The 2x2 block starting at (1, 2). */
+	rc = zsl_mtx_view_block(&v, &w, 1, 2, 2, 2);
+	zassert_equal(rc, 0);
+	zsl_mtx_view_get(&w, 0, 0, &x);
+	zassert_true(val_is_equal(x, 7.0, 1E-8));
+	zsl_mtx_view_get(&w, 1, 1, &x);
+	zassert_true(val_is_equal(x, 12.0, 1E-8));
+
+	/* Writing to the view updates the matrix. */
+	rc = zsl_mtx_view_set(&w, 1, 0, -1.0);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(data[10], -1.0, 1E-8));
+	data[10] = 11.0;
+
+	/* Blocks that don't fit are rejected. */
+	rc = zsl_mtx_view_block(&v, &w, 2, 2, 2, 2);
+	zassert_equal(rc, -EINVAL);
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	rc = zsl_mtx_view_get(&v, 3, 0, &x);
+	zassert_equal(rc, -EINVAL);
+#endif
+
+	/* Row and column views. */
+	rc = zsl_mtx_view_row(&v, &w, 2);
+	zassert_equal(rc, 0);
+	zassert_equal(w.sz_rows, 1);
+	zassert_equal(w.sz_cols, 4);
+	zsl_mtx_view_get(&w, 0, 3, &x);
+	zassert_true(val_is_equal(x, 12.0, 1E-8));
+
+	rc = zsl_mtx_view_col(&v, &w, 1);
+	zassert_equal(rc, 0);
+	zassert_equal(w.sz_rows, 3);
+	zassert_equal(w.sz_cols, 1);
+	zsl_mtx_view_get(&w, 2, 0, &x);
+	zassert_true(val_is_equal(x, 10.0, 1E-8));
+
+	/* The diagonal of a 3x4 matrix has 3 elements. */
+	rc = zsl_mtx_view_diag(&v, &w);
+	zassert_equal(rc, 0);
+	zassert_equal(w.sz_rows, 3);
+	zassert_equal(w.sz_cols, 1);
+	for (size_t i = 0; i < 3; i++) {
+		zsl_mtx_view_get(&w, i, 0, &x);
+		zassert_true(val_is_equal(x, data[(i * 4) + i], 1E-8));
+	}
+
+	/* Transpose views, including the diagonal of a transposed block. */
+	rc = zsl_mtx_view_trans(&v, &w);
+	zassert_equal(rc, 0);
+	zassert_equal(w.sz_rows, 4);
+	zassert_equal(w.sz_cols, 3);
+	for (size_t i = 0; i < 4; i++) {
+		for (size_t j = 0; j < 3; j++) {
+			zsl_mtx_view_get(&w, i, j, &x);
+			zassert_true(val_is_equal(x, data[(j * 4) + i], 1E-8));
+		}
+	}
+
+	rc = zsl_mtx_view_block(&w, &w, 1, 0, 3, 3);
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_view_diag(&w, &w);
+	zassert_equal(rc, 0);
+	zsl_mtx_view_get(&w, 0, 0, &x);
+	zassert_true(val_is_equal(x, 2.0, 1E-8));
+	zsl_mtx_view_get(&w, 1, 0, &x);
+	zassert_true(val_is_equal(x, 7.0, 1E-8));
+	zsl_mtx_view_get(&w, 2, 0, &x);
+	zassert_true(val_is_equal(x, 12.0, 1E-8));
+}
+
+ZTEST(zsl_tests, test_matrix_view_ops)
+{
+	int rc;
+	zsl_real_t x;
+	struct zsl_mtx_view v, va, vb, vc, vi;
+
+	ZSL_MATRIX_DEF(mc, 2, 2);
+	ZSL_MATRIX_DEF(mi, 3, 3);
+
+	zsl_real_t data[12] = { 1.0,  2.0,  3.0,  4.0,
+				5.0,  6.0,  7.0,  8.0,
+				9.0, 10.0, 11.0, 12.0 };
+
+	struct zsl_mtx m = {
+		.sz_rows = 3,
+		.sz_cols = 4,
+		.data = data
+	};
+
+	zsl_mtx_view_init(&m, &v);
+
+	/* Copy the transpose of the upper-left 2x2 block into 'mc'. */
+	zsl_mtx_view_block(&v, &va, 0, 0, 2, 2);
+	zsl_mtx_view_trans(&va, &va);
+	zsl_mtx_view_init(&mc, &vc);
+	rc = zsl_mtx_view_copy(&vc, &va);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(mc.data[0], 1.0, 1E-8));
+	zassert_true(val_is_equal(mc.data[1], 5.0, 1E-8));
+	zassert_true(val_is_equal(mc.data[2], 2.0, 1E-8));
+	zassert_true(val_is_equal(mc.data[3], 6.0, 1E-8));
+
+	/* Add the lower-right block to it. */
+	zsl_mtx_view_block(&v, &vb, 1, 2, 2, 2);
+	rc = zsl_mtx_view_add(&vc, &vb, &vc);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(mc.data[0], 8.0, 1E-8));
+	zassert_true(val_is_equal(mc.data[1], 13.0, 1E-8));
+	zassert_true(val_is_equal(mc.data[2], 13.0, 1E-8));
+	zassert_true(val_is_equal(mc.data[3], 18.0, 1E-8));
+
+	/* Gram matrix of the last two columns. The transposed left operand
+	 * takes the strided fallback path. */
+	zsl_mtx_view_block(&v, &va, 0, 2, 3, 2);
+	zsl_mtx_view_trans(&va, &vb);
+	rc = zsl_mtx_view_mult(&vb, &va, &vc);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(mc.data[0], 179.0, 1E-6));
+	zassert_true(val_is_equal(mc.data[1], 200.0, 1E-6));
+	zassert_true(val_is_equal(mc.data[2], 200.0, 1E-6));
+	zassert_true(val_is_equal(mc.data[3], 224.0, 1E-6));
+
+	/* The outer product of two rows uses the blocked kernel. */
+	zsl_mtx_view_block(&v, &va, 0, 0, 2, 1);
+	zsl_mtx_view_block(&v, &vb, 2, 0, 1, 2);
+	rc = zsl_mtx_view_mult(&va, &vb, &vc);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(mc.data[0], 9.0, 1E-6));
+	zassert_true(val_is_equal(mc.data[1], 10.0, 1E-6));
+	zassert_true(val_is_equal(mc.data[2], 45.0, 1E-6));
+	zassert_true(val_is_equal(mc.data[3], 50.0, 1E-6));
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* The output can't overlap an input. */
+	zsl_mtx_view_block(&v, &vc, 1, 0, 2, 2);
+	rc = zsl_mtx_view_mult(&va, &vb, &vc);
+	zassert_equal(rc, -EINVAL);
+#endif
+
+	/* Norms of the last column. */
+	zsl_mtx_view_col(&v, &va, 3);
+	rc = zsl_mtx_view_norm(&va, &x);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(x, ZSL_SQRT(224.0), 1E-6));
+
+	/* Eliminate column 0 of the right 3x3 block in place, using (1, 0)
+	 * as the pivot. */
+	zsl_mtx_init(&mi, zsl_mtx_entry_fn_identity);
+	zsl_mtx_view_init(&mi, &vi);
+	zsl_mtx_view_block(&v, &va, 0, 1, 3, 3);
+	rc = zsl_mtx_view_gauss_elim(&va, &vi, 1, 0);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(data[1], 0.0, 1E-6));
+	zassert_true(val_is_equal(data[5], 6.0, 1E-6));
+	zassert_true(val_is_equal(data[9], 0.0, 1E-6));
+	zassert_true(val_is_equal(data[3], 4.0 - 8.0 / 3.0, 1E-6));
+	zassert_true(val_is_equal(data[11], 12.0 - 8.0 * 10.0 / 6.0, 1E-6));
+	/* Column 0 is outside the block and is left untouched. */
+	zassert_true(val_is_equal(data[0], 1.0, 1E-8));
+	zassert_true(val_is_equal(data[8], 9.0, 1E-8));
+	zassert_true(val_is_equal(mi.data[1], -1.0 / 3.0, 1E-6));
+	zassert_true(val_is_equal(mi.data[7], -10.0 / 6.0, 1E-6));
+
+	/* Normalise the columns of the lower-left block in place. */
+	zsl_mtx_view_block(&v, &va, 1, 0, 2, 1);
+	rc = zsl_mtx_view_cols_norm(&va, &va);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(data[4], 5.0 / ZSL_SQRT(106.0), 1E-6));
+	zassert_true(val_is_equal(data[8], 9.0 / ZSL_SQRT(106.0), 1E-6));
+	zassert_true(val_is_equal(data[0], 1.0, 1E-8));
+}
+
 ZTEST(zsl_tests, test_matrix_unary_op)
 {
 	int rc;
@@ -908,6 +1153,403 @@ ZTEST(zsl_tests, test_matrix_mult_d)
 	zassert_equal(rc, -EINVAL);
 }
 
+/**
+ * @brief zsl_mtx_mult unit tests with larger matrices.
+ *
+ * This test verifies the blocked zsl_mtx_mult kernel with shapes that are not
+ * a multiple of the register block size, with a shared dimension larger than
+ * the packed panel depth, and with an output matrix aliasing an input.
+ */
+ZTEST(zsl_tests, test_matrix_mult_ex)
+{
+	int rc;
+	zsl_real_t x;
+
+	ZSL_MATRIX_DEF(at, 3, 5);
+	ZSL_MATRIX_DEF(bt, 5, 3);
+	ZSL_MATRIX_DEF(ref, 5, 5);
+	ZSL_MATRIX_DEF(mc, 5, 5);
+	ZSL_MATRIX_DEF(mg, 3, 3);
+	ZSL_MATRIX_DEF(ref3, 3, 3);
+
+	zsl_real_t a[15] = { 1.0,  2.0, -1.0,
+			     0.5,  3.0,  4.0,
+			    -2.0,  1.5,  0.0,
+			     7.0, -0.5,  2.0,
+			     1.0,  1.0,  1.0 };
+
+	zsl_real_t b[15] = { 2.0,  0.0,  1.0,  3.0, -1.0,
+			     1.0, -4.0,  0.5,  2.0,  6.0,
+			     0.0,  2.5, -3.0,  1.0,  1.5 };
+
+	struct zsl_mtx ma = {
+		.sz_rows = 5,
+		.sz_cols = 3,
+		.data = a
+	};
+
+	struct zsl_mtx mb = {
+		.sz_rows = 3,
+		.sz_cols = 5,
+		.data = b
+	};
+
+	zsl_mtx_trans(&ma, &at);
+	zsl_mtx_trans(&mb, &bt);
+
+	rc = zsl_mtx_mult(&ma, &mb, &ref);
+	zassert_equal(rc, 0);
+
+	/* mc = 2 * A * B + 0.5 * mc, for every combination of transposed
+	 * operands. */
+	for (int t = 0; t < 4; t++) {
+		bool ta = (t & 1) != 0;
+		bool tb = (t & 2) != 0;
+
+		for (size_t g = 0; g < 25; g++) {
+			mc.data[g] = (zsl_real_t)g;
+		}
+
+		rc = zsl_mtx_mult_ex(ta ? &at : &ma, ta, tb ? &bt : &mb, tb,
+				     2.0, 0.5, &mc);
+		zassert_equal(rc, 0);
+		for (size_t g = 0; g < 25; g++) {
+			x = 2.0 * ref.data[g] + 0.5 * (zsl_real_t)g;
+			zassert_true(val_is_equal(mc.data[g], x, 1E-5));
+		}
+	}
+
+	/* With a zero beta, the initial contents of 'mc' are ignored. */
+	for (size_t g = 0; g < 25; g++) {
+		mc.data[g] = NAN;
+	}
+	rc = zsl_mtx_mult_ex(&at, true, &mb, false, 1.0, 0.0, &mc);
+	zassert_equal(rc, 0);
+	for (size_t g = 0; g < 25; g++) {
+		zassert_true(val_is_equal(mc.data[g], ref.data[g], 1E-5));
+	}
+
+	/* The output may alias both inputs: mg = M^T * M + mg. */
+	zsl_mtx_from_arr(&mg, a);
+	zsl_mtx_trans(&mg, &ref3);
+	zsl_mtx_mult(&ref3, &mg, &ref3);
+	rc = zsl_mtx_mult_ex(&mg, true, &mg, false, 1.0, 1.0, &mg);
+	zassert_equal(rc, 0);
+	for (size_t g = 0; g < 9; g++) {
+		x = ref3.data[g] + a[g];
+		zassert_true(val_is_equal(mg.data[g], x, 1E-5));
+	}
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Incompatible shapes are rejected. */
+	rc = zsl_mtx_mult_ex(&ma, false, &mb, true, 1.0, 0.0, &mc);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+ZTEST(zsl_tests, test_matrix_syrk)
+{
+	int rc;
+
+	ZSL_MATRIX_DEF(at, 3, 4);
+	ZSL_MATRIX_DEF(ref, 3, 3);
+	ZSL_MATRIX_DEF(mc, 3, 3);
+	ZSL_MATRIX_DEF(ref4, 4, 4);
+	ZSL_MATRIX_DEF(mc4, 4, 4);
+
+	zsl_real_t a[12] = { 1.0,  2.0, -1.0,
+			     0.5,  3.0,  4.0,
+			    -2.0,  1.5,  0.0,
+			     7.0, -0.5,  2.0 };
+
+	struct zsl_mtx ma = {
+		.sz_rows = 4,
+		.sz_cols = 3,
+		.data = a
+	};
+
+	zsl_mtx_trans(&ma, &at);
+
+	/* mc = 3 * A^T * A + 2 * I. */
+	zsl_mtx_mult(&at, &ma, &ref);
+	zsl_mtx_init(&mc, zsl_mtx_entry_fn_identity);
+	rc = zsl_mtx_syrk(&ma, true, 3.0, 2.0, &mc);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 3; i++) {
+		for (size_t j = 0; j < 3; j++) {
+			zassert_true(val_is_equal(mc.data[(i * 3) + j],
+				3.0 * ref.data[(i * 3) + j] +
+				(i == j ? 2.0 : 0.0), 1E-5));
+		}
+	}
+
+	/* mc4 = A * A^T, ignoring the initial contents of mc4. */
+	zsl_mtx_mult(&ma, &at, &ref4);
+	for (size_t g = 0; g < 16; g++) {
+		mc4.data[g] = NAN;
+	}
+	rc = zsl_mtx_syrk(&ma, false, 1.0, 0.0, &mc4);
+	zassert_equal(rc, 0);
+	for (size_t g = 0; g < 16; g++) {
+		zassert_true(val_is_equal(mc4.data[g], ref4.data[g], 1E-5));
+	}
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* The output must be square with the right size. */
+	rc = zsl_mtx_syrk(&ma, false, 1.0, 0.0, &mc);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+ZTEST(zsl_tests, test_matrix_gemv)
+{
+	int rc;
+
+	ZSL_VECTOR_DEF(y3, 3);
+
+	zsl_real_t a[12] = { 1.0,  2.0, -1.0,
+			     0.5,  3.0,  4.0,
+			    -2.0,  1.5,  0.0,
+			     7.0, -0.5,  2.0 };
+	struct zsl_mtx ma = {
+		.sz_rows = 4,
+		.sz_cols = 3,
+		.data = a
+	};
+
+	zsl_real_t dx3[3] = { 1.0, -1.0, 2.0 };
+	struct zsl_vec x3 = {
+		.sz = 3,
+		.data = dx3
+	};
+
+	zsl_real_t dx4[4] = { 1.0, 0.0, -1.0, 2.0 };
+	struct zsl_vec x4 = {
+		.sz = 4,
+		.data = dx4
+	};
+
+	zsl_real_t dy4[4] = { 1.0, 2.0, 3.0, 4.0 };
+	struct zsl_vec y4 = {
+		.sz = 4,
+		.data = dy4
+	};
+
+	/* y4 = 2 * A * x3 - y4, with A * x3 = (-3, 5.5, -3.5, 11.5). */
+	rc = zsl_mtx_gemv(&ma, false, 2.0, &x3, -1.0, &y4);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(dy4[0], -7.0, 1E-6));
+	zassert_true(val_is_equal(dy4[1], 9.0, 1E-6));
+	zassert_true(val_is_equal(dy4[2], -10.0, 1E-6));
+	zassert_true(val_is_equal(dy4[3], 19.0, 1E-6));
+
+	/* y3 = At * x4, ignoring the initial contents of y3. */
+	for (size_t g = 0; g < 3; g++) {
+		y3.data[g] = NAN;
+	}
+	rc = zsl_mtx_gemv(&ma, true, 1.0, &x4, 0.0, &y3);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(y3.data[0], 17.0, 1E-6));
+	zassert_true(val_is_equal(y3.data[1], -0.5, 1E-6));
+	zassert_true(val_is_equal(y3.data[2], 3.0, 1E-6));
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Sizes must match op(A), and 'y' can't overlap 'x'. */
+	rc = zsl_mtx_gemv(&ma, true, 1.0, &x3, 0.0, &y4);
+	zassert_equal(rc, -EINVAL);
+	rc = zsl_mtx_gemv(&ma, false, 1.0, &x4, 0.0, &y3);
+	zassert_equal(rc, -EINVAL);
+	struct zsl_vec x4s = {
+		.sz = 3,
+		.data = &dy4[1]
+	};
+	rc = zsl_mtx_gemv(&ma, false, 1.0, &x4s, 0.0, &y4);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+ZTEST(zsl_tests, test_matrix_ger)
+{
+	int rc;
+
+	zsl_real_t a[12] = { 1.0,  2.0, -1.0,
+			     0.5,  3.0,  4.0,
+			    -2.0,  1.5,  0.0,
+			     7.0, -0.5,  2.0 };
+	struct zsl_mtx ma = {
+		.sz_rows = 4,
+		.sz_cols = 3,
+		.data = a
+	};
+
+	zsl_real_t ref[12] = {  2.0,  1.0,  1.0,
+			        0.5,  3.0,  4.0,
+			       -3.0,  2.5, -2.0,
+			        9.0, -2.5,  6.0 };
+
+	zsl_real_t dx[4] = { 1.0, 0.0, -1.0, 2.0 };
+	struct zsl_vec x = {
+		.sz = 4,
+		.data = dx
+	};
+
+	zsl_real_t dy[3] = { 2.0, -2.0, 4.0 };
+	struct zsl_vec y = {
+		.sz = 3,
+		.data = dy
+	};
+
+	/* A = A + 0.5 * x * yt. */
+	rc = zsl_mtx_ger(&ma, 0.5, &x, &y);
+	zassert_equal(rc, 0);
+	for (size_t g = 0; g < 12; g++) {
+		zassert_true(val_is_equal(a[g], ref[g], 1E-6));
+	}
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	rc = zsl_mtx_ger(&ma, 0.5, &y, &x);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+/**
+ * @brief Checks the element-wise ops that have SIMD kernels on a matrix
+ *        long enough to leave a remainder after the vectorised part.
+ */
+static void
+zsl_mtx_check_elementwise_long(void)
+{
+	int rc = 0;
+	zsl_real_t x;
+
+	ZSL_MATRIX_DEF(ma, 5, 7);
+	ZSL_MATRIX_DEF(mb, 5, 7);
+	ZSL_MATRIX_DEF(mc, 5, 7);
+
+	for (size_t i = 0; i < 35; i++) {
+		ma.data[i] = 0.5 * (zsl_real_t)i - 8.0;
+		mb.data[i] = 1.0 + 0.25 * (zsl_real_t)(i % 5);
+	}
+
+	rc = zsl_mtx_add(&ma, &mb, &mc);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 35; i++) {
+		zassert_true(val_is_equal(mc.data[i], ma.data[i] + mb.data[i],
+					  1E-6));
+	}
+
+	rc = zsl_mtx_sub(&ma, &mb, &mc);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 35; i++) {
+		zassert_true(val_is_equal(mc.data[i], ma.data[i] - mb.data[i],
+					  1E-6));
+	}
+
+	rc = zsl_mtx_scalar_mult_d(&mc, -2.0);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 35; i++) {
+		x = -2.0 * (ma.data[i] - mb.data[i]);
+		zassert_true(val_is_equal(mc.data[i], x, 1E-6));
+	}
+}
+
+ZTEST(zsl_tests, test_matrix_elementwise_long)
+{
+#if (CONFIG_ZSL_PLATFORM_OPT == 3)
+	/* Run with both the SSE2 and the AVX2/FMA kernels, when available. */
+	for (int level = 1; level <= 2; level++) {
+		if (zsl_asm_x86_force_level(level) != 0) {
+			continue;
+		}
+		zsl_mtx_check_elementwise_long();
+	}
+
+	/* Return to the probed level for the remaining tests. */
+	zsl_asm_x86_force_level(0);
+#else
+	zsl_mtx_check_elementwise_long();
+#endif
+}
+
+/**
+ * @brief Checks zsl_mtx_mult on operands large enough to use the blocked
+ *        path, including the aliased case.
+ */
+static void
+zsl_mtx_check_mult_large(void)
+{
+	int rc = 0;
+	zsl_real_t x;
+
+	ZSL_MATRIX_DEF(ma, 7, 70);
+	ZSL_MATRIX_DEF(mb, 70, 6);
+	ZSL_MATRIX_DEF(mc, 7, 6);
+	ZSL_MATRIX_DEF(msq, 6, 6);
+	ZSL_MATRIX_DEF(mref, 6, 6);
+
+	/* Use small integer values so the results are exact. */
+	for (size_t i = 0; i < ma.sz_rows; i++) {
+		for (size_t k = 0; k < ma.sz_cols; k++) {
+			x = (zsl_real_t)((i + 2 * k) % 7) - 3.0;
+			zsl_mtx_set(&ma, i, k, x);
+		}
+	}
+	for (size_t k = 0; k < mb.sz_rows; k++) {
+		for (size_t j = 0; j < mb.sz_cols; j++) {
+			x = (zsl_real_t)((3 * k + j) % 5) - 2.0;
+			zsl_mtx_set(&mb, k, j, x);
+		}
+	}
+
+	rc = zsl_mtx_mult(&ma, &mb, &mc);
+	zassert_equal(rc, 0);
+
+	for (size_t i = 0; i < mc.sz_rows; i++) {
+		for (size_t j = 0; j < mc.sz_cols; j++) {
+			x = 0.0;
+			for (size_t k = 0; k < ma.sz_cols; k++) {
+				x += ma.data[i * ma.sz_cols + k] *
+				     mb.data[k * mb.sz_cols + j];
+			}
+			zassert_equal(mc.data[i * mc.sz_cols + j], x);
+		}
+	}
+
+	/* Multiply in place, with the output aliasing the second operand. */
+	zsl_mtx_init(&msq, zsl_mtx_entry_fn_identity);
+	zsl_mtx_scalar_mult_d(&msq, 2.0);
+	msq.data[5] = 1.0;
+	struct zsl_mtx mbs = {
+		.sz_rows = 6,
+		.sz_cols = 6,
+		.data = mb.data
+	};
+	zsl_mtx_mult(&msq, &mbs, &mref);
+	rc = zsl_mtx_mult(&msq, &mbs, &mbs);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 36; i++) {
+		zassert_equal(mbs.data[i], mref.data[i]);
+	}
+}
+
+ZTEST(zsl_tests, test_matrix_mult_large)
+{
+#if (CONFIG_ZSL_PLATFORM_OPT == 3)
+	/* Run with both the SSE2 and the AVX2/FMA kernels, when available. */
+	for (int level = 1; level <= 2; level++) {
+		if (zsl_asm_x86_force_level(level) != 0) {
+			continue;
+		}
+		zsl_mtx_check_mult_large();
+	}
+
+	/* Return to the probed level for the remaining tests. */
+	zsl_asm_x86_force_level(0);
+#else
+	zsl_mtx_check_mult_large();
+#endif
+}
+
 /**
  * @brief zsl_mtx_scalar_mult_d unit tests.
  *
@@ -1416,7 +2058,11 @@ ZTEST(zsl_tests, test_matrix_deter)
 	zassert_equal(rc, 0);
 
 	/* Check the output. */
-	zassert_equal(x, -509.0);
+#ifdef CONFIG_ZSL_SINGLE_PRECISION
+	zassert_true(val_is_equal(x, -509.0, 1E-2));
+#else
+	zassert_true(val_is_equal(x, -509.0, 1E-8));
+#endif
 }
 
 ZTEST(zsl_tests, test_matrix_gauss_elim)
@@ -1869,18 +2515,1307 @@ ZTEST(zsl_tests, test_matrix_inv)
 	zassert_true(zsl_mtx_is_equal(&mi, &mtst));
 }
 
-ZTEST(zsl_tests, test_matrix_cholesky)
+ZTEST(zsl_tests, test_matrix_fixed)
 {
 	int rc;
+	zsl_real_t x;
+	zsl_real_t c[16];
+	zsl_real_t w[4];
+
+	zsl_real_t a[16] = { 2.0, 1.0, 0.0, 1.0,
+			     1.0, 3.0, 1.0, 0.0,
+			     0.0, 1.0, 4.0, 1.0,
+			     1.0, 0.0, 1.0, 5.0 };
+
+	zsl_real_t b[16] = { 1.0, -1.0, 0.5, 2.0,
+			     0.0,  2.0, 1.0, -3.0,
+			     4.0,  1.0, 0.0, 1.0,
+			    -2.0,  0.5, 1.0, 0.0 };
+
+	zsl_real_t v[4] = { 1.0, -2.0, 3.0, 0.5 };
+
+	zsl_real_t s[9] = { 1.0, 2.0, 3.0,
+			    2.0, 4.0, 6.0,
+			    0.0, 1.0, 1.0 };
+
+	zsl_real_t s2[4] = { 2.0, 4.0,
+			     1.0, 2.0 };
+
+	for (size_t n = 2; n <= 4; n++) {
+		/* Products, written over the first input. */
+		memcpy(c, a, sizeof(c));
+		if (n == 2) {
+			rc = zsl_mtx22_mult(c, b, c);
+		} else if (n == 3) {
+			rc = zsl_mtx33_mult(c, b, c);
+		} else {
+			rc = zsl_mtx44_mult(c, b, c);
+		}
+		zassert_equal(rc, 0);
+		for (size_t i = 0; i < n; i++) {
+			for (size_t j = 0; j < n; j++) {
+				x = 0.0;
+				for (size_t p = 0; p < n; p++) {
+					x += a[(i * n) + p] * b[(p * n) + j];
+				}
+				zassert_true(val_is_equal(c[(i * n) + j], x,
+							  1E-6));
+			}
+		}
+
+		/* Matrix-vector products, written over the vector. */
+		memcpy(w, v, sizeof(w));
+		if (n == 2) {
+			rc = zsl_mtx22_mult_vec(a, w, w);
+		} else if (n == 3) {
+			rc = zsl_mtx33_mult_vec(a, w, w);
+		} else {
+			rc = zsl_mtx44_mult_vec(a, w, w);
+		}
+		zassert_equal(rc, 0);
+		for (size_t i = 0; i < n; i++) {
+			x = 0.0;
+			for (size_t p = 0; p < n; p++) {
+				x += a[(i * n) + p] * v[p];
+			}
+			zassert_true(val_is_equal(w[i], x, 1E-6));
+		}
+
+		/* In-place transpose. */
+		memcpy(c, b, sizeof(c));
+		if (n == 2) {
+			rc = zsl_mtx22_trans(c, c);
+		} else if (n == 3) {
+			rc = zsl_mtx33_trans(c, c);
+		} else {
+			rc = zsl_mtx44_trans(c, c);
+		}
+		zassert_equal(rc, 0);
+		for (size_t i = 0; i < n; i++) {
+			for (size_t j = 0; j < n; j++) {
+				x = b[(j * n) + i];
+				zassert_true(val_is_equal(c[(i * n) + j], x,
+							  1E-8));
+			}
+		}
+
+		/* In-place inverse, checked with a * inv(a) = I. */
+		memcpy(c, a, sizeof(c));
+		if (n == 2) {
+			rc = zsl_mtx22_inv(c, c);
+		} else if (n == 3) {
+			rc = zsl_mtx33_inv(c, c);
+		} else {
+			rc = zsl_mtx44_inv(c, c);
+		}
+		zassert_equal(rc, 0);
+		for (size_t i = 0; i < n; i++) {
+			for (size_t j = 0; j < n; j++) {
+				x = 0.0;
+				for (size_t p = 0; p < n; p++) {
+					x += a[(i * n) + p] * c[(p * n) + j];
+				}
+				zassert_true(val_is_equal(x, i == j ? 1.0 : 0.0,
+							  1E-5));
+			}
+		}
+	}
 
-	ZSL_MATRIX_DEF(mc, 7, 4);
-	ZSL_MATRIX_DEF(l, 3, 3);
-	ZSL_MATRIX_DEF(l2, 5, 3);
-
-	/* Input symmetric matrix. */
-	zsl_real_t data[9] = {   4.0,  12.0, -16.0,
-				 12.0,  37.0, -43.0,
-				 -16.0, -43.0,  98.0 };
+	/* Singular matrices are reported, and the output left untouched. */
+	memcpy(c, b, sizeof(c));
+	rc = zsl_mtx33_inv(s, c);
+	zassert_equal(rc, -ESINGULAR);
+	zassert_true(val_is_equal(c[0], b[0], 1E-8));
+	rc = zsl_mtx22_inv(s2, c);
+	zassert_equal(rc, -ESINGULAR);
+}
+
+ZTEST(zsl_tests, test_matrix_fixed_dispatch)
+{
+	int rc;
+	zsl_real_t x;
+
+	ZSL_MATRIX_DEF(mc, 3, 8);
+
+	zsl_real_t a[9] = { 1.0, -2.0, 0.5,
+			    3.0,  1.0, -1.0,
+			    0.0,  2.0, 4.0 };
+
+	zsl_real_t b[24] = {
+		-1.0, 2.0, 0.0, 1.0, 3.0, -2.0, 0.5, 1.0,
+		 1.0, 0.0, 2.0, -1.0, 1.0, 1.0, 2.0, -3.0,
+		 2.0, 1.0, -1.0, 0.0, 4.0, 0.5, 1.0, 2.0
+	};
+
+	struct zsl_mtx ma = {
+		.sz_rows = 3,
+		.sz_cols = 3,
+		.data = a
+	};
+	struct zsl_mtx mb = {
+		.sz_rows = 3,
+		.sz_cols = 8,
+		.data = b
+	};
+
+	/* Square operands whose product isn't square, or a vector, must not
+	 * reach the unrolled kernels: 3x3 * 3xN and 2x2 * 2xN with N > 4. */
+	for (size_t n = 2; n <= 3; n++) {
+		ma.sz_rows = n;
+		ma.sz_cols = n;
+		for (size_t p = 5; p <= 8; p++) {
+			mb.sz_rows = n;
+			mb.sz_cols = p;
+			mc.sz_rows = n;
+			mc.sz_cols = p;
+			rc = zsl_mtx_mult(&ma, &mb, &mc);
+			zassert_equal(rc, 0);
+			for (size_t i = 0; i < n; i++) {
+				for (size_t j = 0; j < p; j++) {
+					x = 0.0;
+					for (size_t q = 0; q < n; q++) {
+						x += a[(i * n) + q] *
+						     b[(q * p) + j];
+					}
+					zassert_true(val_is_equal(
+						mc.data[(i * p) + j], x, 1E-6));
+				}
+			}
+		}
+	}
+}
+
+/**
+ * @brief zsl_mtx_*_batched unit tests.
+ *
+ * This test verifies the batched matrix functions against their
+ * single-matrix counterparts.
+ */
+ZTEST(zsl_tests, test_matrix_batched)
+{
+	int rc;
+	zsl_real_t x;
+
+	ZSL_MATRIX_BATCH_DEF(ba, 3, 3, 5);
+	ZSL_MATRIX_BATCH_DEF(bb, 3, 3, 5);
+	ZSL_MATRIX_BATCH_DEF(bc, 3, 3, 5);
+	ZSL_MATRIX_BATCH_DEF(bn, 5, 5, 2);
+	ZSL_MATRIX_BATCH_DEF(bt, 3, 2, 5);
+	ZSL_MATRIX_BATCH_DEF(b2, 2, 2, 6);
+	ZSL_MATRIX_DEF(ma, 3, 3);
+	ZSL_MATRIX_DEF(mb, 3, 3);
+	ZSL_MATRIX_DEF(mc, 3, 3);
+	ZSL_MATRIX_DEF(mr, 3, 3);
+	ZSL_MATRIX_DEF(m5, 5, 5);
+	ZSL_MATRIX_DEF(m5i, 5, 5);
+	ZSL_MATRIX_DEF(mr5, 5, 5);
+	ZSL_MATRIX_DEF(merr, 3, 2);
+	ZSL_MATRIX_DEF(m2, 2, 2);
+	ZSL_MATRIX_DEF(m2i, 2, 2);
+
+	/* Fill each batch with distinct, well-conditioned matrices. */
+	for (size_t k = 0; k < 5; k++) {
+		for (size_t e = 0; e < 9; e++) {
+			ma.data[e] = (e % 4 == 0 ? 4.0 : 0.0) +
+				     0.5 * (zsl_real_t)((e + k) % 3) - 0.25;
+			mb.data[e] = (zsl_real_t)e - (zsl_real_t)k;
+		}
+		zassert_equal(zsl_mtx_batch_set(&ba, k, &ma), 0);
+		zassert_equal(zsl_mtx_batch_set(&bb, k, &mb), 0);
+	}
+
+	/* The element layout is interleaved across the batch. */
+	zassert_true(val_is_equal(bb.data[(4 * 5) + 2], 2.0, 1E-8));
+
+	/* Out of range and badly shaped single matrices are rejected. */
+	zassert_equal(zsl_mtx_batch_get(&ba, 5, &ma), -EINVAL);
+	zassert_equal(zsl_mtx_batch_get(&ba, 0, &merr), -EINVAL);
+
+	/* Product. */
+	rc = zsl_mtx_mult_batched(&ba, &bb, &bc);
+	zassert_equal(rc, 0);
+	for (size_t k = 0; k < 5; k++) {
+		zsl_mtx_batch_get(&ba, k, &ma);
+		zsl_mtx_batch_get(&bb, k, &mb);
+		zsl_mtx_batch_get(&bc, k, &mc);
+		zsl_mtx_mult(&ma, &mb, &mr);
+		for (size_t e = 0; e < 9; e++) {
+			zassert_true(val_is_equal(mc.data[e], mr.data[e],
+						  1E-6));
+		}
+	}
+
+	/* Sum, written over the first input. */
+	rc = zsl_mtx_add_batched(&bc, &bb, &bc);
+	zassert_equal(rc, 0);
+	for (size_t k = 0; k < 5; k++) {
+		zsl_mtx_batch_get(&ba, k, &ma);
+		zsl_mtx_batch_get(&bb, k, &mb);
+		zsl_mtx_batch_get(&bc, k, &mc);
+		zsl_mtx_mult(&ma, &mb, &mr);
+		zsl_mtx_add_d(&mr, &mb);
+		for (size_t e = 0; e < 9; e++) {
+			zassert_true(val_is_equal(mc.data[e], mr.data[e],
+						  1E-6));
+		}
+	}
+
+	/* Transpose. */
+	rc = zsl_mtx_trans_batched(&bb, &bc);
+	zassert_equal(rc, 0);
+	for (size_t k = 0; k < 5; k++) {
+		zsl_mtx_batch_get(&bb, k, &mb);
+		zsl_mtx_batch_get(&bc, k, &mc);
+		zsl_mtx_trans(&mb, &mr);
+		for (size_t e = 0; e < 9; e++) {
+			zassert_true(val_is_equal(mc.data[e], mr.data[e],
+						  1E-8));
+		}
+	}
+
+	/* In-place inverse. 'bb' holds singular matrices, which become the
+	 * identity. */
+	memcpy(bc.data, ba.data, sizeof(bc_mtxb));
+	rc = zsl_mtx_inv_batched(&bc, &bc);
+	zassert_equal(rc, 0);
+	for (size_t k = 0; k < 5; k++) {
+		zsl_mtx_batch_get(&ba, k, &ma);
+		zsl_mtx_batch_get(&bc, k, &mc);
+		zsl_mtx_inv(&ma, &mr);
+		for (size_t e = 0; e < 9; e++) {
+			zassert_true(val_is_equal(mc.data[e], mr.data[e],
+						  1E-5));
+		}
+	}
+
+	rc = zsl_mtx_inv_batched(&bb, &bc);
+	zassert_equal(rc, 0);
+	for (size_t k = 0; k < 5; k++) {
+		zsl_mtx_batch_get(&bc, k, &mc);
+		for (size_t e = 0; e < 9; e++) {
+			x = (e % 4 == 0) ? 1.0 : 0.0;
+			zassert_true(val_is_equal(mc.data[e], x, 1E-8));
+		}
+	}
+
+	/* Larger matrices fall back to zsl_mtx_inv, also in place. */
+	for (size_t k = 0; k < 2; k++) {
+		for (size_t e = 0; e < 25; e++) {
+			m5.data[e] = (e % 6 == 0 ? 5.0 : 0.0) +
+				     0.25 * (zsl_real_t)((e * (k + 1)) % 5);
+		}
+		zsl_mtx_batch_set(&bn, k, &m5);
+	}
+	rc = zsl_mtx_inv_batched(&bn, &bn);
+	zassert_equal(rc, 0);
+	for (size_t k = 0; k < 2; k++) {
+		for (size_t e = 0; e < 25; e++) {
+			m5.data[e] = (e % 6 == 0 ? 5.0 : 0.0) +
+				     0.25 * (zsl_real_t)((e * (k + 1)) % 5);
+		}
+		zsl_mtx_batch_get(&bn, k, &m5i);
+		zsl_mtx_mult(&m5, &m5i, &mr5);
+		for (size_t e = 0; e < 25; e++) {
+			x = (e % 6 == 0) ? 1.0 : 0.0;
+			zassert_true(val_is_equal(mr5.data[e], x, 1E-5));
+		}
+	}
+
+	/* 2x2 matrices, in place, across more than one block. Matrix 4 is
+	 * singular and becomes the identity. */
+	for (size_t k = 0; k < 6; k++) {
+		m2.data[0] = 1.0 + (zsl_real_t)k;
+		m2.data[1] = 2.0;
+		m2.data[2] = (k == 4) ? 2.5 : -1.0;
+		m2.data[3] = (k == 4) ? 1.0 : 0.5 * (zsl_real_t)k;
+		zsl_mtx_batch_set(&b2, k, &m2);
+	}
+	rc = zsl_mtx_inv_batched(&b2, &b2);
+	zassert_equal(rc, 0);
+	for (size_t k = 0; k < 6; k++) {
+		m2.data[0] = 1.0 + (zsl_real_t)k;
+		m2.data[1] = 2.0;
+		m2.data[2] = (k == 4) ? 2.5 : -1.0;
+		m2.data[3] = (k == 4) ? 1.0 : 0.5 * (zsl_real_t)k;
+		zsl_mtx_batch_get(&b2, k, &m2i);
+		if (k == 4) {
+			zsl_mtx_init(&m2, zsl_mtx_entry_fn_identity);
+		} else {
+			zassert_equal(zsl_mtx22_inv(m2.data, m2.data), 0);
+		}
+		for (size_t e = 0; e < 4; e++) {
+			zassert_true(val_is_equal(m2i.data[e], m2.data[e],
+						  1E-6));
+		}
+	}
+
+	/* Shape mismatches are rejected. */
+	rc = zsl_mtx_mult_batched(&ba, &bt, &bc);
+	zassert_equal(rc, -EINVAL);
+	rc = zsl_mtx_trans_batched(&ba, &bt);
+	zassert_equal(rc, -EINVAL);
+	rc = zsl_mtx_inv_batched(&bt, &bt);
+	zassert_equal(rc, -EINVAL);
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Overlapping output is rejected. */
+	rc = zsl_mtx_mult_batched(&ba, &bb, &ba);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+/**
+ * @brief zsl_mtx_band unit tests.
+ *
+ * This test verifies the banded matrix accessors, conversions and
+ * zsl_mtx_band_mult_vec.
+ */
+ZTEST(zsl_tests, test_matrix_band)
+{
+	int rc;
+	zsl_real_t x;
+
+	ZSL_MATRIX_BAND_DEF(b, 4, 5, 1, 2);
+	ZSL_MATRIX_DEF(m, 4, 5);
+	ZSL_VECTOR_DEF(w, 4);
+
+	/* One subdiagonal and two superdiagonals. */
+	zsl_real_t data[20] = { 1.0, 2.0,  3.0, 0.0, 0.0,
+				4.0, 5.0,  6.0, 7.0, 0.0,
+				0.0, 8.0,  9.0, 1.0, 2.0,
+				0.0, 0.0, -1.0, 3.0, 4.0 };
+	struct zsl_mtx md = {
+		.sz_rows = 4,
+		.sz_cols = 5,
+		.data = data
+	};
+
+	zsl_real_t dv[5] = { 1.0, -1.0, 2.0, 0.5, -2.0 };
+	struct zsl_vec v = {
+		.sz = 5,
+		.data = dv
+	};
+
+	rc = zsl_mtx_band_from_mtx(&md, &b);
+	zassert_equal(rc, 0);
+
+	/* Four values per row, with the row's subdiagonal first. */
+	zassert_true(val_is_equal(b.data[1], 1.0, 1E-6));
+	zassert_true(val_is_equal(b.data[4], 4.0, 1E-6));
+	zassert_true(val_is_equal(b.data[14], 4.0, 1E-6));
+
+	rc = zsl_mtx_band_get(&b, 2, 4, &x);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(x, 2.0, 1E-6));
+	rc = zsl_mtx_band_get(&b, 3, 0, &x);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(x, 0.0, 1E-6));
+
+	rc = zsl_mtx_band_to_mtx(&b, &m);
+	zassert_equal(rc, 0);
+	for (size_t g = 0; g < 20; g++) {
+		zassert_true(val_is_equal(m.data[g], data[g], 1E-6));
+	}
+
+	/* b * v = (5, 14.5, 6.5, -8.5). */
+	rc = zsl_mtx_band_mult_vec(&b, &v, &w);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(w.data[0], 5.0, 1E-6));
+	zassert_true(val_is_equal(w.data[1], 14.5, 1E-6));
+	zassert_true(val_is_equal(w.data[2], 6.5, 1E-6));
+	zassert_true(val_is_equal(w.data[3], -8.5, 1E-6));
+
+	rc = zsl_mtx_band_set(&b, 3, 4, 0.5);
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_band_get(&b, 3, 4, &x);
+	zassert_true(val_is_equal(x, 0.5, 1E-6));
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Values outside the band can't be set. */
+	rc = zsl_mtx_band_set(&b, 0, 3, 1.0);
+	zassert_equal(rc, -EINVAL);
+	rc = zsl_mtx_band_set(&b, 2, 0, 1.0);
+	zassert_equal(rc, -EINVAL);
+	rc = zsl_mtx_band_mult_vec(&b, &w, &w);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+/**
+ * @brief zsl_mtx_band_tridiag_solve unit tests.
+ *
+ * This test verifies the zsl_mtx_band_tridiag_solve function.
+ */
+ZTEST(zsl_tests, test_matrix_band_tridiag_solve)
+{
+	int rc;
+
+	ZSL_MATRIX_BAND_DEF(t, 5, 5, 1, 1);
+	ZSL_VECTOR_DEF(b, 5);
+	ZSL_VECTOR_DEF(x, 5);
+
+	zsl_real_t xref[5] = { 1.0, -2.0, 0.5, 3.0, 1.5 };
+	struct zsl_vec vref = {
+		.sz = 5,
+		.data = xref
+	};
+
+	/* Implicit step of the 1-D heat equation: 1 + 2r on the diagonal and
+	 * -r next to it. */
+	for (size_t i = 0; i < 5; i++) {
+		zsl_mtx_band_set(&t, i, i, 1.0 + 2.0 * 0.4);
+		if (i > 0) {
+			zsl_mtx_band_set(&t, i, i - 1, -0.4);
+		}
+		if (i < 4) {
+			zsl_mtx_band_set(&t, i, i + 1, -0.4);
+		}
+	}
+
+	rc = zsl_mtx_band_mult_vec(&t, &vref, &b);
+	zassert_equal(rc, 0);
+
+	rc = zsl_mtx_band_tridiag_solve(&t, &b, &x);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 5; i++) {
+		zassert_true(val_is_equal(x.data[i], xref[i], 1E-5));
+	}
+
+	/* Solve in place. */
+	rc = zsl_mtx_band_tridiag_solve(&t, &b, &b);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 5; i++) {
+		zassert_true(val_is_equal(b.data[i], xref[i], 1E-5));
+	}
+
+	/* A zero pivot can't be handled without pivoting. */
+	zsl_mtx_band_set(&t, 0, 0, 0.0);
+	rc = zsl_mtx_band_tridiag_solve(&t, &b, &x);
+	zassert_equal(rc, -ESINGULAR);
+}
+
+/**
+ * @brief zsl_mtx_band_lu unit tests.
+ *
+ * This test verifies the zsl_mtx_band_lu, zsl_mtx_band_lu_solve and
+ * zsl_mtx_band_solve functions.
+ */
+ZTEST(zsl_tests, test_matrix_band_lu)
+{
+	int rc;
+	size_t p[6];
+
+	ZSL_MATRIX_BAND_DEF(b, 6, 6, 2, 1);
+	ZSL_MATRIX_BAND_DEF(lu, 6, 6, 2, 3);
+	ZSL_MATRIX_BAND_DEF(lerr, 6, 6, 2, 1);
+	ZSL_MATRIX_DEF(m, 6, 6);
+	ZSL_MATRIX_DEF(md, 6, 1);
+	ZSL_MATRIX_DEF(xd, 6, 1);
+	ZSL_VECTOR_DEF(rhs, 6);
+	ZSL_VECTOR_DEF(x, 6);
+
+	/* Not diagonally dominant, with small diagonal values, so partial
+	 * pivoting is needed. */
+	zsl_real_t data[24] = { 0.0,  0.0,  0.1,  2.0,
+				0.0,  3.0,  0.2, -1.0,
+				1.0, -2.0,  0.0,  4.0,
+				5.0,  1.0,  0.3,  1.0,
+				-1.0, 2.0,  1.0, -3.0,
+				2.0,  1.0,  0.5,  0.0 };
+
+	memcpy(b.data, data, sizeof(data));
+
+	for (size_t i = 0; i < 6; i++) {
+		rhs.data[i] = (zsl_real_t)i - 2.5;
+		md.data[i] = rhs.data[i];
+	}
+
+	rc = zsl_mtx_band_lu(&b, &lu, p);
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_band_lu_solve(&lu, p, &rhs, &x);
+	zassert_equal(rc, 0);
+
+	/* Compare against the dense solver. */
+	zsl_mtx_band_to_mtx(&b, &m);
+	rc = zsl_mtx_solve(&m, &md, &xd);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 6; i++) {
+		zassert_true(val_is_equal(x.data[i], xd.data[i], 1E-5));
+	}
+
+	/* The one-shot version, solved in place. */
+	rc = zsl_mtx_band_solve(&b, &rhs, &rhs);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 6; i++) {
+		zassert_true(val_is_equal(rhs.data[i], xd.data[i], 1E-5));
+	}
+
+	/* A zero column makes the matrix singular. */
+	zsl_mtx_band_set(&b, 2, 2, 0.0);
+	zsl_mtx_band_set(&b, 3, 2, 0.0);
+	zsl_mtx_band_set(&b, 4, 2, 0.0);
+	zsl_mtx_band_set(&b, 1, 2, 0.0);
+	rc = zsl_mtx_band_solve(&b, &rhs, &x);
+	zassert_equal(rc, -ESINGULAR);
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* The output needs kl extra superdiagonals. */
+	rc = zsl_mtx_band_lu(&b, &lerr, p);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+/**
+ * @brief zsl_mtx_packed unit tests.
+ *
+ * This test verifies the packed matrix accessors, conversions and products.
+ */
+ZTEST(zsl_tests, test_matrix_packed)
+{
+	int rc;
+	zsl_real_t x;
+
+	ZSL_MATRIX_PACKED_DEF(ps, 3, ZSL_MTX_PACKED_SYM);
+	ZSL_MATRIX_PACKED_DEF(pu, 3, ZSL_MTX_PACKED_UPPER);
+	ZSL_MATRIX_PACKED_DEF(po, 2, ZSL_MTX_PACKED_SYM);
+	ZSL_MATRIX_DEF(m, 3, 3);
+	ZSL_MATRIX_DEF(mc, 3, 2);
+	ZSL_MATRIX_DEF(md, 3, 2);
+	ZSL_MATRIX_DEF(mf, 2, 3);
+	ZSL_MATRIX_DEF(mt, 3, 2);
+	ZSL_MATRIX_DEF(mo, 2, 2);
+	ZSL_VECTOR_DEF(w, 3);
+
+	zsl_real_t data[9] = { 4.0,  1.0, -2.0,
+			       1.0,  3.0,  0.5,
+			      -2.0,  0.5,  5.0 };
+	struct zsl_mtx ms = {
+		.sz_rows = 3,
+		.sz_cols = 3,
+		.data = data
+	};
+
+	zsl_real_t dv[3] = { 1.0, -1.0, 2.0 };
+	struct zsl_vec v = {
+		.sz = 3,
+		.data = dv
+	};
+
+	zsl_real_t db[6] = { 1.0, 0.0,
+			     2.0, -1.0,
+			     0.5, 3.0 };
+	struct zsl_mtx mb = {
+		.sz_rows = 3,
+		.sz_cols = 2,
+		.data = db
+	};
+
+	rc = zsl_mtx_packed_from_mtx(&ms, &ps);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(ps.data[3], -2.0, 1E-6));
+	zassert_true(val_is_equal(ps.data[5], 5.0, 1E-6));
+
+	/* Symmetric values are mirrored, triangular ones are zero. */
+	rc = zsl_mtx_packed_get(&ps, 0, 2, &x);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(x, -2.0, 1E-6));
+
+	rc = zsl_mtx_packed_from_mtx(&ms, &pu);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(pu.data[3], 3.0, 1E-6));
+	rc = zsl_mtx_packed_get(&pu, 2, 0, &x);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(x, 0.0, 1E-6));
+	rc = zsl_mtx_packed_get(&pu, 1, 2, &x);
+	zassert_true(val_is_equal(x, 0.5, 1E-6));
+
+	rc = zsl_mtx_packed_to_mtx(&ps, &m);
+	zassert_equal(rc, 0);
+	for (size_t g = 0; g < 9; g++) {
+		zassert_true(val_is_equal(m.data[g], data[g], 1E-6));
+	}
+
+	/* ps * v = (-1, -1, 7.5). */
+	rc = zsl_mtx_packed_mult_vec(&ps, &v, &w);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(w.data[0], -1.0, 1E-6));
+	zassert_true(val_is_equal(w.data[1], -1.0, 1E-6));
+	zassert_true(val_is_equal(w.data[2], 7.5, 1E-6));
+
+	/* pu * v = (-1, -2, 10). */
+	rc = zsl_mtx_packed_mult_vec(&pu, &v, &w);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(w.data[0], -1.0, 1E-6));
+	zassert_true(val_is_equal(w.data[1], -2.0, 1E-6));
+	zassert_true(val_is_equal(w.data[2], 10.0, 1E-6));
+
+	/* Packed products match the dense ones. */
+	rc = zsl_mtx_packed_mult(&ps, &mb, &mc);
+	zassert_equal(rc, 0);
+	zsl_mtx_mult(&ms, &mb, &md);
+	for (size_t g = 0; g < 6; g++) {
+		zassert_true(val_is_equal(mc.data[g], md.data[g], 1E-6));
+	}
+
+	rc = zsl_mtx_packed_mult(&pu, &mb, &mc);
+	zassert_equal(rc, 0);
+	zsl_mtx_packed_to_mtx(&pu, &m);
+	zsl_mtx_mult(&m, &mb, &md);
+	for (size_t g = 0; g < 6; g++) {
+		zassert_true(val_is_equal(mc.data[g], md.data[g], 1E-6));
+	}
+
+	/* f * ps * ft, with f = bt. */
+	zsl_mtx_trans(&mb, &mf);
+	rc = zsl_mtx_packed_congruence(&mf, &ps, &po);
+	zassert_equal(rc, 0);
+	zsl_mtx_mult(&ms, &mb, &mt);
+	zsl_mtx_mult(&mf, &mt, &mo);
+	for (size_t i = 0; i < 2; i++) {
+		for (size_t j = 0; j < 2; j++) {
+			zsl_mtx_packed_get(&po, i, j, &x);
+			zassert_true(val_is_equal(x, mo.data[(i * 2) + j],
+						  1E-6));
+		}
+	}
+
+	rc = zsl_mtx_packed_set(&ps, 0, 2, 1.5);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(ps.data[3], 1.5, 1E-6));
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* Values outside the triangle of a triangular matrix can't be set. */
+	rc = zsl_mtx_packed_set(&pu, 2, 1, 1.0);
+	zassert_equal(rc, -EINVAL);
+	rc = zsl_mtx_packed_get(&pu, 3, 1, &x);
+	zassert_equal(rc, -EINVAL);
+	rc = zsl_mtx_packed_congruence(&mf, &pu, &po);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+/**
+ * @brief zsl_mtx_packed_cholesky unit tests.
+ *
+ * This test verifies the zsl_mtx_packed_cholesky and
+ * zsl_mtx_packed_cholesky_solve functions.
+ */
+ZTEST(zsl_tests, test_matrix_packed_cholesky)
+{
+	int rc;
+
+	ZSL_MATRIX_PACKED_DEF(l, 3, ZSL_MTX_PACKED_LOWER);
+	ZSL_VECTOR_DEF(x, 3);
+	ZSL_VECTOR_DEF(r, 3);
+
+	/* Same matrix as test_matrix_cholesky. */
+	zsl_real_t data[6] = {  4.0,
+			       12.0,  37.0,
+			      -16.0, -43.0, 98.0 };
+	struct zsl_mtx_packed p = {
+		.sz = 3,
+		.type = ZSL_MTX_PACKED_SYM,
+		.data = data
+	};
+
+	zsl_real_t lref[6] = {  2.0,
+				6.0, 1.0,
+			       -8.0, 5.0, 3.0 };
+
+	zsl_real_t db[3] = { 1.0, 2.0, 3.0 };
+	struct zsl_vec b = {
+		.sz = 3,
+		.data = db
+	};
+
+	rc = zsl_mtx_packed_cholesky(&p, &l);
+	zassert_equal(rc, 0);
+	for (size_t g = 0; g < 6; g++) {
+		zassert_true(val_is_equal(l.data[g], lref[g], 1E-6));
+	}
+
+	/* p * x must give back b. */
+	rc = zsl_mtx_packed_cholesky_solve(&l, &b, &x);
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_packed_mult_vec(&p, &x, &r);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 3; i++) {
+		zassert_true(val_is_equal(r.data[i], db[i], 1E-4));
+	}
+
+	/* Decompose and solve in place. */
+	l.data = data;
+	rc = zsl_mtx_packed_cholesky(&p, &l);
+	zassert_equal(rc, 0);
+	for (size_t g = 0; g < 6; g++) {
+		zassert_true(val_is_equal(data[g], lref[g], 1E-6));
+	}
+	rc = zsl_mtx_packed_cholesky_solve(&l, &b, &b);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 3; i++) {
+		zassert_true(val_is_equal(db[i], x.data[i], 1E-6));
+	}
+
+	/* A matrix that isn't positive definite can't be decomposed. */
+	data[0] = 1.0;
+	data[1] = 2.0;
+	data[2] = 1.0;
+	rc = zsl_mtx_packed_cholesky(&p, &l);
+	zassert_equal(rc, -ESINGULAR);
+}
+
+/**
+ * @brief zsl_mtx_lu unit tests.
+ *
+ * This test verifies the zsl_mtx_lu function.
+ */
+ZTEST(zsl_tests, test_matrix_lu)
+{
+	int rc = 0;
+	size_t p[4];
+
+	ZSL_MATRIX_DEF(lu, 4, 4);
+	ZSL_MATRIX_DEF(merr, 4, 3);
+
+	/* Input matrix, with a zero in the first pivot position. */
+	zsl_real_t data[16] = { 0.0,  2.0, 1.0, 4.0,
+				1.0,  1.0, 0.0, 2.0,
+				3.0, -1.0, 2.0, 0.0,
+				2.0,  0.0, 1.0, 3.0 };
+	struct zsl_mtx m = {
+		.sz_rows = 4,
+		.sz_cols = 4,
+		.data = data
+	};
+
+	/* Expected L (below the diagonal) and U (on and above the diagonal). */
+	zsl_real_t dref[16] = { 3.0,       -1.0,       2.0,        0.0,
+				0.0,        2.0,       1.0,        4.0,
+				1.0 / 3.0,  2.0 / 3.0, -4.0 / 3.0, -2.0 / 3.0,
+				2.0 / 3.0,  1.0 / 3.0, 0.5,        2.0 };
+	size_t pref[4] = { 2, 2, 2, 3 };
+
+	rc = zsl_mtx_lu(&m, &lu, p);
+	zassert_equal(rc, 0);
+
+	for (size_t i = 0; i < 16; i++) {
+		zassert_true(val_is_equal(lu.data[i], dref[i], 1E-6));
+	}
+	for (size_t i = 0; i < 4; i++) {
+		zassert_equal(p[i], pref[i]);
+	}
+
+	/* Factorise in place. */
+	rc = zsl_mtx_lu(&m, &m, p);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 16; i++) {
+		zassert_true(val_is_equal(m.data[i], dref[i], 1E-6));
+	}
+
+	/* Non-square matrices are not accepted. */
+	rc = zsl_mtx_lu(&merr, &merr, p);
+	zassert_equal(rc, -EINVAL);
+}
+
+/**
+ * @brief zsl_mtx_lu_solve unit tests.
+ *
+ * This test verifies the zsl_mtx_lu_solve function.
+ */
+ZTEST(zsl_tests, test_matrix_lu_solve)
+{
+	int rc = 0;
+	size_t p[4];
+
+	ZSL_MATRIX_DEF(lu, 4, 4);
+	ZSL_MATRIX_DEF(x, 4, 2);
+
+	/* Input matrix. */
+	zsl_real_t data[16] = { 0.0,  2.0, 1.0, 4.0,
+				1.0,  1.0, 0.0, 2.0,
+				3.0, -1.0, 2.0, 0.0,
+				2.0,  0.0, 1.0, 3.0 };
+	struct zsl_mtx m = {
+		.sz_rows = 4,
+		.sz_cols = 4,
+		.data = data
+	};
+
+	/* Two right-hand sides, one per column. */
+	zsl_real_t data_b[8] = {  1.0,  2.0,
+				  0.0,  1.0,
+				 -1.0,  0.0,
+				  2.0, -1.0 };
+	struct zsl_mtx b = {
+		.sz_rows = 4,
+		.sz_cols = 2,
+		.data = data_b
+	};
+
+	zsl_real_t dref[8] = { -11.0 / 16.0,  5.0 / 16.0,
+			       -29.0 / 16.0, 35.0 / 16.0,
+			       -3.0 / 8.0,    5.0 / 8.0,
+			        5.0 / 4.0,   -3.0 / 4.0 };
+
+	rc = zsl_mtx_lu(&m, &lu, p);
+	zassert_equal(rc, 0);
+
+	rc = zsl_mtx_lu_solve(&lu, p, &b, &x);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 8; i++) {
+		zassert_true(val_is_equal(x.data[i], dref[i], 1E-6));
+	}
+
+	/* Solve in place. */
+	rc = zsl_mtx_lu_solve(&lu, p, &b, &b);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 8; i++) {
+		zassert_true(val_is_equal(b.data[i], dref[i], 1E-6));
+	}
+
+	/* A singular matrix has no unique solution. */
+	zsl_mtx_init(&m, NULL);
+	m.data[0] = 1.0;
+	rc = zsl_mtx_lu(&m, &lu, p);
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_lu_solve(&lu, p, &b, &x);
+	zassert_equal(rc, -ESINGULAR);
+}
+
+/**
+ * @brief zsl_mtx_lu_det unit tests.
+ *
+ * This test verifies the zsl_mtx_lu_det function.
+ */
+ZTEST(zsl_tests, test_matrix_lu_det)
+{
+	int rc = 0;
+	size_t p[4];
+	zsl_real_t d;
+
+	ZSL_MATRIX_DEF(lu, 4, 4);
+
+	/* Input matrix. */
+	zsl_real_t data[16] = { 0.0,  2.0, 1.0, 4.0,
+				1.0,  1.0, 0.0, 2.0,
+				3.0, -1.0, 2.0, 0.0,
+				2.0,  0.0, 1.0, 3.0 };
+	struct zsl_mtx m = {
+		.sz_rows = 4,
+		.sz_cols = 4,
+		.data = data
+	};
+
+	rc = zsl_mtx_lu(&m, &lu, p);
+	zassert_equal(rc, 0);
+
+	rc = zsl_mtx_lu_det(&lu, p, &d);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(d, -16.0, 1E-5));
+
+	/* Singular matrices have a zero determinant. */
+	data[12] = 2.0;
+	data[13] = 0.0;
+	data[14] = 1.0;
+	data[15] = 1.0;
+	rc = zsl_mtx_lu(&m, &lu, p);
+	zassert_equal(rc, 0);
+
+	rc = zsl_mtx_lu_det(&lu, p, &d);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(d, 0.0, 1E-5));
+}
+
+/**
+ * @brief zsl_mtx_lu_inv unit tests.
+ *
+ * This test verifies the zsl_mtx_lu_inv function.
+ */
+ZTEST(zsl_tests, test_matrix_lu_inv)
+{
+	int rc = 0;
+	size_t p[4];
+
+	ZSL_MATRIX_DEF(lu, 4, 4);
+	ZSL_MATRIX_DEF(mi, 4, 4);
+	ZSL_MATRIX_DEF(merr, 3, 3);
+
+	/* Input matrix. */
+	zsl_real_t data[16] = { 0.0,  2.0, 1.0, 4.0,
+				1.0,  1.0, 0.0, 2.0,
+				3.0, -1.0, 2.0, 0.0,
+				2.0,  0.0, 1.0, 3.0 };
+	struct zsl_mtx m = {
+		.sz_rows = 4,
+		.sz_cols = 4,
+		.data = data
+	};
+
+	zsl_real_t dref[16] = { -0.25,  0.6875, 0.1875, -0.125,
+				 0.25,  0.8125, 0.3125, -0.875,
+				 0.5,  -0.625,  0.375,  -0.25,
+				 0.0,  -0.25,  -0.25,    0.5 };
+
+	rc = zsl_mtx_lu(&m, &lu, p);
+	zassert_equal(rc, 0);
+
+	rc = zsl_mtx_lu_inv(&lu, p, &mi);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 16; i++) {
+		zassert_true(val_is_equal(mi.data[i], dref[i], 1E-6));
+	}
+
+	/* The output must have the same shape as the decomposition. */
+	rc = zsl_mtx_lu_inv(&lu, p, &merr);
+	zassert_equal(rc, -EINVAL);
+}
+
+/**
+ * @brief zsl_mtx_solve unit tests.
+ *
+ * This test verifies the zsl_mtx_solve function.
+ */
+ZTEST(zsl_tests, test_matrix_solve)
+{
+	int rc = 0;
+
+	ZSL_MATRIX_DEF(x, 4, 2);
+	ZSL_MATRIX_DEF(merr, 3, 2);
+
+	/* Input matrix. */
+	zsl_real_t data[16] = { 0.0,  2.0, 1.0, 4.0,
+				1.0,  1.0, 0.0, 2.0,
+				3.0, -1.0, 2.0, 0.0,
+				2.0,  0.0, 1.0, 3.0 };
+	struct zsl_mtx m = {
+		.sz_rows = 4,
+		.sz_cols = 4,
+		.data = data
+	};
+
+	/* Two right-hand sides, one per column. */
+	zsl_real_t data_b[8] = {  1.0,  2.0,
+				  0.0,  1.0,
+				 -1.0,  0.0,
+				  2.0, -1.0 };
+	struct zsl_mtx b = {
+		.sz_rows = 4,
+		.sz_cols = 2,
+		.data = data_b
+	};
+
+	zsl_real_t dref[8] = { -0.6875, 0.3125,
+			       -1.8125, 2.1875,
+			       -0.375,  0.625,
+				1.25,  -0.75 };
+
+	rc = zsl_mtx_solve(&m, &b, &x);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 8; i++) {
+		zassert_true(val_is_equal(x.data[i], dref[i], 1E-6));
+	}
+
+	/* The input matrix should be left untouched. */
+	zassert_equal(m.data[0], 0.0);
+	zassert_equal(m.data[8], 3.0);
+
+	/* Solve in place. */
+	rc = zsl_mtx_solve(&m, &b, &b);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 8; i++) {
+		zassert_true(val_is_equal(b.data[i], dref[i], 1E-6));
+	}
+
+	/* A singular matrix has no unique solution. */
+	data[12] = 2.0;
+	data[13] = 0.0;
+	data[14] = 1.0;
+	data[15] = 1.0;
+	data[4] = 0.0;
+	data[5] = 0.0;
+	data[6] = 0.0;
+	data[7] = 0.0;
+	rc = zsl_mtx_solve(&m, &b, &x);
+	zassert_equal(rc, -ESINGULAR);
+
+	/* The right-hand side must have as many rows as the input matrix. */
+	rc = zsl_mtx_solve(&m, &merr, &merr);
+	zassert_equal(rc, -EINVAL);
+}
+
+/**
+ * @brief zsl_mtx_solve_mixed unit tests.
+ *
+ * This test verifies the zsl_mtx_solve_mixed function.
+ */
+ZTEST(zsl_tests, test_matrix_solve_mixed)
+{
+	int rc = 0;
+
+	ZSL_MATRIX_DEF(m, 4, 4);
+	ZSL_MATRIX_DEF(b, 4, 2);
+	ZSL_MATRIX_DEF(x, 4, 2);
+	ZSL_MATRIX_DEF(merr, 3, 2);
+
+	/* The 4x4 Hilbert matrix, with a condition number of about 15000,
+	 * so a plain single-precision solve loses most of its digits. */
+	zsl_real_t xref[8] = { 1.0,  0.25,
+			       1.0, -2.0,
+			       1.0,  3.5,
+			       1.0, -1.0 };
+
+	for (size_t i = 0; i < 4; i++) {
+		for (size_t j = 0; j < 4; j++) {
+			m.data[i * 4 + j] = 1.0 / (zsl_real_t)(i + j + 1);
+		}
+		for (size_t j = 0; j < 2; j++) {
+			b.data[i * 2 + j] = 0.0;
+			for (size_t k = 0; k < 4; k++) {
+				b.data[i * 2 + j] += m.data[i * 4 + k] *
+						     xref[k * 2 + j];
+			}
+		}
+	}
+
+	rc = zsl_mtx_solve_mixed(&m, &b, &x);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 8; i++) {
+#ifdef CONFIG_ZSL_SINGLE_PRECISION
+		zassert_true(val_is_equal(x.data[i], xref[i], 1E-2));
+#else
+		zassert_true(val_is_equal(x.data[i], xref[i], 1E-10));
+#endif
+	}
+
+	/* Solve in place. */
+	zsl_mtx_copy(&x, &b);
+	rc = zsl_mtx_solve_mixed(&m, &x, &x);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 8; i++) {
+#ifdef CONFIG_ZSL_SINGLE_PRECISION
+		zassert_true(val_is_equal(x.data[i], xref[i], 1E-2));
+#else
+		zassert_true(val_is_equal(x.data[i], xref[i], 1E-10));
+#endif
+	}
+
+#ifndef CONFIG_ZSL_SINGLE_PRECISION
+	/* Values outside the range of float fall back to a double-precision
+	 * solve. */
+	zsl_mtx_scalar_mult_d(&m, 1E50);
+	zsl_mtx_scalar_mult_d(&b, 1E50);
+	rc = zsl_mtx_solve_mixed(&m, &b, &x);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 8; i++) {
+		zassert_true(val_is_equal(x.data[i], xref[i], 1E-10));
+	}
+#endif
+
+	/* A singular matrix has no unique solution. */
+	for (size_t j = 0; j < 4; j++) {
+		m.data[4 + j] = m.data[j];
+	}
+	rc = zsl_mtx_solve_mixed(&m, &b, &x);
+	zassert_equal(rc, -ESINGULAR);
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* The right-hand side must have as many rows as the input matrix. */
+	rc = zsl_mtx_solve_mixed(&m, &merr, &merr);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+/**
+ * @brief zsl_mtx_lu_rcond unit tests.
+ *
+ * This test verifies the zsl_mtx_norm_1, zsl_mtx_lu_rcond,
+ * zsl_mtx_solve_rcond and zsl_mtx_residual_rel functions.
+ */
+ZTEST(zsl_tests, test_matrix_rcond)
+{
+	int rc;
+	zsl_real_t anorm, ainorm, rcond, res;
+	size_t p[4];
+
+	ZSL_MATRIX_DEF(lu, 4, 4);
+	ZSL_MATRIX_DEF(hi, 4, 4);
+	ZSL_MATRIX_DEF(x, 4, 1);
+
+	/* The 4x4 Hilbert matrix, whose 1-norm condition number is 28375. */
+	zsl_real_t hdata[16];
+	struct zsl_mtx h = {
+		.sz_rows = 4,
+		.sz_cols = 4,
+		.data = hdata
+	};
+
+	zsl_real_t bdata[4] = { 1.0, 0.0, 0.0, 1.0 };
+	struct zsl_mtx b = {
+		.sz_rows = 4,
+		.sz_cols = 1,
+		.data = bdata
+	};
+
+	for (size_t i = 0; i < 4; i++) {
+		for (size_t j = 0; j < 4; j++) {
+			hdata[(i * 4) + j] = 1.0 / (zsl_real_t)(i + j + 1);
+		}
+	}
+
+	/* The largest column sum is the first, 1 + 1/2 + 1/3 + 1/4. */
+	rc = zsl_mtx_norm_1(&h, &anorm);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(anorm, 25.0 / 12.0, 1E-6));
+
+	/* The estimate can only be smaller than the exact norm of the
+	 * inverse, so 'rcond' is at least the exact value. */
+	rc = zsl_mtx_lu(&h, &lu, p);
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_lu_rcond(&lu, p, anorm, &rcond);
+	zassert_equal(rc, 0);
+	zsl_mtx_inv(&h, &hi);
+	zsl_mtx_norm_1(&hi, &ainorm);
+	zassert_true(val_is_equal(anorm * ainorm, 28375.0, 300.0));
+	zassert_true(rcond >= 0.95 / 28375.0);
+	zassert_true(rcond <= 3.0 / 28375.0);
+
+	/* A well-conditioned matrix. */
+	zsl_mtx_init(&lu, zsl_mtx_entry_fn_identity);
+	zsl_mtx_scalar_mult_d(&lu, 2.0);
+	for (size_t i = 0; i < 4; i++) {
+		p[i] = i;
+	}
+	rc = zsl_mtx_lu_rcond(&lu, p, 2.0, &rcond);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(rcond, 1.0, 1E-6));
+
+	/* The solution is backward stable even though 'h' is
+	 * ill-conditioned, which a wrong solution isn't. */
+	rc = zsl_mtx_solve_rcond(&h, &b, &x, &rcond);
+	zassert_equal(rc, 0);
+	zassert_true(rcond >= 0.95 / 28375.0);
+	zassert_true(rcond <= 3.0 / 28375.0);
+	rc = zsl_mtx_residual_rel(&h, &x, &b, &res);
+	zassert_equal(rc, 0);
+	zassert_true(res < 100.0 * ZSL_EPSILON);
+	x.data[0] *= 1.01;
+	rc = zsl_mtx_residual_rel(&h, &x, &b, &res);
+	zassert_equal(rc, 0);
+	zassert_true(res > 1E-4);
+
+	/* A singular matrix. */
+	for (size_t j = 0; j < 4; j++) {
+		hdata[(2 * 4) + j] = 0.0;
+	}
+	rc = zsl_mtx_solve_rcond(&h, &b, &x, &rcond);
+	zassert_equal(rc, -ESINGULAR);
+	zassert_equal(rcond, 0.0);
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	rc = zsl_mtx_residual_rel(&h, &hi, &x, &res);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+/**
+ * @brief zsl_mtx_solve_lower unit tests.
+ *
+ * This test verifies the zsl_mtx_solve_lower function.
+ */
+ZTEST(zsl_tests, test_matrix_solve_lower)
+{
+	int rc = 0;
+
+	ZSL_MATRIX_DEF(x, 3, 2);
+
+	/* Input matrix. The values above the diagonal should be ignored. */
+	zsl_real_t data[9] = {  2.0, 9.0, 9.0,
+				1.0, 3.0, 9.0,
+			       -1.0, 2.0, 4.0 };
+	struct zsl_mtx l = {
+		.sz_rows = 3,
+		.sz_cols = 3,
+		.data = data
+	};
+
+	zsl_real_t data_b[6] = { 2.0,  4.0,
+				 7.0,  5.0,
+				 9.0, -2.0 };
+	struct zsl_mtx b = {
+		.sz_rows = 3,
+		.sz_cols = 2,
+		.data = data_b
+	};
+
+	zsl_real_t dref[6] = { 1.0,  2.0,
+			       2.0,  1.0,
+			       1.5, -0.5 };
+
+	rc = zsl_mtx_solve_lower(&l, &b, &x);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 6; i++) {
+		zassert_true(val_is_equal(x.data[i], dref[i], 1E-6));
+	}
+
+	/* A zero on the diagonal makes the system singular. */
+	data[4] = 0.0;
+	rc = zsl_mtx_solve_lower(&l, &b, &b);
+	zassert_equal(rc, -ESINGULAR);
+}
+
+/**
+ * @brief zsl_mtx_solve_upper unit tests.
+ *
+ * This test verifies the zsl_mtx_solve_upper function.
+ */
+ZTEST(zsl_tests, test_matrix_solve_upper)
+{
+	int rc = 0;
+
+	/* Input matrix. The values below the diagonal should be ignored. */
+	zsl_real_t data[9] = { 2.0, 1.0, -1.0,
+			       9.0, 3.0,  2.0,
+			       9.0, 9.0,  4.0 };
+	struct zsl_mtx u = {
+		.sz_rows = 3,
+		.sz_cols = 3,
+		.data = data
+	};
+
+	zsl_real_t data_b[3] = { 1.0, 7.0, 8.0 };
+	struct zsl_mtx b = {
+		.sz_rows = 3,
+		.sz_cols = 1,
+		.data = data_b
+	};
+
+	zsl_real_t dref[3] = { 1.0, 1.0, 2.0 };
+
+	/* Solve in place. */
+	rc = zsl_mtx_solve_upper(&u, &b, &b);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 3; i++) {
+		zassert_true(val_is_equal(b.data[i], dref[i], 1E-6));
+	}
+
+	/* A zero on the diagonal makes the system singular. */
+	data[0] = 0.0;
+	rc = zsl_mtx_solve_upper(&u, &b, &b);
+	zassert_equal(rc, -ESINGULAR);
+}
+
+ZTEST(zsl_tests, test_matrix_cholesky)
+{
+	int rc;
+
+	ZSL_MATRIX_DEF(mc, 7, 4);
+	ZSL_MATRIX_DEF(l, 3, 3);
+	ZSL_MATRIX_DEF(l2, 5, 3);
+
+	/* Input symmetric matrix. */
+	zsl_real_t data[9] = {   4.0,  12.0, -16.0,
+				 12.0,  37.0, -43.0,
+				 -16.0, -43.0,  98.0 };
 
 	struct zsl_mtx ma = {
 		.sz_rows = 3,
@@ -1934,6 +3869,132 @@ ZTEST(zsl_tests, test_matrix_cholesky)
 	zassert_equal(rc, -EINVAL);
 }
 
+/**
+ * @brief zsl_mtx_cholesky_solve unit tests.
+ *
+ * This test verifies the zsl_mtx_cholesky_solve function.
+ */
+ZTEST(zsl_tests, test_matrix_cholesky_solve)
+{
+	int rc;
+
+	ZSL_MATRIX_DEF(x, 3, 1);
+	ZSL_MATRIX_DEF(merr, 2, 1);
+
+	/* Cholesky factor of {{4, 12, -16}, {12, 37, -43}, {-16, -43, 98}}. */
+	zsl_real_t data[9] = {  2.0, 0.0, 0.0,
+				6.0, 1.0, 0.0,
+			       -8.0, 5.0, 3.0 };
+	struct zsl_mtx l = {
+		.sz_rows = 3,
+		.sz_cols = 3,
+		.data = data
+	};
+
+	zsl_real_t data_b[3] = { -40.0, -111.0, 223.0 };
+	struct zsl_mtx b = {
+		.sz_rows = 3,
+		.sz_cols = 1,
+		.data = data_b
+	};
+
+	zsl_real_t dref[3] = { 1.0, -1.0, 2.0 };
+
+	rc = zsl_mtx_cholesky_solve(&l, &b, &x);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 3; i++) {
+		zassert_true(val_is_equal(x.data[i], dref[i], 1E-5));
+	}
+
+	/* Solve in place. */
+	rc = zsl_mtx_cholesky_solve(&l, &b, &b);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 3; i++) {
+		zassert_true(val_is_equal(b.data[i], dref[i], 1E-5));
+	}
+
+	rc = zsl_mtx_cholesky_solve(&l, &merr, &merr);
+	zassert_equal(rc, -EINVAL);
+}
+
+/**
+ * @brief zsl_mtx_cholesky_update and zsl_mtx_cholesky_downdate unit tests.
+ *
+ * This test verifies the zsl_mtx_cholesky_update and
+ * zsl_mtx_cholesky_downdate functions.
+ */
+ZTEST(zsl_tests, test_matrix_cholesky_update)
+{
+	int rc;
+
+	ZSL_MATRIX_DEF(l, 3, 3);
+	ZSL_MATRIX_DEF(lref, 3, 3);
+	ZSL_VECTOR_DEF(verr, 4);
+
+	/* Input symmetric matrix, and the same matrix plus v * vt. */
+	zsl_real_t data[9] = {   4.0,  12.0, -16.0,
+				12.0,  37.0, -43.0,
+			       -16.0, -43.0,  98.0 };
+	zsl_real_t datu[9] = {   5.0,  14.0, -13.0,
+				14.0,  41.0, -37.0,
+			       -13.0, -37.0, 107.0 };
+	struct zsl_mtx ma = {
+		.sz_rows = 3,
+		.sz_cols = 3,
+		.data = data
+	};
+	struct zsl_mtx mu = {
+		.sz_rows = 3,
+		.sz_cols = 3,
+		.data = datu
+	};
+
+	zsl_real_t datv[3] = { 1.0, 2.0, 3.0 };
+	struct zsl_vec v = {
+		.sz = 3,
+		.data = datv
+	};
+
+	/* Update the factor of 'ma', and compare it to the factor of 'mu'. */
+	rc = zsl_mtx_cholesky(&ma, &l);
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_cholesky_update(&l, &v);
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_cholesky(&mu, &lref);
+	zassert_equal(rc, 0);
+	for (size_t g = 0; g < 9; g++) {
+		zassert_true(val_is_equal(l.data[g], lref.data[g], 1E-5));
+	}
+
+	/* 'v' should be left untouched. */
+	zassert_equal(v.data[0], 1.0);
+	zassert_equal(v.data[2], 3.0);
+
+	/* Downdating should restore the factor of 'ma'. */
+	rc = zsl_mtx_cholesky_downdate(&l, &v);
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_cholesky(&ma, &lref);
+	zassert_equal(rc, 0);
+	for (size_t g = 0; g < 9; g++) {
+		zassert_true(val_is_equal(l.data[g], lref.data[g], 1E-5));
+	}
+
+	/* ma - v * vt isn't positive definite if v = (3, 0, 0), and 'l'
+	 * should be left unmodified. */
+	v.data[0] = 3.0;
+	v.data[1] = 0.0;
+	v.data[2] = 0.0;
+	rc = zsl_mtx_cholesky_downdate(&l, &v);
+	zassert_equal(rc, -ESINGULAR);
+	for (size_t g = 0; g < 9; g++) {
+		zassert_true(val_is_equal(l.data[g], lref.data[g], 1E-5));
+	}
+
+	/* The size of 'v' must match 'l'. */
+	rc = zsl_mtx_cholesky_update(&l, &verr);
+	zassert_equal(rc, -EINVAL);
+}
+
 ZTEST(zsl_tests, test_matrix_balance)
 {
 	int rc;
@@ -2232,6 +4293,296 @@ ZTEST(zsl_tests, test_matrix_qrd_hess)
 	}
 }
 
+/**
+ * @brief zsl_mtx_qrd_ws unit tests.
+ *
+ * This test verifies the zsl_mtx_qrd_ws function on a 30x30 matrix, using
+ * a statically allocated workspace.
+ */
+ZTEST(zsl_tests, test_matrix_qrd_ws)
+{
+	int rc;
+	zsl_real_t x;
+	static zsl_real_t buf[30];
+	struct zsl_workspace ws;
+
+	ZSL_MATRIX_DEF(m, 30, 30);
+	ZSL_MATRIX_DEF(q, 30, 30);
+	ZSL_MATRIX_DEF(r, 30, 30);
+	ZSL_MATRIX_DEF(qr, 30, 30);
+
+	zassert_equal(zsl_mtx_qrd_ws_size(30, 30), sizeof(buf));
+
+	for (size_t i = 0; i < 30; i++) {
+		for (size_t j = 0; j < 30; j++) {
+			x = (zsl_real_t)(((i * 7) + (j * 3)) % 11) - 5.0;
+			if (i == j) {
+				x += 10.0;
+			}
+			zsl_mtx_set(&m, i, j, x);
+		}
+	}
+
+	/* A workspace one element short should be rejected. */
+	rc = zsl_ws_init(&ws, buf, sizeof(buf) - sizeof(zsl_real_t));
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_qrd_ws(&m, &q, &r, false, &ws);
+	zassert_equal(rc, -ENOMEM);
+
+	rc = zsl_ws_init(&ws, buf, sizeof(buf));
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_qrd_ws(&m, &q, &r, false, &ws);
+	zassert_equal(rc, 0);
+	zassert_equal(ws.used, 0);
+
+	/* 'r' should be upper triangular, and q * r should be 'm'. */
+	for (size_t i = 1; i < 30; i++) {
+		for (size_t j = 0; j < i; j++) {
+			zsl_mtx_get(&r, i, j, &x);
+#ifdef CONFIG_ZSL_SINGLE_PRECISION
+			zassert_true(val_is_equal(x, 0.0, 1E-3));
+#else
+			zassert_true(val_is_equal(x, 0.0, 1E-10));
+#endif
+		}
+	}
+
+	rc = zsl_mtx_mult(&q, &r, &qr);
+	zassert_equal(rc, 0);
+	for (size_t g = 0; g < (30 * 30); g++) {
+#ifdef CONFIG_ZSL_SINGLE_PRECISION
+		zassert_true(val_is_equal(qr.data[g], m.data[g], 1E-3));
+#else
+		zassert_true(val_is_equal(qr.data[g], m.data[g], 1E-10));
+#endif
+	}
+}
+
+ZTEST(zsl_tests, test_matrix_qr)
+{
+	int rc;
+	zsl_real_t x;
+
+	ZSL_MATRIX_DEF(qr, 4, 2);
+	ZSL_VECTOR_DEF(tau, 2);
+	ZSL_MATRIX_DEF(q, 4, 4);
+	ZSL_MATRIX_DEF(r, 4, 2);
+	ZSL_MATRIX_DEF(xs, 2, 1);
+
+	/* Fit a line to (1, 6), (2, 5), (3, 7) and (4, 10). */
+	zsl_real_t data[8] = { 1.0, 1.0,
+			       1.0, 2.0,
+			       1.0, 3.0,
+			       1.0, 4.0 };
+
+	struct zsl_mtx m = {
+		.sz_rows = 4,
+		.sz_cols = 2,
+		.data = data
+	};
+
+	zsl_real_t datb[4] = { 6.0, 5.0, 7.0, 10.0 };
+
+	struct zsl_mtx b = {
+		.sz_rows = 4,
+		.sz_cols = 1,
+		.data = datb
+	};
+
+	rc = zsl_mtx_qr(&m, &qr, &tau);
+	zassert_equal(rc, 0);
+
+	/* The first reflector maps (1, 1, 1, 1) to (2, 0, 0, 0). */
+	zassert_true(val_is_equal(qr.data[0], 2.0, 1E-6));
+	zassert_true(val_is_equal(tau.data[0], 0.5, 1E-6));
+
+	/* Least-squares solution, y = 3.5 + 1.4 * x. */
+	rc = zsl_mtx_qr_solve(&qr, &tau, &b, &xs);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(xs.data[0], 3.5, 1E-5));
+	zassert_true(val_is_equal(xs.data[1], 1.4, 1E-5));
+
+	/* Applying Q to the identity matrix gives an orthogonal Q, and
+	 * applying Q to R gives back 'm'. */
+	zsl_mtx_init(&q, zsl_mtx_entry_fn_identity);
+	rc = zsl_mtx_qr_apply_q(&qr, &tau, false, &q);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 4; i++) {
+		for (size_t j = 0; j < 4; j++) {
+			x = 0.0;
+			for (size_t k = 0; k < 4; k++) {
+				x += q.data[(k * 4) + i] * q.data[(k * 4) + j];
+			}
+			zassert_true(val_is_equal(x, i == j ? 1.0 : 0.0, 1E-6));
+		}
+	}
+
+	zsl_mtx_init(&r, NULL);
+	for (size_t i = 0; i < 2; i++) {
+		for (size_t j = i; j < 2; j++) {
+			r.data[(i * 2) + j] = qr.data[(i * 2) + j];
+		}
+	}
+	rc = zsl_mtx_qr_apply_q(&qr, &tau, false, &r);
+	zassert_equal(rc, 0);
+	for (size_t g = 0; g < 8; g++) {
+		zassert_true(val_is_equal(r.data[g], data[g], 1E-6));
+	}
+
+	/* And Q transposed undoes it. */
+	rc = zsl_mtx_qr_apply_q(&qr, &tau, true, &r);
+	zassert_equal(rc, 0);
+	for (size_t i = 1; i < 4; i++) {
+		zassert_true(val_is_equal(r.data[i * 2], 0.0, 1E-6));
+	}
+	zassert_true(val_is_equal(r.data[0], 2.0, 1E-6));
+
+	/* 'm' can also be factorised in place. */
+	rc = zsl_mtx_qr(&m, &m, &tau);
+	zassert_equal(rc, 0);
+	for (size_t g = 0; g < 8; g++) {
+		zassert_true(val_is_equal(m.data[g], qr.data[g], 1E-12));
+	}
+}
+
+/**
+ * @brief zsl_mtx_lstsq_mixed unit tests.
+ *
+ * This test verifies the zsl_mtx_lstsq_mixed function.
+ */
+ZTEST(zsl_tests, test_matrix_lstsq_mixed)
+{
+	int rc;
+
+	ZSL_MATRIX_DEF(xs, 2, 1);
+	ZSL_MATRIX_DEF(xq, 3, 1);
+
+	/* Fit a line to (1, 6), (2, 5), (3, 7) and (4, 10). */
+	zsl_real_t data[8] = { 1.0, 1.0,
+			       1.0, 2.0,
+			       1.0, 3.0,
+			       1.0, 4.0 };
+
+	struct zsl_mtx m = {
+		.sz_rows = 4,
+		.sz_cols = 2,
+		.data = data
+	};
+
+	zsl_real_t datb[4] = { 6.0, 5.0, 7.0, 10.0 };
+
+	struct zsl_mtx b = {
+		.sz_rows = 4,
+		.sz_cols = 1,
+		.data = datb
+	};
+
+	/* Least-squares solution, y = 3.5 + 1.4 * x. */
+	rc = zsl_mtx_lstsq_mixed(&m, &b, &xs);
+	zassert_equal(rc, 0);
+#ifdef CONFIG_ZSL_SINGLE_PRECISION
+	zassert_true(val_is_equal(xs.data[0], 3.5, 1E-5));
+	zassert_true(val_is_equal(xs.data[1], 1.4, 1E-5));
+#else
+	zassert_true(val_is_equal(xs.data[0], 3.5, 1E-12));
+	zassert_true(val_is_equal(xs.data[1], 1.4, 1E-12));
+#endif
+
+	/* Fit a quadratic to samples lying exactly on y = 0.1 - 0.3x + 0.7x^2,
+	 * over a range where the Vandermonde matrix is poorly conditioned. */
+	zsl_real_t datv[18];
+	zsl_real_t daty[6];
+
+	struct zsl_mtx v = {
+		.sz_rows = 6,
+		.sz_cols = 3,
+		.data = datv
+	};
+
+	struct zsl_mtx y = {
+		.sz_rows = 6,
+		.sz_cols = 1,
+		.data = daty
+	};
+
+	for (size_t i = 0; i < 6; i++) {
+		zsl_real_t t = 10.0 + 0.5 * (zsl_real_t)i;
+
+		datv[i * 3] = 1.0;
+		datv[i * 3 + 1] = t;
+		datv[i * 3 + 2] = t * t;
+		daty[i] = 0.1 - 0.3 * t + 0.7 * t * t;
+	}
+
+	rc = zsl_mtx_lstsq_mixed(&v, &y, &xq);
+	zassert_equal(rc, 0);
+#ifdef CONFIG_ZSL_SINGLE_PRECISION
+	zassert_true(val_is_equal(xq.data[2], 0.7, 1E-2));
+#else
+	zassert_true(val_is_equal(xq.data[0], 0.1, 1E-8));
+	zassert_true(val_is_equal(xq.data[1], -0.3, 1E-9));
+	zassert_true(val_is_equal(xq.data[2], 0.7, 1E-10));
+#endif
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* 'a' can't have more columns than rows. */
+	rc = zsl_mtx_lstsq_mixed(&xs, &xs, &xs);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+/**
+ * @brief zsl_mtx_qr_rcond unit tests.
+ *
+ * This test verifies the zsl_mtx_qr_rcond function.
+ */
+ZTEST(zsl_tests, test_matrix_qr_rcond)
+{
+	int rc;
+	zsl_real_t rcond;
+
+	ZSL_MATRIX_DEF(qr, 3, 2);
+	ZSL_VECTOR_DEF(tau, 2);
+
+	/* Orthogonal columns give a diagonal R, here with entries of
+	 * magnitude sqrt(3) and sqrt(6). */
+	zsl_real_t data[6] = { 1.0,  1.0,
+			       1.0, -2.0,
+			       1.0,  1.0 };
+	struct zsl_mtx m = {
+		.sz_rows = 3,
+		.sz_cols = 2,
+		.data = data
+	};
+
+	rc = zsl_mtx_qr(&m, &qr, &tau);
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_qr_rcond(&qr, &rcond);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(rcond, ZSL_SQRT(3.0 / 6.0), 1E-5));
+
+	/* Nearly parallel columns. */
+	data[1] = 1.0;
+	data[3] = 1.0;
+	data[5] = 1.001;
+	rc = zsl_mtx_qr(&m, &qr, &tau);
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_qr_rcond(&qr, &rcond);
+	zassert_equal(rc, 0);
+	zassert_true(rcond > 0.0);
+	zassert_true(rcond < 1E-2);
+
+	/* A zero column makes R singular. */
+	data[1] = 0.0;
+	data[3] = 0.0;
+	data[5] = 0.0;
+	rc = zsl_mtx_qr(&m, &qr, &tau);
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_qr_rcond(&qr, &rcond);
+	zassert_equal(rc, 0);
+	zassert_equal(rcond, 0.0);
+}
+
 #ifndef CONFIG_ZSL_SINGLE_PRECISION
 ZTEST(zsl_tests_double, test_matrix_qrd_iter)
 {
@@ -2341,30 +4692,112 @@ ZTEST(zsl_tests_double, test_matrix_eigenvalues)
 	vc2.data[3] = -0.9244614420638188;
 
 
-	/* Init the output vectors. */
-	rc = zsl_vec_init(&va);
-	zassert_equal(rc, 0);
-	rc = zsl_vec_init(&vb);
-	zassert_equal(rc, 0);
-	rc = zsl_vec_init(&vc);
+	/* Init the output vectors. */
+	rc = zsl_vec_init(&va);
+	zassert_equal(rc, 0);
+	rc = zsl_vec_init(&vb);
+	zassert_equal(rc, 0);
+	rc = zsl_vec_init(&vc);
+	zassert_equal(rc, 0);
+
+	/* Calculate the eigenvalues of 'ma', 'mb' and 'mc'. */
+	rc = zsl_mtx_eigenvalues(&ma, &va, 150);
+	zassert_equal(rc, 0);
+
+	rc = zsl_mtx_eigenvalues(&mb, &vb, 150);
+	zassert_equal(rc, -ECOMPLEXVAL);
+
+	rc = zsl_mtx_eigenvalues(&mc, &vc, 150);
+	zassert_equal(rc, 0);
+
+	/* Check the output. */
+	zassert_true(zsl_vec_is_equal(&va, &va2, 1E-6));
+	zassert_true(zsl_vec_is_equal(&vb, &vb2, 1E-6));
+	zassert_true(zsl_vec_is_equal(&vc, &vc2, 1E-6));
+}
+#endif
+
+ZTEST(zsl_tests, test_matrix_eigenvalues_cplx)
+{
+	int rc;
+
+	ZSL_VECTOR_DEF(re, 3);
+	ZSL_VECTOR_DEF(im, 3);
+	ZSL_VECTOR_DEF(re2, 4);
+	ZSL_VECTOR_DEF(im2, 4);
+	ZSL_VECTOR_DEF(v, 4);
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_eigenvalues_ws_size(3));
+
+#ifdef CONFIG_ZSL_SINGLE_PRECISION
+	zsl_real_t eps = 1E-4;
+#else
+	zsl_real_t eps = 1E-9;
+#endif
+
+	/* Companion matrix of (x - 3)(x^2 - 2x + 5), roots 3 and 1 +/- 2i. */
+	zsl_real_t data[9] = { 5.0, -11.0, 15.0,
+			       1.0, 0.0, 0.0,
+			       0.0, 1.0, 0.0 };
+
+	struct zsl_mtx ma = {
+		.sz_rows = 3,
+		.sz_cols = 3,
+		.data = data
+	};
+
+	/* Companion matrix of (x - 2)(x + 4)(x^2 - 2x + 2), roots -4, 2 and
+	 * 1 +/- i. */
+	zsl_real_t datb[16] = { 0.0, 10.0, -20.0, 16.0,
+				1.0, 0.0, 0.0, 0.0,
+				0.0, 1.0, 0.0, 0.0,
+				0.0, 0.0, 1.0, 0.0 };
+
+	struct zsl_mtx mb = {
+		.sz_rows = 4,
+		.sz_cols = 4,
+		.data = datb
+	};
+
+	rc = zsl_mtx_eigenvalues_cplx(&ma, &re, &im, 0);
 	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(re.data[0], 3.0, eps));
+	zassert_true(val_is_equal(im.data[0], 0.0, eps));
+	zassert_true(val_is_equal(re.data[1], 1.0, eps));
+	zassert_true(val_is_equal(im.data[1], 2.0, eps));
+	zassert_true(val_is_equal(re.data[2], 1.0, eps));
+	zassert_true(val_is_equal(im.data[2], -2.0, eps));
 
-	/* Calculate the eigenvalues of 'ma', 'mb' and 'mc'. */
-	rc = zsl_mtx_eigenvalues(&ma, &va, 150);
+	rc = zsl_mtx_eigenvalues_cplx(&mb, &re2, &im2, 0);
 	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(re2.data[0], -4.0, eps));
+	zassert_true(val_is_equal(im2.data[0], 0.0, eps));
+	zassert_true(val_is_equal(re2.data[1], 2.0, eps));
+	zassert_true(val_is_equal(im2.data[1], 0.0, eps));
+	zassert_true(val_is_equal(re2.data[2], 1.0, eps));
+	zassert_true(val_is_equal(im2.data[2], 1.0, eps));
+	zassert_true(val_is_equal(re2.data[3], 1.0, eps));
+	zassert_true(val_is_equal(im2.data[3], -1.0, eps));
 
-	rc = zsl_mtx_eigenvalues(&mb, &vb, 150);
+	/* Only the real eigenvalues are returned by 'zsl_mtx_eigenvalues'. */
+	rc = zsl_mtx_eigenvalues(&mb, &v, 0);
 	zassert_equal(rc, -ECOMPLEXVAL);
-
-	rc = zsl_mtx_eigenvalues(&mc, &vc, 150);
-	zassert_equal(rc, 0);
-
-	/* Check the output. */
-	zassert_true(zsl_vec_is_equal(&va, &va2, 1E-6));
-	zassert_true(zsl_vec_is_equal(&vb, &vb2, 1E-6));
-	zassert_true(zsl_vec_is_equal(&vc, &vc2, 1E-6));
+	zassert_equal(v.sz, 2);
+	zassert_true(val_is_equal(v.data[0], -4.0, eps));
+	zassert_true(val_is_equal(v.data[1], 2.0, eps));
+
+	/* The workspace variant gives the same result, and fails cleanly
+	 * when the workspace is too small. */
+	zsl_vec_init(&re);
+	zsl_vec_init(&im);
+	rc = zsl_mtx_eigenvalues_cplx_ws(&ma, &re, &im, 0, &ws);
+	zassert_equal(rc, 0);
+	zassert_equal(ws.used, 0);
+	zassert_true(val_is_equal(im.data[1], 2.0, eps));
+
+	ws.sz--;
+	rc = zsl_mtx_eigenvalues_cplx_ws(&ma, &re, &im, 0, &ws);
+	zassert_equal(rc, -ENOMEM);
 }
-#endif
 
 #ifndef CONFIG_ZSL_SINGLE_PRECISION
 ZTEST(zsl_tests_double, test_matrix_eigenvectors)
@@ -2464,8 +4897,10 @@ ZTEST(zsl_tests_double, test_matrix_eigenvectors)
 			    2.4608606125, -0.0000000055,
 			    1.0000000000, 1.0000000000 };
 
+	/* The eigenvectors follow the eigenvalues, largest first, so the
+	 * one for 3 comes before the one for 1. */
 	zsl_real_t c[8] = { 1.0, 1.0,
-			    0.0, 1.0,
+			    1.0, 0.0,
 			    0.0, 0.0,
 			    0.0, 0.0 };
 
@@ -2520,8 +4955,8 @@ ZTEST(zsl_tests_double, test_matrix_eigenvectors)
 			     0.7695023535, -0.0000000045,
 			     0.3126964402, 0.8164965782 };
 
-	zsl_real_t c2[8] = { 1.0, 0.7071067812,
-			     0.0, 0.7071067812,
+	zsl_real_t c2[8] = { 0.7071067812, 1.0,
+			     0.7071067812, 0.0,
 			     0.0, 0.0,
 			     0.0, 0.0 };
 
@@ -2554,6 +4989,246 @@ ZTEST(zsl_tests_double, test_matrix_eigenvectors)
 }
 #endif
 
+ZTEST(zsl_tests, test_matrix_eigen_sym)
+{
+	int rc;
+	zsl_real_t x;
+
+	ZSL_VECTOR_DEF(va, 4);
+	ZSL_MATRIX_DEF(meva, 4, 4);
+	ZSL_VECTOR_DEF(vb, 6);
+	ZSL_MATRIX_DEF(mevb, 6, 6);
+	ZSL_MATRIX_DEF(mb, 6, 6);
+	ZSL_MATRIX_DEF(mvt, 6, 6);
+
+#ifdef CONFIG_ZSL_SINGLE_PRECISION
+	zsl_real_t eps = 1E-4;
+#else
+	zsl_real_t eps = 1E-9;
+#endif
+
+	/* Symmetric matrix from 'test_matrix_eigenvalues'. */
+	zsl_real_t data[16] = { 1.0, 2.0, 4.0, 0.0,
+				2.0, 3.0, 4.0, -2.0,
+				4.0, 4.0, -3.0, 5.0,
+				0.0, -2.0, 5.0, -1.0 };
+
+	struct zsl_mtx ma = {
+		.sz_rows = 4,
+		.sz_cols = 4,
+		.data = data
+	};
+
+	zsl_real_t va2[4] = { -9.2890349032381003, 7.4199113544017665,
+			      2.7935849909013921, -0.9244614420638188 };
+
+	rc = zsl_mtx_eigen_sym(&ma, &va, &meva);
+	zassert_equal(rc, 0);
+
+	for (size_t i = 0; i < 4; i++) {
+		zassert_true(val_is_equal(va.data[i], va2[i], eps * 10));
+
+		/* Check that m * v = lambda * v for every column. */
+		for (size_t r = 0; r < 4; r++) {
+			x = 0.0;
+			for (size_t k = 0; k < 4; k++) {
+				x += data[(r * 4) + k] * meva.data[(k * 4) + i];
+			}
+			zassert_true(val_is_equal(x,
+				va.data[i] * meva.data[(r * 4) + i], eps * 10));
+		}
+	}
+
+	/* The 6x6 matrix I + ones has eigenvalues 7 and 1 (five times), and
+	 * goes through the tridiagonal QL path. */
+	zsl_mtx_init(&mb, zsl_mtx_entry_fn_identity);
+	for (size_t i = 0; i < 36; i++) {
+		mb.data[i] += 1.0;
+	}
+
+	rc = zsl_mtx_eigen_sym(&mb, &vb, &mevb);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(vb.data[0], 7.0, eps));
+	for (size_t i = 1; i < 6; i++) {
+		zassert_true(val_is_equal(vb.data[i], 1.0, eps));
+	}
+
+	/* The eigenvector of 7 is the normalised ones vector. */
+	for (size_t i = 0; i < 6; i++) {
+		zassert_true(val_is_equal(mevb.data[i * 6],
+					  1.0 / ZSL_SQRT(6.0), eps));
+	}
+
+	/* The eigenvectors should be orthonormal. */
+	zsl_mtx_trans(&mevb, &mvt);
+	zsl_mtx_mult(&mvt, &mevb, &mb);
+	for (size_t i = 0; i < 6; i++) {
+		for (size_t j = 0; j < 6; j++) {
+			zassert_true(val_is_equal(mb.data[(i * 6) + j],
+						  i == j ? 1.0 : 0.0, eps));
+		}
+	}
+
+	/* The input can be overwritten by the eigenvectors. */
+	zsl_mtx_init(&mb, zsl_mtx_entry_fn_identity);
+	for (size_t i = 0; i < 36; i++) {
+		mb.data[i] += 1.0;
+	}
+	rc = zsl_mtx_eigen_sym(&mb, &vb, &mb);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(vb.data[0], 7.0, eps));
+	for (size_t i = 0; i < 36; i++) {
+		zassert_true(val_is_equal(mb.data[i], mevb.data[i], eps));
+	}
+}
+
+/* Samples of three channels, used as a window for test_matrix_eigen_topk. */
+static zsl_real_t topk_x[8 * 3] = {
+	 1.0,  0.5, -0.2,
+	 2.0,  1.1,  0.1,
+	-1.0, -0.4,  0.3,
+	 0.5,  0.2, -0.5,
+	-2.0, -1.0,  0.2,
+	 1.5,  0.9,  0.4,
+	-0.5, -0.3, -0.1,
+	-1.5, -0.6,  0.0
+};
+
+/**
+ * @brief Multiplies 'x' by xt * x, where x is the 8x3 window in 'arg', without
+ *        forming the covariance matrix.
+ */
+static int topk_cov_fn(void *arg, struct zsl_vec *x, struct zsl_vec *y)
+{
+	zsl_real_t *w = arg;
+	zsl_real_t s;
+
+	zsl_vec_init(y);
+	for (size_t i = 0; i < 8; i++) {
+		s = 0.0;
+		for (size_t j = 0; j < 3; j++) {
+			s += w[(i * 3) + j] * x->data[j];
+		}
+		for (size_t j = 0; j < 3; j++) {
+			y->data[j] += w[(i * 3) + j] * s;
+		}
+	}
+
+	return 0;
+}
+
+static int topk_fail_fn(void *arg, struct zsl_vec *x, struct zsl_vec *y)
+{
+	return -EDOM;
+}
+
+/**
+ * @brief zsl_mtx_eigen_topk unit tests.
+ *
+ * This test verifies the zsl_mtx_eigen_topk, zsl_mtx_eigen_topk_ws and
+ * zsl_mtx_eigen_topk_fn functions.
+ */
+ZTEST(zsl_tests, test_matrix_eigen_topk)
+{
+	int rc;
+	zsl_real_t t, ref, e;
+#ifdef CONFIG_ZSL_SINGLE_PRECISION
+	zsl_real_t eps = 1E-2;
+#else
+	zsl_real_t eps = 1E-6;
+#endif
+
+	ZSL_MATRIX_DEF(m, 6, 6);
+	ZSL_MATRIX_DEF(mev, 6, 2);
+	ZSL_VECTOR_DEF(v, 2);
+	ZSL_MATRIX_DEF(c, 3, 3);
+	ZSL_MATRIX_DEF(cev, 3, 2);
+	ZSL_MATRIX_DEF(cev2, 3, 2);
+	ZSL_MATRIX_DEF(cfull, 3, 3);
+	ZSL_VECTOR_DEF(cv, 2);
+	ZSL_VECTOR_DEF(cv2, 2);
+	ZSL_VECTOR_DEF(cvfull, 3);
+	ZSL_VECTOR_DEF(v7, 7);
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_eigen_topk_ws_size(3, 2));
+
+	struct zsl_mtx x = {
+		.sz_rows = 8,
+		.sz_cols = 3,
+		.data = topk_x
+	};
+
+	/* The 1D Laplacian, tridiag(-1, 2, -1), with eigenvalues
+	 * 2 - 2 * cos(j * pi / 7) and eigenvectors sin(i * j * pi / 7). */
+	zsl_mtx_init(&m, NULL);
+	for (size_t i = 0; i < 6; i++) {
+		m.data[(i * 6) + i] = 2.0;
+		if (i > 0) {
+			m.data[(i * 6) + i - 1] = -1.0;
+			m.data[((i - 1) * 6) + i] = -1.0;
+		}
+	}
+
+	rc = zsl_mtx_eigen_topk(&m, &v, &mev, 0);
+	zassert_equal(rc, 0);
+	for (size_t j = 0; j < 2; j++) {
+		t = (zsl_real_t)(6 - j) * ZSL_PI / 7.0;
+		zassert_true(val_is_equal(v.data[j], 2.0 - 2.0 * ZSL_COS(t),
+					  1E-5));
+		for (size_t i = 0; i < 6; i++) {
+			ref = ZSL_SIN((zsl_real_t)(i + 1) * t) / ZSL_SQRT(3.5);
+			e = mev.data[(i * 2) + j];
+			zassert_true(val_is_equal(ZSL_ABS(e), ZSL_ABS(ref),
+						  1E-3));
+		}
+	}
+
+	/* The covariance matrix applied through a callback gives the same
+	 * eigenpairs as the full decomposition. The second eigenvalue is much
+	 * smaller than the first, so single precision only gets its
+	 * eigenvector to about 1E-2. */
+	zsl_mtx_syrk(&x, true, 1.0, 0.0, &c);
+	rc = zsl_mtx_eigen_sym(&c, &cvfull, &cfull);
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_eigen_topk_fn(topk_cov_fn, topk_x, &cv, &cev, 0, &ws);
+	zassert_equal(rc, 0);
+	zassert_equal(ws.used, 0);
+	rc = zsl_mtx_eigen_topk_ws(&c, &cv2, &cev2, 0, &ws);
+	zassert_equal(rc, 0);
+	for (size_t j = 0; j < 2; j++) {
+		zassert_true(val_is_equal(cv.data[j], cvfull.data[j], 1E-4));
+		zassert_true(val_is_equal(cv2.data[j], cvfull.data[j], 1E-4));
+		for (size_t i = 0; i < 3; i++) {
+			zassert_true(val_is_equal(cev.data[(i * 2) + j],
+						  cfull.data[(i * 3) + j],
+						  eps));
+			zassert_true(val_is_equal(cev2.data[(i * 2) + j],
+						  cfull.data[(i * 3) + j],
+						  eps));
+		}
+	}
+
+	/* Errors from the callback are returned. */
+	rc = zsl_mtx_eigen_topk_fn(topk_fail_fn, NULL, &cv, &cev, 0, &ws);
+	zassert_equal(rc, -EDOM);
+	zassert_equal(ws.used, 0);
+
+	/* A single step isn't enough to converge. */
+	rc = zsl_mtx_eigen_topk(&m, &v, &mev, 1);
+	zassert_equal(rc, -ECONVERGE);
+
+	/* A workspace one element short should be rejected. */
+	ws.sz--;
+	rc = zsl_mtx_eigen_topk_ws(&c, &cv, &cev, 0, &ws);
+	zassert_equal(rc, -ENOMEM);
+	ws.sz++;
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* No more eigenpairs than rows. */
+	rc = zsl_mtx_eigen_topk(&m, &v7, &mev, 0);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
 #ifndef CONFIG_ZSL_SINGLE_PRECISION
 ZTEST(zsl_tests_double, test_matrix_svd)
 {
@@ -2626,6 +5301,103 @@ ZTEST(zsl_tests_double, test_matrix_svd)
 }
 #endif
 
+ZTEST(zsl_tests, test_matrix_svd_thin)
+{
+	int rc;
+	zsl_real_t x;
+
+	ZSL_MATRIX_DEF(u, 3, 3);
+	ZSL_VECTOR_DEF(s, 3);
+	ZSL_MATRIX_DEF(v, 4, 3);
+	ZSL_MATRIX_DEF(ub, 4, 2);
+	ZSL_VECTOR_DEF(sb, 2);
+	ZSL_MATRIX_DEF(vb, 2, 2);
+
+#ifdef CONFIG_ZSL_SINGLE_PRECISION
+	zsl_real_t eps = 1E-4;
+#else
+	zsl_real_t eps = 1E-8;
+#endif
+
+	/* Input matrix, the same as in 'test_matrix_svd'. */
+	zsl_real_t data[12] = { 1.0, 2.0, -1.0, 0.0,
+				0.0, 3.0, 4.0, -2.0,
+				4.0, 4.0, -3.0, 0.0 };
+
+	struct zsl_mtx m = {
+		.sz_rows = 3,
+		.sz_cols = 4,
+		.data = data
+	};
+
+	/* Rank one 4x2 matrix. */
+	zsl_real_t datb[8] = { 1.0, 2.0,
+			       2.0, 4.0,
+			       -1.0, -2.0,
+			       3.0, 6.0 };
+
+	struct zsl_mtx mb = {
+		.sz_rows = 4,
+		.sz_cols = 2,
+		.data = datb
+	};
+
+	/* Expected output, the first three columns of the full SVD. */
+	zsl_real_t a[9] = { -0.3481845133, -0.0474852763, 0.9362225661,
+			    -0.0396196056, -0.9970784021, -0.0653065614,
+			    -0.9365884003, 0.0598315021, -0.3452859102 };
+
+	zsl_real_t b[3] = { 6.8246886030, 5.3940011894, 0.5730415692 };
+
+	zsl_real_t c[12] = { -0.5999596982, 0.0355655710, -0.7764202435,
+			     -0.6683940777, -0.5277862667, 0.5154631408,
+			     0.4395030259, -0.7638713255, -0.2819884104,
+			     0.0116106706, 0.3696989923, 0.2279295777 };
+
+	rc = zsl_mtx_svd_thin(&m, &u, &s, &v, 0);
+	zassert_equal(rc, 0);
+
+	for (size_t g = 0; g < 9; g++) {
+		zassert_true(val_is_equal(u.data[g], a[g], eps));
+	}
+	for (size_t g = 0; g < 3; g++) {
+		zassert_true(val_is_equal(s.data[g], b[g], eps));
+	}
+	for (size_t g = 0; g < 12; g++) {
+		zassert_true(val_is_equal(v.data[g], c[g], eps));
+	}
+
+	/* A rank deficient matrix still gets orthonormal columns in 'u'. */
+	rc = zsl_mtx_svd_thin(&mb, &ub, &sb, &vb, 0);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(sb.data[0], ZSL_SQRT(75.0), eps));
+	zassert_true(val_is_equal(sb.data[1], 0.0, eps));
+
+	for (size_t i = 0; i < 2; i++) {
+		for (size_t j = 0; j < 2; j++) {
+			x = 0.0;
+			for (size_t k = 0; k < 4; k++) {
+				x += ub.data[(k * 2) + i] *
+				     ub.data[(k * 2) + j];
+			}
+			zassert_true(val_is_equal(x, i == j ? 1.0 : 0.0, eps));
+		}
+	}
+
+	/* And u * diag(s) * vt gives back the input. */
+	for (size_t i = 0; i < 4; i++) {
+		for (size_t j = 0; j < 2; j++) {
+			x = 0.0;
+			for (size_t k = 0; k < 2; k++) {
+				x += ub.data[(i * 2) + k] * sb.data[k] *
+				     vb.data[(j * 2) + k];
+			}
+			zassert_true(val_is_equal(x, datb[(i * 2) + j],
+						  eps * 10));
+		}
+	}
+}
+
 #ifndef CONFIG_ZSL_SINGLE_PRECISION
 ZTEST(zsl_tests_double, test_matrix_pinv)
 {
@@ -2672,6 +5444,302 @@ ZTEST(zsl_tests_double, test_matrix_pinv)
 }
 #endif
 
+#ifndef CONFIG_ZSL_SINGLE_PRECISION
+/**
+ * @brief zsl_mtx_pinv_ws unit tests.
+ *
+ * This test verifies the zsl_mtx_pinv_ws and zsl_mtx_svd_ws functions.
+ */
+ZTEST(zsl_tests_double, test_matrix_pinv_ws)
+{
+	int rc;
+	size_t sz = zsl_mtx_pinv_ws_size(3, 4);
+
+	ZSL_MATRIX_DEF(pinv, 4, 3);
+	ZSL_MATRIX_DEF(pinv2, 4, 3);
+	ZSL_MATRIX_DEF(u, 3, 3);
+	ZSL_MATRIX_DEF(e, 3, 4);
+	ZSL_MATRIX_DEF(v, 4, 4);
+	ZSL_MATRIX_DEF(u2, 3, 3);
+	ZSL_MATRIX_DEF(e2, 3, 4);
+	ZSL_MATRIX_DEF(v2, 4, 4);
+	ZSL_WORKSPACE_DEF(ws, sz);
+
+	/* Input  matrix. */
+	zsl_real_t data[12] = { 1.0, 2.0, -1.0, 0.0,
+				0.0, 3.0, 4.0, -2.0,
+				4.0, 4.0, -3.0, 0.0 };
+
+	struct zsl_mtx m = {
+		.sz_rows = 3,
+		.sz_cols = 4,
+		.data = data
+	};
+
+	/* The SVD of 'm' needs less memory than its pseudo-inverse. */
+	zassert_true(zsl_mtx_svd_ws_size(3, 4) < sz);
+
+	/* A workspace one element short should be rejected. */
+	ws.sz--;
+	rc = zsl_mtx_pinv_ws(&m, &pinv, 1500, &ws);
+	zassert_equal(rc, -ENOMEM);
+	ws.sz++;
+
+	/* The results should match the stack-based functions. */
+	rc = zsl_mtx_pinv_ws(&m, &pinv, 1500, &ws);
+	zassert_equal(rc, 0);
+	zassert_equal(ws.used, 0);
+	rc = zsl_mtx_pinv(&m, &pinv2, 1500);
+	zassert_equal(rc, 0);
+	zassert_true(zsl_mtx_is_equal(&pinv, &pinv2));
+
+	zsl_mtx_init(&u, NULL);
+	zsl_mtx_init(&u2, NULL);
+	rc = zsl_mtx_svd_ws(&m, &u, &e, &v, 1500, &ws);
+	zassert_equal(rc, 0);
+	zassert_equal(ws.used, 0);
+	rc = zsl_mtx_svd(&m, &u2, &e2, &v2, 1500);
+	zassert_equal(rc, 0);
+	zassert_true(zsl_mtx_is_equal(&u, &u2));
+	zassert_true(zsl_mtx_is_equal(&e, &e2));
+	zassert_true(zsl_mtx_is_equal(&v, &v2));
+}
+#endif
+
+/**
+ * @brief zsl_mtx_rank unit tests.
+ *
+ * This test verifies the zsl_mtx_rank and zsl_mtx_rank_ws functions.
+ */
+ZTEST(zsl_tests, test_matrix_rank)
+{
+	int rc;
+	size_t rank;
+
+	ZSL_MATRIX_DEF(z, 2, 3);
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_rank_ws_size(3, 4));
+
+	/* The last row is the sum of the first two. */
+	zsl_real_t data[12] = { 1.0, 2.0, -1.0, 0.0,
+				0.0, 3.0,  4.0, -2.0,
+				1.0, 5.0,  3.0, -2.0 };
+	struct zsl_mtx m = {
+		.sz_rows = 3,
+		.sz_cols = 4,
+		.data = data
+	};
+
+	rc = zsl_mtx_rank(&m, 0.0, &rank);
+	zassert_equal(rc, 0);
+	zassert_equal(rank, 2);
+
+	/* A small change makes it full rank. */
+	data[8] = 1.0 + 1E-3;
+	rc = zsl_mtx_rank_ws(&m, 0.0, &rank, &ws);
+	zassert_equal(rc, 0);
+	zassert_equal(ws.used, 0);
+	zassert_equal(rank, 3);
+
+	/* Unless the tolerance is raised above the smallest singular value. */
+	rc = zsl_mtx_rank_ws(&m, 1E-2, &rank, &ws);
+	zassert_equal(rc, 0);
+	zassert_equal(rank, 2);
+
+	zsl_mtx_init(&z, NULL);
+	rc = zsl_mtx_rank(&z, 0.0, &rank);
+	zassert_equal(rc, 0);
+	zassert_equal(rank, 0);
+
+	/* A workspace one element short should be rejected. */
+	ws.sz--;
+	rc = zsl_mtx_rank_ws(&m, 0.0, &rank, &ws);
+	zassert_equal(rc, -ENOMEM);
+	ws.sz++;
+}
+
+/**
+ * @brief zsl_mtx_exp unit tests.
+ *
+ * This test verifies the zsl_mtx_exp and zsl_mtx_exp_ws functions.
+ */
+ZTEST(zsl_tests, test_matrix_exp)
+{
+	int rc;
+	zsl_real_t e = ZSL_EXP(1.0);
+
+	ZSL_MATRIX_DEF(me, 3, 3);
+	ZSL_MATRIX_DEF(mr, 2, 2);
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_exp_ws_size(3));
+
+	zsl_real_t dg[9] = { 1.0,  0.0, 0.0,
+			     0.0, -2.0, 0.0,
+			     0.0,  0.0, 0.5 };
+	struct zsl_mtx md = {
+		.sz_rows = 3,
+		.sz_cols = 3,
+		.data = dg
+	};
+
+	/* I + N, with N nilpotent, so e^(I + N) = e * (I + N + N^2 / 2). Its
+	 * norm is large enough to need scaling and squaring. */
+	zsl_real_t nn[9] = { 1.0, 4.0, 0.0,
+			     0.0, 1.0, 5.0,
+			     0.0, 0.0, 1.0 };
+	zsl_real_t nn_ref[9] = { 1.0, 4.0, 10.0,
+				 0.0, 1.0,  5.0,
+				 0.0, 0.0,  1.0 };
+	struct zsl_mtx mn = {
+		.sz_rows = 3,
+		.sz_cols = 3,
+		.data = nn
+	};
+
+	/* The generator of a rotation by 2.5 radians. */
+	zsl_real_t rot[4] = { 0.0, -2.5,
+			      2.5,  0.0 };
+	struct zsl_mtx mrot = {
+		.sz_rows = 2,
+		.sz_cols = 2,
+		.data = rot
+	};
+
+	rc = zsl_mtx_exp(&md, &me);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(me.data[0], e, 1E-5));
+	zassert_true(val_is_equal(me.data[4], ZSL_EXP(-2.0), 1E-6));
+	zassert_true(val_is_equal(me.data[8], ZSL_EXP(0.5), 1E-6));
+	zassert_true(val_is_equal(me.data[1], 0.0, 1E-6));
+	zassert_true(val_is_equal(me.data[5], 0.0, 1E-6));
+
+	rc = zsl_mtx_exp(&mrot, &mr);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(mr.data[0], ZSL_COS(2.5), 1E-5));
+	zassert_true(val_is_equal(mr.data[1], -ZSL_SIN(2.5), 1E-5));
+	zassert_true(val_is_equal(mr.data[2], ZSL_SIN(2.5), 1E-5));
+	zassert_true(val_is_equal(mr.data[3], ZSL_COS(2.5), 1E-5));
+
+	/* In place, from a workspace, which is left empty afterwards. */
+	rc = zsl_mtx_exp_ws(&mn, &mn, &ws);
+	zassert_equal(rc, 0);
+	zassert_equal(ws.used, 0);
+	for (size_t g = 0; g < 9; g++) {
+		zassert_true(val_is_equal(nn[g], e * nn_ref[g], 1E-4));
+	}
+
+	/* A workspace one element short should be rejected. */
+	ws.sz--;
+	rc = zsl_mtx_exp_ws(&md, &me, &ws);
+	zassert_equal(rc, -ENOMEM);
+	ws.sz++;
+
+	/* So should non-finite inputs. */
+	dg[4] = NAN;
+	rc = zsl_mtx_exp_ws(&md, &me, &ws);
+	zassert_equal(rc, -EINVAL);
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	rc = zsl_mtx_exp(&md, &mr);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+/**
+ * @brief zsl_mtx_discretize unit tests.
+ *
+ * This test verifies the zsl_mtx_discretize and zsl_mtx_discretize_ws
+ * functions.
+ */
+ZTEST(zsl_tests, test_matrix_discretize)
+{
+	int rc;
+	zsl_real_t dt = 0.5;
+
+	ZSL_MATRIX_DEF(ad, 2, 2);
+	ZSL_MATRIX_DEF(bd, 2, 1);
+	ZSL_MATRIX_DEF(qd, 2, 2);
+	ZSL_MATRIX_DEF(ad1, 1, 1);
+	ZSL_MATRIX_DEF(qd1, 1, 1);
+	ZSL_WORKSPACE_DEF(ws, zsl_mtx_discretize_ws_size(2, 1));
+
+	/* A double integrator, driven by an acceleration input and by white
+	 * noise of density 2 on the acceleration. */
+	zsl_real_t a_data[4] = { 0.0, 1.0,
+				 0.0, 0.0 };
+	zsl_real_t b_data[2] = { 0.0, 1.0 };
+	zsl_real_t q_data[4] = { 0.0, 0.0,
+				 0.0, 2.0 };
+	struct zsl_mtx a = {
+		.sz_rows = 2,
+		.sz_cols = 2,
+		.data = a_data
+	};
+	struct zsl_mtx b = {
+		.sz_rows = 2,
+		.sz_cols = 1,
+		.data = b_data
+	};
+	struct zsl_mtx q = {
+		.sz_rows = 2,
+		.sz_cols = 2,
+		.data = q_data
+	};
+
+	/* A first-order lag, dx/dt = -x + w. */
+	zsl_real_t a1_data[1] = { -1.0 };
+	zsl_real_t q1_data[1] = { 2.0 };
+	struct zsl_mtx a1 = {
+		.sz_rows = 1,
+		.sz_cols = 1,
+		.data = a1_data
+	};
+	struct zsl_mtx q1 = {
+		.sz_rows = 1,
+		.sz_cols = 1,
+		.data = q1_data
+	};
+
+	/* Ad = [1 dt; 0 1], Bd = [dt^2 / 2; dt] and
+	 * Qd = 2 * [dt^3 / 3, dt^2 / 2; dt^2 / 2, dt]. */
+	rc = zsl_mtx_discretize_ws(&a, &b, &q, dt, &ad, &bd, &qd, &ws);
+	zassert_equal(rc, 0);
+	zassert_equal(ws.used, 0);
+	zassert_true(val_is_equal(ad.data[0], 1.0, 1E-6));
+	zassert_true(val_is_equal(ad.data[1], dt, 1E-6));
+	zassert_true(val_is_equal(ad.data[2], 0.0, 1E-6));
+	zassert_true(val_is_equal(ad.data[3], 1.0, 1E-6));
+	zassert_true(val_is_equal(bd.data[0], dt * dt / 2.0, 1E-6));
+	zassert_true(val_is_equal(bd.data[1], dt, 1E-6));
+	zassert_true(val_is_equal(qd.data[0], 2.0 * dt * dt * dt / 3.0, 1E-6));
+	zassert_true(val_is_equal(qd.data[1], dt * dt, 1E-6));
+	zassert_true(val_is_equal(qd.data[2], dt * dt, 1E-6));
+	zassert_true(val_is_equal(qd.data[3], 2.0 * dt, 1E-6));
+
+	/* Without 'q', only Ad and Bd are computed. */
+	zsl_mtx_init(&ad, NULL);
+	rc = zsl_mtx_discretize(&a, &b, NULL, dt, &ad, &bd, NULL);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(ad.data[1], dt, 1E-6));
+	zassert_true(val_is_equal(bd.data[0], dt * dt / 2.0, 1E-6));
+
+	/* Without 'b', Ad comes from the Van Loan matrix: Ad = e^-dt and
+	 * Qd = 1 - e^(-2 dt). */
+	rc = zsl_mtx_discretize(&a1, NULL, &q1, dt, &ad1, NULL, &qd1);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(ad1.data[0], ZSL_EXP(-dt), 1E-6));
+	zassert_true(val_is_equal(qd1.data[0], 1.0 - ZSL_EXP(-2.0 * dt),
+				  1E-6));
+
+	/* 'b' and 'bd' must be given together. */
+	rc = zsl_mtx_discretize(&a, &b, NULL, dt, &ad, NULL, NULL);
+	zassert_equal(rc, -EINVAL);
+
+	/* A workspace one element short should be rejected. */
+	ws.sz--;
+	rc = zsl_mtx_discretize_ws(&a, &b, &q, dt, &ad, &bd, &qd, &ws);
+	zassert_equal(rc, -ENOMEM);
+	ws.sz++;
+}
+
 ZTEST(zsl_tests, test_matrix_min)
 {
 	int rc = 0;
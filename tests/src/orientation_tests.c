@@ -979,6 +979,38 @@ ZTEST(zsl_tests, test_quat_to_rot_mtx)
 	}
 }
 
+ZTEST(zsl_tests, test_quat_to_rot_mtx_batched)
+{
+	int rc = 0;
+	struct zsl_quat q[3] = {
+		{ .r = 1.0, .i = 0.0, .j = 0.0, .k = 0.0 },
+		{ .r = 0.5443311, .i = 0.4082483,
+		  .j = 0.6804138, .k = 0.2721655 },
+		{ .r = 0.7071068, .i = 0.0, .j = 0.0, .k = 0.7071068 },
+	};
+
+	ZSL_MATRIX_BATCH_DEF(rots, 3, 3, 3);
+	ZSL_MATRIX_BATCH_DEF(berr, 2, 2, 3);
+	ZSL_MATRIX_DEF(rot, 3, 3);
+	ZSL_MATRIX_DEF(cmp, 3, 3);
+
+	/* Make sure inappropriately size matrices fail. */
+	rc = zsl_quat_to_rot_mtx_batched(q, &berr);
+	zassert_true(rc == -EINVAL);
+
+	/* Each matrix in the batch must match the single conversion. */
+	rc = zsl_quat_to_rot_mtx_batched(q, &rots);
+	zassert_true(rc == 0);
+	for (size_t k = 0; k < 3; k++) {
+		zsl_mtx_batch_get(&rots, k, &rot);
+		zsl_quat_to_rot_mtx(&q[k], &cmp);
+		for (int i = 0; i < 9; i++) {
+			zassert_true(val_is_equal(rot.data[i], cmp.data[i],
+						  1E-6));
+		}
+	}
+}
+
 ZTEST(zsl_tests, test_quat_from_rot_mtx)
 {
 	int rc = 0;
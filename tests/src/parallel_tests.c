@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Kevin Townsend
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zsl/zsl.h>
+#include <zsl/matrices.h>
+#include <zsl/parallel.h>
+#include "floatcheck.h"
+
+#define PAR_TEST_N 1000
+
+static unsigned char par_test_hits[PAR_TEST_N];
+
+static int par_test_mark(void *arg, size_t start, size_t end)
+{
+	unsigned char *hits = arg;
+
+	for (size_t i = start; i < end; i++) {
+		hits[i]++;
+	}
+
+	return 0;
+}
+
+static int par_test_fail(void *arg, size_t start, size_t end)
+{
+	size_t *bad = arg;
+
+	return (*bad >= start && *bad < end) ? -EDOM : 0;
+}
+
+ZTEST(zsl_tests, test_par_for)
+{
+	int rc;
+	size_t bad;
+
+	/* Every index is visited exactly once, whether or not the range is
+	 * split. */
+	for (size_t ops = 0; ops < 2; ops++) {
+		memset(par_test_hits, 0, sizeof(par_test_hits));
+		rc = zsl_par_for(PAR_TEST_N, ops ? SIZE_MAX : 0,
+				 par_test_mark, par_test_hits);
+		zassert_equal(rc, 0);
+		for (size_t i = 0; i < PAR_TEST_N; i++) {
+			zassert_equal(par_test_hits[i], 1);
+		}
+	}
+
+	/* Errors from any chunk are returned. */
+	bad = 0;
+	rc = zsl_par_for(PAR_TEST_N, SIZE_MAX, par_test_fail, &bad);
+	zassert_equal(rc, -EDOM);
+	bad = PAR_TEST_N - 1;
+	rc = zsl_par_for(PAR_TEST_N, SIZE_MAX, par_test_fail, &bad);
+	zassert_equal(rc, -EDOM);
+	bad = PAR_TEST_N;
+	rc = zsl_par_for(PAR_TEST_N, SIZE_MAX, par_test_fail, &bad);
+	zassert_equal(rc, 0);
+}
+
+/* Large enough to be split with the default CONFIG_ZSL_PARALLEL_MIN_OPS. */
+static zsl_real_t par_test_a[45 * 38];
+static zsl_real_t par_test_b[38 * 41];
+static zsl_real_t par_test_c[45 * 41];
+
+ZTEST(zsl_tests, test_par_matrix_mult)
+{
+	int rc;
+	zsl_real_t sum;
+
+	struct zsl_mtx ma = {
+		.sz_rows = 45,
+		.sz_cols = 38,
+		.data = par_test_a
+	};
+	struct zsl_mtx mb = {
+		.sz_rows = 38,
+		.sz_cols = 41,
+		.data = par_test_b
+	};
+	struct zsl_mtx mc = {
+		.sz_rows = 45,
+		.sz_cols = 41,
+		.data = par_test_c
+	};
+
+	for (size_t g = 0; g < 45 * 38; g++) {
+		par_test_a[g] = (zsl_real_t)((g * 7) % 13) - 6.0;
+	}
+	for (size_t g = 0; g < 38 * 41; g++) {
+		par_test_b[g] = (zsl_real_t)((g * 5) % 11) * 0.25 - 1.0;
+	}
+
+	/* Compare every element with a plain dot product. */
+	rc = zsl_mtx_mult(&ma, &mb, &mc);
+	zassert_equal(rc, 0);
+	for (size_t i = 0; i < 45; i++) {
+		for (size_t j = 0; j < 41; j++) {
+			sum = 0.0;
+			for (size_t k = 0; k < 38; k++) {
+				sum += par_test_a[i * 38 + k] *
+				       par_test_b[k * 41 + j];
+			}
+			zassert_true(val_is_equal(par_test_c[i * 41 + j], sum,
+						  1E-4));
+		}
+	}
+
+	/* Element-wise operations cover every element. */
+	rc = zsl_mtx_scalar_mult_d(&mc, 2.0);
+	zassert_equal(rc, 0);
+	rc = zsl_mtx_sub_d(&mc, &mc);
+	zassert_equal(rc, 0);
+	for (size_t g = 0; g < 45 * 41; g++) {
+		zassert_true(val_is_equal(par_test_c[g], 0.0, 1E-6));
+	}
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 Kevin Townsend
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zsl/zsl.h>
+#include <zsl/matrices.h>
+#include <zsl/vectors.h>
+#include <zsl/sparse.h>
+#include "floatcheck.h"
+
+ZTEST(zsl_tests, test_spmtx_from_coo)
+{
+	int rc;
+	zsl_real_t x;
+
+	ZSL_SPMATRIX_DEF(s, 4, 4, 12);
+	ZSL_MATRIX_DEF(m, 4, 4);
+
+	/* Laplacian of the path graph 0-1-2-3, assembled edge by edge in no
+	 * particular order, so the diagonal entries are given twice. */
+	size_t rows[12] = { 1, 1, 2, 1, 2, 2, 3, 3, 2, 0, 0, 1 };
+	size_t cols[12] = { 1, 2, 1, 1, 2, 3, 2, 3, 2, 1, 0, 0 };
+	zsl_real_t vals[12] = {
+		1.0, -1.0, -1.0, 1.0, 1.0, -1.0, -1.0, 1.0, 1.0, -1.0, 1.0, -1.0
+	};
+
+	zsl_real_t ref[16] = {  1.0, -1.0,  0.0,  0.0,
+			       -1.0,  2.0, -1.0,  0.0,
+				0.0, -1.0,  2.0, -1.0,
+				0.0,  0.0, -1.0,  1.0 };
+
+	rc = zsl_spmtx_from_coo(&s, rows, cols, vals, 12);
+	zassert_equal(rc, 0);
+	zassert_equal(s.nnz, 10);
+
+	/* Rows are sorted by column, with the duplicates merged. */
+	zassert_equal(s.row_ptr[1], 2);
+	zassert_equal(s.row_ptr[2], 5);
+	zassert_equal(s.col_idx[2], 0);
+	zassert_equal(s.col_idx[3], 1);
+	zassert_equal(s.col_idx[4], 2);
+	zassert_true(val_is_equal(s.data[3], 2.0, 1E-6));
+
+	rc = zsl_spmtx_to_mtx(&s, &m);
+	zassert_equal(rc, 0);
+	for (size_t g = 0; g < 16; g++) {
+		zassert_true(val_is_equal(m.data[g], ref[g], 1E-6));
+	}
+
+	rc = zsl_spmtx_get(&s, 2, 1, &x);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(x, -1.0, 1E-6));
+	rc = zsl_spmtx_get(&s, 3, 0, &x);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(x, 0.0, 1E-6));
+
+	/* Converting back from dense gives the same structure. */
+	rc = zsl_spmtx_from_mtx(&m, &s);
+	zassert_equal(rc, 0);
+	zassert_equal(s.nnz, 10);
+	zassert_equal(s.row_ptr[4], 10);
+	zassert_equal(s.col_idx[9], 3);
+
+	/* Out of bounds indices and too many entries are rejected. */
+	rows[0] = 4;
+	rc = zsl_spmtx_from_coo(&s, rows, cols, vals, 12);
+	zassert_equal(rc, -EINVAL);
+	zassert_equal(s.nnz, 0);
+	rc = zsl_spmtx_from_coo(&s, rows, cols, vals, 13);
+	zassert_equal(rc, -ENOMEM);
+
+	m.data[3] = 5.0;
+	m.data[12] = 5.0;
+	m.data[6] = 0.0;
+	rc = zsl_spmtx_from_mtx(&m, &s);
+	zassert_equal(rc, 0);
+	zassert_equal(s.nnz, 11);
+	m.data[2] = 5.0;
+	m.data[8] = 5.0;
+	rc = zsl_spmtx_from_mtx(&m, &s);
+	zassert_equal(rc, -ENOMEM);
+	zassert_equal(s.nnz, 0);
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	rc = zsl_spmtx_get(&s, 4, 0, &x);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+ZTEST(zsl_tests, test_spmtx_mult_vec)
+{
+	int rc;
+
+	ZSL_SPMATRIX_DEF(s, 3, 4, 6);
+	ZSL_VECTOR_DEF(w3, 3);
+	ZSL_VECTOR_DEF(w4, 4);
+
+	zsl_real_t data[12] = { 1.0, 0.0,  0.0, 2.0,
+				0.0, 3.0,  0.0, 0.0,
+				4.0, 0.0, -1.0, 5.0 };
+	struct zsl_mtx m = {
+		.sz_rows = 3,
+		.sz_cols = 4,
+		.data = data
+	};
+
+	zsl_real_t a4[4] = { 1.0, -2.0, 3.0, 0.5 };
+	struct zsl_vec v4 = {
+		.sz = 4,
+		.data = a4
+	};
+
+	zsl_real_t a3[3] = { 2.0, 1.0, -1.0 };
+	struct zsl_vec v3 = {
+		.sz = 3,
+		.data = a3
+	};
+
+	rc = zsl_spmtx_from_mtx(&m, &s);
+	zassert_equal(rc, 0);
+	zassert_equal(s.nnz, 6);
+
+	/* s * v4 = (2, -6, 3.5). */
+	rc = zsl_spmtx_mult_vec(&s, &v4, &w3);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(w3.data[0], 2.0, 1E-6));
+	zassert_true(val_is_equal(w3.data[1], -6.0, 1E-6));
+	zassert_true(val_is_equal(w3.data[2], 3.5, 1E-6));
+
+	/* st * v3 = (-2, 3, 1, -1). */
+	rc = zsl_spmtx_mult_vec_trans(&s, &v3, &w4);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(w4.data[0], -2.0, 1E-6));
+	zassert_true(val_is_equal(w4.data[1], 3.0, 1E-6));
+	zassert_true(val_is_equal(w4.data[2], 1.0, 1E-6));
+	zassert_true(val_is_equal(w4.data[3], -1.0, 1E-6));
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	rc = zsl_spmtx_mult_vec(&s, &v3, &w3);
+	zassert_equal(rc, -EINVAL);
+	rc = zsl_spmtx_mult_vec_trans(&s, &v4, &w4);
+	zassert_equal(rc, -EINVAL);
+#endif
+}
+
+ZTEST(zsl_tests, test_spmtx_solve)
+{
+	int rc;
+
+	ZSL_SPMATRIX_DEF(l, 4, 4, 8);
+	ZSL_SPMATRIX_DEF(u, 4, 4, 8);
+	ZSL_VECTOR_DEF(x, 4);
+
+	/* Lower triangular matrix, and its transpose as the upper one. */
+	size_t rows[7] = { 0, 1, 1, 2, 3, 3, 3 };
+	size_t cols[7] = { 0, 0, 1, 2, 0, 2, 3 };
+	zsl_real_t vals[7] = { 2.0, 1.0, 4.0, -1.0, 3.0, 2.0, 0.5 };
+
+	zsl_real_t ab[4] = { 2.0, 9.0, -3.0, 9.5 };
+	struct zsl_vec b = {
+		.sz = 4,
+		.data = ab
+	};
+
+	rc = zsl_spmtx_from_coo(&l, rows, cols, vals, 7);
+	zassert_equal(rc, 0);
+	rc = zsl_spmtx_from_coo(&u, cols, rows, vals, 7);
+	zassert_equal(rc, 0);
+
+	/* l * (1, 2, 3, 1) = b. */
+	rc = zsl_spmtx_solve_lower(&l, &b, &x);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(x.data[0], 1.0, 1E-6));
+	zassert_true(val_is_equal(x.data[1], 2.0, 1E-6));
+	zassert_true(val_is_equal(x.data[2], 3.0, 1E-6));
+	zassert_true(val_is_equal(x.data[3], 1.0, 1E-6));
+
+	/* u * (-7, 2, -2, 4) = (0, 8, 10, 2), solved in place. */
+	ab[0] = 0.0;
+	ab[1] = 8.0;
+	ab[2] = 10.0;
+	ab[3] = 2.0;
+	rc = zsl_spmtx_solve_upper(&u, &b, &b);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(ab[0], -7.0, 1E-6));
+	zassert_true(val_is_equal(ab[1], 2.0, 1E-6));
+	zassert_true(val_is_equal(ab[2], -2.0, 1E-6));
+	zassert_true(val_is_equal(ab[3], 4.0, 1E-6));
+
+	/* Entries below the diagonal are ignored by the upper solve, so with
+	 * 'l' it only divides by the diagonal. */
+	rc = zsl_spmtx_solve_upper(&l, &x, &x);
+	zassert_equal(rc, 0);
+	zassert_true(val_is_equal(x.data[0], 0.5, 1E-6));
+	zassert_true(val_is_equal(x.data[2], -3.0, 1E-6));
+	zassert_true(val_is_equal(x.data[3], 2.0, 1E-6));
+
+	/* A missing diagonal entry makes the system singular. */
+	rows[6] = 2;
+	cols[6] = 0;
+	rc = zsl_spmtx_from_coo(&l, rows, cols, vals, 7);
+	zassert_equal(rc, 0);
+	rc = zsl_spmtx_solve_lower(&l, &b, &x);
+	zassert_equal(rc, -ESINGULAR);
+}
@@ -569,6 +569,43 @@ ZTEST(zsl_tests, test_sta_covariance_matrix)
 	zassert_true(rc == -EINVAL);
 }
 
+ZTEST(zsl_tests, test_sta_covariance_matrix_packed)
+{
+	int rc;
+
+	ZSL_MATRIX_DEF(ma, 4, 3);
+	ZSL_MATRIX_PACKED_DEF(pb, 3, ZSL_MTX_PACKED_SYM);
+	ZSL_MATRIX_PACKED_DEF(pc, 2, ZSL_MTX_PACKED_SYM);
+	ZSL_MATRIX_PACKED_DEF(pd, 3, ZSL_MTX_PACKED_LOWER);
+
+	zsl_real_t a[12] = { -1.0, -6.5, 1.2,
+			     7.0, 5.5, 0.0,
+			     -0.5, 4.0, 6.5,
+			     -1.0, 4.0, -8.5 };
+
+	/* Assign array to the matrix. */
+	rc = zsl_mtx_from_arr(&ma, a);
+	zassert_true(rc == 0);
+
+	/* Only the six values of the lower triangle are stored. */
+	rc = zsl_sta_covar_mtx_packed(&ma, &pb);
+	zassert_true(rc == 0);
+	zassert_true(val_is_equal(pb.data[0], 15.395833, 1E-6));
+	zassert_true(val_is_equal(pb.data[1], 10.375000, 1E-6));
+	zassert_true(val_is_equal(pb.data[2], 30.750000, 1E-6));
+	zassert_true(val_is_equal(pb.data[3], 1.650000, 1E-6));
+	zassert_true(val_is_equal(pb.data[4], -4.800000, 1E-6));
+	zassert_true(val_is_equal(pb.data[5], 38.593333, 1E-6));
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	/* The output must be symmetric, and match the columns of 'ma'. */
+	rc = zsl_sta_covar_mtx_packed(&ma, &pc);
+	zassert_true(rc == -EINVAL);
+	rc = zsl_sta_covar_mtx_packed(&ma, &pd);
+	zassert_true(rc == -EINVAL);
+#endif
+}
+
 ZTEST(zsl_tests, test_sta_linear_regression)
 {
 	int rc;
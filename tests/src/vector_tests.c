@@ -9,6 +9,10 @@
 #include <zsl/vectors.h>
 #include "floatcheck.h"
 
+#if (CONFIG_ZSL_PLATFORM_OPT == 3)
+#include "asm_x86_test.h"
+#endif
+
 ZTEST(zsl_tests, test_vector_init)
 {
 	int rc;
@@ -323,6 +327,34 @@ ZTEST(zsl_tests, test_vector_scalar_div)
 	zassert_true(val_is_equal(v.data[3], -0.2307692307, 1E-6));
 }
 
+ZTEST(zsl_tests, test_vector_axpy)
+{
+	int rc;
+
+	ZSL_VECTOR_DEF(x, 4);
+	ZSL_VECTOR_DEF(y, 4);
+	ZSL_VECTOR_DEF(w, 3);
+
+	zsl_real_t xi[4] = { 1.0, -2.0, 0.5, 4.0 };
+	zsl_real_t yi[4] = { 3.0, 1.0, -1.0, 0.0 };
+
+	zsl_vec_from_arr(&x, xi);
+	zsl_vec_from_arr(&y, yi);
+
+	/* y = -2 * x + y. */
+	rc = zsl_vec_axpy(-2.0, &x, &y);
+	zassert_true(rc == 0);
+	zassert_true(val_is_equal(y.data[0], 1.0, 1E-6));
+	zassert_true(val_is_equal(y.data[1], 5.0, 1E-6));
+	zassert_true(val_is_equal(y.data[2], -2.0, 1E-6));
+	zassert_true(val_is_equal(y.data[3], -8.0, 1E-6));
+
+#if CONFIG_ZSL_BOUNDS_CHECKS
+	rc = zsl_vec_axpy(1.0, &x, &w);
+	zassert_true(rc == -EINVAL);
+#endif
+}
+
 ZTEST(zsl_tests, test_vector_dist)
 {
 	int rc;
@@ -389,6 +421,71 @@ ZTEST(zsl_tests, test_vector_dot)
 	zassert_true(rc == -EINVAL);
 }
 
+/**
+ * @brief Checks add, scalar multiply and dot product on vectors long enough
+ *        to exercise the unrolled loops and scalar tails of the optimised
+ *        platform kernels.
+ */
+/**
+ * @brief Checks the vector ops that have SIMD kernels on vectors long enough
+ *        to leave a remainder after the vectorised part.
+ */
+static void
+zsl_vec_check_long(void)
+{
+	int rc;
+	zsl_real_t d, x;
+
+	ZSL_VECTOR_DEF(v, 19);
+	ZSL_VECTOR_DEF(w, 19);
+	ZSL_VECTOR_DEF(s, 19);
+
+	for (size_t i = 0; i < v.sz; i++) {
+		v.data[i] = 0.5 * (zsl_real_t)i - 3.0;
+		w.data[i] = 1.0 + 0.25 * (zsl_real_t)(i % 5);
+	}
+
+	rc = zsl_vec_add(&v, &w, &s);
+	zassert_true(rc == 0);
+	for (size_t i = 0; i < s.sz; i++) {
+		zassert_true(val_is_equal(s.data[i], v.data[i] + w.data[i],
+					  1E-6));
+	}
+
+	rc = zsl_vec_dot(&v, &w, &d);
+	zassert_true(rc == 0);
+	x = 0.0;
+	for (size_t i = 0; i < v.sz; i++) {
+		x += v.data[i] * w.data[i];
+	}
+	zassert_true(val_is_equal(d, x, 1E-5));
+
+	rc = zsl_vec_scalar_mult(&s, -2.0);
+	zassert_true(rc == 0);
+	for (size_t i = 0; i < s.sz; i++) {
+		x = -2.0 * (v.data[i] + w.data[i]);
+		zassert_true(val_is_equal(s.data[i], x, 1E-6));
+	}
+}
+
+ZTEST(zsl_tests, test_vector_long)
+{
+#if (CONFIG_ZSL_PLATFORM_OPT == 3)
+	/* Run with both the SSE2 and the AVX2/FMA kernels, when available. */
+	for (int level = 1; level <= 2; level++) {
+		if (zsl_asm_x86_force_level(level) != 0) {
+			continue;
+		}
+		zsl_vec_check_long();
+	}
+
+	/* Return to the probed level for the remaining tests. */
+	zsl_asm_x86_force_level(0);
+#else
+	zsl_vec_check_long();
+#endif
+}
+
 ZTEST(zsl_tests, test_vector_norm)
 {
 	int rc;
@@ -526,6 +623,26 @@ ZTEST(zsl_tests, test_vector_cross)
 	zassert_true(rc == -EINVAL);
 }
 
+ZTEST(zsl_tests, test_vector_vec3)
+{
+	int rc;
+	zsl_real_t d;
+
+	zsl_real_t v[3] = { 3.0, 1.0, 2.0 };
+	zsl_real_t w[3] = { 3.4, 2.5, 0.5 };
+
+	rc = zsl_vec3_dot(v, w, &d);
+	zassert_true(rc == 0);
+	zassert_true(val_is_equal(d, 13.7, 1E-6));
+
+	/* The output may be one of the inputs. */
+	rc = zsl_vec3_cross(v, w, v);
+	zassert_true(rc == 0);
+	zassert_true(val_is_equal(v[0], -4.5, 1E-6));
+	zassert_true(val_is_equal(v[1], 5.3, 1E-6));
+	zassert_true(val_is_equal(v[2], 4.1, 1E-6));
+}
+
 ZTEST(zsl_tests, test_vector_sum_of_sqrs)
 {
 	int rc;